@@ -0,0 +1,143 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/bench/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/src/googletest/CMakeLists.txt"
+  "/usr/src/googletest/googlemock/CMakeLists.txt"
+  "/usr/src/googletest/googlemock/cmake/gmock.pc.in"
+  "/usr/src/googletest/googlemock/cmake/gmock_main.pc.in"
+  "/usr/src/googletest/googletest/CMakeLists.txt"
+  "/usr/src/googletest/googletest/cmake/Config.cmake.in"
+  "/usr/src/googletest/googletest/cmake/gtest.pc.in"
+  "/usr/src/googletest/googletest/cmake/gtest_main.pc.in"
+  "/usr/src/googletest/googletest/cmake/internal_utils.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/googletest/generated/gmock.pc"
+  "_deps/googletest-build/googletest/generated/gmock_main.pc"
+  "_deps/googletest-build/googlemock/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/googletest/generated/GTestConfigVersion.cmake"
+  "_deps/googletest-build/googletest/generated/GTestConfig.cmake"
+  "_deps/googletest-build/googletest/generated/gtest.pc"
+  "_deps/googletest-build/googletest/generated/gtest_main.pc"
+  "_deps/googletest-build/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/pokemon_battle.dir/DependInfo.cmake"
+  "CMakeFiles/team_builder_example.dir/DependInfo.cmake"
+  "CMakeFiles/build_win_matrix.dir/DependInfo.cmake"
+  "CMakeFiles/team_batch_bench.dir/DependInfo.cmake"
+  "CMakeFiles/replay.dir/DependInfo.cmake"
+  "CMakeFiles/copy_data_files.dir/DependInfo.cmake"
+  "_deps/googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "_deps/googletest-build/googlemock/CMakeFiles/gmock_main.dir/DependInfo.cmake"
+  "_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_utils.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_pokemon.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_move.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_type_effectiveness.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_input_validator.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_team.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_battle.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_weather.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_ai.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_easy_ai.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_medium_ai.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_hard_ai.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_expert_ai.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_paralysis_determinism.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_team_builder_phase4.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_battle_history_log.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_progress_journal.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_leaderboard_index.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_rating_engine.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_tournament_scheduler.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_team_optimizer.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_species_win_matrix.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_type_mask.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_team_batch_scorer.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_text_search_index.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_team_share_codec.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_draft_candidate_index.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_team_matchup_simulator.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_battle_team_factory.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_battle_events.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_async_event_bus.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_battle_replay.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_health_bar_renderer.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_battle_log.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_perf_compare.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_full_battle.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_status_integration.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_weather_integration.dir/DependInfo.cmake"
+  "tests/CMakeFiles/run_all_tests.dir/DependInfo.cmake"
+  "bench/CMakeFiles/pokemon_bench.dir/DependInfo.cmake"
+  "bench/CMakeFiles/run_benchmarks.dir/DependInfo.cmake"
+  "bench/CMakeFiles/perf_compare.dir/DependInfo.cmake"
+  "bench/CMakeFiles/perf-check.dir/DependInfo.cmake"
+  "bench/CMakeFiles/perf-baseline.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,101 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/build_win_matrix.dir/examples/build_win_matrix.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/examples/build_win_matrix.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/ai/ai_factory.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/ai/ai_factory.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/ai/ai_strategy.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/ai/ai_strategy.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/ai/easy_ai.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/ai/easy_ai.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/ai/expert_ai.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/ai/expert_ai.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/ai/hard_ai.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/ai/hard_ai.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/ai/medium_ai.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/ai/medium_ai.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/async_event_bus.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/async_event_bus.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/battle.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/battle.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/battle_events.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/battle_events.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/battle_history_log.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/battle_history_log.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/battle_log.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/battle_log.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/battle_replay.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/battle_replay.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/battle_simulator.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/battle_simulator.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/battle_team_factory.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/battle_team_factory.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/championship_system.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/championship_system.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/draft_candidate_index.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/draft_candidate_index.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/event_ring_buffer.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/event_ring_buffer.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/gym_leader.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/gym_leader.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/move.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/move.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/pokemon.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/pokemon.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/pokemon_data.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/pokemon_data.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/progress_journal.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/progress_journal.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/rating_engine.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/rating_engine.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/resettable_battle_team.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/resettable_battle_team.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/species_win_matrix.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/species_win_matrix.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/team.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/team.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/team_batch_scorer.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/team_batch_scorer.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/team_builder.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/team_builder.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/team_matchup_simulator.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/team_matchup_simulator.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/team_optimizer.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/team_optimizer.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/team_share_codec.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/team_share_codec.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/tournament_manager.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/tournament_manager.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/tournament_scheduler.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/tournament_scheduler.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/core/weather.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/core/weather.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/utils/base64.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/utils/base64.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/utils/binary_io.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/utils/binary_io.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/utils/health_bar_animator.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/utils/health_bar_animator.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/utils/health_bar_event_listener.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/utils/health_bar_event_listener.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/utils/health_bar_renderer.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/utils/health_bar_renderer.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/utils/input_validator.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/utils/input_validator.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/utils/leaderboard_index.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/utils/leaderboard_index.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/utils/move_type_mapping.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/utils/move_type_mapping.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/utils/text_search_index.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/utils/text_search_index.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/utils/type_effectiveness.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/utils/type_effectiveness.cpp.o.d"
+  "CMakeFiles/build_win_matrix.dir/src/utils/type_mask.cpp.o"
+  "CMakeFiles/build_win_matrix.dir/src/utils/type_mask.cpp.o.d"
+  "bin/build_win_matrix"
+  "bin/build_win_matrix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/build_win_matrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
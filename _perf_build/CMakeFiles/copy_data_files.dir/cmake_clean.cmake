@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy_data_files"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy_data_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,64 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ai/ai_factory.cpp" "CMakeFiles/pokemon_battle.dir/src/ai/ai_factory.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/ai/ai_factory.cpp.o.d"
+  "/root/repo/src/ai/ai_strategy.cpp" "CMakeFiles/pokemon_battle.dir/src/ai/ai_strategy.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/ai/ai_strategy.cpp.o.d"
+  "/root/repo/src/ai/easy_ai.cpp" "CMakeFiles/pokemon_battle.dir/src/ai/easy_ai.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/ai/easy_ai.cpp.o.d"
+  "/root/repo/src/ai/expert_ai.cpp" "CMakeFiles/pokemon_battle.dir/src/ai/expert_ai.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/ai/expert_ai.cpp.o.d"
+  "/root/repo/src/ai/hard_ai.cpp" "CMakeFiles/pokemon_battle.dir/src/ai/hard_ai.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/ai/hard_ai.cpp.o.d"
+  "/root/repo/src/ai/medium_ai.cpp" "CMakeFiles/pokemon_battle.dir/src/ai/medium_ai.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/ai/medium_ai.cpp.o.d"
+  "/root/repo/src/core/async_event_bus.cpp" "CMakeFiles/pokemon_battle.dir/src/core/async_event_bus.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/async_event_bus.cpp.o.d"
+  "/root/repo/src/core/battle.cpp" "CMakeFiles/pokemon_battle.dir/src/core/battle.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/battle.cpp.o.d"
+  "/root/repo/src/core/battle_events.cpp" "CMakeFiles/pokemon_battle.dir/src/core/battle_events.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/battle_events.cpp.o.d"
+  "/root/repo/src/core/battle_history_log.cpp" "CMakeFiles/pokemon_battle.dir/src/core/battle_history_log.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/battle_history_log.cpp.o.d"
+  "/root/repo/src/core/battle_log.cpp" "CMakeFiles/pokemon_battle.dir/src/core/battle_log.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/battle_log.cpp.o.d"
+  "/root/repo/src/core/battle_replay.cpp" "CMakeFiles/pokemon_battle.dir/src/core/battle_replay.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/battle_replay.cpp.o.d"
+  "/root/repo/src/core/battle_simulator.cpp" "CMakeFiles/pokemon_battle.dir/src/core/battle_simulator.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/battle_simulator.cpp.o.d"
+  "/root/repo/src/core/battle_team_factory.cpp" "CMakeFiles/pokemon_battle.dir/src/core/battle_team_factory.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/battle_team_factory.cpp.o.d"
+  "/root/repo/src/core/championship_system.cpp" "CMakeFiles/pokemon_battle.dir/src/core/championship_system.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/championship_system.cpp.o.d"
+  "/root/repo/src/core/draft_candidate_index.cpp" "CMakeFiles/pokemon_battle.dir/src/core/draft_candidate_index.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/draft_candidate_index.cpp.o.d"
+  "/root/repo/src/core/event_ring_buffer.cpp" "CMakeFiles/pokemon_battle.dir/src/core/event_ring_buffer.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/event_ring_buffer.cpp.o.d"
+  "/root/repo/src/core/gym_leader.cpp" "CMakeFiles/pokemon_battle.dir/src/core/gym_leader.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/gym_leader.cpp.o.d"
+  "/root/repo/src/core/move.cpp" "CMakeFiles/pokemon_battle.dir/src/core/move.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/move.cpp.o.d"
+  "/root/repo/src/core/pokemon.cpp" "CMakeFiles/pokemon_battle.dir/src/core/pokemon.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/pokemon.cpp.o.d"
+  "/root/repo/src/core/pokemon_data.cpp" "CMakeFiles/pokemon_battle.dir/src/core/pokemon_data.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/pokemon_data.cpp.o.d"
+  "/root/repo/src/core/progress_journal.cpp" "CMakeFiles/pokemon_battle.dir/src/core/progress_journal.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/progress_journal.cpp.o.d"
+  "/root/repo/src/core/rating_engine.cpp" "CMakeFiles/pokemon_battle.dir/src/core/rating_engine.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/rating_engine.cpp.o.d"
+  "/root/repo/src/core/resettable_battle_team.cpp" "CMakeFiles/pokemon_battle.dir/src/core/resettable_battle_team.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/resettable_battle_team.cpp.o.d"
+  "/root/repo/src/core/species_win_matrix.cpp" "CMakeFiles/pokemon_battle.dir/src/core/species_win_matrix.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/species_win_matrix.cpp.o.d"
+  "/root/repo/src/core/team.cpp" "CMakeFiles/pokemon_battle.dir/src/core/team.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/team.cpp.o.d"
+  "/root/repo/src/core/team_batch_scorer.cpp" "CMakeFiles/pokemon_battle.dir/src/core/team_batch_scorer.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/team_batch_scorer.cpp.o.d"
+  "/root/repo/src/core/team_builder.cpp" "CMakeFiles/pokemon_battle.dir/src/core/team_builder.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/team_builder.cpp.o.d"
+  "/root/repo/src/core/team_matchup_simulator.cpp" "CMakeFiles/pokemon_battle.dir/src/core/team_matchup_simulator.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/team_matchup_simulator.cpp.o.d"
+  "/root/repo/src/core/team_optimizer.cpp" "CMakeFiles/pokemon_battle.dir/src/core/team_optimizer.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/team_optimizer.cpp.o.d"
+  "/root/repo/src/core/team_share_codec.cpp" "CMakeFiles/pokemon_battle.dir/src/core/team_share_codec.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/team_share_codec.cpp.o.d"
+  "/root/repo/src/core/tournament_manager.cpp" "CMakeFiles/pokemon_battle.dir/src/core/tournament_manager.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/tournament_manager.cpp.o.d"
+  "/root/repo/src/core/tournament_scheduler.cpp" "CMakeFiles/pokemon_battle.dir/src/core/tournament_scheduler.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/tournament_scheduler.cpp.o.d"
+  "/root/repo/src/core/weather.cpp" "CMakeFiles/pokemon_battle.dir/src/core/weather.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/core/weather.cpp.o.d"
+  "/root/repo/src/main.cpp" "CMakeFiles/pokemon_battle.dir/src/main.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/main.cpp.o.d"
+  "/root/repo/src/utils/base64.cpp" "CMakeFiles/pokemon_battle.dir/src/utils/base64.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/utils/base64.cpp.o.d"
+  "/root/repo/src/utils/binary_io.cpp" "CMakeFiles/pokemon_battle.dir/src/utils/binary_io.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/utils/binary_io.cpp.o.d"
+  "/root/repo/src/utils/health_bar_animator.cpp" "CMakeFiles/pokemon_battle.dir/src/utils/health_bar_animator.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/utils/health_bar_animator.cpp.o.d"
+  "/root/repo/src/utils/health_bar_event_listener.cpp" "CMakeFiles/pokemon_battle.dir/src/utils/health_bar_event_listener.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/utils/health_bar_event_listener.cpp.o.d"
+  "/root/repo/src/utils/health_bar_renderer.cpp" "CMakeFiles/pokemon_battle.dir/src/utils/health_bar_renderer.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/utils/health_bar_renderer.cpp.o.d"
+  "/root/repo/src/utils/input_validator.cpp" "CMakeFiles/pokemon_battle.dir/src/utils/input_validator.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/utils/input_validator.cpp.o.d"
+  "/root/repo/src/utils/leaderboard_index.cpp" "CMakeFiles/pokemon_battle.dir/src/utils/leaderboard_index.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/utils/leaderboard_index.cpp.o.d"
+  "/root/repo/src/utils/move_type_mapping.cpp" "CMakeFiles/pokemon_battle.dir/src/utils/move_type_mapping.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/utils/move_type_mapping.cpp.o.d"
+  "/root/repo/src/utils/text_search_index.cpp" "CMakeFiles/pokemon_battle.dir/src/utils/text_search_index.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/utils/text_search_index.cpp.o.d"
+  "/root/repo/src/utils/type_effectiveness.cpp" "CMakeFiles/pokemon_battle.dir/src/utils/type_effectiveness.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/utils/type_effectiveness.cpp.o.d"
+  "/root/repo/src/utils/type_mask.cpp" "CMakeFiles/pokemon_battle.dir/src/utils/type_mask.cpp.o" "gcc" "CMakeFiles/pokemon_battle.dir/src/utils/type_mask.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
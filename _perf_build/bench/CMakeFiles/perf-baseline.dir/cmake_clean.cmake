@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf-baseline"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/perf-baseline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bench/perf_compare.cpp" "bench/CMakeFiles/perf_compare.dir/perf_compare.cpp.o" "gcc" "bench/CMakeFiles/perf_compare.dir/perf_compare.cpp.o.d"
+  "/root/repo/bench/perf_compare_main.cpp" "bench/CMakeFiles/perf_compare.dir/perf_compare_main.cpp.o" "gcc" "bench/CMakeFiles/perf_compare.dir/perf_compare_main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
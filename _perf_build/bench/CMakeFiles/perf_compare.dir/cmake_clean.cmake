@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/perf_compare"
+  "../bin/perf_compare.pdb"
+  "CMakeFiles/perf_compare.dir/perf_compare.cpp.o"
+  "CMakeFiles/perf_compare.dir/perf_compare.cpp.o.d"
+  "CMakeFiles/perf_compare.dir/perf_compare_main.cpp.o"
+  "CMakeFiles/perf_compare.dir/perf_compare_main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_compare.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
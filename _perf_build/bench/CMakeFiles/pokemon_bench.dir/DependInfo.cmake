@@ -0,0 +1,64 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ai/ai_factory.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/ai/ai_factory.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/ai/ai_factory.cpp.o.d"
+  "/root/repo/src/ai/ai_strategy.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/ai/ai_strategy.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/ai/ai_strategy.cpp.o.d"
+  "/root/repo/src/ai/easy_ai.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/ai/easy_ai.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/ai/easy_ai.cpp.o.d"
+  "/root/repo/src/ai/expert_ai.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/ai/expert_ai.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/ai/expert_ai.cpp.o.d"
+  "/root/repo/src/ai/hard_ai.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/ai/hard_ai.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/ai/hard_ai.cpp.o.d"
+  "/root/repo/src/ai/medium_ai.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/ai/medium_ai.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/ai/medium_ai.cpp.o.d"
+  "/root/repo/src/core/async_event_bus.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/async_event_bus.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/async_event_bus.cpp.o.d"
+  "/root/repo/src/core/battle.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/battle.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/battle.cpp.o.d"
+  "/root/repo/src/core/battle_events.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/battle_events.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/battle_events.cpp.o.d"
+  "/root/repo/src/core/battle_history_log.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/battle_history_log.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/battle_history_log.cpp.o.d"
+  "/root/repo/src/core/battle_log.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/battle_log.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/battle_log.cpp.o.d"
+  "/root/repo/src/core/battle_replay.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/battle_replay.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/battle_replay.cpp.o.d"
+  "/root/repo/src/core/battle_simulator.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/battle_simulator.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/battle_simulator.cpp.o.d"
+  "/root/repo/src/core/battle_team_factory.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/battle_team_factory.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/battle_team_factory.cpp.o.d"
+  "/root/repo/src/core/championship_system.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/championship_system.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/championship_system.cpp.o.d"
+  "/root/repo/src/core/draft_candidate_index.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/draft_candidate_index.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/draft_candidate_index.cpp.o.d"
+  "/root/repo/src/core/event_ring_buffer.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/event_ring_buffer.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/event_ring_buffer.cpp.o.d"
+  "/root/repo/src/core/gym_leader.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/gym_leader.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/gym_leader.cpp.o.d"
+  "/root/repo/src/core/move.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/move.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/move.cpp.o.d"
+  "/root/repo/src/core/pokemon.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/pokemon.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/pokemon.cpp.o.d"
+  "/root/repo/src/core/pokemon_data.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/pokemon_data.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/pokemon_data.cpp.o.d"
+  "/root/repo/src/core/progress_journal.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/progress_journal.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/progress_journal.cpp.o.d"
+  "/root/repo/src/core/rating_engine.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/rating_engine.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/rating_engine.cpp.o.d"
+  "/root/repo/src/core/resettable_battle_team.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/resettable_battle_team.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/resettable_battle_team.cpp.o.d"
+  "/root/repo/src/core/species_win_matrix.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/species_win_matrix.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/species_win_matrix.cpp.o.d"
+  "/root/repo/src/core/team.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/team.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/team.cpp.o.d"
+  "/root/repo/src/core/team_batch_scorer.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/team_batch_scorer.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/team_batch_scorer.cpp.o.d"
+  "/root/repo/src/core/team_builder.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/team_builder.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/team_builder.cpp.o.d"
+  "/root/repo/src/core/team_matchup_simulator.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/team_matchup_simulator.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/team_matchup_simulator.cpp.o.d"
+  "/root/repo/src/core/team_optimizer.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/team_optimizer.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/team_optimizer.cpp.o.d"
+  "/root/repo/src/core/team_share_codec.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/team_share_codec.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/team_share_codec.cpp.o.d"
+  "/root/repo/src/core/tournament_manager.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/tournament_manager.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/tournament_manager.cpp.o.d"
+  "/root/repo/src/core/tournament_scheduler.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/tournament_scheduler.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/tournament_scheduler.cpp.o.d"
+  "/root/repo/src/core/weather.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/weather.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/core/weather.cpp.o.d"
+  "/root/repo/src/utils/base64.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/base64.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/base64.cpp.o.d"
+  "/root/repo/src/utils/binary_io.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/binary_io.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/binary_io.cpp.o.d"
+  "/root/repo/src/utils/health_bar_animator.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/health_bar_animator.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/health_bar_animator.cpp.o.d"
+  "/root/repo/src/utils/health_bar_event_listener.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/health_bar_event_listener.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/health_bar_event_listener.cpp.o.d"
+  "/root/repo/src/utils/health_bar_renderer.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/health_bar_renderer.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/health_bar_renderer.cpp.o.d"
+  "/root/repo/src/utils/input_validator.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/input_validator.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/input_validator.cpp.o.d"
+  "/root/repo/src/utils/leaderboard_index.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/leaderboard_index.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/leaderboard_index.cpp.o.d"
+  "/root/repo/src/utils/move_type_mapping.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/move_type_mapping.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/move_type_mapping.cpp.o.d"
+  "/root/repo/src/utils/text_search_index.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/text_search_index.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/text_search_index.cpp.o.d"
+  "/root/repo/src/utils/type_effectiveness.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/type_effectiveness.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/type_effectiveness.cpp.o.d"
+  "/root/repo/src/utils/type_mask.cpp" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/type_mask.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/__/src/utils/type_mask.cpp.o.d"
+  "/root/repo/bench/pokemon_bench.cpp" "bench/CMakeFiles/pokemon_bench.dir/pokemon_bench.cpp.o" "gcc" "bench/CMakeFiles/pokemon_bench.dir/pokemon_bench.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,96 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_leaderboard_index.dir/__/src/ai/ai_factory.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/ai/ai_factory.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/ai/ai_strategy.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/ai/ai_strategy.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/ai/easy_ai.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/ai/easy_ai.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/ai/expert_ai.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/ai/expert_ai.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/ai/hard_ai.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/ai/hard_ai.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/ai/medium_ai.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/ai/medium_ai.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/async_event_bus.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/async_event_bus.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/battle.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/battle.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/battle_events.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/battle_events.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/battle_history_log.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/battle_history_log.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/battle_log.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/battle_log.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/battle_replay.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/battle_replay.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/battle_simulator.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/battle_simulator.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/battle_team_factory.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/battle_team_factory.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/draft_candidate_index.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/draft_candidate_index.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/event_ring_buffer.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/event_ring_buffer.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/move.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/move.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/pokemon.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/pokemon.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/pokemon_data.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/pokemon_data.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/progress_journal.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/progress_journal.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/rating_engine.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/rating_engine.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/resettable_battle_team.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/resettable_battle_team.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/species_win_matrix.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/species_win_matrix.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/team.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/team.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/team_batch_scorer.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/team_batch_scorer.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/team_builder.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/team_builder.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/team_matchup_simulator.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/team_matchup_simulator.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/team_optimizer.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/team_optimizer.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/team_share_codec.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/team_share_codec.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/tournament_scheduler.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/tournament_scheduler.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/weather.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/core/weather.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/base64.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/base64.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/binary_io.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/binary_io.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/health_bar_animator.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/health_bar_animator.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/health_bar_event_listener.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/health_bar_event_listener.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/health_bar_renderer.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/health_bar_renderer.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/input_validator.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/input_validator.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/leaderboard_index.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/leaderboard_index.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/move_type_mapping.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/move_type_mapping.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/text_search_index.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/text_search_index.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/type_effectiveness.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/type_effectiveness.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/type_mask.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/__/src/utils/type_mask.cpp.o.d"
+  "CMakeFiles/test_leaderboard_index.dir/unit/test_leaderboard_index.cpp.o"
+  "CMakeFiles/test_leaderboard_index.dir/unit/test_leaderboard_index.cpp.o.d"
+  "test_leaderboard_index"
+  "test_leaderboard_index.pdb"
+  "test_leaderboard_index[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_leaderboard_index.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,64 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ai/ai_factory.cpp" "tests/CMakeFiles/test_weather.dir/__/src/ai/ai_factory.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/ai/ai_factory.cpp.o.d"
+  "/root/repo/src/ai/ai_strategy.cpp" "tests/CMakeFiles/test_weather.dir/__/src/ai/ai_strategy.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/ai/ai_strategy.cpp.o.d"
+  "/root/repo/src/ai/easy_ai.cpp" "tests/CMakeFiles/test_weather.dir/__/src/ai/easy_ai.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/ai/easy_ai.cpp.o.d"
+  "/root/repo/src/ai/expert_ai.cpp" "tests/CMakeFiles/test_weather.dir/__/src/ai/expert_ai.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/ai/expert_ai.cpp.o.d"
+  "/root/repo/src/ai/hard_ai.cpp" "tests/CMakeFiles/test_weather.dir/__/src/ai/hard_ai.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/ai/hard_ai.cpp.o.d"
+  "/root/repo/src/ai/medium_ai.cpp" "tests/CMakeFiles/test_weather.dir/__/src/ai/medium_ai.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/ai/medium_ai.cpp.o.d"
+  "/root/repo/src/core/async_event_bus.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/async_event_bus.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/async_event_bus.cpp.o.d"
+  "/root/repo/src/core/battle.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/battle.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/battle.cpp.o.d"
+  "/root/repo/src/core/battle_events.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/battle_events.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/battle_events.cpp.o.d"
+  "/root/repo/src/core/battle_history_log.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/battle_history_log.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/battle_history_log.cpp.o.d"
+  "/root/repo/src/core/battle_log.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/battle_log.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/battle_log.cpp.o.d"
+  "/root/repo/src/core/battle_replay.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/battle_replay.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/battle_replay.cpp.o.d"
+  "/root/repo/src/core/battle_simulator.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/battle_simulator.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/battle_simulator.cpp.o.d"
+  "/root/repo/src/core/battle_team_factory.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/battle_team_factory.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/battle_team_factory.cpp.o.d"
+  "/root/repo/src/core/draft_candidate_index.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/draft_candidate_index.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/draft_candidate_index.cpp.o.d"
+  "/root/repo/src/core/event_ring_buffer.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/event_ring_buffer.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/event_ring_buffer.cpp.o.d"
+  "/root/repo/src/core/move.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/move.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/move.cpp.o.d"
+  "/root/repo/src/core/pokemon.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/pokemon.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/pokemon.cpp.o.d"
+  "/root/repo/src/core/pokemon_data.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/pokemon_data.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/pokemon_data.cpp.o.d"
+  "/root/repo/src/core/progress_journal.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/progress_journal.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/progress_journal.cpp.o.d"
+  "/root/repo/src/core/rating_engine.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/rating_engine.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/rating_engine.cpp.o.d"
+  "/root/repo/src/core/resettable_battle_team.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/resettable_battle_team.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/resettable_battle_team.cpp.o.d"
+  "/root/repo/src/core/species_win_matrix.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/species_win_matrix.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/species_win_matrix.cpp.o.d"
+  "/root/repo/src/core/team.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/team.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/team.cpp.o.d"
+  "/root/repo/src/core/team_batch_scorer.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/team_batch_scorer.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/team_batch_scorer.cpp.o.d"
+  "/root/repo/src/core/team_builder.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/team_builder.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/team_builder.cpp.o.d"
+  "/root/repo/src/core/team_matchup_simulator.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/team_matchup_simulator.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/team_matchup_simulator.cpp.o.d"
+  "/root/repo/src/core/team_optimizer.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/team_optimizer.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/team_optimizer.cpp.o.d"
+  "/root/repo/src/core/team_share_codec.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/team_share_codec.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/team_share_codec.cpp.o.d"
+  "/root/repo/src/core/tournament_scheduler.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/tournament_scheduler.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/tournament_scheduler.cpp.o.d"
+  "/root/repo/src/core/weather.cpp" "tests/CMakeFiles/test_weather.dir/__/src/core/weather.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/core/weather.cpp.o.d"
+  "/root/repo/src/utils/base64.cpp" "tests/CMakeFiles/test_weather.dir/__/src/utils/base64.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/utils/base64.cpp.o.d"
+  "/root/repo/src/utils/binary_io.cpp" "tests/CMakeFiles/test_weather.dir/__/src/utils/binary_io.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/utils/binary_io.cpp.o.d"
+  "/root/repo/src/utils/health_bar_animator.cpp" "tests/CMakeFiles/test_weather.dir/__/src/utils/health_bar_animator.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/utils/health_bar_animator.cpp.o.d"
+  "/root/repo/src/utils/health_bar_event_listener.cpp" "tests/CMakeFiles/test_weather.dir/__/src/utils/health_bar_event_listener.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/utils/health_bar_event_listener.cpp.o.d"
+  "/root/repo/src/utils/health_bar_renderer.cpp" "tests/CMakeFiles/test_weather.dir/__/src/utils/health_bar_renderer.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/utils/health_bar_renderer.cpp.o.d"
+  "/root/repo/src/utils/input_validator.cpp" "tests/CMakeFiles/test_weather.dir/__/src/utils/input_validator.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/utils/input_validator.cpp.o.d"
+  "/root/repo/src/utils/leaderboard_index.cpp" "tests/CMakeFiles/test_weather.dir/__/src/utils/leaderboard_index.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/utils/leaderboard_index.cpp.o.d"
+  "/root/repo/src/utils/move_type_mapping.cpp" "tests/CMakeFiles/test_weather.dir/__/src/utils/move_type_mapping.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/utils/move_type_mapping.cpp.o.d"
+  "/root/repo/src/utils/text_search_index.cpp" "tests/CMakeFiles/test_weather.dir/__/src/utils/text_search_index.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/utils/text_search_index.cpp.o.d"
+  "/root/repo/src/utils/type_effectiveness.cpp" "tests/CMakeFiles/test_weather.dir/__/src/utils/type_effectiveness.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/utils/type_effectiveness.cpp.o.d"
+  "/root/repo/src/utils/type_mask.cpp" "tests/CMakeFiles/test_weather.dir/__/src/utils/type_mask.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/__/src/utils/type_mask.cpp.o.d"
+  "/root/repo/tests/unit/test_weather.cpp" "tests/CMakeFiles/test_weather.dir/unit/test_weather.cpp.o" "gcc" "tests/CMakeFiles/test_weather.dir/unit/test_weather.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_perf_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_perf_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_perf_build/tests/CMakeFiles/test_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
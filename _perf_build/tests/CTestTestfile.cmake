@@ -0,0 +1,43 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_perf_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_perf_build/tests/test_pokemon[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_move[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_type_effectiveness[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_input_validator[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_team[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_battle[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_weather[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_ai[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_easy_ai[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_medium_ai[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_hard_ai[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_expert_ai[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_paralysis_determinism[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_team_builder_phase4[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_battle_history_log[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_progress_journal[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_leaderboard_index[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_rating_engine[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_tournament_scheduler[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_team_optimizer[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_species_win_matrix[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_type_mask[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_team_batch_scorer[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_text_search_index[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_team_share_codec[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_draft_candidate_index[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_team_matchup_simulator[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_battle_team_factory[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_battle_events[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_async_event_bus[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_battle_replay[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_health_bar_renderer[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_battle_log[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_perf_compare[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_full_battle[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_status_integration[1]_include.cmake")
+include("/root/repo/_perf_build/tests/test_weather_integration[1]_include.cmake")
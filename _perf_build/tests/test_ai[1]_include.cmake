@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_perf_build/tests/test_ai[1]_tests.cmake")
+  include("/root/repo/_perf_build/tests/test_ai[1]_tests.cmake")
+else()
+  add_test(test_ai_NOT_BUILT test_ai_NOT_BUILT)
+endif()
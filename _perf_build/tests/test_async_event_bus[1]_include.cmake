@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_perf_build/tests/test_async_event_bus[1]_tests.cmake")
+  include("/root/repo/_perf_build/tests/test_async_event_bus[1]_tests.cmake")
+else()
+  add_test(test_async_event_bus_NOT_BUILT test_async_event_bus_NOT_BUILT)
+endif()
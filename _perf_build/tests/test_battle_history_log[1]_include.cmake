@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_perf_build/tests/test_battle_history_log[1]_tests.cmake")
+  include("/root/repo/_perf_build/tests/test_battle_history_log[1]_tests.cmake")
+else()
+  add_test(test_battle_history_log_NOT_BUILT test_battle_history_log_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_perf_build/tests/test_draft_candidate_index[1]_tests.cmake")
+  include("/root/repo/_perf_build/tests/test_draft_candidate_index[1]_tests.cmake")
+else()
+  add_test(test_draft_candidate_index_NOT_BUILT test_draft_candidate_index_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_perf_build/tests/test_health_bar_renderer[1]_tests.cmake")
+  include("/root/repo/_perf_build/tests/test_health_bar_renderer[1]_tests.cmake")
+else()
+  add_test(test_health_bar_renderer_NOT_BUILT test_health_bar_renderer_NOT_BUILT)
+endif()
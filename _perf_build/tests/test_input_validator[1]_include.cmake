@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_perf_build/tests/test_input_validator[1]_tests.cmake")
+  include("/root/repo/_perf_build/tests/test_input_validator[1]_tests.cmake")
+else()
+  add_test(test_input_validator_NOT_BUILT test_input_validator_NOT_BUILT)
+endif()
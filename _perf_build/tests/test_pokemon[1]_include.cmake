@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_perf_build/tests/test_pokemon[1]_tests.cmake")
+  include("/root/repo/_perf_build/tests/test_pokemon[1]_tests.cmake")
+else()
+  add_test(test_pokemon_NOT_BUILT test_pokemon_NOT_BUILT)
+endif()
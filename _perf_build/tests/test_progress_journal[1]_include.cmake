@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_perf_build/tests/test_progress_journal[1]_tests.cmake")
+  include("/root/repo/_perf_build/tests/test_progress_journal[1]_tests.cmake")
+else()
+  add_test(test_progress_journal_NOT_BUILT test_progress_journal_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_perf_build/tests/test_status_integration[1]_tests.cmake")
+  include("/root/repo/_perf_build/tests/test_status_integration[1]_tests.cmake")
+else()
+  add_test(test_status_integration_NOT_BUILT test_status_integration_NOT_BUILT)
+endif()
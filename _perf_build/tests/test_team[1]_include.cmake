@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_perf_build/tests/test_team[1]_tests.cmake")
+  include("/root/repo/_perf_build/tests/test_team[1]_tests.cmake")
+else()
+  add_test(test_team_NOT_BUILT test_team_NOT_BUILT)
+endif()
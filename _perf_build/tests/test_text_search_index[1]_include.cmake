@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_perf_build/tests/test_text_search_index[1]_tests.cmake")
+  include("/root/repo/_perf_build/tests/test_text_search_index[1]_tests.cmake")
+else()
+  add_test(test_text_search_index_NOT_BUILT test_text_search_index_NOT_BUILT)
+endif()
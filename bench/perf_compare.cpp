@@ -0,0 +1,296 @@
+#include "perf_compare.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <set>
+#include <tuple>
+
+#include "json.hpp"
+
+namespace PerfCompare {
+
+namespace {
+
+using json = nlohmann::json;
+
+double toNanoseconds(double value, const std::string& unit) {
+    if (unit == "us") return value * 1e3;
+    if (unit == "ms") return value * 1e6;
+    if (unit == "s") return value * 1e9;
+    return value;
+}
+
+std::string formatTime(double nanoseconds) {
+    static const char* const kUnits[] = {"ns", "us", "ms", "s"};
+    int unit = 0;
+    while (unit < 3 && std::abs(nanoseconds) >= 1000.0) {
+        nanoseconds /= 1000.0;
+        ++unit;
+    }
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.3g %s", nanoseconds, kUnits[unit]);
+    return text;
+}
+
+const char* verdictName(Comparison::Verdict verdict) {
+    switch (verdict) {
+        case Comparison::Verdict::UNCHANGED: return "ok";
+        case Comparison::Verdict::REGRESSION: return "REGRESSION";
+        case Comparison::Verdict::IMPROVEMENT: return "faster";
+        case Comparison::Verdict::NOISY: return "noisy";
+        case Comparison::Verdict::NEW: return "new";
+        case Comparison::Verdict::MISSING: return "missing";
+    }
+    return "";
+}
+
+} // namespace
+
+bool loadResults(std::istream& input, ResultFile& result, std::string& error) {
+    const json document = json::parse(input, nullptr, false);
+    if (document.is_discarded() || !document.is_object() || !document.contains("benchmarks") ||
+        !document["benchmarks"].is_array()) {
+        error = "not Google Benchmark JSON output";
+        return false;
+    }
+
+    result = ResultFile();
+    if (document.contains("context") && document["context"].is_object()) {
+        for (const auto& [key, value] : document["context"].items()) {
+            if (value.is_string()) {
+                result.context[key] = value.get<std::string>();
+            } else if (value.is_number() || value.is_boolean()) {
+                result.context[key] = value.dump();
+            }
+        }
+    }
+
+    std::map<std::string, double> medians;
+    for (const auto& entry : document["benchmarks"]) {
+        if (!entry.contains("real_time") || entry.value("error_occurred", false)) {
+            continue;
+        }
+        const std::string run_name = entry.value("run_name", entry.value("name", std::string()));
+        const double time = toNanoseconds(entry["real_time"].get<double>(), entry.value("time_unit", "ns"));
+        const std::string run_type = entry.value("run_type", "iteration");
+        if (run_type == "iteration") {
+            result.samples[run_name].push_back(time);
+        } else if (entry.value("aggregate_name", "") == "median") {
+            medians[run_name] = time;
+        }
+    }
+    for (const auto& [name, time] : medians) {
+        if (result.samples.find(name) == result.samples.end()) {
+            result.samples[name].push_back(time);
+        }
+    }
+    if (result.samples.empty()) {
+        error = "no benchmark results";
+        return false;
+    }
+    return true;
+}
+
+double Thresholds::forBenchmark(const std::string& name) const {
+    double threshold = default_threshold;
+    size_t best_length = 0;
+    for (const auto& [prefix, value] : overrides) {
+        if (prefix.size() >= best_length && name.compare(0, prefix.size(), prefix) == 0) {
+            threshold = value;
+            best_length = prefix.size();
+        }
+    }
+    return threshold;
+}
+
+bool loadThresholds(std::istream& input, Thresholds& thresholds, std::string& error) {
+    const json document = json::parse(input, nullptr, false);
+    if (document.is_discarded() || !document.is_object()) {
+        error = "thresholds file is not a JSON object";
+        return false;
+    }
+    thresholds = Thresholds();
+    if (document.contains("default") && document["default"].is_number()) {
+        thresholds.default_threshold = document["default"].get<double>();
+    }
+    if (document.contains("benchmarks") && document["benchmarks"].is_object()) {
+        for (const auto& [prefix, value] : document["benchmarks"].items()) {
+            if (!value.is_number()) {
+                error = "threshold for " + prefix + " is not a number";
+                return false;
+            }
+            thresholds.overrides.emplace_back(prefix, value.get<double>());
+        }
+    }
+    return true;
+}
+
+double median(std::vector<double> samples) {
+    if (samples.empty()) {
+        return 0.0;
+    }
+    std::sort(samples.begin(), samples.end());
+    const size_t middle = samples.size() / 2;
+    return samples.size() % 2 ? samples[middle] : (samples[middle - 1] + samples[middle]) / 2.0;
+}
+
+std::pair<double, double> medianInterval(std::vector<double> samples, double confidence) {
+    if (samples.empty()) {
+        return {0.0, 0.0};
+    }
+    std::sort(samples.begin(), samples.end());
+    const int n = static_cast<int>(samples.size());
+
+    // Largest k with P(Binomial(n, 1/2) <= k - 1) <= (1 - confidence) / 2;
+    // the interval is then [x(k), x(n - k + 1)] in 1-based order statistics
+    const double tail = (1.0 - confidence) / 2.0;
+    double probability = std::pow(0.5, n);   // P(B = 0)
+    double cumulative = 0.0;
+    int k = 0;
+    for (int i = 0; i < n; ++i) {
+        cumulative += probability;
+        if (cumulative > tail) {
+            break;
+        }
+        k = i + 1;
+        probability *= static_cast<double>(n - i) / (i + 1);
+    }
+    if (k == 0) {
+        return {samples.front(), samples.back()};
+    }
+    return {samples[k - 1], samples[n - k]};
+}
+
+double mannWhitneyPValue(const std::vector<double>& a, const std::vector<double>& b) {
+    if (a.empty() || b.empty()) {
+        return 1.0;
+    }
+    std::vector<std::pair<double, bool>> pooled;   // Value, from a
+    pooled.reserve(a.size() + b.size());
+    for (double value : a) pooled.emplace_back(value, true);
+    for (double value : b) pooled.emplace_back(value, false);
+    std::sort(pooled.begin(), pooled.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    // Average ranks over ties
+    const double n = static_cast<double>(pooled.size());
+    double rank_sum_a = 0.0;
+    double tie_term = 0.0;
+    for (size_t start = 0; start < pooled.size();) {
+        size_t end = start;
+        while (end < pooled.size() && pooled[end].first == pooled[start].first) {
+            ++end;
+        }
+        const double ties = static_cast<double>(end - start);
+        const double rank = (start + 1 + end) / 2.0;
+        for (size_t i = start; i < end; ++i) {
+            if (pooled[i].second) {
+                rank_sum_a += rank;
+            }
+        }
+        tie_term += ties * ties * ties - ties;
+        start = end;
+    }
+
+    const double n1 = static_cast<double>(a.size());
+    const double n2 = static_cast<double>(b.size());
+    const double u = rank_sum_a - n1 * (n1 + 1.0) / 2.0;
+    const double mean = n1 * n2 / 2.0;
+    const double variance = n1 * n2 / 12.0 * ((n + 1.0) - tie_term / (n * (n - 1.0)));
+    if (variance <= 0.0) {
+        return 1.0;
+    }
+    const double distance = std::max(0.0, std::abs(u - mean) - 0.5);   // Continuity correction
+    return std::erfc(distance / std::sqrt(variance) / std::sqrt(2.0));
+}
+
+std::vector<Comparison> compare(const ResultFile& baseline, const ResultFile& current,
+                                const Thresholds& thresholds, double alpha) {
+    std::set<std::string> names;
+    for (const auto& entry : baseline.samples) names.insert(entry.first);
+    for (const auto& entry : current.samples) names.insert(entry.first);
+
+    std::vector<Comparison> comparisons;
+    for (const auto& name : names) {
+        Comparison comparison;
+        comparison.name = name;
+        comparison.threshold = thresholds.forBenchmark(name);
+
+        const auto before = baseline.samples.find(name);
+        const auto after = current.samples.find(name);
+        if (before == baseline.samples.end()) {
+            comparison.verdict = Comparison::Verdict::NEW;
+        } else if (after == current.samples.end()) {
+            comparison.verdict = Comparison::Verdict::MISSING;
+        }
+        if (before != baseline.samples.end()) {
+            comparison.baseline_median = median(before->second);
+        }
+        if (after != current.samples.end()) {
+            comparison.current_median = median(after->second);
+            std::tie(comparison.current_low, comparison.current_high) = medianInterval(after->second);
+        }
+
+        if (comparison.verdict == Comparison::Verdict::UNCHANGED && comparison.baseline_median > 0.0) {
+            comparison.change = comparison.current_median / comparison.baseline_median - 1.0;
+            comparison.p_value = mannWhitneyPValue(before->second, after->second);
+            const bool significant = comparison.p_value < alpha;
+            if (comparison.change > comparison.threshold) {
+                comparison.verdict = significant ? Comparison::Verdict::REGRESSION : Comparison::Verdict::NOISY;
+            } else if (comparison.change < -comparison.threshold && significant) {
+                comparison.verdict = Comparison::Verdict::IMPROVEMENT;
+            }
+        }
+        comparisons.push_back(comparison);
+    }
+    return comparisons;
+}
+
+bool hasRegression(const std::vector<Comparison>& comparisons) {
+    return std::any_of(comparisons.begin(), comparisons.end(), [](const Comparison& comparison) {
+        return comparison.verdict == Comparison::Verdict::REGRESSION;
+    });
+}
+
+std::string formatTable(const std::vector<Comparison>& comparisons) {
+    size_t name_width = 9;
+    for (const auto& comparison : comparisons) {
+        name_width = std::max(name_width, comparison.name.size());
+    }
+
+    std::string table;
+    char row[512];
+    std::snprintf(row, sizeof(row), "%-*s %10s %10s %23s %8s %7s %6s  %s\n", static_cast<int>(name_width),
+                  "Benchmark", "Baseline", "Current", "95% CI of current", "Change", "p", "Limit", "Verdict");
+    table += row;
+    table += std::string(name_width + 88, '-') + "\n";
+
+    for (const auto& comparison : comparisons) {
+        const bool both = comparison.verdict != Comparison::Verdict::NEW &&
+                          comparison.verdict != Comparison::Verdict::MISSING;
+        const std::string baseline =
+            comparison.verdict == Comparison::Verdict::NEW ? "-" : formatTime(comparison.baseline_median);
+        const std::string current =
+            comparison.verdict == Comparison::Verdict::MISSING ? "-" : formatTime(comparison.current_median);
+        const std::string interval = comparison.verdict == Comparison::Verdict::MISSING
+                                         ? "-"
+                                         : formatTime(comparison.current_low) + " - " +
+                                               formatTime(comparison.current_high);
+        char change[16] = "-";
+        char p_value[16] = "-";
+        if (both) {
+            std::snprintf(change, sizeof(change), "%+.1f%%", comparison.change * 100.0);
+            std::snprintf(p_value, sizeof(p_value), "%.3f", comparison.p_value);
+        }
+        char limit[16];
+        std::snprintf(limit, sizeof(limit), "%.0f%%", comparison.threshold * 100.0);
+        std::snprintf(row, sizeof(row), "%-*s %10s %10s %23s %8s %7s %6s  %s\n", static_cast<int>(name_width),
+                      comparison.name.c_str(), baseline.c_str(), current.c_str(), interval.c_str(), change,
+                      p_value, limit, verdictName(comparison.verdict));
+        table += row;
+    }
+    return table;
+}
+
+} // namespace PerfCompare
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <istream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Statistics for comparing two Google Benchmark JSON result files
+ *
+ * Each benchmark's repetitions are treated as samples. A benchmark counts as
+ * regressed only if its median slowed down by more than its threshold and a
+ * Mann-Whitney U test says the two sample sets differ, so a single noisy
+ * repetition cannot fail the check on its own.
+ */
+namespace PerfCompare {
+
+/**
+ * @brief Benchmark results from one JSON file
+ */
+struct ResultFile {
+    std::map<std::string, std::vector<double>> samples;   // Real time per repetition, in nanoseconds
+    std::map<std::string, std::string> context;           // host_name, num_cpus, build_type, ...
+};
+
+/**
+ * @brief Read Google Benchmark JSON output
+ * @param input JSON text (--benchmark_out_format=json)
+ * @param result Receives the samples of every benchmark
+ * @param error Receives a description if the input cannot be used
+ * @return True on success
+ *
+ * Repetitions are read from the "iteration" entries. Files written with
+ * --benchmark_report_aggregates_only fall back to the "median" aggregate as
+ * a single sample.
+ */
+bool loadResults(std::istream& input, ResultFile& result, std::string& error);
+
+/**
+ * @brief Per-benchmark regression thresholds
+ *
+ * A benchmark uses the override with the longest name prefix that matches
+ * it, otherwise the default.
+ */
+struct Thresholds {
+    double default_threshold = 0.10;                         // 10% slower
+    std::vector<std::pair<std::string, double>> overrides;  // Name prefix, threshold
+
+    double forBenchmark(const std::string& name) const;
+};
+
+/**
+ * @brief Read thresholds from JSON: {"default": 0.1, "benchmarks": {"BM_X": 0.2}}
+ * @return True on success
+ */
+bool loadThresholds(std::istream& input, Thresholds& thresholds, std::string& error);
+
+double median(std::vector<double> samples);
+
+/**
+ * @brief Distribution-free confidence interval of the median
+ * @return Order statistics bracketing the median with at least the given
+ *         confidence; the whole sample range for very small samples
+ */
+std::pair<double, double> medianInterval(std::vector<double> samples, double confidence = 0.95);
+
+/**
+ * @brief Two-sided Mann-Whitney U test (normal approximation with tie correction)
+ * @return p-value; 1.0 if either side has no samples
+ */
+double mannWhitneyPValue(const std::vector<double>& a, const std::vector<double>& b);
+
+/**
+ * @brief One benchmark compared against the baseline
+ */
+struct Comparison {
+    enum class Verdict { UNCHANGED, REGRESSION, IMPROVEMENT, NOISY, NEW, MISSING };
+
+    std::string name;
+    Verdict verdict = Verdict::UNCHANGED;
+    double baseline_median = 0.0;   // Nanoseconds
+    double current_median = 0.0;
+    double current_low = 0.0;       // Confidence interval of the current median
+    double current_high = 0.0;
+    double change = 0.0;            // Relative change of the median (+0.15 = 15% slower)
+    double p_value = 1.0;
+    double threshold = 0.0;
+};
+
+/**
+ * @brief Compare every benchmark in either file
+ * @param alpha Significance level for the Mann-Whitney U test
+ *
+ * A change beyond the threshold that is not significant is reported as
+ * NOISY; it does not fail the check.
+ */
+std::vector<Comparison> compare(const ResultFile& baseline, const ResultFile& current,
+                                const Thresholds& thresholds, double alpha = 0.05);
+
+bool hasRegression(const std::vector<Comparison>& comparisons);
+
+/**
+ * @brief Readable diff table, one row per benchmark
+ */
+std::string formatTable(const std::vector<Comparison>& comparisons);
+
+} // namespace PerfCompare
@@ -0,0 +1,124 @@
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "perf_compare.h"
+
+namespace {
+
+// Context keys that must match for timings to be comparable
+const char* const kContextKeys[] = {"build_type", "host_name", "num_cpus"};
+
+bool loadResultFile(const std::string& path, PerfCompare::ResultFile& result) {
+    std::ifstream file(path);
+    std::string error;
+    if (!file.is_open()) {
+        std::cerr << "perf_compare: cannot open " << path << std::endl;
+        return false;
+    }
+    if (!PerfCompare::loadResults(file, result, error)) {
+        std::cerr << "perf_compare: " << path << ": " << error << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void usage() {
+    std::cerr << "Usage: perf_compare [--baseline FILE]... [--thresholds FILE] [--alpha P] CURRENT.json\n"
+                 "  --baseline    Baseline results; the first one that exists is used\n"
+                 "  --thresholds  Per-benchmark slowdown limits (JSON)\n"
+                 "  --alpha       Significance level of the Mann-Whitney U test (default 0.05)\n"
+                 "Exit status: 0 no regression, 1 regression, 2 bad input" << std::endl;
+}
+
+} // namespace
+
+/**
+ * @brief Compares benchmark results against a baseline and fails on regressions
+ *
+ * Both files are Google Benchmark JSON, ideally written with
+ * --benchmark_repetitions so each benchmark has several samples. Prints a
+ * diff table and exits with 1 if any benchmark is significantly slower than
+ * its threshold allows.
+ */
+int main(int argc, char* argv[]) {
+    std::vector<std::string> baselines;
+    std::string thresholds_path;
+    std::string current_path;
+    double alpha = 0.05;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if ((arg == "--baseline" || arg == "--thresholds" || arg == "--alpha") && i + 1 < argc) {
+            const std::string value = argv[++i];
+            if (arg == "--baseline") {
+                baselines.push_back(value);
+            } else if (arg == "--thresholds") {
+                thresholds_path = value;
+            } else {
+                alpha = std::atof(value.c_str());
+            }
+        } else if (current_path.empty() && arg.compare(0, 2, "--") != 0) {
+            current_path = arg;
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (current_path.empty() || baselines.empty() || alpha <= 0.0 || alpha >= 1.0) {
+        usage();
+        return 2;
+    }
+
+    std::string baseline_path;
+    for (const auto& candidate : baselines) {
+        if (std::ifstream(candidate).good()) {
+            baseline_path = candidate;
+            break;
+        }
+    }
+    if (baseline_path.empty()) {
+        std::cerr << "perf_compare: no baseline found; record one with 'make perf-baseline'" << std::endl;
+        return 2;
+    }
+
+    PerfCompare::ResultFile baseline;
+    PerfCompare::ResultFile current;
+    if (!loadResultFile(baseline_path, baseline) || !loadResultFile(current_path, current)) {
+        return 2;
+    }
+
+    PerfCompare::Thresholds thresholds;
+    if (!thresholds_path.empty()) {
+        std::ifstream file(thresholds_path);
+        std::string error;
+        if (!file.is_open() || !PerfCompare::loadThresholds(file, thresholds, error)) {
+            std::cerr << "perf_compare: " << thresholds_path << ": "
+                      << (error.empty() ? "cannot open" : error) << std::endl;
+            return 2;
+        }
+    }
+
+    std::cout << "Baseline: " << baseline_path << "\nCurrent:  " << current_path << "\n";
+    for (const char* key : kContextKeys) {
+        const auto before = baseline.context.find(key);
+        const auto after = current.context.find(key);
+        if (before != baseline.context.end() && after != current.context.end() && before->second != after->second) {
+            std::cout << "Warning: " << key << " differs (" << before->second << " vs " << after->second
+                      << "); timings may not be comparable\n";
+        }
+    }
+    std::cout << "\n";
+
+    const auto comparisons = PerfCompare::compare(baseline, current, thresholds, alpha);
+    std::cout << PerfCompare::formatTable(comparisons);
+
+    if (PerfCompare::hasRegression(comparisons)) {
+        std::cout << "\nFAILED: significant regression beyond the threshold" << std::endl;
+        return 1;
+    }
+    std::cout << "\nNo significant regressions" << std::endl;
+    return 0;
+}
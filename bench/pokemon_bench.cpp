@@ -0,0 +1,329 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ai_factory.h"
+#include "battle.h"
+#include "battle_simulator.h"
+#include "expert_ai.h"
+#include "json.hpp"
+#include "pokemon_data.h"
+#include "team.h"
+#include "team_builder.h"
+#include "type_effectiveness.h"
+
+#ifndef POKEMON_BENCH_BUILD_TYPE
+#define POKEMON_BENCH_BUILD_TYPE "unknown"
+#endif
+
+/**
+ * @brief Reaches Battle's private damage calculation for the benchmarks
+ */
+class BattleBenchmark {
+public:
+    static int damage(const Battle& battle, const Pokemon& attacker, const Pokemon& defender, const Move& move) {
+        return battle.calculateDamageWithEffects(attacker, defender, move).damage;
+    }
+};
+
+namespace {
+
+using json = nlohmann::json;
+using TeamMap = std::unordered_map<std::string, std::vector<std::string>>;
+using MoveMap =
+    std::unordered_map<std::string, std::vector<std::pair<std::string, std::vector<std::string>>>>;
+
+const char* const kTeamFiles[] = {"data/teams/Team-1.json", "data/teams/Team-2.json", "data/teams/Team-3.json"};
+
+/**
+ * @brief The stock teams in the shape Team::loadTeams expects
+ */
+struct TeamFiles {
+    TeamMap teams;
+    MoveMap moves;
+    std::vector<std::string> names;
+};
+
+const TeamFiles& teamFiles() {
+    static const TeamFiles files = [] {
+        TeamFiles result;
+        for (const char* path : kTeamFiles) {
+            std::ifstream file(path);
+            json document = json::parse(file, nullptr, false);
+            if (document.is_discarded()) {
+                continue;
+            }
+            for (const auto& [team_name, team] : document.items()) {
+                const auto& pokemon = team["Pokemon"];
+                result.names.push_back(team_name);
+                for (const auto& species : pokemon["pokemon"]) {
+                    const std::string name = species.get<std::string>();
+                    result.teams[team_name].push_back(name);
+                    result.moves[team_name].emplace_back(name, pokemon["moves"][name].get<std::vector<std::string>>());
+                }
+            }
+        }
+        return result;
+    }();
+    return files;
+}
+
+Team loadTeam(const std::string& name) {
+    Team team;
+    team.loadTeams(teamFiles().teams, teamFiles().moves, name);
+    return team;
+}
+
+/**
+ * @brief Discards std::cerr while in scope
+ *
+ * PokemonData reports every data file it skips; the messages are still
+ * formatted, but the benchmark does not time a terminal.
+ */
+class QuietStderr {
+public:
+    QuietStderr() : saved_(std::cerr.rdbuf(nullptr)) {}
+    ~QuietStderr() {
+        std::cerr.rdbuf(saved_);
+        std::cerr.clear();
+    }
+
+    QuietStderr(const QuietStderr&) = delete;
+    QuietStderr& operator=(const QuietStderr&) = delete;
+
+private:
+    std::streambuf* saved_;
+};
+
+/**
+ * @brief Fixed positions for the AI benchmarks
+ *
+ * Every stock team faces every other one, with each of its slots leading
+ * against a rotating opposing slot. Positions are rebuilt fresh for each
+ * benchmark so no state carries over between AIs.
+ */
+class PositionCorpus {
+public:
+    PositionCorpus() {
+        const auto& names = teamFiles().names;
+        for (const auto& ai_name : names) {
+            for (const auto& opponent_name : names) {
+                if (ai_name != opponent_name) {
+                    matchups_.emplace_back(loadTeam(ai_name), loadTeam(opponent_name));
+                }
+            }
+        }
+        for (auto& [ai_team, opponent_team] : matchups_) {
+            const int size = static_cast<int>(std::min(ai_team.size(), opponent_team.size()));
+            for (int slot = 0; slot < size; ++slot) {
+                BattleState state;
+                state.aiPokemon = ai_team.getPokemon(slot);
+                state.opponentPokemon = opponent_team.getPokemon((slot + 1) % size);
+                state.aiTeam = &ai_team;
+                state.opponentTeam = &opponent_team;
+                state.currentWeather = WeatherCondition::NONE;
+                state.weatherTurnsRemaining = 0;
+                state.turnNumber = slot + 1;
+                positions_.push_back(state);
+            }
+        }
+    }
+
+    PositionCorpus(const PositionCorpus&) = delete;
+    PositionCorpus& operator=(const PositionCorpus&) = delete;
+
+    const std::vector<BattleState>& positions() const { return positions_; }
+
+private:
+    std::vector<std::pair<Team, Team>> matchups_;   // Complete before positions_ points into it
+    std::vector<BattleState> positions_;
+};
+
+// ────────────────────────────────
+//  Battle engine
+// ────────────────────────────────
+
+void BM_CalculateDamageWithEffects(benchmark::State& state) {
+    const Team team_a = loadTeam(teamFiles().names.front());
+    const Team team_b = loadTeam(teamFiles().names.back());
+    Battle battle(team_a, team_b);
+
+    std::vector<std::tuple<const Pokemon*, const Pokemon*, const Move*>> calls;
+    for (size_t a = 0; a < team_a.size(); ++a) {
+        for (size_t b = 0; b < team_b.size(); ++b) {
+            const Pokemon* attacker = team_a.getPokemon(static_cast<int>(a));
+            for (const auto& move : attacker->moves) {
+                if (move.power > 0) {
+                    calls.emplace_back(attacker, team_b.getPokemon(static_cast<int>(b)), &move);
+                }
+            }
+        }
+    }
+
+    for (auto _ : state) {
+        for (const auto& [attacker, defender, move] : calls) {
+            benchmark::DoNotOptimize(BattleBenchmark::damage(battle, *attacker, *defender, *move));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(calls.size()));
+}
+BENCHMARK(BM_CalculateDamageWithEffects);
+
+void BM_TypeEffectiveness(benchmark::State& state) {
+    const std::vector<std::string> types = TypeEffectiveness::getAllTypes();
+    std::vector<std::vector<std::string>> defenders;
+    for (size_t i = 0; i < types.size(); ++i) {
+        defenders.push_back({types[i]});
+        defenders.push_back({types[i], types[(i + 7) % types.size()]});
+    }
+
+    for (auto _ : state) {
+        for (const auto& attacking : types) {
+            for (const auto& defending : defenders) {
+                benchmark::DoNotOptimize(TypeEffectiveness::getEffectivenessMultiplier(attacking, defending));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(types.size() * defenders.size()));
+}
+BENCHMARK(BM_TypeEffectiveness);
+
+void BM_HeadlessBattle(benchmark::State& state) {
+    const Team team_a = loadTeam(teamFiles().names.front());
+    const Team team_b = loadTeam(teamFiles().names.back());
+    BattleSimulator::Options options;
+    options.team_a_ai = static_cast<AIDifficulty>(state.range(0));
+    options.team_b_ai = options.team_a_ai;
+
+    uint64_t seed = 0;
+    for (auto _ : state) {
+        options.seed = ++seed;
+        benchmark::DoNotOptimize(BattleSimulator::simulate(team_a, team_b, options).turns);
+    }
+    state.SetItemsProcessed(state.iterations());   // Battles per second
+}
+BENCHMARK(BM_HeadlessBattle)
+    ->ArgName("ai")
+    ->Arg(static_cast<int>(AIDifficulty::EASY))
+    ->Arg(static_cast<int>(AIDifficulty::MEDIUM))
+    ->Arg(static_cast<int>(AIDifficulty::HARD))
+    ->Unit(benchmark::kMillisecond);
+
+// ────────────────────────────────
+//  AI
+// ────────────────────────────────
+
+void BM_ChooseBestMove(benchmark::State& state) {
+    const PositionCorpus corpus;
+    auto ai = AIFactory::createAI(static_cast<AIDifficulty>(state.range(0)));
+
+    for (auto _ : state) {
+        for (const auto& position : corpus.positions()) {
+            benchmark::DoNotOptimize(ai->chooseBestMove(position).moveIndex);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(corpus.positions().size()));
+}
+BENCHMARK(BM_ChooseBestMove)
+    ->ArgName("ai")
+    ->Arg(static_cast<int>(AIDifficulty::EASY))
+    ->Arg(static_cast<int>(AIDifficulty::MEDIUM))
+    ->Arg(static_cast<int>(AIDifficulty::HARD))
+    ->Arg(static_cast<int>(AIDifficulty::EXPERT))
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_MiniMaxSearch(benchmark::State& state) {
+    const PositionCorpus corpus;
+    ExpertAI ai;
+    const int depth = static_cast<int>(state.range(0));
+    int64_t nodes = 0;
+
+    for (auto _ : state) {
+        for (const auto& position : corpus.positions()) {
+            std::vector<int> best_line;
+            benchmark::DoNotOptimize(ai.miniMaxSearch(position, depth, -1e9, 1e9, true, best_line));
+            nodes += ai.getLastSearchStatistics().nodes_evaluated;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(corpus.positions().size()));
+    state.counters["nodes"] = benchmark::Counter(static_cast<double>(nodes), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_MiniMaxSearch)->ArgName("depth")->DenseRange(1, 3)->Unit(benchmark::kMicrosecond);
+
+// ────────────────────────────────
+//  Data loading and team building
+// ────────────────────────────────
+
+void BM_PokemonDataInitialize(benchmark::State& state) {
+    QuietStderr quiet;
+    for (auto _ : state) {
+        PokemonData data;
+        benchmark::DoNotOptimize(data.initialize().success);
+    }
+}
+BENCHMARK(BM_PokemonDataInitialize)->Unit(benchmark::kMillisecond);
+
+void BM_TeamLoadTeams(benchmark::State& state) {
+    const std::string& name = teamFiles().names.front();
+    for (auto _ : state) {
+        Team team;
+        team.loadTeams(teamFiles().teams, teamFiles().moves, name);
+        benchmark::DoNotOptimize(team.size());
+    }
+}
+BENCHMARK(BM_TeamLoadTeams)->Unit(benchmark::kMicrosecond);
+
+void BM_AnalyzeTeam(benchmark::State& state) {
+    auto data = std::make_shared<PokemonData>();
+    QuietStderr quiet;
+    if (!data->initialize().success) {
+        state.SkipWithError("Pokemon data failed to load");
+        return;
+    }
+    TeamBuilder builder(data);
+    const std::string& name = teamFiles().names.front();
+    TeamBuilder::Team team(name);
+    for (const auto& [species, moves] : teamFiles().moves.at(name)) {
+        team.pokemon.emplace_back(species, moves);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(builder.analyzeTeam(team).physical_moves);
+    }
+}
+BENCHMARK(BM_AnalyzeTeam)->Unit(benchmark::kMicrosecond);
+
+} // namespace
+
+/**
+ * @brief Engine, AI, data loading and team building benchmarks
+ *
+ * Reads the stock data files relative to the working directory, so run it
+ * from the build directory (the run_benchmarks target does). Takes the usual
+ * Google Benchmark flags, e.g. --benchmark_out=results.json
+ * --benchmark_out_format=json to keep results for comparison.
+ */
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    if (!std::filesystem::is_directory("data/pokemon") || teamFiles().names.empty()) {
+        std::cerr << "pokemon_bench: data/ not found; run it from the build directory" << std::endl;
+        return 1;
+    }
+    benchmark::AddCustomContext("build_type", POKEMON_BENCH_BUILD_TYPE);   // Debug and Release timings differ
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,177 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "battle_replay.h"
+#include "battle_team_factory.h"
+#include "trace.h"
+
+/**
+ * @brief Record, inspect, verify and replay simulated battles
+ *
+ * Usage:
+ *   replay record <file> <seed> <team_a> <team_b>
+ *       Teams are comma-separated members, each "species/move/move..."
+ *   replay info <file>
+ *   replay verify <file>
+ *   replay seek <file> <turn>
+ *   replay bench <file> [iterations]
+ */
+namespace {
+
+int usage() {
+    std::cerr << "Usage:\n"
+              << "  replay record <file> <seed> <team_a> <team_b>   (team: species/move/move,species/...)\n"
+              << "  replay info <file>\n"
+              << "  replay verify <file>\n"
+              << "  replay seek <file> <turn>\n"
+              << "  replay bench <file> [iterations]" << std::endl;
+    return 2;
+}
+
+std::vector<std::string> split(const std::string& text, char separator) {
+    std::vector<std::string> parts;
+    std::stringstream stream(text);
+    std::string part;
+    while (std::getline(stream, part, separator)) {
+        if (!part.empty()) {
+            parts.push_back(part);
+        }
+    }
+    return parts;
+}
+
+Team parseTeam(const std::string& spec) {
+    TeamBuilder::Team team("replay");
+    for (const auto& member : split(spec, ',')) {
+        auto names = split(member, '/');
+        if (names.empty()) {
+            continue;
+        }
+        const std::string species = names.front();
+        names.erase(names.begin());
+        team.pokemon.emplace_back(species, names);
+    }
+    return BattleTeamFactory::shared().build(team);
+}
+
+const char* outcomeName(BattleSimulator::Outcome outcome) {
+    switch (outcome) {
+        case BattleSimulator::Outcome::TEAM_A_WINS: return "team A wins";
+        case BattleSimulator::Outcome::TEAM_B_WINS: return "team B wins";
+        default: return "draw";
+    }
+}
+
+void printTeam(const char* label, const Team& team) {
+    std::cout << label << ":";
+    for (int slot = 0; slot < static_cast<int>(team.size()); ++slot) {
+        const Pokemon* pokemon = team.getPokemon(slot);
+        if (pokemon) {
+            std::cout << "  " << pokemon->name << " " << pokemon->current_hp << "/" << pokemon->hp;
+            if (pokemon->hasStatusCondition()) {
+                std::cout << " (" << pokemon->getStatusConditionName() << ")";
+            }
+        }
+    }
+    std::cout << std::endl;
+}
+
+bool loadReplay(const std::string& path, BattleReplay& replay) {
+    if (!BattleReplay::load(path, replay)) {
+        std::cerr << "Could not read replay " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        return usage();
+    }
+    const std::string command = argv[1];
+    const std::string path = argv[2];
+    Trace::startFromEnvironment();
+
+    if (command == "record") {
+        if (argc < 6) {
+            return usage();
+        }
+        const Team team_a = parseTeam(argv[4]);
+        const Team team_b = parseTeam(argv[5]);
+        if (team_a.isEmpty() || team_b.isEmpty()) {
+            std::cerr << "Both teams need at least one valid Pokemon" << std::endl;
+            return 1;
+        }
+        BattleSimulator::Options options;
+        options.seed = std::strtoull(argv[3], nullptr, 10);
+        BattleSimulator::Result result;
+        const BattleReplay replay = ReplayRecorder::record(team_a, team_b, options, true, &result);
+        if (!replay.save(path)) {
+            std::cerr << "Failed to write " << path << std::endl;
+            return 1;
+        }
+        std::cout << "Recorded " << result.turns << " turns (" << outcomeName(result.outcome) << ") to "
+                  << path << ", " << replay.encode().size() << " bytes" << std::endl;
+        return 0;
+    }
+
+    BattleReplay replay;
+    if (!loadReplay(path, replay)) {
+        return 1;
+    }
+    BattleReplayer replayer(replay);
+
+    if (command == "info") {
+        std::cout << "Seed " << replay.seed << ", " << replay.turns << " turns, " << outcomeName(replay.outcome)
+                  << ", " << replay.actions.size() << " choices, " << replay.events.size() << " events" << std::endl;
+        printTeam("Team A", replayer.getTeamA());
+        printTeam("Team B", replayer.getTeamB());
+        return 0;
+    }
+
+    if (command == "verify") {
+        const auto verification = replayer.verify();
+        std::cout << verification.message;
+        if (verification.first_divergent_turn >= 0) {
+            std::cout << " (first divergence at turn " << verification.first_divergent_turn << ")";
+        }
+        std::cout << std::endl;
+        return verification.matches() ? 0 : 1;
+    }
+
+    if (command == "seek") {
+        if (argc < 4) {
+            return usage();
+        }
+        const int turn = std::atoi(argv[3]);
+        if (!replayer.seek(turn)) {
+            std::cerr << "Turn " << turn << " is not part of this battle (" << replay.turns << " turns)" << std::endl;
+            return 1;
+        }
+        std::cout << "After turn " << turn << std::endl;
+        printTeam("Team A", replayer.getTeamA());
+        printTeam("Team B", replayer.getTeamB());
+        return 0;
+    }
+
+    if (command == "bench") {
+        const int iterations = argc > 3 ? std::max(1, std::atoi(argv[3])) : 10000;
+        const auto started = std::chrono::steady_clock::now();
+        long long turns = 0;
+        for (int i = 0; i < iterations; ++i) {
+            turns += replayer.run().turns;
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        std::cout << iterations << " replays, " << static_cast<long long>(iterations / seconds) << " battles/s, "
+                  << static_cast<long long>(turns / seconds) << " turns/s" << std::endl;
+        return 0;
+    }
+
+    return usage();
+}
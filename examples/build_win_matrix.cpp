@@ -0,0 +1,58 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include "pokemon_data.h"
+#include "species_win_matrix.h"
+
+/**
+ * @brief Offline job that builds the species-vs-species win matrix
+ *
+ * Simulates every species with its suggested moveset against every other
+ * species on all cores and writes the result where TeamBuilder's
+ * generateCounterTeam looks for it.
+ *
+ * Usage: build_win_matrix [games_per_duel] [seed] [output_path]
+ */
+int main(int argc, char* argv[]) {
+    SpeciesWinMatrix::Settings settings;
+    if (argc > 1) {
+        settings.games_per_duel = std::max(1, std::atoi(argv[1]));
+    }
+    if (argc > 2) {
+        settings.seed = std::strtoull(argv[2], nullptr, 10);
+    }
+    const std::string output_path = argc > 3 ? argv[3] : SpeciesWinMatrix::defaultPath();
+
+    auto pokemon_data = std::make_shared<PokemonData>();
+    auto init_result = pokemon_data->initialize();
+    if (!init_result.success) {
+        std::cerr << "Failed to initialize Pokemon data: " << init_result.error_message << std::endl;
+        return 1;
+    }
+
+    std::cout << "Simulating " << settings.games_per_duel << " games per species pair..." << std::endl;
+    SpeciesWinMatrix matrix;
+    int last_percent = -1;
+    const bool built = matrix.buildFromData(*pokemon_data, settings, [&](size_t completed, size_t total) {
+        const int percent = static_cast<int>(completed * 100 / total);
+        if (percent != last_percent) {
+            last_percent = percent;
+            std::cout << "\r" << percent << "% (" << completed << "/" << total << " pairs)" << std::flush;
+        }
+    });
+    std::cout << std::endl;
+
+    if (!built) {
+        std::cerr << "Not enough species to build a matrix" << std::endl;
+        return 1;
+    }
+    if (!matrix.save(output_path)) {
+        std::cerr << "Failed to write " << output_path << std::endl;
+        return 1;
+    }
+
+    std::cout << "Wrote " << matrix.size() << "x" << matrix.size() << " matrix to " << output_path << std::endl;
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+#include "pokemon_data.h"
+#include "team_batch_scorer.h"
+
+/**
+ * @brief Throughput benchmark for TeamBatchScorer
+ *
+ * Scores a batch of random six-Pokemon teams with one thread and then with
+ * every core, reporting teams per second for each run (best of several).
+ *
+ * Usage: team_batch_bench [team_count] [repetitions]
+ */
+int main(int argc, char* argv[]) {
+    const size_t team_count = argc > 1 ? std::max(1L, std::atol(argv[1])) : 2000000;
+    const int repetitions = argc > 2 ? std::max(1, std::atoi(argv[2])) : 5;
+
+    auto pokemon_data = std::make_shared<PokemonData>();
+    auto init_result = pokemon_data->initialize();
+    if (!init_result.success) {
+        std::cerr << "Failed to initialize Pokemon data: " << init_result.error_message << std::endl;
+        return 1;
+    }
+
+    TeamBatchScorer probe(*pokemon_data);
+    if (probe.getSpeciesCount() == 0 || probe.getMoveCount() == 0) {
+        std::cerr << "No species or moves loaded" << std::endl;
+        return 1;
+    }
+
+    std::mt19937 rng(42);
+    std::vector<TeamBatchScorer::PackedTeam> teams(team_count);
+    for (auto& team : teams) {
+        for (int slot = 0; slot < TeamBatchScorer::kMaxTeamSize; ++slot) {
+            team.species[slot] = static_cast<uint16_t>(rng() % probe.getSpeciesCount());
+            for (int move = 0; move < TeamBatchScorer::kMaxMoves; ++move) {
+                team.moves[slot][move] = static_cast<uint16_t>(rng() % probe.getMoveCount());
+            }
+        }
+    }
+    std::vector<TeamBatchScorer::TeamScore> results(team_count);
+
+    std::vector<unsigned> thread_counts = {1};
+    const unsigned cores = std::thread::hardware_concurrency();
+    if (cores > 1) {
+        thread_counts.push_back(cores);
+    }
+
+    std::cout << "Scoring " << team_count << " teams, best of " << repetitions << " runs" << std::endl;
+    for (unsigned threads : thread_counts) {
+        TeamBatchScorer::Settings settings;
+        settings.worker_threads = threads;
+        TeamBatchScorer scorer(*pokemon_data, settings);
+
+        double best_seconds = 0.0;
+        for (int run = 0; run < repetitions; ++run) {
+            const auto start = std::chrono::steady_clock::now();
+            scorer.score(teams.data(), teams.size(), results.data());
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            if (run == 0 || elapsed.count() < best_seconds) {
+                best_seconds = elapsed.count();
+            }
+        }
+
+        // Checksum keeps the scoring pass from being optimized away
+        uint64_t checksum = 0;
+        for (const auto& result : results) {
+            checksum += result.balance_score;
+        }
+
+        std::cout << std::setw(3) << threads << " thread(s): " << std::fixed << std::setprecision(1)
+                  << team_count / best_seconds / 1e6 << "M teams/s (" << std::setprecision(3)
+                  << best_seconds * 1e3 << " ms, checksum " << checksum << ")" << std::endl;
+    }
+    return 0;
+}
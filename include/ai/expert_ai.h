@@ -3,6 +3,7 @@
 #include <chrono>
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "ai_strategy.h"
@@ -77,6 +78,18 @@ class ExpertAI : public AIStrategy {
   double predictOpponentMoveProbability(const BattleState& battle_state, int move_index) const;
   std::string classifyOpponentPlayStyle(const BattleState& battle_state) const;
   
+  // Statistics of the most recent miniMaxSearch call
+  struct SearchStatistics {
+    int nodes_evaluated = 0;
+    int alpha_beta_cutoffs = 0;
+    std::chrono::microseconds search_time{0};
+  };
+  SearchStatistics getLastSearchStatistics() const;
+
+  // Wall time spent in each decision method since construction (nested calls counted in both)
+  using MethodTimings = std::map<std::string, std::chrono::microseconds, std::less<>>;
+  const MethodTimings& getMethodTimings() const { return method_timings_; }
+
   // MiniMax search methods
   double miniMaxSearch(const BattleState& root_state, int depth, double alpha, double beta, 
                       bool maximizing_player, std::vector<int>& best_line) const;
@@ -168,6 +181,10 @@ class ExpertAI : public AIStrategy {
   double analyzeEndgamePosition(const BattleState& battleState) const;
   bool isEndgameScenario(const BattleState& battleState) const;
 
+  // One node of miniMaxSearch; the public entry point resets and records the statistics
+  double searchNode(const BattleState& state, int depth, double alpha, double beta,
+                    bool maximizing_player, std::vector<int>& best_line) const;
+
   // Utility methods
   double simulateBattleOutcome(const BattleState& initialState,
                                const TurnPlan& plan) const;
@@ -219,13 +236,13 @@ class ExpertAI : public AIStrategy {
     static constexpr double kAlphaBetaThreshold = 0.1;  // Pruning sensitivity
     
     // Search statistics for performance analysis
-    mutable int nodes_evaluated_;
-    mutable int alpha_beta_cutoffs_;
-    mutable std::chrono::milliseconds search_time_;
+    mutable int nodes_evaluated_ = 0;
+    mutable int alpha_beta_cutoffs_ = 0;
+    mutable std::chrono::microseconds search_time_{0};
     
     // Principal Variation (best line found)
     mutable std::vector<int> principal_variation_;
-    mutable double principal_variation_score_;
+    mutable double principal_variation_score_ = 0.0;
   };
 
 
@@ -236,6 +253,6 @@ class ExpertAI : public AIStrategy {
   mutable MetaGameAnalyzer meta_analyzer_;
   
   // Performance tracking
-  mutable std::map<std::string, std::chrono::milliseconds> method_timings_;
-  mutable int total_positions_analyzed_;
+  mutable MethodTimings method_timings_;
+  mutable int total_positions_analyzed_ = 0;
 };
\ No newline at end of file
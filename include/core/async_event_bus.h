@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "battle_events.h"
+#include "event_ring_buffer.h"
+
+namespace BattleEvents {
+
+/**
+ * @brief Delivers battle events to consumers on their own threads
+ *
+ * Subscribe the bus to a BattleEventManager - the interactive Battle's, or
+ * one handed to BattleSimulator::simulateInPlace - and it turns every event
+ * into an EventRecord. Each consumer - a renderer, logger, metrics collector or
+ * replay recorder - has its own ring buffer and thread, so a slow consumer
+ * never delays the battle or the other consumers beyond what its
+ * backpressure policy allows.
+ *
+ * Records hold pointers into the battle, so call flush() or stop() before
+ * the battle's teams are destroyed. Consumers must be added before start().
+ * Publishing is thread-safe; one bus may serve several battle threads.
+ */
+class AsyncEventBus : public BattleEventListener {
+public:
+    using RecordHandler = std::function<void(const EventRecord&)>;
+
+    /**
+     * @brief Queue settings for one consumer
+     */
+    struct ConsumerOptions {
+        size_t capacity;
+        EventRingBuffer::Policy policy;
+        uint32_t sample_rate;
+
+        ConsumerOptions() : capacity(4096), policy(EventRingBuffer::Policy::BLOCK), sample_rate(8) {}
+    };
+
+    AsyncEventBus() = default;
+    ~AsyncEventBus() override;
+
+    AsyncEventBus(const AsyncEventBus&) = delete;
+    AsyncEventBus& operator=(const AsyncEventBus&) = delete;
+
+    /**
+     * @brief Consume raw records
+     * @return Consumer index, or -1 if the bus is already running
+     */
+    int addConsumer(RecordHandler handler, const ConsumerOptions& options = ConsumerOptions());
+
+    /**
+     * @brief Consume rebuilt events through an ordinary listener
+     *
+     * Multi-turn move events arrive without their display message.
+     */
+    int addConsumer(std::shared_ptr<BattleEventListener> listener,
+                    const ConsumerOptions& options = ConsumerOptions());
+
+    void start();
+
+    /**
+     * @brief Wait until every record published so far is consumed or dropped
+     */
+    void flush();
+
+    /**
+     * @brief Drain the queues and join the consumer threads
+     *
+     * Records published after stop() are ignored; start() may be called again.
+     */
+    void stop();
+
+    bool isRunning() const { return running.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Stamp a sequence number on a record and queue it for every consumer
+     *
+     * Ignored unless the bus is running.
+     */
+    void publish(EventRecord record);
+
+    uint64_t getPublishedCount() const { return sequence.load(std::memory_order_relaxed); }
+    uint64_t getConsumedCount(int consumer) const;
+    uint64_t getDroppedCount(int consumer) const;
+    size_t getConsumerCount() const { return consumers.size(); }
+
+    // BattleEventListener
+    void onHealthChanged(const HealthChangeEvent& event) override { publish(makeRecord(event)); }
+    void onStatusChanged(const StatusChangeEvent& event) override { publish(makeRecord(event)); }
+    void onMoveUsed(const MoveUsedEvent& event) override { publish(makeRecord(event)); }
+    void onWeatherChanged(const WeatherChangeEvent& event) override { publish(makeRecord(event)); }
+    void onPokemonSwitch(const PokemonSwitchEvent& event) override { publish(makeRecord(event)); }
+    void onBattleStart(const BattleStartEvent& event) override { publish(makeRecord(event)); }
+    void onBattleEnd(const BattleEndEvent& event) override { publish(makeRecord(event)); }
+    void onTurnStart(int turnNumber) override { publish(makeTurnRecord(EventType::TURN_START, turnNumber)); }
+    void onTurnEnd(int turnNumber) override { publish(makeTurnRecord(EventType::TURN_END, turnNumber)); }
+    void onMultiTurnMove(const MultiTurnMoveEvent& event) override { publish(makeRecord(event)); }
+    void onActionChosen(const ActionChosenEvent& event) override { publish(makeRecord(event)); }
+
+private:
+    struct Consumer {
+        EventRingBuffer ring;
+        RecordHandler handler;
+        std::thread thread;
+        std::atomic<uint64_t> offered{0};      // Push attempts
+        std::atomic<uint64_t> consumed{0};
+
+        Consumer(const ConsumerOptions& options, RecordHandler handler)
+            : ring(options.capacity, options.policy, options.sample_rate), handler(std::move(handler)) {}
+    };
+
+    void drain(Consumer& consumer);
+
+    std::vector<std::unique_ptr<Consumer>> consumers;
+    std::atomic<bool> running{false};
+    std::atomic<bool> stopping{false};
+    std::atomic<uint64_t> sequence{0};
+};
+
+} // namespace BattleEvents
@@ -11,6 +11,7 @@
 #include "type_effectiveness.h"
 #include "weather.h"
 #include "battle_events.h"
+#include "battle_log.h"
 #include "health_bar_animator.h"
 #include "health_bar_event_listener.h"
 
@@ -37,6 +38,9 @@ class Battle {
 
   BattleResult getBattleResult() const;
 
+  // Friend declaration for the benchmark suite (bench/)
+  friend class BattleBenchmark;
+
  private:
   Team playerTeam;
   Team opponentTeam;
@@ -128,6 +132,8 @@ class Battle {
   std::shared_ptr<HealthBarAnimator> healthBarAnimator;
   std::shared_ptr<HealthBarEventListener> healthBarListener;
   
+  // Battle narrative; flushed once per turn and before every prompt
+  mutable BattleLog::Logger battleLog;
   
 public:
   // Event system access
@@ -136,4 +142,8 @@ public:
   // Health bar animation configuration
   void configureHealthBarAnimation(HealthBarAnimator::AnimationSpeed speed = HealthBarAnimator::AnimationSpeed::NORMAL,
                                   HealthBarAnimator::ColorTheme theme = HealthBarAnimator::ColorTheme::BASIC);
+  
+  // Battle narrative verbosity (defaults to VERBOSE)
+  void setLogLevel(BattleLog::Level level) { battleLog.setLevel(level); }
+  BattleLog::Level getLogLevel() const { return battleLog.getLevel(); }
 };
\ No newline at end of file
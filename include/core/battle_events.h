@@ -1,9 +1,11 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <functional>
 #include <string>
+#include <tuple>
 
 // Forward declarations
 class Pokemon;
@@ -13,13 +15,30 @@ enum class WeatherCondition;
 
 namespace BattleEvents {
 
+// What caused an event; tags are cheap to create, describeSource() turns them into text
+enum class EventSource : uint8_t {
+    UNKNOWN,
+    MOVE,           // Damage from sourcePokemon's sourceMove
+    OHKO_MOVE,
+    HEALING_MOVE,
+    DRAIN,
+    RECOIL,
+    WEATHER,        // Damage from sourceWeather
+    STATUS,         // Damage from sourceStatus
+    SWITCH
+};
+
 // Event data structures
 struct HealthChangeEvent {
     Pokemon* pokemon;
     int oldHealth;
     int newHealth;
     int damage;  // Positive for damage taken, negative for healing
-    std::string source;  // "move", "weather", "status", etc.
+    EventSource source;
+    const Pokemon* sourcePokemon;   // Attacker, for move sources
+    const Move* sourceMove;
+    WeatherCondition sourceWeather;
+    StatusCondition sourceStatus;
 };
 
 struct StatusChangeEvent {
@@ -27,9 +46,12 @@ struct StatusChangeEvent {
     StatusCondition oldStatus;
     StatusCondition newStatus;
     int turnsRemaining;
-    std::string source;
+    EventSource source;
 };
 
+// Human-readable source, e.g. "Pikachu's thunderbolt" or "Sandstorm damage"
+std::string describeSource(const HealthChangeEvent& event);
+
 struct MoveUsedEvent {
     Pokemon* user;
     const Move* move;
@@ -68,6 +90,14 @@ struct MultiTurnMoveEvent {
     std::string message;  // Display message for the UI
 };
 
+// A side's decision for the turn, or its pick to replace a fainted Pokemon
+struct ActionChosenEvent {
+    int turn;
+    bool isPlayer;  // true if player (team A), false if AI
+    enum class Kind : uint8_t { MOVE, SWITCH, REPLACEMENT } kind;
+    int index;      // Move index (-1 = Struggle) or team slot
+};
+
 // Abstract observer interface
 class BattleEventListener {
 public:
@@ -84,9 +114,17 @@ public:
     virtual void onTurnStart(int /*turnNumber*/) {}
     virtual void onTurnEnd(int /*turnNumber*/) {}
     virtual void onMultiTurnMove(const MultiTurnMoveEvent& /*event*/) {}
+    virtual void onActionChosen(const ActionChosenEvent& /*event*/) {}
 };
 
 // Event manager - handles subscription and notification
+//
+// Dispatch walks the live listener list without copying it, so an event costs
+// nothing beyond an empty check when nobody is subscribed. Listeners may
+// subscribe or unsubscribe from inside a handler: removals during dispatch
+// leave a tombstone that is compacted once the outermost dispatch finishes,
+// and the removed listener is kept alive until then. The generation counter
+// changes on every subscription change.
 class BattleEventManager {
 public:
     using ListenerPtr = std::shared_ptr<BattleEventListener>;
@@ -95,6 +133,7 @@ public:
     void subscribe(ListenerPtr listener);
     void unsubscribe(ListenerPtr listener);
     void clear();
+    uint64_t getGeneration() const { return generation_; }
     
     // Event notification methods
     void notifyHealthChanged(const HealthChangeEvent& event);
@@ -107,31 +146,80 @@ public:
     void notifyTurnStart(int turnNumber);
     void notifyTurnEnd(int turnNumber);
     void notifyMultiTurnMove(const MultiTurnMoveEvent& event);
+    void notifyActionChosen(const ActionChosenEvent& event);
     
     // Utility methods
-    size_t getListenerCount() const { return listeners_.size(); }
-    bool hasListeners() const { return !listeners_.empty(); }
+    size_t getListenerCount() const { return listeners_.size() - tombstones_; }
+    bool hasListeners() const { return getListenerCount() > 0; }
     
     // Convenience methods for common event creation
-    HealthChangeEvent createHealthChangeEvent(Pokemon* pokemon, int oldHp, int newHp, 
-                                            const std::string& source);
-    StatusChangeEvent createStatusChangeEvent(Pokemon* pokemon, StatusCondition oldStatus, 
-                                            StatusCondition newStatus, int turns, 
-                                            const std::string& source);
-    MoveUsedEvent createMoveUsedEvent(Pokemon* user, const Move* move, Pokemon* target, 
-                                    bool successful, bool critical, double effectiveness);
-    MultiTurnMoveEvent createMultiTurnMoveEvent(Pokemon* pokemon, const Move* move, 
-                                              MultiTurnMoveEvent::Phase phase, 
-                                              const std::string& message);
+    static HealthChangeEvent createHealthChangeEvent(Pokemon* pokemon, int oldHp, int newHp,
+                                                   EventSource source,
+                                                   const Pokemon* sourcePokemon = nullptr,
+                                                   const Move* sourceMove = nullptr);
+    static HealthChangeEvent createWeatherDamageEvent(Pokemon* pokemon, int oldHp, int newHp,
+                                                    WeatherCondition weather);
+    static HealthChangeEvent createStatusDamageEvent(Pokemon* pokemon, int oldHp, int newHp,
+                                                   StatusCondition status);
+    static StatusChangeEvent createStatusChangeEvent(Pokemon* pokemon, StatusCondition oldStatus, 
+                                                   StatusCondition newStatus, int turns, 
+                                                   EventSource source);
+    static MoveUsedEvent createMoveUsedEvent(Pokemon* user, const Move* move, Pokemon* target, 
+                                           bool successful, bool critical, double effectiveness);
+    static MultiTurnMoveEvent createMultiTurnMoveEvent(Pokemon* pokemon, const Move* move, 
+                                                     MultiTurnMoveEvent::Phase phase, 
+                                                     const std::string& message);
 
 private:
     std::vector<ListenerPtr> listeners_;
+    std::vector<ListenerPtr> removedDuringDispatch_;   // Kept alive until dispatch ends
+    size_t tombstones_ = 0;
+    int dispatchDepth_ = 0;
+    uint64_t generation_ = 0;
     
     // Helper to safely notify all listeners
     template<typename EventType, typename NotifyFunc>
     void notifyAll(const EventType& event, NotifyFunc func);
+    void compact();
+};
+
+// Compile-time listener set for hot paths
+//
+// Has the same notify interface as BattleEventManager but calls each listener
+// directly, so handlers can be inlined and an empty set compiles to nothing.
+// Listeners need not derive from BattleEventListener; they only need the
+// handler methods, and are held by reference.
+template<typename... Listeners>
+class StaticEventDispatcher {
+public:
+    explicit StaticEventDispatcher(Listeners&... listeners) : listeners_(listeners...) {}
+    
+    static constexpr bool hasListeners() { return sizeof...(Listeners) > 0; }
+    
+    void notifyHealthChanged(const HealthChangeEvent& event) { each([&](auto& l) { l.onHealthChanged(event); }); }
+    void notifyStatusChanged(const StatusChangeEvent& event) { each([&](auto& l) { l.onStatusChanged(event); }); }
+    void notifyMoveUsed(const MoveUsedEvent& event) { each([&](auto& l) { l.onMoveUsed(event); }); }
+    void notifyWeatherChanged(const WeatherChangeEvent& event) { each([&](auto& l) { l.onWeatherChanged(event); }); }
+    void notifyPokemonSwitch(const PokemonSwitchEvent& event) { each([&](auto& l) { l.onPokemonSwitch(event); }); }
+    void notifyBattleStart(const BattleStartEvent& event) { each([&](auto& l) { l.onBattleStart(event); }); }
+    void notifyBattleEnd(const BattleEndEvent& event) { each([&](auto& l) { l.onBattleEnd(event); }); }
+    void notifyTurnStart(int turnNumber) { each([&](auto& l) { l.onTurnStart(turnNumber); }); }
+    void notifyTurnEnd(int turnNumber) { each([&](auto& l) { l.onTurnEnd(turnNumber); }); }
+    void notifyMultiTurnMove(const MultiTurnMoveEvent& event) { each([&](auto& l) { l.onMultiTurnMove(event); }); }
+    void notifyActionChosen(const ActionChosenEvent& event) { each([&](auto& l) { l.onActionChosen(event); }); }
+
+private:
+    std::tuple<Listeners&...> listeners_;
+    
+    template<typename Func>
+    void each(Func&& func) {
+        std::apply([&](auto&... listener) { (func(listener), ...); }, listeners_);
+    }
 };
 
+// Dispatcher with no listeners; every notification is a no-op
+using NullEventDispatcher = StaticEventDispatcher<>;
+
 // Convenience type aliases
 using EventManager = BattleEventManager;
 using EventListener = BattleEventListener;
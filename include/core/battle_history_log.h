@@ -0,0 +1,176 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "team_builder.h"
+
+/**
+ * @brief Append-only, checksummed battle history log with incremental team statistics
+ *
+ * Battle records are appended to a binary log as length-prefixed, CRC32-checked
+ * frames, so recording a battle costs O(1) regardless of how much history exists.
+ * Per-team statistics are maintained incrementally from running totals and are
+ * periodically snapshotted together with a bounded tail of recent records per team.
+ * Opening the log loads the latest snapshot and streams only the records written
+ * after it. Clearing a team appends a tombstone; compaction rewrites the log without
+ * dead records once they make up a large enough share of the file.
+ *
+ * Log layout:      "PBHL" u32 version, u64 generation, then frames of
+ *                  [u32 length][u32 crc32][payload]
+ * Snapshot layout: "PBHS" u32 version, u64 generation, u64 covered log offset,
+ *                  team accumulators and recent tails, trailing u32 crc32
+ */
+class BattleHistoryLog {
+public:
+    using BattleRecord = TeamBuilder::BattleRecord;
+    using TeamStatistics = TeamBuilder::TeamStatistics;
+
+    /**
+     * @brief Tuning knobs for snapshotting, compaction and in-memory retention
+     */
+    struct Settings {
+        size_t recent_records_per_team;   // Records kept in memory per team for fast history queries
+        size_t snapshot_interval;         // Appends between automatic snapshots (0 = manual only)
+        double compaction_dead_ratio;     // Compact when dead bytes exceed this share of the log
+        uint64_t compaction_min_bytes;    // Never compact logs smaller than this
+
+        Settings()
+            : recent_records_per_team(256), snapshot_interval(4096),
+              compaction_dead_ratio(0.5), compaction_min_bytes(64 * 1024) {}
+    };
+
+    BattleHistoryLog(const std::string& log_path, const std::string& snapshot_path,
+                     const Settings& settings = Settings());
+    ~BattleHistoryLog();
+
+    BattleHistoryLog(const BattleHistoryLog&) = delete;
+    BattleHistoryLog& operator=(const BattleHistoryLog&) = delete;
+
+    /**
+     * @brief Open the log, creating it if missing, and rebuild in-memory state
+     * @param legacy_json_path Optional battle_history.json to import when no log exists yet
+     * @return True if the log is ready for appends
+     */
+    bool open(const std::string& legacy_json_path = "");
+
+    /**
+     * @brief Append a battle record and update its team's statistics
+     * @param record Record to append
+     * @return True if the record was durably handed to the OS
+     */
+    bool append(const BattleRecord& record);
+
+    /**
+     * @brief Drop all history and statistics for a team (appends a tombstone)
+     * @param team_name Team to clear
+     * @return True if the tombstone was written
+     */
+    bool clearTeam(const std::string& team_name);
+
+    /**
+     * @brief Get the incrementally maintained statistics for a team
+     * @param team_name Team to look up
+     * @return Statistics or empty if the team has no recorded battles
+     */
+    std::optional<TeamStatistics> getStatistics(const std::string& team_name) const;
+
+    /**
+     * @brief Get the most recent records for a team
+     * @param team_name Team to look up
+     * @param max_records Maximum records to return (0 for the complete history)
+     * @return Records in chronological order
+     *
+     * Requests that fit in the in-memory tail are served without I/O; larger
+     * requests stream the log from disk.
+     */
+    std::vector<BattleRecord> getRecords(const std::string& team_name, size_t max_records) const;
+
+    /**
+     * @brief Stream every live record in log order
+     * @param visitor Called once per record; records removed by clearTeam() are skipped
+     * @return True if the whole log was read successfully
+     */
+    bool forEachRecord(const std::function<void(const BattleRecord&)>& visitor) const;
+
+    /**
+     * @brief Write a statistics snapshot covering the current end of the log
+     * @return True if the snapshot was written and atomically installed
+     */
+    bool writeSnapshot();
+
+    /**
+     * @brief Rewrite the log without records removed by clearTeam()
+     * @return True if compaction succeeded
+     */
+    bool compact();
+
+    // State queries
+    bool isOpen() const { return is_open; }
+    uint64_t getRecordCount() const { return live_record_count; }
+    uint64_t getLogSizeBytes() const { return log_size; }
+    uint64_t getDeadBytes() const { return dead_bytes; }
+    std::vector<std::string> getTeamNames() const;
+
+private:
+    /**
+     * @brief Running totals from which TeamStatistics are derived
+     */
+    struct TeamAccumulator {
+        uint64_t battles = 0;
+        uint64_t victories = 0;
+        double total_turns = 0.0;
+        double total_effectiveness = 0.0;
+        uint64_t live_bytes = 0;              // Log bytes belonging to this team's live records
+        std::deque<BattleRecord> recent;      // Bounded tail of recent records
+    };
+
+    enum class RecordType : uint8_t { BATTLE = 1, CLEAR_TEAM = 2 };
+
+    std::string log_path;
+    std::string snapshot_path;
+    Settings settings;
+
+    mutable std::mutex log_mutex;
+    std::ofstream log_stream;
+    bool is_open;
+    uint64_t generation;
+    uint64_t log_size;
+    uint64_t dead_bytes;
+    uint64_t live_record_count;
+    uint64_t appends_since_snapshot;
+    std::unordered_map<std::string, TeamAccumulator> teams;
+    std::unordered_map<std::string, uint64_t> team_cleared_at;  // Records before this offset are dead
+
+    // Record encoding
+    static std::vector<uint8_t> encodeBattle(const BattleRecord& record);
+    static std::vector<uint8_t> encodeClear(const std::string& team_name);
+    static bool decodeBattle(const uint8_t* data, size_t length, BattleRecord& record);
+
+    // State maintenance (callers hold log_mutex)
+    void applyBattle(const BattleRecord& record, uint64_t frame_bytes);
+    bool isLive(const std::string& team_name, uint64_t frame_offset) const;
+    void applyClear(const std::string& team_name, uint64_t frame_offset, uint64_t frame_bytes);
+    TeamStatistics buildStatistics(const std::string& team_name, const TeamAccumulator& acc) const;
+    bool appendFrame(const std::vector<uint8_t>& payload);
+    void maybeMaintain();
+
+    // File helpers (callers hold log_mutex)
+    bool createEmptyLog();
+    bool readHeader(std::ifstream& in, uint64_t& header_generation) const;
+    bool loadSnapshot(uint64_t& covered_offset);
+    bool replayFrom(uint64_t offset);
+    bool writeSnapshotLocked();
+    bool compactLocked();
+    bool scanLog(uint64_t start_offset,
+                 const std::function<void(RecordType, const uint8_t*, size_t, uint64_t)>& visitor,
+                 uint64_t* valid_end) const;
+    bool importLegacyJson(const std::string& json_path);
+    bool reopenAppendStream();
+};
@@ -0,0 +1,347 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace BattleLog {
+
+// How much of the battle narrative to write; each level includes the ones above it
+enum class Level : uint8_t {
+    SILENT,     // Nothing
+    SUMMARY,    // Send-outs, faints and the result
+    VERBOSE,    // Every move, hit, status and weather change
+    DEBUG       // Input fallbacks and engine decisions
+};
+
+// Battle narrative messages. Entries ending in a fragment of a line are
+// continued with append() and finished with endLine().
+enum class Message : uint16_t {
+    BLANK_LINE,
+    BATTLE_START,
+    TURN_SEPARATOR,
+    PLAYER_SELECTED,
+    OPPONENT_SELECTED,
+    SELECTION_FAILED,
+    AUTO_SELECTED,
+    ACTION_FAILED,
+    FALLBACK_RECHARGE,
+    FALLBACK_CHARGING,
+    FALLBACK_FIRST_MOVE,
+    SWITCH_FAILED,
+    FALLBACK_FIRST_POKEMON,
+    MUST_RECHARGE_THIS_TURN,
+    MUST_EXECUTE_CHARGE,
+    HEALTH,                     // Fragment
+    HEALTH_STATUS,              // Fragment
+    MUST_RECHARGE,
+    PARALYZED,
+    NO_PP,
+    UNLEASHED,
+    USED_MOVE,
+    SUN_SKIPS_CHARGE,
+    BEGAN_CHARGING,
+    DEFENSE_ROSE_WHILE_CHARGING,
+    MISSED,
+    ONE_HIT_KO,
+    RESTORED_HP,
+    HP_ALREADY_FULL,
+    STATUS_APPLIED,
+    STATUS_FAILED,
+    MOVE_NO_EFFECT,
+    HIT_NUMBER,                 // Fragment
+    DAMAGE_DEALT,               // Fragment
+    BOOSTED_BY_WEATHER,         // Fragment
+    WEAKENED_BY_WEATHER,        // Fragment
+    CRITICAL_HIT,               // Fragment
+    SUPER_EFFECTIVE,            // Fragment
+    NOT_VERY_EFFECTIVE,         // Fragment
+    NO_TYPE_EFFECT,             // Fragment
+    MULTI_HIT_TOTAL,            // Fragment
+    MULTI_HIT_STAB,             // Fragment
+    MULTI_HIT_CRITICAL,         // Fragment
+    STAB,
+    ABSORBED_HP,
+    RECOIL,
+    FLINCHED,
+    ATTACK_ROSE,
+    ATTACK_ROSE_SHARPLY,
+    ATTACK_FELL,
+    DEFENSE_ROSE,
+    DEFENSE_ROSE_SHARPLY,
+    DEFENSE_FELL,
+    SPEED_ROSE_SHARPLY,
+    SPECIAL_ATTACK_ROSE_SHARPLY,
+    SPECIAL_DEFENSE_ROSE_SHARPLY,
+    SPECIAL_STATS_ROSE,
+    ATTACK_AND_SPEED_ROSE,
+    NO_STAT_EFFECT,
+    WEATHER_STATUS,             // Fragment
+    WEATHER_TURNS_LEFT,         // Fragment
+    RAIN_EFFECTS,               // Fragment
+    SUN_EFFECTS,                // Fragment
+    SANDSTORM_EFFECTS,          // Fragment
+    HAIL_EFFECTS,               // Fragment
+    HURT_BY_WEATHER,
+    WEATHER_STOPPED,
+    WEATHER_STARTED,            // Fragment
+    RAIN_STARTED,               // Fragment
+    SUN_STARTED,                // Fragment
+    SANDSTORM_STARTED,          // Fragment
+    HAIL_STARTED,               // Fragment
+    CURRENT_WEATHER,            // Fragment
+    WEATHER_TURNS_REMAINING,    // Fragment
+    RECHARGING,
+    COME_BACK,
+    GO,
+    FAINTED,
+    OPPONENT_FAINTED,
+    SEND_OUT,
+    OPPONENT_SENDS_OUT,
+    PLAYER_WINS,
+    OPPONENT_WINS,
+    DRAW,
+    COUNT
+};
+
+// Level and format of a message; each "{}" takes the next argument
+struct Entry {
+    Level level;
+    const char* format;
+};
+
+inline constexpr Entry kCatalog[] = {
+    {Level::VERBOSE, ""},
+    {Level::SUMMARY, "\n======================================================== BATTLE START ========================================================="},
+    {Level::VERBOSE, "==============================================================================================================================\n"},
+    {Level::SUMMARY, "\nYou have selected {} to send out!"},
+    {Level::SUMMARY, "\nThe opponent has selected {} to send out!"},
+    {Level::VERBOSE, "Failed to get valid Pokemon selection: {}"},
+    {Level::VERBOSE, "Auto-selecting {} as fallback!"},
+    {Level::VERBOSE, "Failed to get valid action selection: {}"},
+    {Level::DEBUG, "Pokemon must recharge - returning recharge indicator."},
+    {Level::DEBUG, "Pokemon is charging - returning charging move index."},
+    {Level::VERBOSE, "Auto-selecting first available move as fallback."},
+    {Level::VERBOSE, "Failed to get valid Pokemon switch selection: {}"},
+    {Level::VERBOSE, "Auto-selecting first available Pokemon as fallback."},
+    {Level::VERBOSE, "\n{} must recharge this turn and cannot act!"},
+    {Level::VERBOSE, "\n{} is charging {} and must execute it!"},
+    {Level::VERBOSE, "{} HP: {}/{}"},
+    {Level::VERBOSE, " ({})"},
+    {Level::VERBOSE, "{} must recharge and cannot move!"},
+    {Level::VERBOSE, "{} is paralyzed and can't move!"},
+    {Level::VERBOSE, "{} tried to use {} but it has no PP left!"},
+    {Level::VERBOSE, "{} unleashed {}!"},
+    {Level::VERBOSE, "{} used {}!"},
+    {Level::VERBOSE, "The sunlight is strong! {} doesn't need to charge!"},
+    {Level::VERBOSE, "{} began charging {}!"},
+    {Level::VERBOSE, "{}'s Defense rose while charging {}!"},
+    {Level::VERBOSE, "{}'s attack missed!"},
+    {Level::VERBOSE, "It's a one-hit KO!"},
+    {Level::VERBOSE, "{} restored {} HP! ({}% heal)"},
+    {Level::VERBOSE, "{}'s HP is already full!"},
+    {Level::VERBOSE, "{} is now {}!"},
+    {Level::VERBOSE, "But it failed! {} is already affected by a status condition."},
+    {Level::VERBOSE, "The move had no effect!"},
+    {Level::VERBOSE, "Hit {}: "},
+    {Level::VERBOSE, "It dealt {} damage!"},
+    {Level::VERBOSE, " (Boosted by {}!)"},
+    {Level::VERBOSE, " (Weakened by {}!)"},
+    {Level::VERBOSE, " A critical hit!"},
+    {Level::VERBOSE, " It's super effective!"},
+    {Level::VERBOSE, " It's not very effective..."},
+    {Level::VERBOSE, " It has no effect!"},
+    {Level::VERBOSE, "Hit {} time(s) for {} total damage!"},
+    {Level::VERBOSE, " {} gets STAB!"},
+    {Level::VERBOSE, " At least one critical hit!"},
+    {Level::VERBOSE, "{} gets STAB!"},
+    {Level::VERBOSE, "{} absorbed {} HP! ({}% of damage dealt)"},
+    {Level::VERBOSE, "{} is hit with recoil! ({}% of damage dealt = {} HP)"},
+    {Level::VERBOSE, "{} flinched!"},
+    {Level::VERBOSE, "{}'s Attack rose!"},
+    {Level::VERBOSE, "{}'s Attack rose sharply!"},
+    {Level::VERBOSE, "{}'s Attack fell!"},
+    {Level::VERBOSE, "{}'s Defense rose!"},
+    {Level::VERBOSE, "{}'s Defense rose sharply!"},
+    {Level::VERBOSE, "{}'s Defense fell!"},
+    {Level::VERBOSE, "{}'s Speed rose sharply!"},
+    {Level::VERBOSE, "{}'s Special Attack rose sharply!"},
+    {Level::VERBOSE, "{}'s Special Defense rose sharply!"},
+    {Level::VERBOSE, "{}'s Special Attack and Special Defense rose!"},
+    {Level::VERBOSE, "{}'s Attack and Speed rose!"},
+    {Level::VERBOSE, "{} used {}, but it had no stat effect!"},
+    {Level::VERBOSE, "Weather: {}"},
+    {Level::VERBOSE, " ({} turns left)"},
+    {Level::VERBOSE, " [Water +50%, Fire -50%]"},
+    {Level::VERBOSE, " [Fire +50%, Water -50%]"},
+    {Level::VERBOSE, " [Sandstorm damage]"},
+    {Level::VERBOSE, " [Hail damage]"},
+    {Level::VERBOSE, "{} is hurt by {}! (-{} HP)"},
+    {Level::VERBOSE, "The {} stopped."},
+    {Level::VERBOSE, "{} started!"},
+    {Level::VERBOSE, " (Water moves boosted 1.5x, Fire moves weakened 0.5x)"},
+    {Level::VERBOSE, " (Fire moves boosted 1.5x, Water moves weakened 0.5x)"},
+    {Level::VERBOSE, " (Non Rock/Ground/Steel types take damage each turn)"},
+    {Level::VERBOSE, " (Non Ice types take damage each turn)"},
+    {Level::VERBOSE, "Current weather: {}"},
+    {Level::VERBOSE, " ({} turns remaining)"},
+    {Level::VERBOSE, "{} is recharging and cannot move!"},
+    {Level::SUMMARY, "\n{}, come back!"},
+    {Level::SUMMARY, "Go, {}!"},
+    {Level::SUMMARY, "\n{} has fainted!"},
+    {Level::SUMMARY, "\nOpponent's {} has fainted!"},
+    {Level::SUMMARY, "\nYou send out {}!"},
+    {Level::SUMMARY, "\nOpponent sends out {}!"},
+    {Level::SUMMARY, "\nAll opponent's Pokémon have fainted! You won the battle!"},
+    {Level::SUMMARY, "\nAll your Pokémon have fainted! You lost the battle."},
+    {Level::SUMMARY, "\nIt's a draw! All Pokémon have fainted."},
+};
+
+static_assert(sizeof(kCatalog) / sizeof(kCatalog[0]) == static_cast<size_t>(Message::COUNT),
+              "Every message needs a catalog entry");
+
+constexpr Level levelOf(Message message) {
+    return kCatalog[static_cast<size_t>(message)].level;
+}
+
+/**
+ * @brief A message argument: text or an integer, formatted without streams
+ */
+class Arg {
+public:
+    Arg(const std::string& text) : text_(text), number_(0), isNumber_(false) {}
+    Arg(const char* text) : text_(text), number_(0), isNumber_(false) {}
+    Arg(int value) : number_(value), isNumber_(true) {}
+    Arg(long long value) : number_(value), isNumber_(true) {}
+
+    void appendTo(std::string& out) const;
+
+private:
+    std::string_view text_;
+    long long number_;
+    bool isNumber_;
+};
+
+/**
+ * @brief Append a catalog message with its arguments substituted
+ */
+void formatMessage(std::string& out, Message message, std::initializer_list<Arg> args);
+
+/**
+ * @brief Writes log lines into a stream without flushing it
+ *
+ * The stream's own buffer collects the lines and flush() hands them to the
+ * terminal or file in one go, so the log shares ordering with anything else
+ * written to the same stream.
+ */
+class StreamSink {
+public:
+    static constexpr bool kEnabled = true;
+
+    explicit StreamSink(std::ostream& stream) : stream_(&stream) {}
+
+    void write(const char* data, size_t size);
+    void flush();
+
+private:
+    std::ostream* stream_;
+};
+
+/**
+ * @brief Discards everything; a logger over it compiles to nothing
+ */
+class NullSink {
+public:
+    static constexpr bool kEnabled = false;
+
+    void write(const char* /*data*/, size_t /*size*/) {}
+    void flush() {}
+};
+
+/**
+ * @brief Leveled logger over a sink
+ *
+ * Messages below the logger's level are skipped before any formatting. With
+ * the NullSink every call is an empty inline function.
+ */
+template<typename Sink>
+class BasicLogger {
+public:
+    template<typename... SinkArgs>
+    explicit BasicLogger(Level level, SinkArgs&&... sinkArgs)
+        : level_(level), sink_(std::forward<SinkArgs>(sinkArgs)...) {}
+
+    bool enabled(Level level) const {
+        if constexpr (!Sink::kEnabled) {
+            return false;
+        } else {
+            return level != Level::SILENT && level <= level_;
+        }
+    }
+
+    void setLevel(Level level) { level_ = level; }
+    Level getLevel() const { return level_; }
+
+    /**
+     * @brief Write a message as a complete line (or finish a line started with append())
+     */
+    template<typename... Args>
+    void log(Message message, const Args&... args) {
+        emit(message, true, args...);
+    }
+
+    /**
+     * @brief Write a message without ending the line
+     */
+    template<typename... Args>
+    void append(Message message, const Args&... args) {
+        emit(message, false, args...);
+    }
+
+    /**
+     * @brief End a line built with append()
+     */
+    void endLine(Level level) {
+        if constexpr (Sink::kEnabled) {
+            if (enabled(level)) {
+                sink_.write("\n", 1);
+            }
+        }
+    }
+
+    /**
+     * @brief Hand everything written so far to the output, once per turn
+     */
+    void flush() {
+        sink_.flush();
+    }
+
+private:
+    Level level_;
+    Sink sink_;
+    std::string line_;   // Reused between messages
+
+    template<typename... Args>
+    void emit(Message message, bool endOfLine, const Args&... args) {
+        if constexpr (Sink::kEnabled) {
+            if (!enabled(levelOf(message))) {
+                return;
+            }
+            line_.clear();
+            formatMessage(line_, message, {Arg(args)...});
+            if (endOfLine) {
+                line_ += '\n';
+            }
+            sink_.write(line_.data(), line_.size());
+        }
+    }
+};
+
+using Logger = BasicLogger<StreamSink>;
+using NullLogger = BasicLogger<NullSink>;
+
+} // namespace BattleLog
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "battle_events.h"
+#include "battle_simulator.h"
+#include "event_ring_buffer.h"
+#include "team.h"
+
+/**
+ * @brief A recorded BattleSimulator battle
+ *
+ * Holds what is needed to play the battle again: the seed and options, both
+ * teams by species and move name, a checksum of their data, and every choice
+ * either side made. The event stream is optional. A battle replays from its
+ * seed and choices alone, so a recording costs a few bytes per turn.
+ *
+ * File layout: "PBRP" u32 version, u64 seed, u8 AI levels, i32 turn limit,
+ *              u32 data checksum, both teams, u32 action count and 4-byte
+ *              actions, u32 event count and 20-byte events, i32 turns,
+ *              u8 outcome, u32 final state hash, trailing u32 crc32
+ */
+struct BattleReplay {
+    static constexpr uint32_t kFormatVersion = 1;
+    static constexpr uint8_t kNoPokemon = 0xFF;
+
+    struct Member {
+        std::string species;
+        std::vector<std::string> moves;
+    };
+
+    /**
+     * @brief Pointer-free EventRecord; Pokemon are (team B ? 8 : 0) | slot
+     */
+    struct Event {
+        BattleEvents::EventType type;
+        BattleEvents::EventSource source;
+        uint8_t subject;            // kNoPokemon if none
+        uint8_t other;
+        uint8_t old_code;
+        uint8_t new_code;
+        uint8_t flags;
+        int8_t move;                // Index in the acting Pokemon's moveset, or -1
+        int32_t old_value;
+        int32_t new_value;
+        int32_t delta;
+    };
+
+    uint64_t seed;
+    AIDifficulty team_a_ai;
+    AIDifficulty team_b_ai;
+    int max_turns;
+    uint32_t data_checksum;         // teamChecksum() of both teams before the battle
+    std::vector<Member> team_a;
+    std::vector<Member> team_b;
+    std::vector<BattleSimulator::Action> actions;
+    std::vector<Event> events;      // Empty unless recorded with events
+    int turns;
+    BattleSimulator::Outcome outcome;
+    uint32_t final_state_hash;      // stateHash() of both teams after the battle
+
+    BattleReplay()
+        : seed(0), team_a_ai(AIDifficulty::MEDIUM), team_b_ai(AIDifficulty::MEDIUM), max_turns(200),
+          data_checksum(0), turns(0), outcome(BattleSimulator::Outcome::DRAW), final_state_hash(0) {}
+
+    /**
+     * @brief Simulator options the battle was played with
+     */
+    BattleSimulator::Options makeOptions() const;
+
+    std::vector<uint8_t> encode() const;
+    static bool decode(const std::vector<uint8_t>& data, BattleReplay& replay);
+    bool save(const std::string& path) const;
+    static bool load(const std::string& path, BattleReplay& replay);
+
+    /**
+     * @brief Fingerprint of the species and move data of both teams
+     *
+     * Differs when the data pack changes a stat, type or move the teams use.
+     */
+    static uint32_t teamChecksum(const Team& team_a, const Team& team_b);
+
+    /**
+     * @brief Hash of the battle state of both teams (HP, status, stages, PP)
+     */
+    static uint32_t stateHash(const Team& team_a, const Team& team_b);
+};
+
+/**
+ * @brief Records a battle from its event stream
+ *
+ * Subscribe to the BattleEventManager passed to
+ * BattleSimulator::simulateInPlace, then call finish() with the result. Only
+ * action events are kept unless record_events is set.
+ */
+class ReplayRecorder : public BattleEvents::BattleEventListener {
+public:
+    /**
+     * @param team_a Team A as it will be played in place (before the battle)
+     * @param team_b Team B as it will be played in place
+     */
+    ReplayRecorder(const Team& team_a, const Team& team_b, const BattleSimulator::Options& options,
+                   bool record_events = false);
+
+    /**
+     * @brief Complete the replay once the battle is over
+     */
+    BattleReplay finish(const BattleSimulator::Result& result);
+
+    /**
+     * @brief Simulate a battle and record it
+     * @param result Receives the battle result if not null
+     */
+    static BattleReplay record(const Team& team_a, const Team& team_b, const BattleSimulator::Options& options,
+                               bool record_events = false, BattleSimulator::Result* result = nullptr);
+
+    void onActionChosen(const BattleEvents::ActionChosenEvent& event) override;
+    void onHealthChanged(const BattleEvents::HealthChangeEvent& event) override;
+    void onStatusChanged(const BattleEvents::StatusChangeEvent& event) override;
+    void onMoveUsed(const BattleEvents::MoveUsedEvent& event) override;
+    void onWeatherChanged(const BattleEvents::WeatherChangeEvent& event) override;
+    void onPokemonSwitch(const BattleEvents::PokemonSwitchEvent& event) override;
+    void onBattleEnd(const BattleEvents::BattleEndEvent& event) override;
+    void onTurnStart(int turnNumber) override;
+
+private:
+    BattleReplay replay;
+    const Team* team_a;
+    const Team* team_b;
+    bool record_events;
+    std::unordered_map<const Pokemon*, uint8_t> pokemon_codes;
+
+    void addEvent(const BattleEvents::EventRecord& record);
+    uint8_t codeOf(const Pokemon* pokemon) const;
+};
+
+/**
+ * @brief Plays a recorded battle back at engine speed
+ *
+ * Recorded choices stand in for the AI, so playback does not depend on the
+ * AI being deterministic. The first seek() plays the battle once and keeps a
+ * keyframe every kKeyframeInterval turns; later seeks restore the nearest
+ * keyframe and play forward from there.
+ */
+class BattleReplayer {
+public:
+    static constexpr int kKeyframeInterval = 10;
+
+    /**
+     * @brief Outcome of verify()
+     */
+    struct Verification {
+        bool data_matches;          // Teams' data checksum equals the recorded one
+        bool playback_matches;      // Recorded choices reproduce the recorded result
+        bool ai_matches;            // Fresh AI choices from the seed reproduce the recorded choices
+        int first_divergent_turn;   // -1 if nothing diverged
+        std::string message;
+
+        bool matches() const { return data_matches && playback_matches && ai_matches; }
+    };
+
+    /**
+     * @brief Rebuild the teams from the data pack by species and move name
+     */
+    explicit BattleReplayer(const BattleReplay& replay);
+
+    /**
+     * @brief Play the replay with teams supplied by the caller
+     */
+    BattleReplayer(const BattleReplay& replay, const Team& team_a, const Team& team_b);
+
+    /**
+     * @brief True if both teams could be built and their data matches the recording
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Play the whole battle from the recorded choices
+     * @param events Optional sink for the battle's events
+     */
+    BattleSimulator::Result run(BattleEvents::BattleEventManager* events = nullptr);
+
+    /**
+     * @brief Move to the end of a turn (0 = before the first turn)
+     * @return False if the battle ended before that turn
+     */
+    bool seek(int turn);
+
+    const Team& getTeamA() const { return current_a; }
+    const Team& getTeamB() const { return current_b; }
+    int getCurrentTurn() const { return current_turn; }
+
+    /**
+     * @brief Check the replay against the data, the engine and the AI
+     */
+    Verification verify();
+
+    const BattleReplay& getReplay() const { return replay; }
+
+private:
+    BattleReplay replay;
+    Team base_a;
+    Team base_b;
+    Team current_a;
+    Team current_b;
+    int current_turn;
+    std::vector<BattleSimulator::Keyframe> keyframes;
+
+    void buildKeyframes();
+};
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "team.h"
+#include "ai_strategy.h"
+#include "battle_events.h"
+#include "weather.h"
+
+/**
+ * @brief Headless AI-vs-AI battle engine for bulk simulations
+ *
+ * Plays a complete battle between two teams without console I/O, delays or
+ * shared random state, so many battles can run concurrently on worker threads.
+ * Both sides are driven by AIStrategy instances, and every random roll comes
+ * from one generator seeded per battle, which makes any battle replayable from
+ * its seed. Damage, accuracy, critical hits, STAB, status conditions,
+ * multi-turn moves, stat-stage moves and weather follow the rules of the
+ * interactive Battle class.
+ */
+class BattleSimulator {
+public:
+    enum class Outcome { TEAM_A_WINS, TEAM_B_WINS, DRAW };
+
+    /**
+     * @brief Simulation configuration
+     */
+    struct Options {
+        AIDifficulty team_a_ai;
+        AIDifficulty team_b_ai;
+        int max_turns;           // Battles still running after this many turns are draws
+        uint64_t seed;
+        bool record_knockouts;   // Fill Result::knockout_log
+
+        Options()
+            : team_a_ai(AIDifficulty::MEDIUM), team_b_ai(AIDifficulty::MEDIUM),
+              max_turns(200), seed(0), record_knockouts(false) {}
+    };
+
+    /**
+     * @brief A Pokemon fainting during a battle
+     */
+    struct Knockout {
+        int turn;
+        bool team_a;             // True if the fainted Pokemon belongs to team A
+        int slot;                // Team slot of the fainted Pokemon
+        int attacker_slot;       // Opposing slot whose move caused it, or -1 (status, weather, recoil)
+
+        Knockout(int turn, bool team_a, int slot, int attacker_slot)
+            : turn(turn), team_a(team_a), slot(slot), attacker_slot(attacker_slot) {}
+    };
+
+    /**
+     * @brief Outcome and summary of a simulated battle
+     */
+    struct Result {
+        Outcome outcome;
+        int turns;
+        int team_a_remaining;        // Pokemon still standing
+        int team_b_remaining;
+        double team_a_hp_fraction;   // Remaining HP over total HP (0.0 - 1.0)
+        double team_b_hp_fraction;
+        std::array<int, 6> team_a_knockouts;   // Opponents knocked out by each team slot's moves
+        std::array<int, 6> team_b_knockouts;
+        std::array<bool, 6> team_a_fainted;    // Team slots that fainted
+        std::array<bool, 6> team_b_fainted;
+        std::array<double, 6> team_a_slot_hp;  // Remaining HP fraction of each team slot
+        std::array<double, 6> team_b_slot_hp;
+        std::vector<Knockout> knockout_log;    // In battle order; only with Options::record_knockouts
+
+        Result()
+            : outcome(Outcome::DRAW), turns(0), team_a_remaining(0), team_b_remaining(0),
+              team_a_hp_fraction(0.0), team_b_hp_fraction(0.0), team_a_knockouts{}, team_b_knockouts{},
+              team_a_fainted{}, team_b_fainted{}, team_a_slot_hp{}, team_b_slot_hp{} {}
+    };
+
+    /**
+     * @brief Outcome of a best-of-N series
+     */
+    struct SeriesResult {
+        int best_of;
+        int games_played;
+        int team_a_wins;
+        int team_b_wins;
+        int draws;
+        Outcome winner;          // DRAW if neither side reached a majority
+        double average_turns;
+
+        SeriesResult()
+            : best_of(0), games_played(0), team_a_wins(0), team_b_wins(0), draws(0),
+              winner(Outcome::DRAW), average_turns(0.0) {}
+    };
+
+    /**
+     * @brief A side's choice for a turn, as reported through onActionChosen
+     *
+     * Forced turns (charging, recharging) choose nothing and are not reported.
+     */
+    using Action = BattleEvents::ActionChosenEvent;
+
+    /**
+     * @brief Snapshot of a battle at the end of a turn, for seeking in replays
+     */
+    struct Keyframe {
+        int turn;
+        Team team_a;
+        Team team_b;
+        int active_a;                // Team slot of the active Pokemon, or -1
+        int active_b;
+        std::mt19937 rng;
+        WeatherCondition weather;
+        int weather_turns;
+        std::array<int, 6> team_a_knockouts;
+        std::array<int, 6> team_b_knockouts;
+        uint32_t team_a_logged_faints;
+        uint32_t team_b_logged_faints;
+        std::vector<Knockout> knockout_log;
+        size_t action_cursor;        // Next scripted action to play
+
+        Keyframe()
+            : turn(0), active_a(-1), active_b(-1), weather(WeatherCondition::NONE), weather_turns(0),
+              team_a_knockouts{}, team_b_knockouts{}, team_a_logged_faints(0), team_b_logged_faints(0),
+              action_cursor(0) {}
+    };
+
+    /**
+     * @brief Scripts and checkpoints a battle for replayInPlace
+     */
+    struct ReplayControl {
+        const std::vector<Action>* actions;   // Choices to play instead of asking the AI; null = AI plays
+        std::vector<Keyframe>* keyframes;     // Receives turn 0 and every keyframe_interval turns, if set
+        int keyframe_interval;
+        const Keyframe* resume_from;          // Start from this keyframe instead of the first turn
+        int stop_after_turn;                  // Stop once this turn has been played; -1 = play to the end
+        bool diverged;                        // Set if a scripted choice did not fit the battle
+        int diverged_turn;                    // Turn of the first unfitting choice, or -1
+
+        ReplayControl()
+            : actions(nullptr), keyframes(nullptr), keyframe_interval(10), resume_from(nullptr),
+              stop_after_turn(-1), diverged(false), diverged_turn(-1) {}
+    };
+
+    /**
+     * @brief Play one battle to completion
+     * @param team_a First team (copied; the original is left untouched)
+     * @param team_b Second team (copied; the original is left untouched)
+     * @param options AI levels, turn limit and seed
+     * @return Battle result
+     *
+     * Thread-safe: concurrent calls share no mutable state.
+     */
+    static Result simulate(const Team& team_a, const Team& team_b, const Options& options = Options());
+
+    /**
+     * @brief Play one battle on the given teams without copying them
+     * @param team_a First team; left in its post-battle state
+     * @param team_b Second team; left in its post-battle state
+     * @param options AI levels, turn limit and seed
+     * @return Battle result
+     *
+     * For loops that reuse a ResettableBattleTeam. The teams must not be
+     * shared with another battle while this one runs.
+     */
+    static Result simulateInPlace(Team& team_a, Team& team_b, const Options& options = Options());
+
+    /**
+     * @brief Play one battle in place, reporting it to an event manager
+     * @param events Receives battle start/end, turns, switches, moves, health,
+     *               status and weather changes; team A is reported as the player
+     *
+     * Produces the same battle as the overload without events for the same seed.
+     */
+    static Result simulateInPlace(Team& team_a, Team& team_b, const Options& options,
+                                  BattleEvents::BattleEventManager& events);
+
+    /**
+     * @brief Play a battle in place from recorded choices
+     * @param team_a First team; replaced by the keyframe's copy when resuming
+     * @param team_b Second team
+     * @param options Options the battle was recorded with
+     * @param control Scripted choices, keyframe capture, resume point and stop turn
+     * @param events Optional sink for the battle's events
+     *
+     * The generator is consumed exactly as in simulateInPlace, so the recorded
+     * choices of a battle reproduce it without running the AI. A choice that
+     * does not fit (wrong turn, side or kind, or an unusable move or switch) is
+     * replaced by the AI's, marks control.diverged and ends the battle after
+     * that turn.
+     */
+    static Result replayInPlace(Team& team_a, Team& team_b, const Options& options, ReplayControl& control,
+                                BattleEvents::BattleEventManager* events = nullptr);
+
+    /**
+     * @brief Play games until one team wins a majority of a best-of-N series
+     * @param team_a First team
+     * @param team_b Second team
+     * @param best_of Series length; drawn games are replayed, up to 2 * best_of games in total
+     * @param options AI levels and turn limit; game seeds are derived from options.seed
+     * @return Series result
+     */
+    static SeriesResult simulateSeries(const Team& team_a, const Team& team_b, int best_of,
+                                       const Options& options = Options());
+};
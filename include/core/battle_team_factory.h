@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "team.h"
+#include "team_builder.h"
+
+/**
+ * @brief Builds battle teams from cached species and move prototypes
+ *
+ * Each species and move is loaded from disk the first time its name is
+ * resolved, and is then referred to by a small integer ID. Building a team
+ * from resolved IDs copies the cached prototypes, so converting the same
+ * TeamBuilder::Team again costs no file I/O and no JSON parsing. Names that
+ * fail to load are remembered too, so they are not retried.
+ *
+ * Thread-safe: resolving and building may run concurrently.
+ */
+class BattleTeamFactory {
+public:
+    using SpeciesId = int;
+    using MoveId = int;
+    static constexpr int kUnresolved = -1;
+
+    /**
+     * @brief Team member with its species and moves resolved to IDs
+     */
+    struct ResolvedMember {
+        SpeciesId species;
+        std::vector<MoveId> moves;      // Only the moves that loaded
+
+        ResolvedMember() : species(kUnresolved) {}
+    };
+
+    /**
+     * @brief Team with every usable member resolved; members that failed to load are dropped
+     */
+    struct ResolvedTeam {
+        std::vector<ResolvedMember> members;
+
+        bool isEmpty() const { return members.empty(); }
+    };
+
+    /**
+     * @brief Process-wide factory shared by the battle systems
+     */
+    static BattleTeamFactory& shared();
+
+    /**
+     * @brief ID of a species, loading it on first use
+     * @return Species ID, or kUnresolved if the name is invalid or fails to load
+     */
+    SpeciesId resolveSpecies(const std::string& name);
+
+    /**
+     * @brief ID of a move, loading it on first use
+     * @return Move ID, or kUnresolved if the name is invalid or fails to load
+     */
+    MoveId resolveMove(const std::string& name);
+
+    /**
+     * @brief Resolve every member of a team builder team
+     */
+    ResolvedTeam resolve(const TeamBuilder::Team& team);
+
+    /**
+     * @brief Build a battle-ready team from resolved IDs (no file I/O)
+     */
+    Team build(const ResolvedTeam& team) const;
+
+    /**
+     * @brief Resolve and build in one step
+     */
+    Team build(const TeamBuilder::Team& team);
+
+    /**
+     * @brief Cached species prototype, or nullptr for an unknown ID (valid until clear())
+     */
+    const Pokemon* getSpecies(SpeciesId id) const;
+
+    /**
+     * @brief Cached move prototype, or nullptr for an unknown ID (valid until clear())
+     */
+    const Move* getMove(MoveId id) const;
+
+    size_t getSpeciesCount() const;
+    size_t getMoveCount() const;
+
+    /**
+     * @brief Forget every cached prototype, e.g. after the data files change
+     */
+    void clear();
+
+private:
+    mutable std::shared_mutex mutex;
+    std::deque<Pokemon> species;        // Deques keep prototypes in place as the cache grows
+    std::deque<Move> moves;
+    std::unordered_map<std::string, SpeciesId> species_ids;
+    std::unordered_map<std::string, MoveId> move_ids;
+};
@@ -7,7 +7,10 @@
 #include <optional>
 #include "team_builder.h"
 #include "tournament_manager.h"
+#include "progress_journal.h"
+#include "leaderboard_index.h"
 #include "ai_factory.h"
+#include "battle_simulator.h"
 
 // Forward declaration
 class Battle;
@@ -97,9 +100,23 @@ public:
         std::vector<std::string> strategic_notes;
         std::string mvp_pokemon;        // Most valuable Pokemon
         
+        uint64_t battle_seed;           // Replays the battle with BattleSimulator
+        
         ChampionshipBattleResult() 
             : opponent_position(0), victory(false), turns_taken(0), 
-              performance_score(0.0), team_needs_healing(false) {}
+              performance_score(0.0), team_needs_healing(false), battle_seed(0) {}
+    };
+
+    /**
+     * @brief Simulated best-of-N estimate against one championship opponent
+     */
+    struct LadderEstimate {
+        std::string opponent_name;
+        int opponent_position;
+        std::string difficulty_level;
+        BattleSimulator::SeriesResult series;
+        
+        LadderEstimate() : opponent_position(0) {}
     };
 
     /**
@@ -119,6 +136,7 @@ public:
         std::string base_difficulty;            // Starting difficulty level
         bool progressive_difficulty;            // Increase difficulty through Elite Four
         std::string champion_difficulty;        // Champion-specific difficulty
+        std::string player_ai_difficulty;       // AI that plays the player's team in battles
         
         // Run management  
         int max_championship_attempts;          // Maximum attempts per run (0 = unlimited)
@@ -134,7 +152,7 @@ public:
             : require_sequential_battles(true), require_elite_four_completion(true),
               allow_healing_between_elite_four(true), force_healing_before_champion(true),
               allow_item_usage(false), base_difficulty("Hard"), progressive_difficulty(true),
-              champion_difficulty("Expert"), max_championship_attempts(0),
+              champion_difficulty("Expert"), player_ai_difficulty("Hard"), max_championship_attempts(0),
               save_run_progress(true), allow_run_restart(true),
               track_detailed_statistics(true), time_bonus_multiplier(1.0),
               consecutive_victory_bonus(1.5) {}
@@ -193,6 +211,17 @@ public:
     ChampionshipBattleResult executeBattle(const std::string& player_name, 
                                           const TeamBuilder::Team& player_team);
 
+    /**
+     * @brief Estimate a whole championship ladder with simulated best-of-N series
+     * @param player_team Player's team, played as team A
+     * @param best_of Series length against each opponent
+     * @param seed Seed of the first series; later opponents use derived seeds
+     * @return One estimate per Elite Four member and the Champion, in ladder order.
+     *         Nothing is recorded; opponents without usable teams are skipped
+     */
+    std::vector<LadderEstimate> estimateLadder(const TeamBuilder::Team& player_team,
+                                               int best_of = 5, uint64_t seed = 0) const;
+
     /**
      * @brief Record the result of a championship battle
      * @param player_name Name of the player
@@ -278,6 +307,15 @@ public:
     std::vector<std::pair<std::string, double>> getChampionshipLeaderboard(
         const std::string& sort_by = "score", int max_results = 10) const;
 
+    /**
+     * @brief Get a player's position on the championship leaderboard
+     * @param player_name Name of the player
+     * @param sort_by Sorting criteria ("time", "attempts", "score")
+     * @return 1-based rank, or 0 if the player has no championship stats
+     */
+    int getPlayerChampionshipRank(const std::string& player_name,
+                                  const std::string& sort_by = "score") const;
+
     // Configuration Management
     /**
      * @brief Get current championship settings
@@ -289,17 +327,17 @@ public:
      * @brief Update championship settings
      * @param settings New championship configuration
      */
-    void setSettings(const ChampionshipSettings& settings) { championship_settings = settings; }
+    void setSettings(const ChampionshipSettings& settings);
 
     // Data Persistence
     /**
-     * @brief Save championship data to file
+     * @brief Journal championship data for every player and make it durable
      * @return True if save successful
      */
     bool saveChampionshipData() const;
 
     /**
-     * @brief Load championship data from file
+     * @brief Load championship data from the progress journal
      * @return True if load successful
      */
     bool loadChampionshipData();
@@ -343,12 +381,22 @@ private:
     // Championship statistics
     std::unordered_map<std::string, std::unordered_map<std::string, double>> player_championship_stats;
     
+    // Leaderboards, updated only when a player's stats change
+    LeaderboardIndex time_leaderboard{LeaderboardIndex::Order::LOWER_IS_BETTER};
+    LeaderboardIndex attempts_leaderboard{LeaderboardIndex::Order::LOWER_IS_BETTER};
+    LeaderboardIndex score_leaderboard{LeaderboardIndex::Order::HIGHER_IS_BETTER};
+    
+    // Crash-safe persistence; tracks how much of each history is already journaled
+    std::unique_ptr<ProgressJournal> journal;
+    mutable std::unordered_map<std::string, size_t> journaled_history_count;
+    
     // Initialization and configuration
     void initializeChampionshipOpponents();
     void loadChampionshipConfiguration();
     
     // Battle execution helpers
-    std::unique_ptr<TeamBuilder::Team> createOpponentTeam(const ChampionshipOpponent& opponent);
+    std::unique_ptr<TeamBuilder::Team> createOpponentTeam(const ChampionshipOpponent& opponent) const;
+    BattleSimulator::Options createBattleOptions(const std::string& difficulty_level) const;
     std::string calculateBattleDifficulty(int position) const;
     
     // Progress tracking helpers
@@ -365,10 +413,17 @@ private:
     double calculateChampionshipScore(const std::string& player_name) const;
     double calculateCompletionTime(const ChampionshipRun& run) const;
     void updatePlayerChampionshipStats(const std::string& player_name);
+    void refreshLeaderboards(const std::string& player_name);
+    void rebuildLeaderboards();
+    const LeaderboardIndex& findLeaderboard(const std::string& sort_by) const;
     
     // Data persistence helpers
     std::string getChampionshipDataFilePath() const;
+    std::string getChampionshipDataDirectory() const;
     bool ensureChampionshipDataDirectoryExists() const;
+    bool savePlayerChampionshipData(const std::string& player_name) const;
+    void journalPlayerChampionshipData(const std::string& player_name) const;
+    bool importLegacyChampionshipData();
     
     // Validation helpers
     bool isValidRun(const ChampionshipRun& run) const;
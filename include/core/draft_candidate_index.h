@@ -0,0 +1,131 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "type_mask.h"
+
+/**
+ * @brief Incrementally maintained pick pool of a draft session
+ *
+ * Holds one entry per species in the session's pool with its type mask,
+ * legendary flag and a strength score, plus:
+ *  - an availability bitset (bans and picks clear a bit),
+ *  - per-player type counters, type masks and legendary counts,
+ *  - the species ordered by strength, best first.
+ *
+ * Bans and picks update it in O(1). Pick legality checks are O(1) (a species
+ * has at most two types). suggest() walks the strength order and stops once
+ * no later species can beat the current top results, so it usually reads
+ * only a handful of entries.
+ */
+class DraftCandidateIndex {
+public:
+    /**
+     * @brief One species in the draft pool
+     */
+    struct Candidate {
+        std::string name;
+        TypeMask types;
+        bool legendary;
+        double strength;       // Static ranking score, higher is better
+
+        Candidate() : types(0), legendary(false), strength(0.0) {}
+        Candidate(const std::string& candidate_name, TypeMask candidate_types, bool is_legendary, double score)
+            : name(candidate_name), types(candidate_types), legendary(is_legendary), strength(score) {}
+    };
+
+    /**
+     * @brief Draft rules checked by canPick() and suggest()
+     */
+    struct Limits {
+        int max_legendaries;
+        int max_same_type;
+
+        Limits() : max_legendaries(1), max_same_type(2) {}
+        Limits(int legendaries, int same_type) : max_legendaries(legendaries), max_same_type(same_type) {}
+    };
+
+    /// Extra score for a candidate, e.g. its simulated win rate against the opponents' picks
+    using BonusFunction = std::function<double(int candidate)>;
+
+    DraftCandidateIndex() = default;
+
+    /**
+     * @brief Reset the index to a new pool
+     * @param candidates Every species in the pool, all initially available
+     * @param player_count Number of drafting players
+     */
+    void build(std::vector<Candidate> candidates, int player_count);
+
+    bool isBuilt() const { return built; }
+    size_t size() const { return candidates.size(); }
+    size_t availableCount() const { return available_count; }
+    const Candidate& getCandidate(int id) const { return candidates[id]; }
+
+    /**
+     * @brief Candidate id of a species, or -1 if it is not in the pool
+     */
+    int find(const std::string& name) const;
+
+    bool isAvailable(int id) const { return (available[id >> 6] >> (id & 63)) & 1u; }
+
+    /**
+     * @brief Take a species out of the pool (ban or pick)
+     * @return False if it was not available
+     */
+    bool remove(int id);
+
+    /**
+     * @brief Record that a player picked a species (does not change availability)
+     */
+    void addToTeam(int player, int id);
+
+    /**
+     * @brief Whether a player may pick a species under the given limits
+     */
+    bool canPick(int player, int id, const Limits& limits) const;
+
+    TypeMask getTeamTypes(int player) const { return players[player].types; }
+
+    /**
+     * @brief Ids of available species in pool order
+     */
+    std::vector<int> getAvailable() const;
+
+    /**
+     * @brief Best legal picks for a player
+     *
+     * Score = strength + coverage_weight * (number of types new to the team)
+     *         + bonus(candidate).
+     *
+     * @param player Player to suggest for
+     * @param count Number of suggestions
+     * @param limits Draft rules a suggestion must satisfy
+     * @param coverage_weight Score per new type
+     * @param bonus Optional extra score per candidate, within [0, max_bonus]
+     * @param max_bonus Upper bound of bonus, used to stop the scan early
+     * @return Candidate ids with their scores, best first
+     */
+    std::vector<std::pair<int, double>> suggest(int player, size_t count, const Limits& limits,
+                                                double coverage_weight, const BonusFunction& bonus = nullptr,
+                                                double max_bonus = 0.0) const;
+
+private:
+    struct PlayerState {
+        std::array<uint8_t, TypeMasks::kTypeCount> type_counts{};
+        TypeMask types = 0;
+        int legendaries = 0;
+    };
+
+    bool built = false;
+    std::vector<Candidate> candidates;
+    std::unordered_map<std::string, int> ids;
+    std::vector<uint64_t> available;
+    size_t available_count = 0;
+    std::vector<int> by_strength;
+    std::vector<PlayerState> players;
+};
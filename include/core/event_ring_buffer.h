@@ -0,0 +1,149 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include "battle_events.h"
+
+namespace BattleEvents {
+
+enum class EventType : uint8_t {
+    HEALTH_CHANGED,
+    STATUS_CHANGED,
+    MOVE_USED,
+    WEATHER_CHANGED,
+    POKEMON_SWITCH,
+    BATTLE_START,
+    BATTLE_END,
+    TURN_START,
+    TURN_END,
+    MULTI_TURN_MOVE,
+    ACTION_CHOSEN
+};
+
+/**
+ * @brief Fixed-size copy of any battle event, for queues and files
+ *
+ * Enum fields are stored as their underlying values and every reference is a
+ * plain pointer, so records are trivially copyable. The pointers are only
+ * meaningful while the battle that produced them is alive. Multi-turn move
+ * records carry no display message.
+ */
+struct EventRecord {
+    uint64_t sequence;          // Publish order, assigned by the publisher
+    EventType type;
+    EventSource source;
+    uint8_t old_code;           // Old status/weather, phase, winner or action kind
+    uint8_t new_code;           // New status/weather
+    uint8_t flags;              // kFlag* bits
+    int32_t old_value;          // Old HP or action index
+    int32_t new_value;          // New HP, turn number, turns remaining or total turns
+    int32_t delta;              // Damage (negative for healing)
+    float effectiveness;
+    Pokemon* pokemon;           // Subject: damaged, statused, switched-out or user
+    Pokemon* other;             // Target, switched-in or AI lead
+    const Pokemon* source_pokemon;
+    const Move* move;
+
+    static constexpr uint8_t kFlagSuccessful = 1;
+    static constexpr uint8_t kFlagCritical = 2;
+    static constexpr uint8_t kFlagPlayer = 4;
+};
+
+static_assert(std::is_trivially_copyable<EventRecord>::value, "EventRecord must stay POD");
+
+EventRecord makeRecord(const HealthChangeEvent& event);
+EventRecord makeRecord(const StatusChangeEvent& event);
+EventRecord makeRecord(const MoveUsedEvent& event);
+EventRecord makeRecord(const WeatherChangeEvent& event);
+EventRecord makeRecord(const PokemonSwitchEvent& event);
+EventRecord makeRecord(const BattleStartEvent& event);
+EventRecord makeRecord(const BattleEndEvent& event);
+EventRecord makeRecord(const MultiTurnMoveEvent& event);
+EventRecord makeRecord(const ActionChosenEvent& event);
+EventRecord makeTurnRecord(EventType type, int turnNumber);
+
+/**
+ * @brief Rebuild the event a record was made from and hand it to a listener
+ */
+void dispatchRecord(const EventRecord& record, BattleEventListener& listener);
+
+/**
+ * @brief Bounded lock-free queue of event records
+ *
+ * Any number of threads may push and pop concurrently (each cell carries a
+ * sequence number, so producers and consumers never take a lock). The
+ * policy decides what a push does when the queue is full:
+ *  - BLOCK waits for space, so nothing is lost but producers run at consumer speed
+ *  - DROP_OLDEST evicts the oldest queued record to make room
+ *  - SAMPLE keeps one in sample_rate records once the queue is half full, and
+ *    drops the new record when it is full
+ * Under DROP_OLDEST and SAMPLE a push never waits.
+ */
+class EventRingBuffer {
+public:
+    enum class Policy { BLOCK, DROP_OLDEST, SAMPLE };
+
+    /**
+     * @param capacity Rounded up to a power of two (at least 2)
+     * @param policy Behaviour when full
+     * @param sample_rate Keep one record in this many under SAMPLE pressure
+     */
+    explicit EventRingBuffer(size_t capacity, Policy policy = Policy::BLOCK, uint32_t sample_rate = 8);
+
+    EventRingBuffer(const EventRingBuffer&) = delete;
+    EventRingBuffer& operator=(const EventRingBuffer&) = delete;
+
+    /**
+     * @brief Queue a record according to the policy
+     * @return false if the record was dropped (or the buffer is closed)
+     */
+    bool push(const EventRecord& record);
+
+    /**
+     * @brief Queue a record only if there is room
+     */
+    bool tryPush(const EventRecord& record);
+
+    /**
+     * @brief Take the oldest record
+     * @return false if the queue is empty
+     */
+    bool pop(EventRecord& record);
+
+    /**
+     * @brief Release blocked producers; later pushes are dropped
+     */
+    void close();
+    void reopen() { closed.store(false, std::memory_order_release); }
+    bool isClosed() const { return closed.load(std::memory_order_acquire); }
+
+    size_t size() const;        // Approximate while other threads are active
+    size_t getCapacity() const { return mask + 1; }
+    Policy getPolicy() const { return policy; }
+
+    /**
+     * @brief Records lost to the policy: evicted, sampled out, or pushed after close()
+     */
+    uint64_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        EventRecord record;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    size_t mask;
+    Policy policy;
+    uint32_t sample_rate;
+    alignas(64) std::atomic<size_t> enqueue_pos;
+    alignas(64) std::atomic<size_t> dequeue_pos;
+    alignas(64) std::atomic<uint64_t> dropped;
+    std::atomic<uint64_t> sample_counter;
+    std::atomic<bool> closed;
+};
+
+} // namespace BattleEvents
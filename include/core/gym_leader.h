@@ -7,7 +7,10 @@
 #include <optional>
 #include "team_builder.h"
 #include "tournament_manager.h"
+#include "progress_journal.h"
+#include "leaderboard_index.h"
 #include "ai_factory.h"
+#include "battle_simulator.h"
 
 // Forward declarations
 class Battle;
@@ -123,13 +126,16 @@ public:
         std::unordered_map<std::string, double> type_matchup_effectiveness;
         std::vector<std::string> missed_opportunities;   // Strategic mistakes
         std::vector<std::string> good_decisions;         // Strategic successes
+        std::vector<std::string> key_moments;            // Knockouts in battle order
         
         // Post-battle team status
         std::vector<std::string> fainted_pokemon;
         bool needs_healing;
         
+        uint64_t battle_seed;                            // Replays the battle with BattleSimulator
+        
         GymBattleResult() 
-            : victory(false), turns_taken(0), performance_score(0.0), needs_healing(false) {}
+            : victory(false), turns_taken(0), performance_score(0.0), needs_healing(false), battle_seed(0) {}
     };
 
     /**
@@ -146,6 +152,7 @@ public:
         std::string base_difficulty;        // Default gym difficulty
         bool scale_with_badges;             // Increase difficulty with badge count
         bool adaptive_difficulty;           // Adjust based on player performance
+        std::string player_ai_difficulty;   // AI that plays the player's team in battles
         
         // Badge settings
         bool award_badges_immediately;      // Award badges right after victory
@@ -161,6 +168,7 @@ public:
             : allow_multiple_attempts(true), max_attempts_per_gym(0),
               heal_between_attempts(true), track_detailed_stats(true),
               base_difficulty("Medium"), scale_with_badges(true), adaptive_difficulty(false),
+              player_ai_difficulty("Medium"),
               award_badges_immediately(true), allow_badge_rechallenges(true),
               track_post_badge_battles(false), enforce_type_restrictions(true),
               min_type_pokemon(4), allow_dual_types(true) {}
@@ -210,6 +218,21 @@ public:
                                       const std::string& gym_leader_name,
                                       const TeamBuilder::Team& player_team);
 
+    /**
+     * @brief Estimate a gym challenge with a simulated best-of-N series
+     * @param player_name Name of the challenging player (sets the gym difficulty)
+     * @param gym_leader_name Name of the gym leader
+     * @param player_team Player's team, played as team A
+     * @param best_of Series length
+     * @param seed Seed of the series
+     * @return Series result; nothing is recorded. Empty (no games played) if the
+     *         gym leader is unknown or either team has no usable Pokemon
+     */
+    BattleSimulator::SeriesResult estimateGymChallenge(const std::string& player_name,
+                                                       const std::string& gym_leader_name,
+                                                       const TeamBuilder::Team& player_team,
+                                                       int best_of = 5, uint64_t seed = 0) const;
+
     /**
      * @brief Check if player can challenge a specific gym leader
      * @param player_name Name of the player
@@ -360,6 +383,17 @@ public:
         const std::string& sort_by = "score", 
         int max_results = 10) const;
 
+    /**
+     * @brief Get a player's position on a gym leaderboard
+     * @param player_name Name of the player
+     * @param gym_leader_name Name of the gym leader
+     * @param sort_by Sorting criteria ("attempts", "score", "time")
+     * @return 1-based rank, or 0 if the player hasn't challenged this gym
+     */
+    int getPlayerGymRank(const std::string& player_name,
+                         const std::string& gym_leader_name,
+                         const std::string& sort_by = "score") const;
+
     // Configuration Management
     /**
      * @brief Get current gym system settings
@@ -375,13 +409,13 @@ public:
 
     // Data Persistence
     /**
-     * @brief Save gym data to file
+     * @brief Journal gym data changes for every player and make them durable
      * @return True if save successful
      */
     bool saveGymData() const;
 
     /**
-     * @brief Load gym data from file
+     * @brief Load gym data from the progress journal
      * @return True if load successful
      */
     bool loadGymData();
@@ -425,13 +459,26 @@ private:
     std::unordered_map<std::string, std::unordered_map<std::string, GymProgress>> player_gym_progress;
     std::unordered_map<std::string, std::vector<GymBattleResult>> player_gym_history;
     
+    // Per-gym leaderboards, updated only when a player's progress at that gym changes
+    struct GymLeaderboards {
+        LeaderboardIndex by_score{LeaderboardIndex::Order::HIGHER_IS_BETTER};
+        LeaderboardIndex by_attempts{LeaderboardIndex::Order::LOWER_IS_BETTER};
+        LeaderboardIndex by_time{LeaderboardIndex::Order::LOWER_IS_BETTER};
+    };
+    std::unordered_map<std::string, GymLeaderboards> gym_leaderboards;
+    
+    // Crash-safe persistence; tracks how much of each history is already journaled
+    std::unique_ptr<ProgressJournal> journal;
+    mutable std::unordered_map<std::string, size_t> journaled_history_count;
+    
     // Initialization and configuration
     void initializeGymLeaders();
     void initializeBadgeTemplates();
     void loadGymConfiguration();
     
     // Battle execution helpers
-    std::unique_ptr<TeamBuilder::Team> createGymLeaderTeam(const GymLeaderInfo& gym_leader);
+    std::unique_ptr<TeamBuilder::Team> createGymLeaderTeam(const GymLeaderInfo& gym_leader) const;
+    BattleSimulator::Options createBattleOptions(const std::string& difficulty_level) const;
     std::string calculateGymDifficulty(const std::string& gym_leader_name, 
                                       const std::string& player_name) const;
     
@@ -455,10 +502,15 @@ private:
     // Statistics calculation helpers
     double calculateGymScore(const GymBattleResult& result) const;
     void updateGymStatistics(const std::string& player_name, const std::string& gym_leader_name);
+    void rebuildGymLeaderboards();
     
     // Data persistence helpers
     std::string getGymDataFilePath() const;
+    std::string getGymDataDirectory() const;
     bool ensureGymDataDirectoryExists() const;
+    bool savePlayerGymData(const std::string& player_name) const;
+    void journalPlayerGymData(const std::string& player_name) const;
+    bool importLegacyGymData();
     
     // Validation helpers
     bool isValidGymLeaderName(const std::string& gym_leader_name) const;
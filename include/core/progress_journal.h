@@ -0,0 +1,158 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Crash-safe write-ahead journal for keyed progress state
+ *
+ * Shared persistence layer for tournament, gym and championship progress. Each
+ * mutation is appended to the active WAL segment as a small checksummed record
+ * (set a key, append an item to a key's list, erase a key prefix), so the cost of
+ * saving is proportional to the change rather than to the number of players.
+ *
+ * commit() is a group-commit barrier: concurrent committers share one write and
+ * one fdatasync. A background thread checkpoints the materialized state into a
+ * snapshot (temp file, fsync, rename) once the WAL grows past a threshold, then
+ * deletes the segments the snapshot covers. Recovery loads the snapshot and
+ * replays the remaining segments, discarding a torn tail left by a crash.
+ *
+ * Files for journal "<name>" in <directory>:
+ *   <name>.snapshot        "PJSN" u32 version, u64 covered segment, entries, u32 crc32
+ *   <name>.wal.<segment>   frames of [u32 length][u32 crc32][op, key, value]
+ */
+class ProgressJournal {
+public:
+    /**
+     * @brief Materialized value stored under a key
+     */
+    struct Entry {
+        std::string value;                  // Latest value written with put()
+        std::vector<std::string> items;     // Items accumulated with appendItem()
+    };
+
+    /**
+     * @brief Durability and checkpointing configuration
+     */
+    struct Settings {
+        bool sync_on_commit;                // fdatasync on every commit (off = OS-buffered)
+        uint64_t checkpoint_wal_bytes;      // Checkpoint once the WAL grows past this size
+        bool background_checkpoint;         // Checkpoint on a worker thread instead of inline
+
+        Settings()
+            : sync_on_commit(true), checkpoint_wal_bytes(1024 * 1024),
+              background_checkpoint(true) {}
+    };
+
+    ProgressJournal(const std::string& directory, const std::string& name,
+                    const Settings& settings = Settings());
+    ~ProgressJournal();
+
+    ProgressJournal(const ProgressJournal&) = delete;
+    ProgressJournal& operator=(const ProgressJournal&) = delete;
+
+    /**
+     * @brief Recover state from the snapshot and WAL and start accepting records
+     * @return True if the journal is ready
+     */
+    bool open();
+
+    // Mutations (buffered until commit())
+    bool put(const std::string& key, const std::string& value);
+    bool appendItem(const std::string& key, const std::string& item);
+    bool erasePrefix(const std::string& prefix);
+
+    /**
+     * @brief Make every mutation recorded so far durable
+     * @return True if the records reached the WAL (and disk, when syncing)
+     */
+    bool commit();
+
+    /**
+     * @brief Write a snapshot of the current state and drop covered WAL segments
+     * @return True if the checkpoint completed
+     */
+    bool checkpoint();
+
+    /**
+     * @brief Look up a single key
+     * @param key Key to read
+     * @return Entry or empty if the key does not exist
+     */
+    std::optional<Entry> get(const std::string& key) const;
+
+    /**
+     * @brief Visit every key starting with a prefix in key order
+     * @param prefix Key prefix ("" for all keys)
+     * @param visitor Called once per matching key
+     */
+    void forEachWithPrefix(const std::string& prefix,
+                           const std::function<void(const std::string&, const Entry&)>& visitor) const;
+
+    /**
+     * @brief Build a key for one field of an owner (e.g. a player's badges)
+     *
+     * Keys of the same owner share ownerPrefix(owner), so erasePrefix() on it
+     * removes everything stored for that owner without touching similar names.
+     */
+    static std::string makeKey(const std::string& owner, const std::string& field);
+    static std::string ownerPrefix(const std::string& owner);
+    static std::pair<std::string, std::string> splitKey(const std::string& key);
+
+    // State queries
+    bool isOpen() const { return is_open; }
+    bool isEmpty() const;
+    uint64_t getWalBytes() const;
+    uint64_t getCommittedSequence() const;
+
+private:
+    enum class OpType : uint8_t { PUT = 1, APPEND_ITEM = 2, ERASE_PREFIX = 3 };
+
+    std::string directory;
+    std::string name;
+    Settings settings;
+
+    // State and WAL bookkeeping guarded by state_mutex
+    mutable std::mutex state_mutex;
+    std::map<std::string, Entry> entries;
+    std::vector<uint8_t> pending;           // Framed records not yet written
+    uint64_t next_sequence;                 // Sequence assigned to the next record
+    uint64_t durable_sequence;              // Highest sequence written (and synced, if enabled)
+    bool flush_in_progress;
+    std::condition_variable flush_done;
+    int wal_fd;
+    uint64_t wal_segment;
+    uint64_t wal_bytes;
+    bool is_open;
+
+    // Background checkpointing
+    std::mutex checkpoint_mutex;            // Serializes checkpoints
+    std::thread checkpoint_thread;
+    std::condition_variable checkpoint_wakeup;
+    bool checkpoint_requested;
+    bool stopping;
+
+    // Record helpers (callers hold state_mutex)
+    bool record(OpType op, const std::string& key, const std::string& value);
+    void apply(OpType op, const std::string& key, const std::string& value);
+    bool flushPendingLocked(std::unique_lock<std::mutex>& lock, uint64_t target);
+
+    // File helpers
+    std::string snapshotPath() const;
+    std::string segmentPath(uint64_t segment) const;
+    std::vector<uint64_t> listSegments() const;
+    bool loadSnapshot(uint64_t& covered_segment);
+    bool replaySegment(uint64_t segment, bool is_last);
+    bool openSegment(uint64_t segment);
+    void closeSegment();
+    bool writeSnapshotFile(const std::map<std::string, Entry>& state, uint64_t covered_segment) const;
+    void checkpointLoop();
+};
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class BattleHistoryLog;
+
+/**
+ * @brief Glicko-2 rating engine for teams, players and AI configurations
+ *
+ * Results are queued into the current rating period and applied together when
+ * the period closes, as Glicko-2 intends. Rated entities are interned to dense
+ * ids and their parameters live in flat arrays, so closing a period is two
+ * linear passes: one over the queued games accumulating each entity's variance
+ * and improvement sums, one over the entities solving for the new volatility.
+ * Entities without games in a period only have their deviation widened.
+ *
+ * Ratings are reported on the familiar Glicko scale (1500 / 350 by default).
+ *
+ * File layout: "PGRT" u32 version, u64 periods, u64 source watermark,
+ *              entities (name, mu, phi, sigma, games), queued games,
+ *              trailing u32 crc32
+ */
+class RatingEngine {
+public:
+    /**
+     * @brief Rating of a single entity on the Glicko scale
+     */
+    struct Rating {
+        double rating;
+        double deviation;
+        double volatility;
+        uint32_t games;          // Rated games across all closed periods
+
+        Rating() : rating(1500.0), deviation(350.0), volatility(0.06), games(0) {}
+    };
+
+    /**
+     * @brief A queued game between two interned entities
+     */
+    struct GameResult {
+        uint32_t player;
+        uint32_t opponent;
+        float score;             // From the player's side: 1 win, 0.5 draw, 0 loss
+    };
+
+    /**
+     * @brief Glicko-2 system constants and period batching
+     */
+    struct Settings {
+        double tau;                 // Constrains volatility changes (0.3 - 1.2)
+        double initial_rating;
+        double initial_deviation;
+        double initial_volatility;
+        size_t games_per_period;    // Close the period automatically after this many games (0 = manual)
+
+        Settings()
+            : tau(0.5), initial_rating(1500.0), initial_deviation(350.0),
+              initial_volatility(0.06), games_per_period(0) {}
+    };
+
+    explicit RatingEngine(const Settings& settings = Settings());
+
+    /**
+     * @brief Get the id of an entity, registering it if unknown
+     * @param name Entity name
+     * @return Dense id usable with addResults()
+     */
+    uint32_t getEntityId(const std::string& name);
+
+    /**
+     * @brief Look up an entity without registering it
+     * @param name Entity name
+     * @return Id or empty if the entity has never been rated
+     */
+    std::optional<uint32_t> findEntityId(const std::string& name) const;
+
+    const std::string& getEntityName(uint32_t id) const { return names[id]; }
+
+    /**
+     * @brief Queue one game for the current rating period
+     * @param player Entity the score refers to
+     * @param opponent Opposing entity
+     * @param score 1 for a player win, 0.5 for a draw, 0 for a loss
+     * @return True if the game closed a rating period
+     */
+    bool addResult(const std::string& player, const std::string& opponent, double score);
+
+    /**
+     * @brief Queue a stream of games between already interned entities
+     * @param results Games to queue, in order
+     * @return Number of rating periods closed while queueing
+     */
+    size_t addResults(const std::vector<GameResult>& results);
+
+    /**
+     * @brief Queue the live records of a battle history log
+     * @param log Open battle history log
+     * @param skip_records Leading records already rated (see getSourceWatermark())
+     * @return Number of rating periods closed while queueing
+     *
+     * Teams are rated against their recorded opponent, or against the AI
+     * difficulty when no opponent team was recorded.
+     */
+    size_t ingestBattleHistory(const BattleHistoryLog& log, uint64_t skip_records = 0);
+
+    /**
+     * @brief Apply all queued games and start a new rating period
+     */
+    void closeRatingPeriod();
+
+    /**
+     * @brief Get an entity's rating as of the last closed period
+     * @param name Entity name
+     * @return Rating or empty if the entity is unknown
+     */
+    std::optional<Rating> getRating(const std::string& name) const;
+    Rating getRating(uint32_t id) const;
+
+    /**
+     * @brief Seed an entity's rating, e.g. a known AI configuration's strength
+     * @param name Entity name (registered if unknown)
+     * @param rating Rating on the Glicko scale
+     */
+    void setRating(const std::string& name, const Rating& rating);
+
+    /**
+     * @brief Rating minus two deviations; a fair sort key for leaderboards
+     */
+    static double conservativeRating(const Rating& rating) {
+        return rating.rating - 2.0 * rating.deviation;
+    }
+
+    /**
+     * @brief Write ratings and queued games atomically
+     * @param path Destination file
+     * @return True if the file was written and installed
+     */
+    bool save(const std::string& path) const;
+
+    /**
+     * @brief Replace all state with the contents of a saved file
+     * @param path File written by save()
+     * @return True if the file was present and valid
+     */
+    bool load(const std::string& path);
+
+    void clear();
+
+    // Position in the result source these ratings cover, stored alongside them
+    uint64_t getSourceWatermark() const { return source_watermark; }
+    void setSourceWatermark(uint64_t watermark) { source_watermark = watermark; }
+
+    size_t getEntityCount() const { return names.size(); }
+    size_t getPendingGameCount() const { return pending.size(); }
+    uint64_t getPeriodCount() const { return periods; }
+
+private:
+    Settings settings;
+
+    // Entity parameters on the internal Glicko-2 scale, indexed by id
+    std::vector<std::string> names;
+    std::vector<double> mu;
+    std::vector<double> phi;
+    std::vector<double> sigma;
+    std::vector<uint32_t> games;
+    std::unordered_map<std::string, uint32_t> ids;
+
+    std::vector<GameResult> pending;
+    uint64_t periods;
+    uint64_t source_watermark;
+
+    // Per-period scratch, kept to avoid reallocating every period
+    std::vector<double> g_scratch;
+    std::vector<double> variance_inverse;
+    std::vector<double> improvement;
+
+    bool queue(const GameResult& result);
+    double solveVolatility(double phi_value, double sigma_value, double v, double delta) const;
+};
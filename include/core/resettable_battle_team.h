@@ -0,0 +1,32 @@
+#pragma once
+
+#include "team.h"
+
+/**
+ * @brief Battle team that is built once and restored between battles
+ *
+ * Tournament and simulation loops play many battles with the same team. This
+ * keeps one copy and puts it back to full HP, full PP, no status and neutral
+ * stat stages in place, without reallocating any storage.
+ */
+class ResettableBattleTeam {
+public:
+    ResettableBattleTeam() = default;
+    explicit ResettableBattleTeam(const Team& team) : team(team) { reset(); }
+
+    /**
+     * @brief Replace the stored team (copies once) and reset it
+     */
+    void assign(const Team& source);
+
+    /**
+     * @brief Restore every member to a fresh battle state
+     */
+    void reset();
+
+    Team& get() { return team; }
+    const Team& get() const { return team; }
+
+private:
+    Team team;
+};
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "pokemon.h"
+#include "pokemon_data.h"
+#include "ai_strategy.h"
+
+/**
+ * @brief Species-vs-species 1v1 win probabilities measured by simulation
+ *
+ * Built offline by playing every species (with its default moveset) against
+ * every other species in headless 1v1 duels on all cores. Probabilities are
+ * quantized to one byte per ordered pair, so the full 151x151 table is about
+ * 22 KB on disk and in memory.
+ *
+ * selectCounters() answers counter-team queries from the table alone with a
+ * greedy max-coverage search, so lookups take microseconds to milliseconds.
+ */
+class SpeciesWinMatrix {
+public:
+    /**
+     * @brief Build configuration
+     */
+    struct Settings {
+        int games_per_duel;          // Games per species pair; alternates which side is team A
+        unsigned worker_threads;     // 0 = hardware concurrency
+        uint64_t seed;
+        AIDifficulty ai_difficulty;  // AI driving both sides of every duel
+        int max_turns;               // Duels still running after this many turns are draws
+
+        Settings()
+            : games_per_duel(16), worker_threads(0), seed(0),
+              ai_difficulty(AIDifficulty::MEDIUM), max_turns(100) {}
+    };
+
+    /// Callback reporting finished and total species pairs during build
+    using ProgressCallback = std::function<void(size_t completed, size_t total)>;
+
+    /**
+     * @brief Default on-disk location used by TeamBuilder
+     */
+    static std::string defaultPath() { return "data/species_win_matrix.bin"; }
+
+    /**
+     * @brief Simulate every pair of the given Pokemon
+     * @param species One battle-ready Pokemon per species, moves included
+     * @param settings Games per pair, threads and seed
+     * @param progress Optional callback invoked from the calling thread
+     * @return True if the matrix was built (needs at least two species)
+     */
+    bool build(const std::vector<Pokemon>& species, const Settings& settings = Settings(),
+               const ProgressCallback& progress = nullptr);
+
+    /**
+     * @brief Build for every species in the data set using suggested movesets
+     * @param data Loaded Pokemon data
+     * @param settings Games per pair, threads and seed
+     * @param progress Optional progress callback
+     * @return True if the matrix was built
+     */
+    bool buildFromData(const PokemonData& data, const Settings& settings = Settings(),
+                       const ProgressCallback& progress = nullptr);
+
+    /**
+     * @brief Probability that one species beats another in a 1v1 duel
+     * @return Probability in [0, 1], or nullopt if either species is unknown
+     */
+    std::optional<double> getWinProbability(const std::string& species, const std::string& opponent) const;
+    double getWinProbability(size_t species, size_t opponent) const;
+
+    /**
+     * @brief Pick species that together beat as many of the targets as possible
+     * @param targets Species to counter (unknown names are ignored)
+     * @param count Number of species to pick
+     * @param strictness 1.0 = pure coverage of the targets, 0.0 = strongest overall
+     * @param allowed Optional filter for candidate species
+     * @return Picked species, best first
+     *
+     * Maximizes strictness * mean over targets of the best pick's win
+     * probability plus (1 - strictness) * mean overall strength of the picks.
+     * The objective is submodular, so greedy selection is within 1 - 1/e of optimal.
+     */
+    std::vector<std::string> selectCounters(const std::vector<std::string>& targets, size_t count,
+                                            double strictness = 0.7,
+                                            const std::function<bool(const std::string&)>& allowed = nullptr) const;
+
+    /**
+     * @brief Write the matrix with a checksum (atomically, via a temporary file)
+     */
+    bool save(const std::string& path) const;
+
+    /**
+     * @brief Replace the matrix with one read from disk
+     * @return False if the file is missing, truncated or fails its checksum
+     */
+    bool load(const std::string& path);
+
+    std::optional<size_t> findSpecies(const std::string& name) const;
+    const std::vector<std::string>& getSpeciesNames() const { return species_names; }
+    size_t size() const { return species_names.size(); }
+    bool empty() const { return species_names.empty(); }
+    int getGamesPerDuel() const { return games_per_duel; }
+
+private:
+    std::vector<std::string> species_names;
+    std::unordered_map<std::string, size_t> species_index;
+    std::vector<uint8_t> probabilities;  // Row-major; row = species, column = opponent, 255 = always wins
+    int games_per_duel = 0;
+    uint64_t seed = 0;
+
+    void setSpecies(const std::vector<std::string>& names);
+    double overallStrength(size_t species) const;
+};
@@ -23,6 +23,7 @@ class Team {
 
   // Add Pokemon directly to team (for testing)
   void addPokemon(const Pokemon &pokemon);
+  void addPokemon(Pokemon &&pokemon);
 
   // Getters
   Pokemon *getPokemon(int index);
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "pokemon_data.h"
+#include "team_builder.h"
+#include "type_mask.h"
+
+/**
+ * @brief Scores large batches of candidate teams in one pass
+ *
+ * Teams are packed as fixed-size arrays of species and move IDs, so a batch is
+ * one contiguous block with no strings. Scoring reads flat per-species and
+ * per-move tables (type masks, defensive matchups, base stats) built once in
+ * the constructor, does no allocation per team and splits the batch across
+ * worker threads. Each result carries the balance score, offensive coverage,
+ * shared weaknesses, stat averages and validation flags of one team.
+ *
+ * Results match TeamBuilder::calculateBalanceScore, calculateTypeCoverage,
+ * analyzeTeam and validateTeam for teams whose species and moves are known.
+ */
+class TeamBatchScorer {
+public:
+    static constexpr int kMaxTeamSize = 6;
+    static constexpr int kMaxMoves = 4;
+    static constexpr uint16_t kEmptySlot = 0xFFFF;   // No Pokemon or move in this slot
+    static constexpr uint16_t kUnknownId = 0xFFFE;   // Name not found when packing
+
+    /**
+     * @brief One candidate team as species and move IDs
+     *
+     * Slots are filled from the front; the first kEmptySlot species ends the
+     * team and kEmptySlot moves are skipped.
+     */
+    struct PackedTeam {
+        uint16_t species[kMaxTeamSize];
+        uint16_t moves[kMaxTeamSize][kMaxMoves];
+
+        PackedTeam();
+    };
+
+    /**
+     * @brief Validation problems found in a team
+     *
+     * The low byte holds errors (the team fails validateTeam), the high byte
+     * holds warnings.
+     */
+    enum ValidationFlag : uint16_t {
+        TEAM_TOO_SMALL = 1u << 0,
+        UNKNOWN_SPECIES = 1u << 1,
+        UNKNOWN_MOVE = 1u << 2,
+        TOO_FEW_MOVES = 1u << 3,
+        DUPLICATE_SPECIES = 1u << 4,
+        LOW_TYPE_DIVERSITY = 1u << 5,
+
+        DUPLICATE_MOVES = 1u << 8,      // A Pokemon knows the same move twice
+        SMALL_TEAM = 1u << 9,           // Fewer than 3 Pokemon
+        TYPE_HEAVY = 1u << 10           // One type on more than half the team
+    };
+    static constexpr uint16_t kErrorFlags = 0x00FF;
+
+    /**
+     * @brief Packed scoring result for one team
+     */
+    struct TeamScore {
+        float average_stats[6];       // hp, attack, defense, special attack, special defense, speed
+        TypeMask team_types;          // Types of the team's members
+        TypeMask coverage;            // Types hit super effectively by at least one move
+        TypeMask shared_weaknesses;   // Types more members are weak to than resist
+        uint16_t flags;               // ValidationFlag bits
+        uint8_t balance_score;        // 0-100, as TeamBuilder::calculateBalanceScore
+        uint8_t team_size;
+
+        bool isValid() const { return (flags & kErrorFlags) == 0; }
+    };
+
+    /**
+     * @brief Scoring configuration
+     */
+    struct Settings {
+        unsigned worker_threads;                        // 0 = hardware concurrency
+        size_t chunk_size;                              // Teams per work item handed to a thread
+        TeamBuilder::ValidationSettings validation;     // Rules behind the error flags
+
+        Settings() : worker_threads(0), chunk_size(4096) {}
+    };
+
+    /**
+     * @brief Build the species and move tables
+     * @param data Loaded Pokemon data; IDs follow its name order
+     * @param settings Threads, chunking and validation rules
+     */
+    explicit TeamBatchScorer(const PokemonData& data, const Settings& settings = Settings());
+
+    // ID lookups
+    uint16_t getSpeciesId(const std::string& name) const;
+    uint16_t getMoveId(const std::string& name) const;
+    const std::string& getSpeciesName(uint16_t id) const { return species_names[id]; }
+    const std::string& getMoveName(uint16_t id) const { return move_names[id]; }
+    size_t getSpeciesCount() const { return species_names.size(); }
+    size_t getMoveCount() const { return move_names.size(); }
+
+    /**
+     * @brief Pack a named team
+     * @param team Team to pack; unknown names become kUnknownId
+     * @param packed Output slots
+     * @return False if the team has more than 6 Pokemon or a Pokemon has more than 4 moves
+     */
+    bool pack(const TeamBuilder::Team& team, PackedTeam& packed) const;
+
+    /**
+     * @brief Score a contiguous batch of teams
+     * @param teams First of count packed teams
+     * @param count Number of teams
+     * @param results Output array with room for count results
+     */
+    void score(const PackedTeam* teams, size_t count, TeamScore* results) const;
+    std::vector<TeamScore> score(const std::vector<PackedTeam>& teams) const;
+
+    /**
+     * @brief Score a single team on the calling thread
+     */
+    TeamScore scoreOne(const PackedTeam& team) const;
+
+    const Settings& getSettings() const { return settings; }
+
+private:
+    struct SpeciesEntry {
+        std::array<uint16_t, 6> stats;
+        TypeMask types;
+        TypeMask weak;
+        TypeMask resisted;    // Resisted or immune
+    };
+
+    void scoreRange(const PackedTeam* teams, size_t count, TeamScore* results) const;
+
+    Settings settings;
+    std::vector<SpeciesEntry> species;
+    std::vector<TypeMask> move_hits;     // Super effective targets of each move's type
+    std::vector<std::string> species_names;
+    std::vector<std::string> move_names;
+    std::unordered_map<std::string, uint16_t> species_ids;
+    std::unordered_map<std::string, uint16_t> move_ids;
+};
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -7,6 +10,15 @@
 #include <optional>
 #include "pokemon_data.h"
 #include "input_validator.h"
+#include "draft_candidate_index.h"
+#include "leaderboard_index.h"
+#include "text_search_index.h"
+#include "type_mask.h"
+
+class BattleHistoryLog;
+class RatingEngine;
+class SpeciesWinMatrix;
+class TeamShareCodec;
 
 /**
  * @brief Comprehensive team building system with validation and suggestions
@@ -171,10 +183,17 @@ public:
         std::string difficulty;                 // "beginner", "intermediate", "advanced"
         bool optimize_movesets;                 // Use competitive movesets vs basic ones
         
+        // Simulation optimizer (generateMetaOptimizedTeam only)
+        bool simulate_battles;                  // Evolve the team against a gauntlet instead of picking by tier
+        size_t evaluation_budget;               // Maximum simulated games (0 = unlimited)
+        uint64_t seed;                          // Same seed and settings give the same team
+        std::vector<Team> gauntlet;             // Opponents to beat (empty = meta-tier teams)
+        
         RandomGenerationSettings() 
             : team_size(6), allow_legendaries(false), allow_duplicates(false),
               type_theme(""), min_physical_attackers(0), min_special_attackers(0),
-              min_tanks(0), difficulty("intermediate"), optimize_movesets(true) {}
+              min_tanks(0), difficulty("intermediate"), optimize_movesets(true),
+              simulate_battles(false), evaluation_budget(4000), seed(0) {}
     };
 
     // Constructor
@@ -403,8 +422,12 @@ public:
 
     /**
      * @brief Search templates by keywords
-     * @param keywords Search terms to look for in template names/descriptions
-     * @return Vector of matching templates with category and name
+     *
+     * Keywords match word prefixes in template names, descriptions, usage notes,
+     * Pokemon, roles and strategy text. Multi-word keywords must match every word.
+     *
+     * @param keywords Search terms; a template matching any of them is returned
+     * @return Matching templates with category and name, most relevant first
      */
     std::vector<std::pair<std::string, std::string>> searchTemplates(
         const std::vector<std::string>& keywords) const;
@@ -436,11 +459,15 @@ public:
         bool reveal_picks;                             // Show picks to all players
         bool allow_trade_phase;                        // Allow trading after draft
         
+        // Suggestions
+        bool rank_by_win_rate;                         // Rank suggestions with the species win matrix
+        
         DraftSettings() 
             : team_size(6), player_count(2), ban_phase_picks_per_player(2),
               pick_phase_picks_per_turn(1), allow_pick_same_turn(false),
               max_legendaries_per_team(1), max_same_type_per_team(2),
-              snake_draft(true), reveal_picks(true), allow_trade_phase(false) {}
+              snake_draft(true), reveal_picks(true), allow_trade_phase(false),
+              rank_by_win_rate(false) {}
     };
 
     /**
@@ -465,6 +492,11 @@ public:
         std::vector<std::vector<std::string>> player_teams;  // Pokemon picked by each player
         std::vector<std::vector<std::string>> player_bans;   // Pokemon banned by each player
         
+        // Pick pool index, updated by executeDraftBan/executeDraftPick. Draft
+        // queries fall back to scanning available_pokemon if the pool is
+        // edited directly and the index no longer matches it.
+        DraftCandidateIndex candidate_index;
+        
         // Draft history for strategy analysis
         struct DraftAction {
             int player_id;
@@ -525,6 +557,11 @@ public:
         double average_battle_length;
         double average_effectiveness_score;
         
+        // Glicko-2 rating as of the last closed rating period
+        double rating;
+        double rating_deviation;
+        double rating_volatility;
+        
         // Type matchup performance
         std::map<std::string, double> type_matchup_performance;
         
@@ -535,7 +572,8 @@ public:
         std::vector<std::string> improvement_suggestions;
         
         TeamStatistics() : total_battles(0), victories(0), defeats(0), win_rate(0.0),
-                          average_battle_length(0.0), average_effectiveness_score(0.0) {}
+                          average_battle_length(0.0), average_effectiveness_score(0.0),
+                          rating(1500.0), rating_deviation(350.0), rating_volatility(0.06) {}
     };
 
     // Tournament/Draft Mode Methods
@@ -580,7 +618,11 @@ public:
      * @brief Get draft suggestions for current player
      * @param session Current draft session
      * @param suggestion_count Number of suggestions to provide
-     * @return Vector of suggested Pokemon with reasoning
+     * @return Vector of suggested Pokemon with reasoning, best first
+     *
+     * Ranks legal picks by base stats plus the types they add to the team.
+     * With settings.rank_by_win_rate and a species win matrix available,
+     * ranks by simulated win rate overall and against the opponents' picks.
      */
     std::vector<std::pair<std::string, std::string>> getDraftSuggestions(
         const DraftSession& session, int suggestion_count = 3) const;
@@ -617,6 +659,10 @@ public:
     // Team Sharing System Methods
     /**
      * @brief Export team as shareable base64 encoded string
+     *
+     * Teams whose Pokemon and moves are all in the loaded data get a compact
+     * binary code (see TeamShareCodec); others fall back to the JSON format.
+     *
      * @param team Team to export
      * @param creator_name Name of team creator
      * @param description Optional team description
@@ -627,7 +673,7 @@ public:
 
     /**
      * @brief Import team from base64 encoded share code
-     * @param share_code Base64 encoded team data
+     * @param share_code Binary or legacy JSON share code
      * @param validate_team Whether to validate imported team
      * @return Imported team or empty team if import failed
      */
@@ -662,6 +708,75 @@ public:
     bool deleteCustomTeam(const std::string& filename);
 
     // Team Comparison and Analysis Methods
+    static constexpr int kTurnHistogramBucket = 10;    // Turns per turn_histogram entry
+    
+    /**
+     * @brief Settings for comparing teams by simulated battles
+     */
+    struct ComparisonSettings {
+        std::vector<std::string> difficulties;         // AI levels played: easy, medium, hard, expert
+        int max_battles_per_difficulty;
+        int min_battles_per_difficulty;                // Played before early stopping is considered
+        double target_margin;                          // Stop once the 95% interval half-width is this small
+        int max_turns;                                 // Longer battles count as draws
+        unsigned worker_threads;                       // 0 = hardware concurrency
+        uint64_t seed;
+        
+        ComparisonSettings()
+            : difficulties({"easy", "medium", "hard", "expert"}), max_battles_per_difficulty(200),
+              min_battles_per_difficulty(32), target_margin(0.05), max_turns(200),
+              worker_threads(0), seed(0) {}
+    };
+    
+    /// Reports finished and planned battles from the calling thread; return false to cancel
+    using ComparisonProgressCallback = std::function<bool(size_t completed, size_t total)>;
+    
+    /**
+     * @brief Simulated performance of one team member
+     */
+    struct SimulatedMemberStats {
+        std::string name;
+        int knockouts;                                 // Opponents knocked out by its moves
+        int faints;                                    // Battles in which it fainted
+        int mvp_awards;                                // Wins where it scored the most knockouts
+        
+        SimulatedMemberStats() : knockouts(0), faints(0), mvp_awards(0) {}
+    };
+    
+    /**
+     * @brief Results of the simulated battles at one AI level, or all of them
+     */
+    struct SimulatedRecord {
+        std::string difficulty;                        // AI level, or "all"
+        int battles;
+        int team1_wins;
+        int team2_wins;
+        int draws;
+        double team1_win_rate;                         // Draws count as half a win
+        double confidence_low;                         // 95% Wilson score interval of the win rate
+        double confidence_high;
+        double average_turns;
+        std::vector<int> turn_histogram;               // Battles per kTurnHistogramBucket turns
+        
+        SimulatedRecord()
+            : battles(0), team1_wins(0), team2_wins(0), draws(0), team1_win_rate(0.0),
+              confidence_low(0.0), confidence_high(1.0), average_turns(0.0) {}
+    };
+    
+    /**
+     * @brief Outcome of a Monte Carlo team comparison
+     */
+    struct MatchupSimulation {
+        bool performed;                                // False if no battles could be played
+        bool cancelled;                                // Stopped by the progress callback
+        SimulatedRecord overall;
+        std::vector<SimulatedRecord> by_difficulty;
+        std::vector<SimulatedMemberStats> team1_members;   // In team order
+        std::vector<SimulatedMemberStats> team2_members;
+        
+        MatchupSimulation() : performed(false), cancelled(false) {}
+    };
+    
     /**
      * @brief Compare two teams and provide detailed analysis
      * @param team1 First team to compare
@@ -692,10 +807,27 @@ public:
         // Improvement suggestions
         std::vector<std::string> team1_improvement_suggestions;
         std::vector<std::string> team2_improvement_suggestions;
+        
+        // Simulated battles (simulated compareTeams only)
+        MatchupSimulation simulation;
     };
     
     TeamComparison compareTeams(const Team& team1, const Team& team2) const;
 
+    /**
+     * @brief Compare two teams by playing simulated battles between them
+     * @param team1 First team to compare
+     * @param team2 Second team to compare
+     * @param settings AI levels, battle counts, early-stop margin, threads and seed
+     * @param progress Optional progress callback; returning false cancels the run
+     * @return Heuristic comparison with team1_win_probability and the
+     *         prediction replaced by the simulated results when any battles ran
+     *
+     * See TeamMatchupSimulator for how battles are scheduled and stopped.
+     */
+    TeamComparison compareTeams(const Team& team1, const Team& team2, const ComparisonSettings& settings,
+                                const ComparisonProgressCallback& progress = nullptr) const;
+
     // Battle History and Statistics Methods
     /**
      * @brief Record a battle result for team statistics
@@ -717,6 +849,20 @@ public:
      */
     std::optional<TeamStatistics> getTeamStatistics(const std::string& team_name) const;
 
+    /**
+     * @brief Get teams and AI opponents ranked by Glicko-2 rating
+     * @param max_results Maximum number of results to return (0 for all)
+     * @return Names with their conservative rating (rating minus two deviations)
+     */
+    std::vector<std::pair<std::string, double>> getTeamRatingLeaderboard(int max_results = 10) const;
+
+    /**
+     * @brief Apply battles recorded since the last rating period
+     *
+     * Periods also close automatically every kRatingPeriodBattles battles.
+     */
+    void closeTeamRatingPeriod();
+
     /**
      * @brief Get battle history for a team
      * @param team_name Name of team to get history for
@@ -739,6 +885,9 @@ public:
      * @param settings Enhanced random generation settings
      * @param meta_analysis Whether to consider current meta when generating
      * @return Generated team optimized for current meta
+     *
+     * With settings.simulate_battles the tier picks only seed a genetic search
+     * that plays simulated battles against settings.gauntlet (see TeamOptimizer).
      */
     Team generateMetaOptimizedTeam(const RandomGenerationSettings& settings,
                                   bool meta_analysis = true) const;
@@ -753,6 +902,16 @@ public:
     Team generateCounterTeam(const Team& target_team, const std::string& team_name,
                             double strictness = 0.7) const;
 
+    /**
+     * @brief Load the species win matrix used by generateCounterTeam
+     * @param file_path Matrix written by the build_win_matrix job
+     * @return True if loaded; generateCounterTeam falls back to type rules otherwise
+     *
+     * generateCounterTeam loads SpeciesWinMatrix::defaultPath() on first use
+     * unless a matrix was loaded explicitly.
+     */
+    bool loadSpeciesWinMatrix(const std::string& file_path) const;
+
 private:
     std::shared_ptr<PokemonData> pokemon_data;
     ValidationSettings validation_settings;
@@ -761,9 +920,34 @@ private:
     mutable std::unordered_map<std::string, std::unordered_map<std::string, TeamTemplate>> templates;
     mutable bool templates_loaded;
     
-    // Battle history and statistics storage
-    mutable std::unordered_map<std::string, std::vector<BattleRecord>> battle_history;
-    mutable std::unordered_map<std::string, TeamStatistics> team_statistics;
+    // Template lookup structures rebuilt by loadTemplates(); ids index template_refs,
+    // which is sorted by category then template name
+    struct TemplateRef {
+        std::string category;
+        std::string name;
+        std::string difficulty;
+        std::string strategy;
+    };
+    mutable std::vector<TemplateRef> template_refs;
+    mutable TextSearchIndex template_search_index;
+    mutable std::unordered_map<std::string, std::vector<std::string>> template_names_by_category;
+    mutable std::unordered_map<std::string, std::vector<size_t>> templates_by_difficulty;
+    mutable std::unordered_map<std::string, std::vector<size_t>> templates_by_strategy;
+    
+    // Battle history and statistics storage (append-only log, opened lazily)
+    mutable std::shared_ptr<BattleHistoryLog> history_log;
+    
+    // Glicko-2 ratings derived from the battle history, persisted alongside it
+    static constexpr size_t kRatingPeriodBattles = 16;
+    mutable std::shared_ptr<RatingEngine> rating_engine;
+    mutable LeaderboardIndex rating_leaderboard;
+    
+    // Simulated species-vs-species win rates for counter picks, loaded lazily
+    mutable std::shared_ptr<SpeciesWinMatrix> win_matrix;
+    mutable bool win_matrix_loaded;
+    
+    // Binary share code tables, built on first export or import
+    mutable std::shared_ptr<TeamShareCodec> share_codec;
     
     // Draft session management
     std::unordered_map<std::string, DraftSession> active_draft_sessions;
@@ -771,6 +955,31 @@ private:
     // Performance optimization caches
     mutable std::unordered_map<std::string, std::vector<std::string>> pokemon_type_cache;
     mutable std::unordered_map<std::string, std::vector<std::string>> pokemon_moves_cache;
+    
+    /**
+     * @brief Type masks, matchups and base stats of one species, computed once
+     */
+    struct SpeciesProfile {
+        std::string name;
+        TypeMask types;
+        TypeMasks::DefenseProfile matchups;
+        std::array<int, 6> stats;       // HP, Attack, Defense, Sp. Attack, Sp. Defense, Speed
+        int base_stat_total;
+    };
+    
+    /**
+     * @brief Type and damage class of one move, computed once
+     */
+    struct MoveProfile {
+        int type_index;                 // TypeMasks index, -1 if unknown
+        bool physical;
+        bool special;
+    };
+    
+    // Analysis profiles, built for every species on first use
+    mutable std::vector<SpeciesProfile> species_profiles;
+    mutable std::unordered_map<std::string, size_t> species_profile_index;
+    mutable std::unordered_map<std::string, MoveProfile> move_profiles;
 
     // Validation helper methods
     bool validateTeamSize(const Team& team, std::vector<std::string>& errors, 
@@ -802,6 +1011,7 @@ private:
 
     // Template system helper methods
     void ensureTemplatesLoaded() const;
+    void buildTemplateIndex();
     TeamTemplate parseTemplateFromJson(const std::string& file_path);
     bool isValidTemplateFile(const std::string& file_path) const;
     std::string getTemplateNameFromFile(const std::string& file_path) const;
@@ -821,11 +1031,16 @@ private:
     std::vector<std::string> getPlayerTeamTypes(const DraftSession& session, int player_id) const;
     bool exceedsTypeLimit(const DraftSession& session, int player_id, const std::string& pokemon_name) const;
     bool exceedsLegendaryLimit(const DraftSession& session, int player_id, const std::string& pokemon_name) const;
+    void buildDraftIndex(DraftSession& session) const;
+    bool isDraftIndexCurrent(const DraftSession& session) const;
+    std::vector<std::pair<std::string, std::string>> getIndexedDraftSuggestions(
+        const DraftSession& session, int suggestion_count) const;
     std::string getCurrentTimestamp() const;
 
     // Team sharing helper methods
     std::string encodeTeamToBase64(const TeamShareCode& share_code) const;
     TeamShareCode decodeTeamFromBase64(const std::string& base64_data) const;
+    const TeamShareCodec& getShareCodec() const;
     std::string getCustomTeamsDirectory() const;
     std::string sanitizeCustomFilename(const std::string& filename) const;
     bool ensureCustomTeamsDirectoryExists() const;
@@ -839,19 +1054,30 @@ private:
     // Battle history helper methods
     void loadBattleHistory() const;
     void saveBattleHistory() const;
-    void updateTeamStatistics(const std::string& team_name) const;
     std::string getBattleHistoryFilePath() const;
     std::string getTeamStatisticsFilePath() const;
+    std::string getLegacyBattleHistoryFilePath() const;
+    std::string getTeamRatingsFilePath() const;
+    void loadTeamRatings() const;
+    void saveTeamRatings() const;
+    void refreshRatingLeaderboard() const;
 
     // Performance optimization helper methods
     void preloadPokemonData() const;
     void clearPerformanceCaches() const;
     std::vector<std::string> getCachedPokemonTypes(const std::string& pokemon_name) const;
     std::vector<std::string> getCachedPokemonMoves(const std::string& pokemon_name) const;
+    void buildSpeciesProfiles() const;
+    const SpeciesProfile* getSpeciesProfile(const std::string& pokemon_name) const;
+    const MoveProfile* getMoveProfile(const std::string& move_name) const;
+    TypeMask getTeamTypeMask(const Team& team) const;
+    std::array<double, 6> getTeamStatTotals(const Team& team) const;
 
     // Enhanced generation helper methods
     std::vector<std::string> getMetaTierPokemon(const std::string& tier) const;
     std::vector<std::string> getCounterPokemon(const std::string& target_pokemon) const;
     double calculatePokemonSynergy(const std::vector<std::string>& team_pokemon) const;
     std::vector<std::string> optimizeTeamComposition(const std::vector<std::string>& base_team) const;
+    Team generateSimulationOptimizedTeam(const RandomGenerationSettings& settings,
+                                         const std::vector<std::string>& seed_pokemon) const;
 };
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include "team.h"
+#include "team_builder.h"
+#include "battle_simulator.h"
+
+/**
+ * @brief Monte Carlo head-to-head runs behind TeamBuilder::compareTeams
+ *
+ * Plays two teams against each other with BattleSimulator at each requested
+ * AI level, both sides driven by the same level and the teams swapping sides
+ * every other battle. Battles run in parallel in rounds. After each round
+ * every AI level still running checks its 95% Wilson score interval and stops
+ * once the interval is narrower than the target margin. Round sizes and
+ * per-battle seeds depend only on the settings, so a seed gives the same
+ * results regardless of thread count.
+ */
+class TeamMatchupSimulator {
+public:
+    /**
+     * @brief Turn a team builder team into a battle-ready team via BattleTeamFactory::shared()
+     * @return Team of the members whose species loads; moves that fail to load are skipped
+     */
+    static Team buildBattleTeam(const TeamBuilder::Team& team);
+
+    /**
+     * @brief AI level for a difficulty name ("easy", "medium", "hard", "expert"; any case)
+     */
+    static std::optional<AIDifficulty> parseDifficulty(const std::string& difficulty);
+
+    /**
+     * @brief 95% Wilson score interval of a win rate
+     * @param score Wins plus half the draws
+     * @param battles Battles played
+     * @param low Receives the lower bound
+     * @param high Receives the upper bound
+     */
+    static void wilsonInterval(double score, int battles, double& low, double& high);
+
+    /**
+     * @brief Play the two teams against each other
+     * @param team1 First team
+     * @param team2 Second team
+     * @param settings Battle counts, AI levels, stopping margin, threads and seed
+     * @param progress Optional callback, invoked from the calling thread
+     * @return Empirical results; performed is false if either team has no
+     *         usable Pokemon or no AI level is recognized
+     */
+    static TeamBuilder::MatchupSimulation run(const TeamBuilder::Team& team1, const TeamBuilder::Team& team2,
+                                              const TeamBuilder::ComparisonSettings& settings,
+                                              const TeamBuilder::ComparisonProgressCallback& progress = nullptr);
+};
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "pokemon_data.h"
+#include "team.h"
+#include "team_builder.h"
+#include "battle_simulator.h"
+
+/**
+ * @brief Simulation-driven team search
+ *
+ * Evolves a population of candidate teams (species plus movesets) with a
+ * genetic algorithm and scores each candidate by playing headless battles
+ * against a gauntlet of opponent teams. Movesets are drawn from
+ * PokemonData::suggestMovesForPokemon plus the species' own-type damaging
+ * moves.
+ *
+ * Each generation is evaluated as a successive-halving race: every candidate
+ * plays a few games against each gauntlet team, the weaker half is dropped,
+ * and the survivors play twice as many games, until one candidate is left or
+ * the evaluation budget runs out. All games of a rung run in parallel, and
+ * every random choice derives from Settings::seed, so a given seed always
+ * yields the same team regardless of thread count.
+ */
+class TeamOptimizer {
+public:
+    /**
+     * @brief Search configuration
+     */
+    struct Settings {
+        int team_size;
+        int population_size;
+        int generations;
+        int elite_count;              // Best candidates copied unchanged into the next generation
+        double mutation_rate;         // Per-slot chance of swapping the species or one move
+        int initial_games;            // Games against each gauntlet team in the first rung
+        int halving_rate;             // Keep 1/halving_rate of candidates per rung, multiply games by it
+        size_t evaluation_budget;     // Total simulated games across the search (0 = unlimited)
+        int move_candidates;          // Candidate moves considered per species
+        unsigned worker_threads;      // 0 = hardware concurrency
+        uint64_t seed;
+        AIDifficulty ai_difficulty;   // AI driving both sides of every game
+        int max_turns;
+
+        Settings()
+            : team_size(6), population_size(16), generations(10), elite_count(2), mutation_rate(0.25),
+              initial_games(1), halving_rate(2), evaluation_budget(4000), move_candidates(8),
+              worker_threads(0), seed(0), ai_difficulty(AIDifficulty::MEDIUM), max_turns(200) {}
+    };
+
+    /**
+     * @brief Best team found and how it was measured
+     */
+    struct Result {
+        TeamBuilder::Team team;
+        double fitness;               // Score against the gauntlet (win 1, draw 0.5) over games played
+        int fitness_games;            // Games behind the fitness estimate
+        size_t games_played;          // Games simulated over the whole search
+        int generations_completed;
+
+        Result() : fitness(0.0), fitness_games(0), games_played(0), generations_completed(0) {}
+    };
+
+    explicit TeamOptimizer(std::shared_ptr<PokemonData> data, const Settings& settings = Settings());
+
+    /**
+     * @brief Add an opponent to the gauntlet
+     * @param team Team to evaluate candidates against
+     * @return True if the team had at least one loadable Pokemon
+     */
+    bool addGauntletTeam(const TeamBuilder::Team& team);
+
+    /**
+     * @brief Add a team that joins the first generation as-is
+     * @param members Species and moves of the seed candidate
+     */
+    void addSeedTeam(const std::vector<TeamBuilder::TeamPokemon>& members);
+
+    /**
+     * @brief Restrict the species the search may use (default: every species)
+     */
+    void setSpeciesPool(const std::vector<std::string>& species);
+
+    /**
+     * @brief Run the search
+     * @param team_name Name given to the resulting team
+     * @return Best team found; empty if no gauntlet or no usable species
+     */
+    Result optimize(const std::string& team_name);
+
+    size_t getGauntletSize() const { return gauntlet.size(); }
+
+private:
+    struct Candidate {
+        std::vector<TeamBuilder::TeamPokemon> members;
+        double score = 0.0;
+        int games = 0;
+        int rung = 0;
+
+        double fitness() const { return games > 0 ? score / games : 0.0; }
+    };
+
+    std::shared_ptr<PokemonData> pokemon_data;
+    Settings settings;
+    std::vector<Team> gauntlet;
+    std::vector<std::vector<TeamBuilder::TeamPokemon>> seed_teams;
+    std::vector<std::string> species_pool;
+
+    // Loaded once up front so battle teams can be assembled without file I/O
+    std::unordered_map<std::string, Pokemon> species_cache;
+    std::unordered_map<std::string, Move> move_cache;
+    std::unordered_map<std::string, std::vector<std::string>> move_candidates;
+
+    // Data preparation
+    bool loadSpecies(const std::string& name);
+    bool loadMove(const std::string& name);
+    std::vector<std::string> candidateMovesFor(const std::string& species) const;
+    Team buildBattleTeam(const std::vector<TeamBuilder::TeamPokemon>& members) const;
+
+    // Genetic operators
+    Candidate randomCandidate(std::mt19937_64& rng) const;
+    Candidate crossover(const Candidate& a, const Candidate& b, std::mt19937_64& rng) const;
+    void mutate(Candidate& candidate, std::mt19937_64& rng) const;
+    std::vector<std::string> randomMoveset(const std::string& species, std::mt19937_64& rng) const;
+    std::string randomSpecies(const Candidate& candidate, std::mt19937_64& rng) const;
+
+    // Evaluation
+    size_t evaluateGeneration(std::vector<Candidate>& population, int generation, size_t budget) const;
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "pokemon_data.h"
+#include "team_builder.h"
+
+/**
+ * @brief Compact binary team share codes
+ *
+ * A code is base64url text of this payload:
+ *
+ *   u8  format version (2)
+ *   u16 data table fingerprint
+ *   u8  species ID bits << 4 | move ID bits
+ *   bit-packed team: 3-bit Pokemon count, then per Pokemon its dex number,
+ *       a 3-bit move count and the move IDs, padded to a whole byte
+ *   varint-length strings: team name, creator, description, creation date
+ *   u32 CRC32 of everything above
+ *
+ * Species are stored by dex number and moves by their position in the sorted
+ * move list, each in as few bits as the loaded data needs. The fingerprint
+ * covers both tables, so a code made against different data is rejected
+ * rather than decoded into the wrong Pokemon or moves. A full six-Pokemon
+ * team encodes to about 120 characters against about 800 for a JSON code.
+ */
+class TeamShareCodec {
+public:
+    static constexpr uint8_t kFormatVersion = 2;
+
+    /**
+     * @brief Build the species and move tables
+     * @param data Loaded Pokemon data
+     */
+    explicit TeamShareCodec(const PokemonData& data);
+
+    /**
+     * @brief Encode a share code
+     * @param share_code Team and metadata to encode
+     * @param code Receives the base64url code
+     * @return False if the team has more than 6 Pokemon, more than 4 moves on
+     *         a Pokemon, or a species or move missing from the loaded data
+     */
+    bool encode(const TeamBuilder::TeamShareCode& share_code, std::string& code) const;
+
+    /**
+     * @brief Decode a share code
+     * @param code Code produced by encode()
+     * @param share_code Receives the decoded team and metadata
+     * @return False if the code is not a valid binary code for this data
+     */
+    bool decode(const std::string& code, TeamBuilder::TeamShareCode& share_code) const;
+
+    uint16_t getFingerprint() const { return fingerprint; }
+
+private:
+    std::vector<std::string> species_by_dex;        // Empty where no species has the number
+    std::unordered_map<std::string, uint32_t> dex_by_species;
+    std::vector<std::string> move_names;            // Sorted; index is the move ID
+    std::unordered_map<std::string, uint32_t> move_ids;
+    uint8_t species_bits;
+    uint8_t move_bits;
+    uint16_t fingerprint;
+};
@@ -8,6 +8,9 @@
 #include <memory>
 #include "team_builder.h"
 #include "pokemon_data.h"
+#include "progress_journal.h"
+#include "leaderboard_index.h"
+#include "rating_engine.h"
 
 /**
  * @brief Comprehensive tournament system managing gym battles, Elite Four, and Champion
@@ -261,23 +264,35 @@ public:
 
     /**
      * @brief Get leaderboard of tournament progress across all players
-     * @param sort_by Sorting criteria ("badges", "completion", "score")
+     * @param sort_by Sorting criteria ("badges", "completion", "score", "rating")
      * @param max_results Maximum number of results to return
      * @return Vector of player names with their scores/progress
+     *
+     * Served from incrementally maintained indexes in O(log n + max_results).
+     * "rating" ranks by conservative Glicko-2 rating (rating minus two deviations).
      */
     std::vector<std::pair<std::string, double>> getTournamentLeaderboard(
         const std::string& sort_by = "completion", int max_results = 10) const;
 
+    /**
+     * @brief Get a player's position on a tournament leaderboard
+     * @param player_name Name of the player
+     * @param sort_by Sorting criteria ("badges", "completion", "score", "rating")
+     * @return 1-based rank, or 0 if the player or criteria is unknown
+     */
+    int getPlayerLeaderboardRank(const std::string& player_name,
+                                 const std::string& sort_by = "completion") const;
+
     // Data Persistence
     /**
-     * @brief Save tournament progress to JSON file
+     * @brief Journal tournament progress changes and make them durable
      * @param player_name Name of the player (empty for all players)
      * @return True if save successful
      */
     bool saveTournamentProgress(const std::string& player_name = "") const;
 
     /**
-     * @brief Load tournament progress from JSON file
+     * @brief Load tournament progress from the progress journal
      * @param player_name Name of the player (empty for all players)
      * @return True if load successful
      */
@@ -333,6 +348,21 @@ private:
     std::unordered_map<std::string, TournamentProgress> player_progress;
     std::unordered_map<std::string, std::vector<TournamentBattleResult>> player_battle_history;
     
+    // Crash-safe persistence; tracks how much of each history is already journaled
+    std::unique_ptr<ProgressJournal> journal;
+    mutable std::unordered_map<std::string, size_t> journaled_history_count;
+    
+    // Leaderboards, updated only when a player's progress changes
+    LeaderboardIndex badge_leaderboard;
+    LeaderboardIndex completion_leaderboard;
+    LeaderboardIndex score_leaderboard;
+    LeaderboardIndex rating_leaderboard;
+    
+    // Glicko-2 ratings of players against the opponents they battle; derived
+    // from the journaled battle history, so they need no file of their own
+    static constexpr size_t kRatingPeriodBattles = 16;
+    RatingEngine player_ratings;
+    
     // Tournament configuration data
     std::vector<std::string> gym_order;
     std::vector<std::string> elite_four_order;
@@ -344,6 +374,11 @@ private:
     bool updateEliteFourProgress(const std::string& player_name, const std::string& elite_member);
     bool updateChampionProgress(const std::string& player_name);
     void recalculatePlayerStats(const std::string& player_name);
+    void refreshLeaderboards(const std::string& player_name);
+    void rebuildLeaderboards();
+    void rebuildPlayerRatings();
+    void refreshRatingLeaderboard();
+    const LeaderboardIndex* findLeaderboard(const std::string& sort_by) const;
     
     // Helper methods for challenge validation
     bool meetsGymRequirements(const std::string& player_name, const std::string& gym_name) const;
@@ -352,7 +387,9 @@ private:
     
     // Data persistence helpers
     std::string getTournamentDataFilePath() const;
+    std::string getTournamentDataDirectory() const;
     bool ensureTournamentDataDirectoryExists() const;
+    bool importLegacyTournamentData();
     void loadTournamentConfiguration();
     
     // Statistics calculation helpers
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "team.h"
+#include "team_builder.h"
+#include "battle_simulator.h"
+
+/**
+ * @brief Swiss and round-robin brackets between many teams
+ *
+ * Pairs N entrants round by round and plays every pairing as a short match of
+ * headless BattleSimulator games. Pairings within a round are independent, so
+ * they run concurrently on a pool of worker threads; rounds are sequential
+ * because Swiss pairings depend on the standings so far.
+ *
+ * Every pairing carries its own seed derived from the tournament seed, so the
+ * whole schedule is reproducible and any single match can be replayed with
+ * replayPairing().
+ *
+ * Standings are ordered by match points (win 1, draw 0.5, bye 1), then
+ * Buchholz (opponents' match points), Sonneborn-Berger (points of beaten
+ * opponents plus half of drawn ones), game win percentage and finally name.
+ */
+class TournamentScheduler {
+public:
+    enum class Format { ROUND_ROBIN, SWISS };
+
+    /**
+     * @brief Bracket configuration
+     */
+    struct Settings {
+        Format format;
+        int swiss_rounds;            // 0 = ceil(log2(entrants))
+        int games_per_pairing;       // Games in each match; alternates which side moves as team A
+        unsigned worker_threads;     // 0 = hardware concurrency
+        uint64_t seed;
+        AIDifficulty ai_difficulty;  // AI driving both sides of every game
+        int max_turns;               // Per-game turn limit before a draw is declared
+
+        Settings()
+            : format(Format::SWISS), swiss_rounds(0), games_per_pairing(3), worker_threads(0),
+              seed(0), ai_difficulty(AIDifficulty::MEDIUM), max_turns(200) {}
+    };
+
+    /**
+     * @brief One scheduled match and its result
+     */
+    struct Pairing {
+        int round;
+        int team_a;                  // Entrant index
+        int team_b;                  // Entrant index, or -1 for a bye
+        uint64_t seed;
+        int wins_a;
+        int wins_b;
+        int draws;
+
+        Pairing() : round(0), team_a(-1), team_b(-1), seed(0), wins_a(0), wins_b(0), draws(0) {}
+        bool isBye() const { return team_b < 0; }
+    };
+
+    /**
+     * @brief Standing of one entrant after all played rounds
+     */
+    struct Standing {
+        std::string team_name;
+        int rank;
+        double match_points;
+        int match_wins;
+        int match_losses;
+        int match_draws;
+        int game_wins;
+        int game_losses;
+        int game_draws;
+        double buchholz;
+        double sonneborn_berger;
+        double game_win_percentage;
+
+        Standing()
+            : rank(0), match_points(0.0), match_wins(0), match_losses(0), match_draws(0),
+              game_wins(0), game_losses(0), game_draws(0), buchholz(0.0),
+              sonneborn_berger(0.0), game_win_percentage(0.0) {}
+    };
+
+    explicit TournamentScheduler(const Settings& settings = Settings());
+
+    /**
+     * @brief Register an entrant
+     * @param name Unique entrant name
+     * @param team Battle-ready team
+     * @return True if added (names must be unique and teams non-empty)
+     */
+    bool addEntrant(const std::string& name, const Team& team);
+
+    /**
+     * @brief Register a TeamBuilder custom or template team
+     * @param team Team to enter under its own name, converted through BattleTeamFactory::shared()
+     * @return True if added
+     */
+    bool addEntrant(const TeamBuilder::Team& team);
+
+    /**
+     * @brief Play every round of the bracket
+     * @return True if the bracket ran (needs at least two entrants)
+     */
+    bool run();
+
+    /**
+     * @brief Re-simulate a single pairing from its seed
+     * @param pairing Pairing from getSchedule()
+     * @return The pairing with freshly simulated results
+     */
+    Pairing replayPairing(const Pairing& pairing) const;
+
+    /**
+     * @brief Get standings with tiebreakers applied, best first
+     */
+    std::vector<Standing> getStandings() const;
+
+    /**
+     * @brief Write settings, entrants and every pairing with its seed and result
+     * @param file_path Destination JSON file
+     * @return True if written
+     */
+    bool saveSchedule(const std::string& file_path) const;
+
+    const std::vector<Pairing>& getSchedule() const { return schedule; }
+    const std::string& getEntrantName(int index) const { return entrants[index].name; }
+    size_t getEntrantCount() const { return entrants.size(); }
+    int getRoundCount() const;
+
+private:
+    struct Entrant {
+        std::string name;
+        Team team;
+        bool had_bye = false;
+    };
+
+    Settings settings;
+    std::vector<Entrant> entrants;
+    std::vector<Pairing> schedule;
+
+    // Pairing generation
+    std::vector<Pairing> roundRobinRound(int round) const;
+    std::vector<Pairing> swissRound(int round);
+    uint64_t pairingSeed(int round, int team_a, int team_b) const;
+
+    // Execution
+    void playRound(std::vector<Pairing>& pairings) const;
+    void playPairing(Pairing& pairing) const;
+
+    // Standings helpers
+    std::vector<double> matchPoints() const;
+    std::vector<std::vector<int>> opponentsOf() const;
+};
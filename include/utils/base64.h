@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Table-driven base64 encoding and decoding
+ *
+ * Encoding works on whole 3-byte groups through a 64-entry alphabet; decoding
+ * maps each character through a 256-entry table, so both run in one pass with
+ * no searching. The decoder accepts the standard and URL-safe alphabets, with
+ * or without '=' padding.
+ */
+namespace Base64 {
+
+/**
+ * @brief Encode with the standard alphabet ('+', '/') and '=' padding
+ */
+std::string encode(const uint8_t* data, size_t length);
+
+/**
+ * @brief Encode with the URL-safe alphabet ('-', '_') and no padding
+ */
+std::string encodeUrl(const uint8_t* data, size_t length);
+
+/**
+ * @brief Decode standard or URL-safe base64
+ * @param text Encoded characters; padding is optional
+ * @param output Replaced with the decoded bytes
+ * @return False on an invalid character or length, or stray bits in the last
+ *         character (output is then unspecified)
+ */
+bool decode(const std::string& text, std::vector<uint8_t>& output);
+
+} // namespace Base64
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Little-endian binary encoding helpers and CRC32 checksums
+ *
+ * Shared by the on-disk record formats (battle history log, journals, replays)
+ * so every format frames and checksums its records the same way.
+ */
+namespace BinaryIO {
+
+/**
+ * @brief Compute a CRC32 (IEEE 802.3, reflected) checksum
+ * @param data Bytes to checksum
+ * @param length Number of bytes
+ * @param seed Running CRC to continue from (0 for a fresh checksum)
+ * @return CRC32 of the data
+ */
+uint32_t crc32(const void* data, size_t length, uint32_t seed = 0);
+
+/**
+ * @brief Append-only little-endian byte writer
+ */
+class ByteWriter {
+public:
+    void writeU8(uint8_t value) { buffer_.push_back(value); }
+    void writeU16(uint16_t value);
+    void writeU32(uint32_t value);
+    void writeU64(uint64_t value);
+    void writeI32(int32_t value) { writeU32(static_cast<uint32_t>(value)); }
+    void writeF64(double value);
+    void writeString(const std::string& value);  // u32 length prefix + bytes
+    void writeBytes(const void* data, size_t length);
+
+    const std::vector<uint8_t>& data() const { return buffer_; }
+    size_t size() const { return buffer_.size(); }
+    void clear() { buffer_.clear(); }
+
+private:
+    std::vector<uint8_t> buffer_;
+};
+
+/**
+ * @brief Bounds-checked little-endian byte reader
+ *
+ * Reads past the end of the buffer do not throw; they set the failure flag
+ * and return zero values so callers can check ok() once after decoding.
+ */
+class ByteReader {
+public:
+    ByteReader(const uint8_t* data, size_t length) : data_(data), length_(length), offset_(0), ok_(true) {}
+
+    uint8_t readU8();
+    uint16_t readU16();
+    uint32_t readU32();
+    uint64_t readU64();
+    int32_t readI32() { return static_cast<int32_t>(readU32()); }
+    double readF64();
+    std::string readString();
+
+    bool ok() const { return ok_; }
+    size_t remaining() const { return ok_ ? length_ - offset_ : 0; }
+    size_t offset() const { return offset_; }
+
+private:
+    const uint8_t* data_;
+    size_t length_;
+    size_t offset_;
+    bool ok_;
+
+    bool require(size_t bytes);
+};
+
+/**
+ * @brief Header written in front of every framed record: payload length then payload CRC
+ */
+constexpr size_t kRecordHeaderSize = 8;
+
+/**
+ * @brief Frame a payload as [u32 length][u32 crc32][payload]
+ * @param payload Encoded record body
+ * @return Framed bytes ready to append to a log
+ */
+std::vector<uint8_t> frameRecord(const std::vector<uint8_t>& payload);
+
+} // namespace BinaryIO
@@ -1,15 +1,18 @@
 #pragma once
 #include <iostream>
 #include <chrono>
-#include <thread>
+#include <memory>
 #include <string>
 #include <functional>
+#include "health_bar_renderer.h"
 
 /**
  * @brief Health Bar Animator for Pokemon Battle Simulator
  * 
  * Provides smooth animated health bar transitions with color coding
- * and cross-platform terminal support.
+ * and cross-platform terminal support. On a terminal, animations run on a
+ * HealthBarRenderer thread and never block the caller; elsewhere the final
+ * value is printed once.
  */
 class HealthBarAnimator {
 public:
@@ -67,7 +70,7 @@ public:
     /**
      * @brief Constructor with configuration
      */
-    explicit HealthBarAnimator(const Config& config = Config()) : config_(config) {}
+    explicit HealthBarAnimator(const Config& config = Config()) : config_(config), rendererChecked_(false) {}
 
     /**
      * @brief Display animated health transition
@@ -82,6 +85,16 @@ public:
                              int previousHP = -1,
                              const std::string& statusCondition = "") const;
 
+    /**
+     * @brief Post a health change to a pinned bar and return immediately
+     * @param row Pinned row of the bar (0 = top)
+     * @param previousHP HP to animate from (-1 for no animation)
+     */
+    void postHealth(int row, const std::string& pokemonName,
+                    int currentHP, int maxHP,
+                    int previousHP = -1,
+                    const std::string& statusCondition = "") const;
+
     /**
      * @brief Display static health bar (no animation)
      */
@@ -89,6 +102,13 @@ public:
                            int currentHP, int maxHP,
                            const std::string& statusCondition = "") const;
 
+    /**
+     * @brief Format one health bar line (no newline)
+     */
+    std::string formatHealthLine(const std::string& pokemonName,
+                                 int currentHP, int maxHP,
+                                 const std::string& statusCondition = "") const;
+
     /**
      * @brief Check if terminal supports colors
      */
@@ -115,6 +135,10 @@ private:
     mutable HealthState lastPlayerState_;
     mutable HealthState lastOpponentState_;
 
+    // Started on first use on a terminal; declared last so it stops before the rest is destroyed
+    mutable bool rendererChecked_;
+    mutable std::unique_ptr<HealthBarRenderer> renderer_;
+
     /**
      * @brief Calculate health percentage
      */
@@ -141,21 +165,9 @@ private:
     std::string getResetColor() const;
 
     /**
-     * @brief Clear current line in terminal
-     */
-    void clearLine() const;
-
-    /**
-     * @brief Move cursor up specified lines
-     */
-    void moveCursorUp(int lines) const;
-
-    /**
-     * @brief Animate health transition
+     * @brief Renderer for animated bars, or null if animations are off or output is not a terminal
      */
-    void animateHealthTransition(const std::string& pokemonName,
-                               int fromHP, int toHP, int maxHP,
-                               const std::string& statusCondition) const;
+    HealthBarRenderer* getRenderer() const;
 
     /**
      * @brief Update internal health state tracking
@@ -33,6 +33,7 @@ public:
 private:
     std::shared_ptr<HealthBarAnimator> animator_;
     std::unordered_map<Pokemon*, std::string> pokemonDisplayNames_;
+    std::unordered_map<Pokemon*, int> pokemonRows_;   // Pinned bar row: 0 = player, 1 = opponent
     
     // Helper methods
     std::string getPokemonDisplayName(Pokemon* pokemon) const;
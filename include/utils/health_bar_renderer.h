@@ -0,0 +1,108 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Background renderer for animated health bars
+ *
+ * Health bars are pinned to the top rows of the terminal, above a scroll
+ * region that holds the regular battle output. Callers post target HP values
+ * and return immediately; the render thread interpolates each bar towards its
+ * target, diffs the new frame against the one on screen and emits only the
+ * changed rows, each frame with a single write(2) of a prebuilt buffer.
+ */
+class HealthBarRenderer {
+public:
+    /**
+     * @brief Formats one bar's line (without newline)
+     */
+    using LineFormatter = std::function<std::string(const std::string& name, int hp, int maxHP,
+                                                    const std::string& statusCondition)>;
+
+    /**
+     * @param formatter Formats a bar at an intermediate HP value
+     * @param frameDelayMs Delay between animation frames (0 = jump to the target)
+     * @param fd File descriptor to write frames to
+     */
+    HealthBarRenderer(LineFormatter formatter, int frameDelayMs, int fd = 1);
+    ~HealthBarRenderer();
+
+    HealthBarRenderer(const HealthBarRenderer&) = delete;
+    HealthBarRenderer& operator=(const HealthBarRenderer&) = delete;
+
+    /**
+     * @brief Start the render thread
+     * @param terminalRows Terminal height; 0 queries the terminal
+     * @return False if the height is unknown (fd is not a terminal)
+     */
+    bool start(int terminalRows = 0);
+
+    /**
+     * @brief Finish the current frame, stop the thread and release the scroll region
+     */
+    void stop();
+
+    bool isRunning() const;
+
+    /**
+     * @brief Set a bar's target HP; returns without waiting for the animation
+     * @param row Pinned row of the bar (0 = top)
+     * @param fromHP HP to animate from if the bar is new (-1 = show the target directly)
+     */
+    void post(int row, const std::string& name, int targetHP, int maxHP, int fromHP = -1,
+              const std::string& statusCondition = "");
+
+    /**
+     * @brief Block until every bar has reached its target and is on screen
+     */
+    void waitIdle();
+
+    size_t getFramesWritten() const;
+
+    /**
+     * @brief Terminal output that turns the shown rows into the next rows
+     * @return Escape sequences and text for the changed rows only; empty if nothing changed
+     *
+     * When rows are added, the scroll region is moved below them first.
+     */
+    static std::string composeFrame(const std::vector<std::string>& shown, const std::vector<std::string>& next,
+                                    int terminalRows);
+
+private:
+    struct Bar {
+        std::string name;
+        std::string statusCondition;
+        int maxHP;
+        int targetHP;
+        double shownHP;
+        double step;       // HP per frame towards the target
+        bool used;
+    };
+
+    LineFormatter formatter_;
+    std::chrono::milliseconds frameDelay_;
+    int fd_;
+    int terminalRows_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable idle_;
+    std::vector<Bar> bars_;
+    std::vector<std::string> shownRows_;   // Front buffer: what the terminal shows
+    bool dirty_;
+    bool drawing_;
+    bool running_;
+    size_t framesWritten_;
+    std::thread thread_;
+
+    void renderLoop();
+    bool animating() const;
+    void advance();
+    void writeFrame(const std::string& frame) const;
+};
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Order-statistic index over (player, score) pairs
+ *
+ * Keeps players sorted by score in a size-augmented treap so leaderboards are
+ * updated incrementally when a single player's score changes instead of being
+ * rebuilt and re-sorted on every query.
+ *
+ * Complexity (expected): update/remove/rank O(log n), top-K O(log n + K).
+ * Ties are broken by player name so rankings are deterministic.
+ */
+class LeaderboardIndex {
+public:
+    enum class Order { HIGHER_IS_BETTER, LOWER_IS_BETTER };
+
+    explicit LeaderboardIndex(Order order = Order::HIGHER_IS_BETTER);
+
+    /**
+     * @brief Insert a player or move them to a new score
+     * @param player_name Player to update
+     * @param score New score
+     */
+    void update(const std::string& player_name, double score);
+
+    /**
+     * @brief Remove a player from the leaderboard
+     * @param player_name Player to remove
+     * @return True if the player was present
+     */
+    bool remove(const std::string& player_name);
+
+    /**
+     * @brief Remove every player
+     */
+    void clear();
+
+    /**
+     * @brief Get the best players in leaderboard order
+     * @param count Number of entries to return (0 or negative for all)
+     * @return Player names with their scores, best first
+     */
+    std::vector<std::pair<std::string, double>> top(int count) const;
+
+    /**
+     * @brief Get a player's 1-based position
+     * @param player_name Player to look up
+     * @return Rank, or 0 if the player is not on the leaderboard
+     */
+    size_t rank(const std::string& player_name) const;
+
+    /**
+     * @brief Get the entry at a 0-based position
+     * @param index Position in leaderboard order
+     * @return Player name and score (empty name if out of range)
+     */
+    std::pair<std::string, double> at(size_t index) const;
+
+    bool contains(const std::string& player_name) const { return scores.count(player_name) > 0; }
+    size_t size() const { return scores.size(); }
+    bool empty() const { return scores.empty(); }
+
+private:
+    static constexpr int32_t kNull = -1;
+
+    struct Node {
+        std::string name;
+        double score;
+        uint32_t priority;
+        int32_t left;
+        int32_t right;
+        uint32_t size;
+    };
+
+    Order order;
+    std::vector<Node> nodes;
+    std::vector<int32_t> free_nodes;
+    std::unordered_map<std::string, double> scores;
+    int32_t root;
+    uint32_t rng_state;
+
+    bool ranksBefore(double score_a, const std::string& name_a,
+                     double score_b, const std::string& name_b) const;
+    uint32_t nextPriority();
+    uint32_t sizeOf(int32_t node) const { return node == kNull ? 0 : nodes[node].size; }
+    void pull(int32_t node);
+    int32_t allocate(const std::string& name, double score);
+
+    // Split into (entries ranking before the key, entries at or after it)
+    void split(int32_t node, double score, const std::string& name, int32_t& before, int32_t& after);
+    int32_t merge(int32_t before, int32_t after);
+    int32_t erase(int32_t node, double score, const std::string& name);
+    void collect(int32_t node, size_t limit, std::vector<std::pair<std::string, double>>& out) const;
+};
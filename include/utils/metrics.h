@@ -0,0 +1,249 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Runtime metrics: counters, gauges and latency histograms
+ *
+ * Metrics live in a Registry and are looked up once by name and labels;
+ * call sites keep the returned reference (usually in a function-local
+ * static) so updates never touch the registry again. Updates are lock-free:
+ * counters are striped across cache-line-sized shards picked per thread and
+ * summed on read, and histograms bump one atomic bucket. Reads go through
+ * Registry::snapshot() or the Prometheus text exposition format.
+ *
+ * Typical use:
+ *   static Metrics::Counter& battles = Metrics::Registry::global().counter(
+ *       "pokemon_battles_total", "Battles played");
+ *   battles.increment();
+ */
+namespace Metrics {
+
+using Labels = std::vector<std::pair<std::string, std::string>>;
+
+namespace detail {
+constexpr size_t kShards = 16;
+size_t nextShard();
+
+inline size_t shardIndex() {
+    thread_local const size_t index = nextShard();
+    return index;
+}
+} // namespace detail
+
+/**
+ * @brief Monotonic count, striped per thread and summed on read
+ */
+class Counter {
+public:
+    void increment(uint64_t amount = 1) {
+        shards[detail::shardIndex()].value.fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    uint64_t value() const;
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> value{0};
+    };
+    std::array<Shard, detail::kShards> shards;
+};
+
+/**
+ * @brief Value that can go up and down (queue depth, load time)
+ */
+class Gauge {
+public:
+    void set(double value);
+    void add(double delta);
+    double value() const;
+
+private:
+    std::atomic<uint64_t> bits{0};   // IEEE-754 double; 0 bits is 0.0
+};
+
+/**
+ * @brief Distribution summary at read time
+ *
+ * Quantiles and max are in exported units and accurate to one bucket
+ * (about 3% relative error).
+ */
+struct HistogramSummary {
+    uint64_t count = 0;
+    double sum = 0.0;
+    double max = 0.0;
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+};
+
+/**
+ * @brief HDR-style log-linear histogram of non-negative integer values
+ *
+ * Values below 32 get exact buckets; above that each power of two is split
+ * into 16 buckets, so every value up to 2^64 is recorded with bounded
+ * relative error in fixed memory. Latencies are recorded in nanoseconds
+ * and exported in seconds (unit 1e-9); counts use unit 1.
+ */
+class Histogram {
+public:
+    static constexpr int kSubBucketBits = 4;
+    static constexpr size_t kBuckets = (64 - kSubBucketBits + 1) << kSubBucketBits;
+
+    explicit Histogram(double unit = 1e-9) : unit(unit) {}
+
+    void record(uint64_t value);
+    void recordDuration(std::chrono::nanoseconds elapsed) {
+        record(elapsed.count() > 0 ? static_cast<uint64_t>(elapsed.count()) : 0);
+    }
+
+    uint64_t count() const { return total.load(std::memory_order_relaxed); }
+    double getUnit() const { return unit; }
+
+    /**
+     * @brief Value at quantile q (0..1), in recorded units
+     */
+    uint64_t quantile(double q) const;
+
+    HistogramSummary summarize() const;
+
+    static size_t bucketIndex(uint64_t value);
+    static uint64_t bucketLowerBound(size_t index);
+    static uint64_t bucketWidth(size_t index);
+
+private:
+    double unit;
+    std::array<std::atomic<uint64_t>, kBuckets> buckets{};
+    std::atomic<uint64_t> total{0};
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> maximum{0};
+};
+
+/**
+ * @brief Records the lifetime of a scope into a histogram, in nanoseconds
+ */
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Histogram& histogram)
+        : histogram(histogram), start(std::chrono::steady_clock::now()) {}
+    ~ScopedTimer() { histogram.recordDuration(std::chrono::steady_clock::now() - start); }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Histogram& histogram;
+    std::chrono::steady_clock::time_point start;
+};
+
+/**
+ * @brief Point-in-time copy of every metric, for tests and tooling
+ */
+struct Snapshot {
+    struct Value {
+        std::string name;
+        Labels labels;
+        double value;
+    };
+    struct Distribution {
+        std::string name;
+        Labels labels;
+        HistogramSummary summary;
+    };
+
+    std::vector<Value> counters;
+    std::vector<Value> gauges;
+    std::vector<Distribution> histograms;
+
+    /**
+     * @brief Look up one series; missing series read as zero / nullptr
+     */
+    double counter(const std::string& name, const Labels& labels = {}) const;
+    double gauge(const std::string& name, const Labels& labels = {}) const;
+    const HistogramSummary* histogram(const std::string& name, const Labels& labels = {}) const;
+};
+
+/**
+ * @brief Owns metrics by name and labels
+ *
+ * Looking up an existing series returns the same object; references stay
+ * valid for the registry's lifetime. Reusing a name for a different metric
+ * type throws std::invalid_argument.
+ */
+class Registry {
+public:
+    Registry() = default;
+    Registry(const Registry&) = delete;
+    Registry& operator=(const Registry&) = delete;
+
+    /**
+     * @brief Process-wide registry used by the engine
+     */
+    static Registry& global();
+
+    Counter& counter(const std::string& name, const std::string& help, const Labels& labels = {});
+    Gauge& gauge(const std::string& name, const std::string& help, const Labels& labels = {});
+    Histogram& histogram(const std::string& name, const std::string& help, const Labels& labels = {},
+                         double unit = 1e-9);
+
+    Snapshot snapshot() const;
+
+    /**
+     * @brief Write every metric in the Prometheus text exposition format
+     *
+     * Histograms are exported as summaries (0.5, 0.9 and 0.99 quantiles,
+     * _sum and _count).
+     */
+    void writePrometheus(std::ostream& out) const;
+
+    /**
+     * @brief Replace a file with the Prometheus text, atomically (temp file + rename)
+     *
+     * Suitable for node_exporter's textfile collector.
+     */
+    bool writePrometheusFile(const std::string& path) const;
+
+private:
+    enum class Type { COUNTER, GAUGE, HISTOGRAM };
+
+    struct Series {
+        Labels labels;
+        std::unique_ptr<Counter> counter;
+        std::unique_ptr<Gauge> gauge;
+        std::unique_ptr<Histogram> histogram;
+    };
+
+    struct Family {
+        Type type;
+        std::string help;
+        std::map<std::string, Series> series;   // Keyed by rendered labels
+    };
+
+    Series& findOrAdd(const std::string& name, const std::string& help, const Labels& labels, Type type,
+                      double unit = 1e-9);
+
+    mutable std::mutex mutex;
+    std::map<std::string, Family> families;
+};
+
+/**
+ * @brief Export the global registry if POKEMON_METRICS names a file
+ *
+ * The file is rewritten every POKEMON_METRICS_INTERVAL seconds (default 10)
+ * on a background thread and once more when the program exits normally.
+ * @return true if the exporter was started
+ */
+bool startFromEnvironment();
+
+} // namespace Metrics
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Inverted index with prefix matching and TF-IDF ranking
+ *
+ * Documents are lists of (text, weight) fields. Text is split into lowercase
+ * alphanumeric tokens and each token's weighted count per document goes into
+ * a posting list. The vocabulary is kept sorted, so every term starting with
+ * a query token is one contiguous range found by binary search.
+ *
+ * A query is a list of keywords. A document matches a keyword when each token
+ * of the keyword is a prefix of one of its terms, and documents matching any
+ * keyword are ranked by the summed TF-IDF weight of the terms they matched.
+ * Exact term matches count fully; longer terms reached by prefix count half.
+ */
+class TextSearchIndex {
+public:
+    /**
+     * @brief One ranked search result
+     */
+    struct Hit {
+        size_t document;   // Index returned by addDocument
+        double score;
+    };
+
+    /**
+     * @brief Remove every document
+     */
+    void clear();
+
+    /**
+     * @brief Add a document (call finalize() before searching again)
+     * @param fields Text of each field with its weight
+     * @return Document index, counting from 0 in insertion order
+     */
+    size_t addDocument(const std::vector<std::pair<std::string, double>>& fields);
+
+    /**
+     * @brief Sort the vocabulary and compute term weights
+     */
+    void finalize();
+
+    /**
+     * @brief Find documents matching any of the keywords
+     * @param keywords Words or phrases; every token of a phrase must match
+     * @param max_results Maximum hits to return (0 for all)
+     * @return Hits by descending score, ties in insertion order
+     */
+    std::vector<Hit> search(const std::vector<std::string>& keywords, size_t max_results = 0) const;
+
+    size_t documentCount() const { return document_count; }
+    size_t termCount() const { return vocabulary.size(); }
+
+    /**
+     * @brief Split text into lowercase alphanumeric tokens
+     */
+    static std::vector<std::string> tokenize(const std::string& text);
+
+private:
+    struct Posting {
+        uint32_t document;
+        float frequency;    // Field-weighted term count
+        float weight;       // TF-IDF, set by finalize()
+    };
+
+    std::unordered_map<std::string, uint32_t> term_ids;
+    std::vector<std::vector<Posting>> postings;              // By term id, documents ascending
+    std::vector<std::pair<std::string, uint32_t>> vocabulary;  // Sorted terms with their ids
+    size_t document_count = 0;
+};
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Scoped hot-path tracing exported as Chrome trace_event JSON
+ *
+ * Code marks interesting regions with TRACE_SCOPE("category", "name"). While
+ * recording, each scope appends one complete event to a ring buffer owned by
+ * the calling thread, so tracing takes no lock after a thread's first event.
+ * When not recording, a scope costs one relaxed atomic load. Building with
+ * POKEMON_TRACING=0 compiles the scopes out entirely.
+ *
+ * Typical use:
+ *   Trace::start();
+ *   ... run battles ...
+ *   Trace::stop();
+ *   Trace::writeChromeTrace("trace.json");   // Open in ui.perfetto.dev
+ */
+namespace Trace {
+
+/**
+ * @brief One completed scope
+ *
+ * Names and categories are not copied; they must be string literals (or
+ * otherwise outlive the trace).
+ */
+struct Event {
+    const char* name;
+    const char* category;
+    uint64_t start_ns;      // Since start()
+    uint64_t duration_ns;
+    uint32_t thread_id;     // Small sequential id, in order of each thread's first event
+};
+
+/// Events kept per thread; older events are overwritten once a buffer is full
+constexpr size_t kEventsPerThread = 1 << 14;
+
+namespace detail {
+extern std::atomic<bool> recording;
+}
+
+/**
+ * @brief Discard previous events and begin recording
+ */
+void start();
+
+/**
+ * @brief Stop recording; scopes still open when this is called are dropped
+ */
+void stop();
+
+inline bool isRecording() { return detail::recording.load(std::memory_order_relaxed); }
+
+/**
+ * @brief Discard all recorded events
+ */
+void clear();
+
+/**
+ * @brief Nanoseconds on the trace clock (steady, relative to the last start())
+ */
+uint64_t now();
+
+/**
+ * @brief Append a completed event to the calling thread's buffer
+ */
+void record(const char* category, const char* name, uint64_t start_ns, uint64_t duration_ns);
+
+/**
+ * @brief Copy of every buffered event, ordered by start time
+ *
+ * Meant to be called after stop(), once traced threads are done; events
+ * written while collecting may be torn.
+ */
+std::vector<Event> collect();
+
+/**
+ * @brief Events overwritten because a thread's buffer was full
+ */
+uint64_t getDroppedCount();
+
+/**
+ * @brief Write the buffered events as Chrome trace_event JSON
+ *
+ * The output loads in Perfetto and chrome://tracing.
+ */
+void writeChromeTrace(std::ostream& out);
+bool writeChromeTrace(const std::string& path);
+
+/**
+ * @brief Start recording if the POKEMON_TRACE environment variable names a file
+ *
+ * The trace is written to that file when the program exits normally.
+ * @return true if recording was started
+ */
+bool startFromEnvironment();
+
+/**
+ * @brief RAII scope recording its lifetime as one event
+ */
+class Scope {
+public:
+    Scope(const char* category, const char* name)
+        : category(category), name(name), start_ns(isRecording() ? now() : kNotRecording) {}
+
+    ~Scope() {
+        if (start_ns != kNotRecording && isRecording()) {
+            const uint64_t end_ns = now();
+            if (end_ns >= start_ns) {   // Else opened before a restart
+                record(category, name, start_ns, end_ns - start_ns);
+            }
+        }
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    static constexpr uint64_t kNotRecording = ~uint64_t{0};
+
+    const char* category;
+    const char* name;
+    uint64_t start_ns;
+};
+
+} // namespace Trace
+
+#ifndef POKEMON_TRACING
+#define POKEMON_TRACING 1
+#endif
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+
+#if POKEMON_TRACING
+#define TRACE_SCOPE(category, name) ::Trace::Scope TRACE_CONCAT(trace_scope_, __LINE__)(category, name)
+#else
+#define TRACE_SCOPE(category, name) static_cast<void>(0)
+#endif
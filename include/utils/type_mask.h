@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief 18-bit type sets and precomputed type matchups
+ *
+ * Bit i stands for TypeEffectiveness::getAllTypes()[i], so a Pokemon's types,
+ * a team's types or the types a move hits super effectively each fit in one
+ * word. Set operations become bitwise AND/OR and counting becomes a popcount.
+ * Matchup masks come from the TypeEffectiveness chart used by battles.
+ */
+using TypeMask = uint32_t;
+
+namespace TypeMasks {
+
+constexpr int kTypeCount = 18;
+constexpr TypeMask kAllTypes = (1u << kTypeCount) - 1;
+
+/**
+ * @brief Defensive matchups of a single or dual type combination
+ */
+struct DefenseProfile {
+    TypeMask weak;       // Attacking types dealing more than 1x
+    TypeMask resist;     // Attacking types dealing less than 1x but more than 0x
+    TypeMask immune;     // Attacking types dealing 0x
+
+    DefenseProfile() : weak(0), resist(0), immune(0) {}
+};
+
+inline int count(TypeMask mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcount(mask);
+#else
+    int bits = 0;
+    for (; mask; mask &= mask - 1) {
+        ++bits;
+    }
+    return bits;
+#endif
+}
+
+inline TypeMask bit(int type_index) {
+    return type_index >= 0 && type_index < kTypeCount ? (1u << type_index) : 0u;
+}
+
+/**
+ * @brief Index of a type name, or -1 if unknown
+ */
+int typeIndex(const std::string& type);
+
+/**
+ * @brief Name of the type at an index (must be in [0, kTypeCount))
+ */
+const std::string& typeName(int type_index);
+
+/**
+ * @brief Mask of the given type names; unknown names are ignored
+ */
+TypeMask fromTypes(const std::vector<std::string>& types);
+
+/**
+ * @brief Type names in the mask, in chart order
+ */
+std::vector<std::string> toTypes(TypeMask mask);
+
+/**
+ * @brief Single defending types an attacking type hits super effectively
+ */
+TypeMask superEffectiveAgainst(int attacking_type);
+
+/**
+ * @brief Weaknesses, resistances and immunities of a type combination
+ * @param defending_types Mask of the defender's types (one or two bits)
+ */
+DefenseProfile defenseProfile(TypeMask defending_types);
+
+} // namespace TypeMasks
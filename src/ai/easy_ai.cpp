@@ -3,7 +3,10 @@
 #include <algorithm>
 #include <random>
 
+#include "trace.h"
+
 MoveEvaluation EasyAI::chooseBestMove(const BattleState& battleState) {
+  TRACE_SCOPE("ai", "EasyAI::chooseBestMove");
   std::vector<Move*> usableMoves = getUsableMoves(*battleState.aiPokemon);
 
   if (usableMoves.empty()) {
@@ -31,6 +34,7 @@ MoveEvaluation EasyAI::chooseBestMove(const BattleState& battleState) {
 }
 
 SwitchEvaluation EasyAI::chooseBestSwitch(const BattleState& battleState) {
+  TRACE_SCOPE("ai", "EasyAI::chooseBestSwitch");
   // EasyAI only switches to first alive Pokemon (very basic)
   for (int i = 0; i < static_cast<int>(battleState.aiTeam->size()); ++i) {
     Pokemon* pokemon = battleState.aiTeam->getPokemon(i);
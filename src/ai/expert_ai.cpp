@@ -4,6 +4,7 @@
 #include <cmath>
 #include <numeric>
 
+#include "trace.h"
 #include "weather.h"
 
 struct PredictionResult {
@@ -13,7 +14,38 @@ struct PredictionResult {
   std::vector<double> moveProbabilities;
 };
 
+namespace {
+
+// Adds the wall time of a scope to one entry of ExpertAI's method timings
+class MethodTimer {
+ public:
+  MethodTimer(ExpertAI::MethodTimings& timings, const char* method)
+      : timings_(timings), method_(method), start_(std::chrono::steady_clock::now()) {}
+
+  ~MethodTimer() {
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_);
+    auto it = timings_.find(method_);
+    if (it == timings_.end()) {
+      it = timings_.emplace(method_, std::chrono::microseconds{0}).first;
+    }
+    it->second += elapsed;
+  }
+
+  MethodTimer(const MethodTimer&) = delete;
+  MethodTimer& operator=(const MethodTimer&) = delete;
+
+ private:
+  ExpertAI::MethodTimings& timings_;
+  const char* method_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace
+
 MoveEvaluation ExpertAI::chooseBestMove(const BattleState& battleState) {
+  TRACE_SCOPE("ai", "ExpertAI::chooseBestMove");
+  MethodTimer timer(method_timings_, "chooseBestMove");
   updateOpponentModel(battleState);
 
   std::vector<Move*> usableMoves = getUsableMoves(*battleState.aiPokemon);
@@ -69,6 +101,8 @@ MoveEvaluation ExpertAI::chooseBestMove(const BattleState& battleState) {
 }
 
 SwitchEvaluation ExpertAI::chooseBestSwitch(const BattleState& battleState) {
+  TRACE_SCOPE("ai", "ExpertAI::chooseBestSwitch");
+  MethodTimer timer(method_timings_, "chooseBestSwitch");
   SwitchEvaluation bestSwitch{-1, -1000.0, ""};
 
   // Analyze team synergy and identify optimal switch
@@ -141,6 +175,8 @@ SwitchEvaluation ExpertAI::chooseBestSwitch(const BattleState& battleState) {
 }
 
 bool ExpertAI::shouldSwitch(const BattleState& battleState) {
+  TRACE_SCOPE("ai", "ExpertAI::shouldSwitch");
+  MethodTimer timer(method_timings_, "shouldSwitch");
   // Multi-factor switching decision
 
   // Immediate danger assessment
@@ -1079,18 +1115,40 @@ std::string ExpertAI::classifyOpponentPlayStyle(const BattleState& battle_state)
 // MiniMax Search Engine Implementation
 double ExpertAI::miniMaxSearch(const BattleState& root_state, int depth, double alpha, double beta, 
                               bool maximizing_player, std::vector<int>& best_line) const {
-  auto start_time = std::chrono::high_resolution_clock::now();
+  TRACE_SCOPE("ai", "ExpertAI::miniMaxSearch");
+  MethodTimer timer(method_timings_, "miniMaxSearch");
+  auto start_time = std::chrono::steady_clock::now();
   search_engine_.nodes_evaluated_ = 0;
   search_engine_.alpha_beta_cutoffs_ = 0;
-  
-  if (depth <= 0 || isEndgamePosition(root_state)) {
+
+  double best_value = searchNode(root_state, depth, alpha, beta, maximizing_player, best_line);
+
+  search_engine_.principal_variation_ = best_line;
+  search_engine_.principal_variation_score_ = best_value;
+  search_engine_.search_time_ = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start_time);
+  return best_value;
+}
+
+ExpertAI::SearchStatistics ExpertAI::getLastSearchStatistics() const {
+  SearchStatistics statistics;
+  statistics.nodes_evaluated = search_engine_.nodes_evaluated_;
+  statistics.alpha_beta_cutoffs = search_engine_.alpha_beta_cutoffs_;
+  statistics.search_time = search_engine_.search_time_;
+  return statistics;
+}
+
+double ExpertAI::searchNode(const BattleState& state, int depth, double alpha, double beta,
+                            bool maximizing_player, std::vector<int>& best_line) const {
+  if (depth <= 0 || isEndgamePosition(state)) {
     search_engine_.nodes_evaluated_++;
-    return evaluatePosition(root_state);
+    return evaluatePosition(state);
   }
   
-  std::vector<BattleState> legal_moves = generateLegalMoves(root_state, maximizing_player);
+  std::vector<BattleState> legal_moves = generateLegalMoves(state, maximizing_player);
   if (legal_moves.empty()) {
-    return evaluatePosition(root_state);
+    search_engine_.nodes_evaluated_++;
+    return evaluatePosition(state);
   }
   
   orderMoves(legal_moves, maximizing_player);
@@ -1100,7 +1158,7 @@ double ExpertAI::miniMaxSearch(const BattleState& root_state, int depth, double
   
   for (size_t i = 0; i < legal_moves.size() && i < static_cast<size_t>(MiniMaxSearchEngine::kMaxBranchingFactor); ++i) {
     std::vector<int> child_line;
-    double value = miniMaxSearch(legal_moves[i], depth - 1, alpha, beta, !maximizing_player, child_line);
+    double value = searchNode(legal_moves[i], depth - 1, alpha, beta, !maximizing_player, child_line);
     
     if (maximizing_player) {
       if (value > best_value) {
@@ -1125,14 +1183,6 @@ double ExpertAI::miniMaxSearch(const BattleState& root_state, int depth, double
     }
   }
   
-  if (depth == MiniMaxSearchEngine::kMaxSearchDepth) {
-    search_engine_.principal_variation_ = current_best_line;
-    search_engine_.principal_variation_score_ = best_value;
-    
-    auto end_time = std::chrono::high_resolution_clock::now();
-    search_engine_.search_time_ = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
-  }
-  
   best_line = current_best_line;
   return best_value;
 }
@@ -3,9 +3,11 @@
 #include <algorithm>
 #include <cmath>
 
+#include "trace.h"
 #include "weather.h"
 
 MoveEvaluation HardAI::chooseBestMove(const BattleState& battleState) {
+  TRACE_SCOPE("ai", "HardAI::chooseBestMove");
   std::vector<Move*> usableMoves = getUsableMoves(*battleState.aiPokemon);
 
   if (usableMoves.empty()) {
@@ -45,6 +47,7 @@ MoveEvaluation HardAI::chooseBestMove(const BattleState& battleState) {
 }
 
 SwitchEvaluation HardAI::chooseBestSwitch(const BattleState& battleState) {
+  TRACE_SCOPE("ai", "HardAI::chooseBestSwitch");
   SwitchEvaluation bestSwitch{-1, -1000.0, ""};
 
   for (int i = 0; i < static_cast<int>(battleState.aiTeam->size()); ++i) {
@@ -3,9 +3,11 @@
 #include <algorithm>
 #include <cmath>
 
+#include "trace.h"
 #include "weather.h"
 
 MoveEvaluation MediumAI::chooseBestMove(const BattleState& battleState) {
+  TRACE_SCOPE("ai", "MediumAI::chooseBestMove");
   std::vector<Move*> usableMoves = getUsableMoves(*battleState.aiPokemon);
 
   if (usableMoves.empty()) {
@@ -32,6 +34,7 @@ MoveEvaluation MediumAI::chooseBestMove(const BattleState& battleState) {
 }
 
 SwitchEvaluation MediumAI::chooseBestSwitch(const BattleState& battleState) {
+  TRACE_SCOPE("ai", "MediumAI::chooseBestSwitch");
   SwitchEvaluation bestSwitch{-1, -1000.0, ""};
 
   for (int i = 0; i < static_cast<int>(battleState.aiTeam->size()); ++i) {
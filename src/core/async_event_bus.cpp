@@ -0,0 +1,122 @@
+#include "async_event_bus.h"
+#include <chrono>
+
+namespace BattleEvents {
+
+namespace {
+
+// Idle consumers yield a few times before sleeping, so bursts are picked up quickly
+constexpr int kSpinsBeforeSleep = 64;
+constexpr std::chrono::microseconds kIdleSleep(200);
+
+} // namespace
+
+AsyncEventBus::~AsyncEventBus() {
+    stop();
+}
+
+int AsyncEventBus::addConsumer(RecordHandler handler, const ConsumerOptions& options) {
+    if (isRunning() || !handler) {
+        return -1;
+    }
+    consumers.push_back(std::make_unique<Consumer>(options, std::move(handler)));
+    return static_cast<int>(consumers.size()) - 1;
+}
+
+int AsyncEventBus::addConsumer(std::shared_ptr<BattleEventListener> listener, const ConsumerOptions& options) {
+    if (!listener) {
+        return -1;
+    }
+    return addConsumer([listener](const EventRecord& record) { dispatchRecord(record, *listener); }, options);
+}
+
+void AsyncEventBus::start() {
+    if (isRunning()) {
+        return;
+    }
+    stopping.store(false, std::memory_order_release);
+    running.store(true, std::memory_order_release);
+    for (auto& consumer : consumers) {
+        Consumer* raw = consumer.get();
+        raw->ring.reopen();
+        raw->thread = std::thread([this, raw]() { drain(*raw); });
+    }
+}
+
+void AsyncEventBus::drain(Consumer& consumer) {
+    EventRecord record;
+    int idle = 0;
+    for (;;) {
+        if (consumer.ring.pop(record)) {
+            idle = 0;
+            try {
+                consumer.handler(record);
+            } catch (...) {
+                // A failing consumer must not stop the others, same as synchronous dispatch
+            }
+            consumer.consumed.fetch_add(1, std::memory_order_release);
+            continue;
+        }
+        if (stopping.load(std::memory_order_acquire) && consumer.ring.size() == 0) {
+            return;
+        }
+        if (++idle < kSpinsBeforeSleep) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(kIdleSleep);
+        }
+    }
+}
+
+void AsyncEventBus::publish(EventRecord record) {
+    if (!isRunning()) {
+        return;
+    }
+    record.sequence = sequence.fetch_add(1, std::memory_order_relaxed);
+    for (auto& consumer : consumers) {
+        consumer->offered.fetch_add(1, std::memory_order_relaxed);
+        consumer->ring.push(record);
+    }
+}
+
+void AsyncEventBus::flush() {
+    if (!isRunning()) {
+        return;
+    }
+    for (auto& consumer : consumers) {
+        const uint64_t target = consumer->offered.load(std::memory_order_acquire);
+        while (consumer->consumed.load(std::memory_order_acquire) + consumer->ring.getDroppedCount() < target) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void AsyncEventBus::stop() {
+    if (!isRunning()) {
+        return;
+    }
+    running.store(false, std::memory_order_release);
+    stopping.store(true, std::memory_order_release);
+    for (auto& consumer : consumers) {
+        consumer->ring.close();  // Producers still blocked in push() give up
+        if (consumer->thread.joinable()) {
+            consumer->thread.join();
+        }
+    }
+}
+
+uint64_t AsyncEventBus::getConsumedCount(int consumer) const {
+    if (consumer < 0 || consumer >= static_cast<int>(consumers.size())) {
+        return 0;
+    }
+    return consumers[consumer]->consumed.load(std::memory_order_acquire);
+}
+
+uint64_t AsyncEventBus::getDroppedCount(int consumer) const {
+    if (consumer < 0 || consumer >= static_cast<int>(consumers.size())) {
+        return 0;
+    }
+    return consumers[consumer]->ring.getDroppedCount();
+}
+
+} // namespace BattleEvents
@@ -14,6 +14,7 @@
 #include "weather.h"
 #include "input_validator.h"
 #include "battle_events.h"
+#include "trace.h"
 
 Battle::Battle(const Team &playerTeam, const Team &opponentTeam,
                AIDifficulty aiDifficulty)
@@ -25,7 +26,8 @@ Battle::Battle(const Team &playerTeam, const Team &opponentTeam,
       currentWeather(WeatherCondition::NONE),
       weatherTurnsRemaining(0),
       rng(std::random_device{}()),
-      criticalDistribution(0.0, 1.0) {
+      criticalDistribution(0.0, 1.0),
+      battleLog(BattleLog::Level::VERBOSE, std::cout) {
   srand(time(0));  // Seed random number generator once
   
   // Initialize health bar animation system with auto-detection
@@ -40,11 +42,11 @@ Battle::Battle(const Team &playerTeam, const Team &opponentTeam,
 void Battle::displayHealth(const Pokemon &pokemon) const {
   if (!healthBarAnimator) {
     // Fallback to basic display if animator not initialized
-    std::cout << pokemon.name << " HP: " << pokemon.current_hp << "/" << pokemon.hp;
+    battleLog.append(BattleLog::Message::HEALTH, pokemon.name, pokemon.current_hp, pokemon.hp);
     if (pokemon.hasStatusCondition()) {
-      std::cout << " (" << pokemon.getStatusConditionName() << ")";
+      battleLog.append(BattleLog::Message::HEALTH_STATUS, pokemon.getStatusConditionName());
     }
-    std::cout << std::endl;
+    battleLog.endLine(BattleLog::Level::VERBOSE);
     return;
   }
 
@@ -56,13 +58,13 @@ void Battle::displayHealth(const Pokemon &pokemon) const {
 }
 
 void Battle::selectPokemon() {
-  std::cout << "\nSelect the Pokémon you want to send out first:" << std::endl;
+  std::cout << "\nSelect the Pokémon you want to send out first:\n";
 
   // Display available Pokemon
   for (int i = 0; i < static_cast<int>(playerTeam.size()); ++i) {
     const auto *pokemon = playerTeam.getPokemon(i);
     if (pokemon && pokemon->isAlive()) {
-      std::cout << "[" << i + 1 << "] - " << pokemon->name << std::endl;
+      std::cout << "[" << i + 1 << "] - " << pokemon->name << "\n";
     }
   }
 
@@ -92,13 +94,13 @@ void Battle::selectPokemon() {
   );
   
   if (!pokemonResult.isValid()) {
-    std::cout << "Failed to get valid Pokemon selection: " << pokemonResult.errorMessage << std::endl;
+    battleLog.log(BattleLog::Message::SELECTION_FAILED, pokemonResult.errorMessage);
     // Auto-select first available Pokemon as fallback
     for (int i = 0; i < static_cast<int>(playerTeam.size()); ++i) {
       auto *pokemon = playerTeam.getPokemon(i);
       if (pokemon && pokemon->isAlive()) {
         selectedPokemon = pokemon;
-        std::cout << "Auto-selecting " << selectedPokemon->name << " as fallback!" << std::endl;
+        battleLog.log(BattleLog::Message::AUTO_SELECTED, selectedPokemon->name);
         return;
       }
     }
@@ -107,15 +109,14 @@ void Battle::selectPokemon() {
   
   int chosenPokemonNum = pokemonResult.value;
   selectedPokemon = playerTeam.getPokemon(chosenPokemonNum - 1);
-  std::cout << "\nYou have selected " << selectedPokemon->name
-            << " to send out!" << std::endl;
+  battleLog.log(BattleLog::Message::PLAYER_SELECTED, selectedPokemon->name);
   
   // Register Pokemon with health bar system
   if (healthBarListener && selectedPokemon) {
     healthBarListener->registerPokemon(selectedPokemon, "Player");
   }
   
-  std::cout << std::endl;
+  battleLog.log(BattleLog::Message::BLANK_LINE);
 }
 
 void Battle::selectOpponentPokemon() {
@@ -123,8 +124,7 @@ void Battle::selectOpponentPokemon() {
   if (!alivePokemon.empty()) {
     auto randomIndex = rand() % alivePokemon.size();
     opponentSelectedPokemon = alivePokemon[randomIndex];
-    std::cout << "\nThe opponent has selected " << opponentSelectedPokemon->name
-              << " to send out!" << std::endl;
+    battleLog.log(BattleLog::Message::OPPONENT_SELECTED, opponentSelectedPokemon->name);
     
     // Register opponent Pokemon with health bar system
     if (healthBarListener && opponentSelectedPokemon) {
@@ -134,9 +134,11 @@ void Battle::selectOpponentPokemon() {
 }
 
 void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
+  TRACE_SCOPE("battle", "Battle::moveExecution");
+
   // Check if attacker must recharge this turn
   if (attacker.mustRecharge()) {
-    std::cout << attacker.name << " must recharge and cannot move!" << std::endl;
+    battleLog.log(BattleLog::Message::MUST_RECHARGE, attacker.name);
     attacker.finishRecharge();
     return;
   }
@@ -144,8 +146,7 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
   // Check if attacker can act (not asleep, frozen, or fully paralyzed)
   if (!attacker.canActThisTurn()) {
     if (attacker.status == StatusCondition::PARALYSIS) {
-      std::cout << attacker.name << " is paralyzed and can't move!"
-                << std::endl;
+      battleLog.log(BattleLog::Message::PARALYZED, attacker.name);
     }
     return;
   }
@@ -154,23 +155,24 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
   Move &move = attacker.moves[moveIndex];
 
   if (!move.canUse()) {
-    std::cout << attacker.name << " tried to use " << move.name
-              << " but it has no PP left!" << std::endl;
+    battleLog.log(BattleLog::Message::NO_PP, attacker.name, move.name);
     return;
   }
 
   // Handle multi-turn move state transitions
   if (attacker.isCharging() && attacker.getChargingMoveIndex() == moveIndex) {
     // Pokemon is finishing a charging move
-    std::cout << attacker.name << " unleashed " << move.name << "!" << std::endl;
+    battleLog.log(BattleLog::Message::UNLEASHED, attacker.name, move.name);
     attacker.finishCharging();
     
     // Notify event system
-    auto event = eventManager.createMultiTurnMoveEvent(
-      &attacker, &move, BattleEvents::MultiTurnMoveEvent::Phase::EXECUTING,
-      attacker.name + " unleashed " + move.name + "!"
-    );
-    eventManager.notifyMultiTurnMove(event);
+    if (eventManager.hasListeners()) {
+      auto event = eventManager.createMultiTurnMoveEvent(
+        &attacker, &move, BattleEvents::MultiTurnMoveEvent::Phase::EXECUTING,
+        attacker.name + " unleashed " + move.name + "!"
+      );
+      eventManager.notifyMultiTurnMove(event);
+    }
     
     // Consume PP when actually executing the move
     move.usePP();
@@ -180,28 +182,35 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
     
     // Check for Solar Beam sunny weather skip
     if (move.skipChargeInSunnyWeather() && currentWeather == WeatherCondition::SUN) {
-      std::cout << attacker.name << " used " << move.name << "!" << std::endl;
-      std::cout << "The sunlight is strong! " << attacker.name << " doesn't need to charge!" << std::endl;
+      battleLog.log(BattleLog::Message::USED_MOVE, attacker.name, move.name);
+      battleLog.log(BattleLog::Message::SUN_SKIPS_CHARGE, attacker.name);
       
       // Notify event system for weather skip
-      auto event = eventManager.createMultiTurnMoveEvent(
-        &attacker, &move, BattleEvents::MultiTurnMoveEvent::Phase::EXECUTING,
-        "The sunlight is strong! " + attacker.name + " doesn't need to charge!"
-      );
-      eventManager.notifyMultiTurnMove(event);
+      if (eventManager.hasListeners()) {
+        auto event = eventManager.createMultiTurnMoveEvent(
+          &attacker, &move, BattleEvents::MultiTurnMoveEvent::Phase::EXECUTING,
+          "The sunlight is strong! " + attacker.name + " doesn't need to charge!"
+        );
+        eventManager.notifyMultiTurnMove(event);
+      }
       
       skipCharge = true;
       move.usePP();
     } else {
-      std::cout << attacker.name << " began charging " << move.name << "!" << std::endl;
+      battleLog.log(BattleLog::Message::BEGAN_CHARGING, attacker.name, move.name);
       attacker.startCharging(moveIndex, move.name);
+      if (move.boostsDefenseOnCharge()) {
+        battleLog.log(BattleLog::Message::DEFENSE_ROSE_WHILE_CHARGING, attacker.name, move.name);
+      }
       
       // Notify event system
-      auto event = eventManager.createMultiTurnMoveEvent(
-        &attacker, &move, BattleEvents::MultiTurnMoveEvent::Phase::CHARGING,
-        attacker.name + " began charging " + move.name + "!"
-      );
-      eventManager.notifyMultiTurnMove(event);
+      if (eventManager.hasListeners()) {
+        auto event = eventManager.createMultiTurnMoveEvent(
+          &attacker, &move, BattleEvents::MultiTurnMoveEvent::Phase::CHARGING,
+          attacker.name + " began charging " + move.name + "!"
+        );
+        eventManager.notifyMultiTurnMove(event);
+      }
       
       move.usePP();
       return; // Charging turn, no damage dealt
@@ -212,7 +221,7 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
     }
   } else {
     // Regular move execution
-    std::cout << attacker.name << " used " << move.name << "!" << std::endl;
+    battleLog.log(BattleLog::Message::USED_MOVE, attacker.name, move.name);
     move.usePP();
     
     // Handle recharge moves
@@ -220,17 +229,19 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
       attacker.startRecharge();
       
       // Notify event system
-      auto event = eventManager.createMultiTurnMoveEvent(
-        &attacker, &move, BattleEvents::MultiTurnMoveEvent::Phase::RECHARGING,
-        attacker.name + " must recharge next turn!"
-      );
-      eventManager.notifyMultiTurnMove(event);
+      if (eventManager.hasListeners()) {
+        auto event = eventManager.createMultiTurnMoveEvent(
+          &attacker, &move, BattleEvents::MultiTurnMoveEvent::Phase::RECHARGING,
+          attacker.name + " must recharge next turn!"
+        );
+        eventManager.notifyMultiTurnMove(event);
+      }
     }
   }
 
   // Check if the move hits
   if (!checkMoveAccuracy(move)) {
-    std::cout << attacker.name << "'s attack missed!" << std::endl;
+    battleLog.log(BattleLog::Message::MISSED, attacker.name);
     return;
   }
 
@@ -239,13 +250,13 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
     // OHKO moves ignore normal damage calculation
     // In real Pokemon, OHKO accuracy is based on level difference, but we'll
     // use base accuracy
-    std::cout << "It's a one-hit KO!" << std::endl;
+    battleLog.log(BattleLog::Message::ONE_HIT_KO);
     int previousHealth = defender.current_hp;
     defender.takeDamage(defender.current_hp);  // Deal enough damage to KO
     
     // Emit health change event for OHKO
     auto healthEvent = eventManager.createHealthChangeEvent(
-      &defender, previousHealth, defender.current_hp, attacker.name + "'s " + move.name + " (OHKO)"
+      &defender, previousHealth, defender.current_hp, BattleEvents::EventSource::OHKO_MOVE, &attacker, &move
     );
     eventManager.notifyHealthChanged(healthEvent);
     return;  // OHKO moves don't have other effects
@@ -259,16 +270,15 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
     if (actualHeal > 0) {
       int previousHealth = attacker.current_hp;
       attacker.heal(actualHeal);
-      std::cout << attacker.name << " restored " << actualHeal << " HP! ("
-                << healAmount << "% heal)" << std::endl;
+      battleLog.log(BattleLog::Message::RESTORED_HP, attacker.name, actualHeal, healAmount);
       
       // Emit health change event for healing
       auto healthEvent = eventManager.createHealthChangeEvent(
-        &attacker, previousHealth, attacker.current_hp, move.name + " (heal)"
+        &attacker, previousHealth, attacker.current_hp, BattleEvents::EventSource::HEALING_MOVE, &attacker, &move
       );
       eventManager.notifyHealthChanged(healthEvent);
     } else {
-      std::cout << attacker.name << "'s HP is already full!" << std::endl;
+      battleLog.log(BattleLog::Message::HP_ALREADY_FULL, attacker.name);
     }
     return;  // Healing moves don't do damage or apply other effects
   }
@@ -293,11 +303,9 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
 
       if (statusApplied && !defender.hasStatusCondition()) {
         defender.applyStatusCondition(statusToApply);
-        std::cout << defender.name << " is now "
-                  << defender.getStatusConditionName() << "!" << std::endl;
+        battleLog.log(BattleLog::Message::STATUS_APPLIED, defender.name, defender.getStatusConditionName());
       } else if (statusApplied && defender.hasStatusCondition()) {
-        std::cout << "But it failed! " << defender.name
-                  << " is already affected by a status condition." << std::endl;
+        battleLog.log(BattleLog::Message::STATUS_FAILED, defender.name);
       }
     }
 
@@ -315,7 +323,7 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
     } else if (move.name == "hail") {
       setWeather(WeatherCondition::HAIL, 5);
     } else if (statusToApply == StatusCondition::NONE) {
-      std::cout << "The move had no effect!" << std::endl;
+      battleLog.log(BattleLog::Message::MOVE_NO_EFFECT);
     }
   } else {
     // Damage-dealing move
@@ -338,20 +346,18 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
       auto damageResult = calculateDamageWithEffects(attacker, defender, move);
 
       if (numHits > 1) {
-        std::cout << "Hit " << (hit + 1) << ": ";
+        battleLog.append(BattleLog::Message::HIT_NUMBER, hit + 1);
       }
 
-      std::cout << "It dealt " << damageResult.damage << " damage!";
+      battleLog.append(BattleLog::Message::DAMAGE_DEALT, damageResult.damage);
 
       // Show weather boost if applicable
       double weatherMultiplier =
           Weather::getWeatherDamageMultiplier(currentWeather, move.type);
       if (weatherMultiplier > 1.0) {
-        std::cout << " (Boosted by " << Weather::getWeatherName(currentWeather)
-                  << "!)";
+        battleLog.append(BattleLog::Message::BOOSTED_BY_WEATHER, Weather::getWeatherName(currentWeather));
       } else if (weatherMultiplier < 1.0) {
-        std::cout << " (Weakened by " << Weather::getWeatherName(currentWeather)
-                  << "!)";
+        battleLog.append(BattleLog::Message::WEAKENED_BY_WEATHER, Weather::getWeatherName(currentWeather));
       }
 
       // Track overall move properties
@@ -360,7 +366,7 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
       if (damageResult.wasCritical) wasCritical = true;
 
       if (damageResult.wasCritical) {
-        std::cout << " A critical hit!";
+        battleLog.append(BattleLog::Message::CRITICAL_HIT);
       }
 
       // Show type effectiveness only once for multi-hit moves
@@ -369,16 +375,16 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
             MoveTypeMapping::getMoveType(move.name), defender.types);
 
         if (typeMultiplier > 1.0) {
-          std::cout << " It's super effective!";
+          battleLog.append(BattleLog::Message::SUPER_EFFECTIVE);
         } else if (typeMultiplier < 1.0 && typeMultiplier > 0.0) {
-          std::cout << " It's not very effective...";
+          battleLog.append(BattleLog::Message::NOT_VERY_EFFECTIVE);
         } else if (typeMultiplier == 0.0) {
-          std::cout << " It has no effect!";
+          battleLog.append(BattleLog::Message::NO_TYPE_EFFECT);
         }
         showEffectiveness = false;
       }
 
-      std::cout << std::endl;
+      battleLog.endLine(BattleLog::Level::VERBOSE);
       
       // Store previous health for event
       int previousHealth = defender.current_hp;
@@ -386,24 +392,23 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
       
       // Emit health change event
       auto healthEvent = eventManager.createHealthChangeEvent(
-        &defender, previousHealth, defender.current_hp, attacker.name + "'s " + move.name
+        &defender, previousHealth, defender.current_hp, BattleEvents::EventSource::MOVE, &attacker, &move
       );
       eventManager.notifyHealthChanged(healthEvent);
     }
 
     // Show multi-hit summary
     if (numHits > 1) {
-      std::cout << "Hit " << numHits << " time(s) for " << totalDamage
-                << " total damage!";
+      battleLog.append(BattleLog::Message::MULTI_HIT_TOTAL, numHits, totalDamage);
       if (hadSTAB) {
-        std::cout << " " << attacker.name << " gets STAB!";
+        battleLog.append(BattleLog::Message::MULTI_HIT_STAB, attacker.name);
       }
       if (wasCritical) {
-        std::cout << " At least one critical hit!";
+        battleLog.append(BattleLog::Message::MULTI_HIT_CRITICAL);
       }
-      std::cout << std::endl;
+      battleLog.endLine(BattleLog::Level::VERBOSE);
     } else if (hadSTAB) {
-      std::cout << attacker.name << " gets STAB!" << std::endl;
+      battleLog.log(BattleLog::Message::STAB, attacker.name);
     }
 
     // Handle draining moves (Mega Drain, Absorb, etc.)
@@ -414,12 +419,11 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
       if (actualHeal > 0) {
         int previousHealth = attacker.current_hp;
         attacker.heal(actualHeal);
-        std::cout << attacker.name << " absorbed " << actualHeal << " HP! ("
-                  << move.drain << "% of damage dealt)" << std::endl;
+        battleLog.log(BattleLog::Message::ABSORBED_HP, attacker.name, actualHeal, move.drain);
         
         // Emit health change event for drain healing
         auto healthEvent = eventManager.createHealthChangeEvent(
-          &attacker, previousHealth, attacker.current_hp, move.name + " (drain)"
+          &attacker, previousHealth, attacker.current_hp, BattleEvents::EventSource::DRAIN, &attacker, &move
         );
         eventManager.notifyHealthChanged(healthEvent);
       }
@@ -434,13 +438,11 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
       if (recoilDamage > 0) {
         int previousHealth = attacker.current_hp;
         attacker.takeDamage(recoilDamage);
-        std::cout << attacker.name << " is hit with recoil! (" << recoilPercent
-                  << "% of damage dealt = " << recoilDamage << " HP)"
-                  << std::endl;
+        battleLog.log(BattleLog::Message::RECOIL, attacker.name, recoilPercent, recoilDamage);
         
         // Emit health change event for recoil damage
         auto healthEvent = eventManager.createHealthChangeEvent(
-          &attacker, previousHealth, attacker.current_hp, move.name + " (recoil)"
+          &attacker, previousHealth, attacker.current_hp, BattleEvents::EventSource::RECOIL, &attacker, &move
         );
         eventManager.notifyHealthChanged(healthEvent);
       }
@@ -451,7 +453,7 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
       auto flinchDistribution = std::uniform_int_distribution<int>(1, 100);
       if (flinchDistribution(rng) <= move.flinch_chance) {
         defender.applyStatusCondition(StatusCondition::FLINCH);
-        std::cout << defender.name << " flinched!" << std::endl;
+        battleLog.log(BattleLog::Message::FLINCHED, defender.name);
       }
     }
 
@@ -462,8 +464,7 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
       if (distribution(rng) <= move.ailment_chance &&
           !defender.hasStatusCondition()) {
         defender.applyStatusCondition(statusToApply);
-        std::cout << defender.name << " is now "
-                  << defender.getStatusConditionName() << "!" << std::endl;
+        battleLog.log(BattleLog::Message::STATUS_APPLIED, defender.name, defender.getStatusConditionName());
       }
     }
   }
@@ -557,11 +558,13 @@ bool Battle::playerFirst(const Move &playerMove,
 }
 
 int Battle::getMoveChoice() const {
+  TRACE_SCOPE("battle", "Battle::playerMoveSelection");
+
   std::cout << "\nChoose an action:\n";
 
   // Check if Pokemon must recharge
   if (selectedPokemon->mustRecharge()) {
-    std::cout << "\n" << selectedPokemon->name << " must recharge this turn and cannot act!\n";
+    battleLog.log(BattleLog::Message::MUST_RECHARGE_THIS_TURN, selectedPokemon->name);
     return -2; // Special value to indicate forced recharge
   }
   
@@ -569,7 +572,7 @@ int Battle::getMoveChoice() const {
   if (selectedPokemon->isCharging()) {
     int chargingMoveIndex = selectedPokemon->getChargingMoveIndex();
     std::string chargingMoveName = selectedPokemon->getChargingMoveName();
-    std::cout << "\n" << selectedPokemon->name << " is charging " << chargingMoveName << " and must execute it!\n";
+    battleLog.log(BattleLog::Message::MUST_EXECUTE_CHARGE, selectedPokemon->name, chargingMoveName);
     return chargingMoveIndex; // Must execute the charging move
   }
 
@@ -690,20 +693,20 @@ int Battle::getMoveChoice() const {
   );
   
   if (!actionResult.isValid()) {
-    std::cout << "Failed to get valid action selection: " << actionResult.errorMessage << std::endl;
+    battleLog.log(BattleLog::Message::ACTION_FAILED, actionResult.errorMessage);
     
     // Handle multi-turn move constraints in fallback
     if (selectedPokemon->mustRecharge()) {
-      std::cout << "Pokemon must recharge - returning recharge indicator.\n";
+      battleLog.log(BattleLog::Message::FALLBACK_RECHARGE);
       return -2; // Special value for forced recharge
     }
     
     if (selectedPokemon->isCharging()) {
-      std::cout << "Pokemon is charging - returning charging move index.\n";
+      battleLog.log(BattleLog::Message::FALLBACK_CHARGING);
       return selectedPokemon->getChargingMoveIndex();
     }
     
-    std::cout << "Auto-selecting first available move as fallback.\n";
+    battleLog.log(BattleLog::Message::FALLBACK_FIRST_MOVE);
     
     // Find first usable move as fallback
     for (size_t i = 0; i < selectedPokemon->moves.size(); ++i) {
@@ -791,8 +794,8 @@ int Battle::getPokemonChoice() const {
   );
   
   if (!switchResult.isValid()) {
-    std::cout << "Failed to get valid Pokemon switch selection: " << switchResult.errorMessage << std::endl;
-    std::cout << "Auto-selecting first available Pokemon as fallback.\n";
+    battleLog.log(BattleLog::Message::SWITCH_FAILED, switchResult.errorMessage);
+    battleLog.log(BattleLog::Message::FALLBACK_FIRST_POKEMON);
     
     // Return first available Pokemon as fallback
     if (!availableIndices.empty()) {
@@ -824,10 +827,7 @@ bool Battle::isBattleOver() const {
 }
 
 void Battle::startBattle() {
-  std::cout << "\n======================================================== "
-               "BATTLE START "
-            << "========================================================="
-            << std::endl;
+  battleLog.log(BattleLog::Message::BATTLE_START);
 
   // Initial Pokemon selection
   selectOpponentPokemon();
@@ -835,11 +835,8 @@ void Battle::startBattle() {
 
   // Main battle loop
   while (!isBattleOver()) {
-    std::cout
-        << "==============================================================="
-        << "==============================================================="
-        << std::endl;
-    std::cout << std::endl;
+    TRACE_SCOPE("battle", "Battle::turn");
+    battleLog.log(BattleLog::Message::TURN_SEPARATOR);
 
     // Process status conditions at start of turn
     if (selectedPokemon->hasStatusCondition()) {
@@ -870,7 +867,7 @@ void Battle::startBattle() {
       if (playerChoice == -2) {
         // Pokemon must recharge - skip turn
         selectedPokemon->finishRecharge();
-        std::cout << selectedPokemon->name << " is recharging and cannot move!" << std::endl;
+        battleLog.log(BattleLog::Message::RECHARGING, selectedPokemon->name);
         
         // Opponent still gets to attack
         int opponentMoveIndex = getAIMoveChoice();
@@ -878,20 +875,19 @@ void Battle::startBattle() {
         // Handle opponent recharge state
         if (opponentMoveIndex == -2) {
           opponentSelectedPokemon->finishRecharge();
-          std::cout << opponentSelectedPokemon->name << " is recharging and cannot move!" << std::endl;
+          battleLog.log(BattleLog::Message::RECHARGING, opponentSelectedPokemon->name);
         } else {
           executeMove(*opponentSelectedPokemon, *selectedPokemon, opponentMoveIndex);
         }
         
-        std::cout << std::endl;
+        battleLog.log(BattleLog::Message::BLANK_LINE);
       } else if (playerChoice == -1) {
         // Player wants to switch Pokemon
         int chosenIndex = getPokemonChoice();
         if (chosenIndex >= 0) {
-          std::cout << "\n"
-                    << selectedPokemon->name << ", come back!" << std::endl;
+          battleLog.log(BattleLog::Message::COME_BACK, selectedPokemon->name);
           selectedPokemon = playerTeam.getPokemon(chosenIndex);
-          std::cout << "Go, " << selectedPokemon->name << "!" << std::endl;
+          battleLog.log(BattleLog::Message::GO, selectedPokemon->name);
           
           // Register new Pokemon with health bar system
           if (healthBarListener && selectedPokemon) {
@@ -906,13 +902,13 @@ void Battle::startBattle() {
           // Handle opponent recharge state
           if (opponentMoveIndex == -2) {
             opponentSelectedPokemon->finishRecharge();
-            std::cout << opponentSelectedPokemon->name << " is recharging and cannot move!" << std::endl;
+            battleLog.log(BattleLog::Message::RECHARGING, opponentSelectedPokemon->name);
           } else {
             executeMove(*opponentSelectedPokemon, *selectedPokemon,
                         opponentMoveIndex);
           }
 
-          std::cout << std::endl;
+          battleLog.log(BattleLog::Message::BLANK_LINE);
         }
       } else {
         // Player chose a move
@@ -925,7 +921,7 @@ void Battle::startBattle() {
         if (opponentMoveIndex == -2) {
           // AI must recharge
           opponentSelectedPokemon->finishRecharge();
-          std::cout << opponentSelectedPokemon->name << " is recharging and cannot move!" << std::endl;
+          battleLog.log(BattleLog::Message::RECHARGING, opponentSelectedPokemon->name);
           
           // Only player moves
           executeMove(*selectedPokemon, *opponentSelectedPokemon, playerChoice);
@@ -950,11 +946,14 @@ void Battle::startBattle() {
           }
         }
 
+        // Show the moves before pausing
+        battleLog.flush();
+
         // Wait a moment to simulate turn processing
         std::this_thread::sleep_for(std::chrono::seconds(1));
 
         // Health bars updated through event system
-        std::cout << std::endl;
+        battleLog.log(BattleLog::Message::BLANK_LINE);
 
         // Wait a moment to simulate turn processing
         std::this_thread::sleep_for(std::chrono::seconds(1));
@@ -963,23 +962,20 @@ void Battle::startBattle() {
 
     // Handle fainted Pokemon (simplified for now)
     if (!selectedPokemon->isAlive()) {
-      std::cout << "\n"
-                << selectedPokemon->name << " has fainted!" << std::endl;
+      battleLog.log(BattleLog::Message::FAINTED, selectedPokemon->name);
       auto *newPokemon = playerTeam.getFirstAlivePokemon();
       if (newPokemon) {
         selectedPokemon = newPokemon;
-        std::cout << "\nYou send out " << selectedPokemon->name << "!\n";
+        battleLog.log(BattleLog::Message::SEND_OUT, selectedPokemon->name);
       }
     }
 
     if (!opponentSelectedPokemon->isAlive()) {
-      std::cout << "\nOpponent's " << opponentSelectedPokemon->name
-                << " has fainted!" << std::endl;
+      battleLog.log(BattleLog::Message::OPPONENT_FAINTED, opponentSelectedPokemon->name);
       auto *newPokemon = opponentTeam.getFirstAlivePokemon();
       if (newPokemon) {
         opponentSelectedPokemon = newPokemon;
-        std::cout << "\nOpponent sends out " << opponentSelectedPokemon->name
-                  << "!\n";
+        battleLog.log(BattleLog::Message::OPPONENT_SENDS_OUT, opponentSelectedPokemon->name);
         
         // Register new opponent Pokemon with health bar system
         if (healthBarListener && opponentSelectedPokemon) {
@@ -987,24 +983,27 @@ void Battle::startBattle() {
         }
       }
     }
+
+    // One write per turn; reading the next choice from std::cin flushes too
+    battleLog.flush();
   }
 
   // Display battle result
   BattleResult result = getBattleResult();
   switch (result) {
     case BattleResult::PLAYER_WINS:
-      std::cout
-          << "\nAll opponent's Pokémon have fainted! You won the battle!\n";
+      battleLog.log(BattleLog::Message::PLAYER_WINS);
       break;
     case BattleResult::OPPONENT_WINS:
-      std::cout << "\nAll your Pokémon have fainted! You lost the battle.\n";
+      battleLog.log(BattleLog::Message::OPPONENT_WINS);
       break;
     case BattleResult::DRAW:
-      std::cout << "\nIt's a draw! All Pokémon have fainted.\n";
+      battleLog.log(BattleLog::Message::DRAW);
       break;
     default:
       break;
   }
+  battleLog.flush();
 }
 
 // STAB (Same Type Attack Bonus) implementation
@@ -1111,7 +1110,7 @@ void Battle::executeTurn() {
 void Battle::handlePokemonFainted() {
   // Handle player Pokemon fainting
   if (!selectedPokemon->isAlive()) {
-    std::cout << "\n" << selectedPokemon->name << " has fainted!" << std::endl;
+    battleLog.log(BattleLog::Message::FAINTED, selectedPokemon->name);
 
     // Check if player has any Pokemon left
     if (!playerTeam.hasAlivePokemon()) {
@@ -1122,7 +1121,7 @@ void Battle::handlePokemonFainted() {
     int chosenIndex = getPokemonChoice();
     if (chosenIndex >= 0) {
       selectedPokemon = playerTeam.getPokemon(chosenIndex);
-      std::cout << "\nYou send out " << selectedPokemon->name << "!\n";
+      battleLog.log(BattleLog::Message::SEND_OUT, selectedPokemon->name);
       
       // Register new Pokemon with health bar system
       if (healthBarListener && selectedPokemon) {
@@ -1133,8 +1132,7 @@ void Battle::handlePokemonFainted() {
 
   // Handle opponent Pokemon fainting
   if (!opponentSelectedPokemon->isAlive()) {
-    std::cout << "\nOpponent's " << opponentSelectedPokemon->name
-              << " has fainted!" << std::endl;
+    battleLog.log(BattleLog::Message::OPPONENT_FAINTED, opponentSelectedPokemon->name);
 
     // Check if opponent has any Pokemon left
     if (!opponentTeam.hasAlivePokemon()) {
@@ -1145,8 +1143,7 @@ void Battle::handlePokemonFainted() {
     auto *newPokemon = opponentTeam.getFirstAlivePokemon();
     if (newPokemon) {
       opponentSelectedPokemon = newPokemon;
-      std::cout << "\nOpponent sends out " << opponentSelectedPokemon->name
-                << "!\n";
+      battleLog.log(BattleLog::Message::OPPONENT_SENDS_OUT, opponentSelectedPokemon->name);
       
       // Register new opponent Pokemon with health bar system
       if (healthBarListener && opponentSelectedPokemon) {
@@ -1163,89 +1160,87 @@ void Battle::applyStatModification(Pokemon &attacker, Pokemon &defender,
 
   if (move.name == "swords-dance") {
     attacker.modifyAttack(2);
-    std::cout << attacker.name << "'s Attack rose sharply!" << std::endl;
+    battleLog.log(BattleLog::Message::ATTACK_ROSE_SHARPLY, attacker.name);
   } else if (move.name == "growl") {
     defender.modifyAttack(-1);
-    std::cout << defender.name << "'s Attack fell!" << std::endl;
+    battleLog.log(BattleLog::Message::ATTACK_FELL, defender.name);
   } else if (move.name == "agility") {
     attacker.modifySpeed(2);
-    std::cout << attacker.name << "'s Speed rose sharply!" << std::endl;
+    battleLog.log(BattleLog::Message::SPEED_ROSE_SHARPLY, attacker.name);
   } else if (move.name == "harden") {
     attacker.modifyDefense(1);
-    std::cout << attacker.name << "'s Defense rose!" << std::endl;
+    battleLog.log(BattleLog::Message::DEFENSE_ROSE, attacker.name);
   } else if (move.name == "defense-curl") {
     attacker.modifyDefense(1);
-    std::cout << attacker.name << "'s Defense rose!" << std::endl;
+    battleLog.log(BattleLog::Message::DEFENSE_ROSE, attacker.name);
   } else if (move.name == "iron-defense") {
     attacker.modifyDefense(2);
-    std::cout << attacker.name << "'s Defense rose sharply!" << std::endl;
+    battleLog.log(BattleLog::Message::DEFENSE_ROSE_SHARPLY, attacker.name);
   } else if (move.name == "calm-mind") {
     attacker.modifySpecialAttack(1);
     attacker.modifySpecialDefense(1);
-    std::cout << attacker.name << "'s Special Attack and Special Defense rose!"
-              << std::endl;
+    battleLog.log(BattleLog::Message::SPECIAL_STATS_ROSE, attacker.name);
   } else if (move.name == "leer") {
     defender.modifyDefense(-1);
-    std::cout << defender.name << "'s Defense fell!" << std::endl;
+    battleLog.log(BattleLog::Message::DEFENSE_FELL, defender.name);
   } else if (move.name == "tail-whip") {
     defender.modifyDefense(-1);
-    std::cout << defender.name << "'s Defense fell!" << std::endl;
+    battleLog.log(BattleLog::Message::DEFENSE_FELL, defender.name);
   } else if (move.name == "amnesia") {
     attacker.modifySpecialDefense(2);
-    std::cout << attacker.name << "'s Special Defense rose sharply!"
-              << std::endl;
+    battleLog.log(BattleLog::Message::SPECIAL_DEFENSE_ROSE_SHARPLY, attacker.name);
   } else if (move.name == "barrier") {
     attacker.modifyDefense(2);
-    std::cout << attacker.name << "'s Defense rose sharply!" << std::endl;
+    battleLog.log(BattleLog::Message::DEFENSE_ROSE_SHARPLY, attacker.name);
   } else if (move.name == "sharpen") {
     attacker.modifyAttack(1);
-    std::cout << attacker.name << "'s Attack rose!" << std::endl;
+    battleLog.log(BattleLog::Message::ATTACK_ROSE, attacker.name);
   } else if (move.name == "meditate") {
     attacker.modifyAttack(1);
-    std::cout << attacker.name << "'s Attack rose!" << std::endl;
+    battleLog.log(BattleLog::Message::ATTACK_ROSE, attacker.name);
   } else if (move.name == "dragon-dance") {
     attacker.modifyAttack(1);
     attacker.modifySpeed(1);
-    std::cout << attacker.name << "'s Attack and Speed rose!" << std::endl;
+    battleLog.log(BattleLog::Message::ATTACK_AND_SPEED_ROSE, attacker.name);
   } else if (move.name == "nasty-plot") {
     attacker.modifySpecialAttack(2);
-    std::cout << attacker.name << "'s Special Attack rose sharply!"
-              << std::endl;
+    battleLog.log(BattleLog::Message::SPECIAL_ATTACK_ROSE_SHARPLY, attacker.name);
   } else {
-    std::cout << attacker.name << " used " << move.name
-              << ", but it had no stat effect!" << std::endl;
+    battleLog.log(BattleLog::Message::NO_STAT_EFFECT, attacker.name, move.name);
   }
 }
 
 void Battle::processWeather() {
+  TRACE_SCOPE("battle", "Battle::weather");
+
   if (currentWeather == WeatherCondition::NONE) {
     return;
   }
 
   // Display weather effect
-  std::cout << "Weather: " << Weather::getWeatherName(currentWeather);
+  battleLog.append(BattleLog::Message::WEATHER_STATUS, Weather::getWeatherName(currentWeather));
   if (weatherTurnsRemaining > 0) {
-    std::cout << " (" << weatherTurnsRemaining << " turns left)";
+    battleLog.append(BattleLog::Message::WEATHER_TURNS_LEFT, weatherTurnsRemaining);
   }
 
   // Show current weather boosts
   switch (currentWeather) {
     case WeatherCondition::RAIN:
-      std::cout << " [Water +50%, Fire -50%]";
+      battleLog.append(BattleLog::Message::RAIN_EFFECTS);
       break;
     case WeatherCondition::SUN:
-      std::cout << " [Fire +50%, Water -50%]";
+      battleLog.append(BattleLog::Message::SUN_EFFECTS);
       break;
     case WeatherCondition::SANDSTORM:
-      std::cout << " [Sandstorm damage]";
+      battleLog.append(BattleLog::Message::SANDSTORM_EFFECTS);
       break;
     case WeatherCondition::HAIL:
-      std::cout << " [Hail damage]";
+      battleLog.append(BattleLog::Message::HAIL_EFFECTS);
       break;
     default:
       break;
   }
-  std::cout << std::endl;
+  battleLog.endLine(BattleLog::Level::VERBOSE);
 
   // Apply weather damage to Pokemon
   if (selectedPokemon && selectedPokemon->isAlive()) {
@@ -1256,14 +1251,12 @@ void Battle::processWeather() {
       if (damage > 0) {
         int previousHealth = selectedPokemon->current_hp;
         selectedPokemon->takeDamage(damage);
-        std::cout << selectedPokemon->name << " is hurt by "
-                  << Weather::getWeatherName(currentWeather) << "! (-" << damage
-                  << " HP)" << std::endl;
+        battleLog.log(BattleLog::Message::HURT_BY_WEATHER, selectedPokemon->name,
+                      Weather::getWeatherName(currentWeather), damage);
         
         // Emit health change event for weather damage
-        auto healthEvent = eventManager.createHealthChangeEvent(
-          selectedPokemon, previousHealth, selectedPokemon->current_hp, 
-          Weather::getWeatherName(currentWeather) + " damage"
+        auto healthEvent = eventManager.createWeatherDamageEvent(
+          selectedPokemon, previousHealth, selectedPokemon->current_hp, currentWeather
         );
         eventManager.notifyHealthChanged(healthEvent);
       }
@@ -1278,14 +1271,12 @@ void Battle::processWeather() {
       if (damage > 0) {
         int previousHealth = opponentSelectedPokemon->current_hp;
         opponentSelectedPokemon->takeDamage(damage);
-        std::cout << opponentSelectedPokemon->name << " is hurt by "
-                  << Weather::getWeatherName(currentWeather) << "! (-" << damage
-                  << " HP)" << std::endl;
+        battleLog.log(BattleLog::Message::HURT_BY_WEATHER, opponentSelectedPokemon->name,
+                      Weather::getWeatherName(currentWeather), damage);
         
         // Emit health change event for weather damage
-        auto healthEvent = eventManager.createHealthChangeEvent(
-          opponentSelectedPokemon, previousHealth, opponentSelectedPokemon->current_hp,
-          Weather::getWeatherName(currentWeather) + " damage"
+        auto healthEvent = eventManager.createWeatherDamageEvent(
+          opponentSelectedPokemon, previousHealth, opponentSelectedPokemon->current_hp, currentWeather
         );
         eventManager.notifyHealthChanged(healthEvent);
       }
@@ -1296,8 +1287,7 @@ void Battle::processWeather() {
   if (weatherTurnsRemaining > 0) {
     weatherTurnsRemaining--;
     if (weatherTurnsRemaining == 0) {
-      std::cout << "The " << Weather::getWeatherName(currentWeather)
-                << " stopped." << std::endl;
+      battleLog.log(BattleLog::Message::WEATHER_STOPPED, Weather::getWeatherName(currentWeather));
       currentWeather = WeatherCondition::NONE;
     }
   }
@@ -1307,41 +1297,43 @@ void Battle::setWeather(WeatherCondition weather, int turns) {
   currentWeather = weather;
   weatherTurnsRemaining = turns;
   if (weather != WeatherCondition::NONE) {
-    std::cout << Weather::getWeatherName(weather) << " started!";
+    battleLog.append(BattleLog::Message::WEATHER_STARTED, Weather::getWeatherName(weather));
 
     // Show what boost the weather provides
     switch (weather) {
       case WeatherCondition::RAIN:
-        std::cout << " (Water moves boosted 1.5x, Fire moves weakened 0.5x)";
+        battleLog.append(BattleLog::Message::RAIN_STARTED);
         break;
       case WeatherCondition::SUN:
-        std::cout << " (Fire moves boosted 1.5x, Water moves weakened 0.5x)";
+        battleLog.append(BattleLog::Message::SUN_STARTED);
         break;
       case WeatherCondition::SANDSTORM:
-        std::cout << " (Non Rock/Ground/Steel types take damage each turn)";
+        battleLog.append(BattleLog::Message::SANDSTORM_STARTED);
         break;
       case WeatherCondition::HAIL:
-        std::cout << " (Non Ice types take damage each turn)";
+        battleLog.append(BattleLog::Message::HAIL_STARTED);
         break;
       default:
         break;
     }
-    std::cout << std::endl;
+    battleLog.endLine(BattleLog::Level::VERBOSE);
   }
 }
 
 void Battle::displayWeather() const {
   if (currentWeather != WeatherCondition::NONE) {
-    std::cout << "Current weather: " << Weather::getWeatherName(currentWeather);
+    battleLog.append(BattleLog::Message::CURRENT_WEATHER, Weather::getWeatherName(currentWeather));
     if (weatherTurnsRemaining > 0) {
-      std::cout << " (" << weatherTurnsRemaining << " turns remaining)";
+      battleLog.append(BattleLog::Message::WEATHER_TURNS_REMAINING, weatherTurnsRemaining);
     }
-    std::cout << std::endl;
+    battleLog.endLine(BattleLog::Level::VERBOSE);
   }
 }
 
 // AI Move Selection Implementation
 int Battle::getAIMoveChoice() const {
+  TRACE_SCOPE("battle", "Battle::aiMoveSelection");
+
   // Check if AI Pokemon must recharge
   if (opponentSelectedPokemon->mustRecharge()) {
     return -2; // Special value for forced recharge
@@ -1755,6 +1747,9 @@ void Battle::configureHealthBarAnimation(HealthBarAnimator::AnimationSpeed speed
     config.speed = speed;
     config.colorTheme = theme;
     
+    // Drop the old listener so only one renderer draws the pinned bars
+    eventManager.unsubscribe(healthBarListener);
+    
     // Create new animator with updated config
     healthBarAnimator = std::make_shared<HealthBarAnimator>(config);
     
@@ -1776,15 +1771,16 @@ void Battle::configureHealthBarAnimation(HealthBarAnimator::AnimationSpeed speed
 
 void Battle::processStatusConditionWithEvents(Pokemon& pokemon) {
   if (!pokemon.hasStatusCondition()) return;
+  TRACE_SCOPE("battle", "Battle::status");
   
   int previousHealth = pokemon.current_hp;
+  StatusCondition previousStatus = pokemon.status;
   pokemon.processStatusCondition();
   
   // Only emit event if health actually changed
   if (pokemon.current_hp != previousHealth) {
-    auto healthEvent = eventManager.createHealthChangeEvent(
-      &pokemon, previousHealth, pokemon.current_hp, 
-      pokemon.getStatusConditionName() + " damage"
+    auto healthEvent = eventManager.createStatusDamageEvent(
+      &pokemon, previousHealth, pokemon.current_hp, previousStatus
     );
     eventManager.notifyHealthChanged(healthEvent);
   }
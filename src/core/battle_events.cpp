@@ -1,109 +1,188 @@
 #include "battle_events.h"
 #include "pokemon.h"
 #include "move.h"
+#include "weather.h"
 #include <algorithm>
 
 namespace BattleEvents {
 
+namespace {
+
+std::string statusDamageName(StatusCondition status) {
+    switch (status) {
+        case StatusCondition::POISON: return "Poisoned";
+        case StatusCondition::BURN: return "Burned";
+        default: return "Status";
+    }
+}
+
+} // namespace
+
+std::string describeSource(const HealthChangeEvent& event) {
+    const std::string user = event.sourcePokemon ? event.sourcePokemon->name + "'s " : "";
+    const std::string move = event.sourceMove ? event.sourceMove->name : "move";
+    switch (event.source) {
+        case EventSource::MOVE: return user + move;
+        case EventSource::OHKO_MOVE: return user + move + " (OHKO)";
+        case EventSource::HEALING_MOVE: return move + " (heal)";
+        case EventSource::DRAIN: return move + " (drain)";
+        case EventSource::RECOIL: return move + " (recoil)";
+        case EventSource::WEATHER: return Weather::getWeatherName(event.sourceWeather) + " damage";
+        case EventSource::STATUS: return statusDamageName(event.sourceStatus) + " damage";
+        case EventSource::SWITCH: return "switch";
+        case EventSource::UNKNOWN: break;
+    }
+    return "";
+}
+
 // BattleEventManager implementation
 
 void BattleEventManager::subscribe(ListenerPtr listener) {
     if (listener && std::find(listeners_.begin(), listeners_.end(), listener) == listeners_.end()) {
         listeners_.push_back(listener);
+        ++generation_;
     }
 }
 
 void BattleEventManager::unsubscribe(ListenerPtr listener) {
-    listeners_.erase(
-        std::remove(listeners_.begin(), listeners_.end(), listener),
-        listeners_.end()
-    );
+    auto it = std::find(listeners_.begin(), listeners_.end(), listener);
+    if (!listener || it == listeners_.end()) {
+        return;
+    }
+    ++generation_;
+    if (dispatchDepth_ > 0) {
+        // Leave a tombstone so indices in the running dispatch stay valid
+        removedDuringDispatch_.push_back(std::move(*it));
+        it->reset();
+        ++tombstones_;
+    } else {
+        listeners_.erase(it);
+    }
 }
 
 void BattleEventManager::clear() {
-    listeners_.clear();
+    if (dispatchDepth_ > 0) {
+        for (auto& listener : listeners_) {
+            if (listener) {
+                removedDuringDispatch_.push_back(std::move(listener));
+                listener.reset();
+                ++tombstones_;
+            }
+        }
+    } else {
+        listeners_.clear();
+    }
+    ++generation_;
+}
+
+void BattleEventManager::compact() {
+    listeners_.erase(std::remove(listeners_.begin(), listeners_.end(), nullptr), listeners_.end());
+    tombstones_ = 0;
+    removedDuringDispatch_.clear();
 }
 
 void BattleEventManager::notifyHealthChanged(const HealthChangeEvent& event) {
-    notifyAll(event, [](ListenerPtr listener, const HealthChangeEvent& e) {
-        listener->onHealthChanged(e);
+    notifyAll(event, [](BattleEventListener& listener, const HealthChangeEvent& e) {
+        listener.onHealthChanged(e);
     });
 }
 
 void BattleEventManager::notifyStatusChanged(const StatusChangeEvent& event) {
-    notifyAll(event, [](ListenerPtr listener, const StatusChangeEvent& e) {
-        listener->onStatusChanged(e);
+    notifyAll(event, [](BattleEventListener& listener, const StatusChangeEvent& e) {
+        listener.onStatusChanged(e);
     });
 }
 
 void BattleEventManager::notifyMoveUsed(const MoveUsedEvent& event) {
-    notifyAll(event, [](ListenerPtr listener, const MoveUsedEvent& e) {
-        listener->onMoveUsed(e);
+    notifyAll(event, [](BattleEventListener& listener, const MoveUsedEvent& e) {
+        listener.onMoveUsed(e);
     });
 }
 
 void BattleEventManager::notifyWeatherChanged(const WeatherChangeEvent& event) {
-    notifyAll(event, [](ListenerPtr listener, const WeatherChangeEvent& e) {
-        listener->onWeatherChanged(e);
+    notifyAll(event, [](BattleEventListener& listener, const WeatherChangeEvent& e) {
+        listener.onWeatherChanged(e);
     });
 }
 
 void BattleEventManager::notifyPokemonSwitch(const PokemonSwitchEvent& event) {
-    notifyAll(event, [](ListenerPtr listener, const PokemonSwitchEvent& e) {
-        listener->onPokemonSwitch(e);
+    notifyAll(event, [](BattleEventListener& listener, const PokemonSwitchEvent& e) {
+        listener.onPokemonSwitch(e);
     });
 }
 
 void BattleEventManager::notifyBattleStart(const BattleStartEvent& event) {
-    notifyAll(event, [](ListenerPtr listener, const BattleStartEvent& e) {
-        listener->onBattleStart(e);
+    notifyAll(event, [](BattleEventListener& listener, const BattleStartEvent& e) {
+        listener.onBattleStart(e);
     });
 }
 
 void BattleEventManager::notifyBattleEnd(const BattleEndEvent& event) {
-    notifyAll(event, [](ListenerPtr listener, const BattleEndEvent& e) {
-        listener->onBattleEnd(e);
+    notifyAll(event, [](BattleEventListener& listener, const BattleEndEvent& e) {
+        listener.onBattleEnd(e);
     });
 }
 
 void BattleEventManager::notifyTurnStart(int turnNumber) {
-    for (auto& listener : listeners_) {
-        if (listener) {
-            listener->onTurnStart(turnNumber);
-        }
-    }
+    notifyAll(turnNumber, [](BattleEventListener& listener, int turn) {
+        listener.onTurnStart(turn);
+    });
 }
 
 void BattleEventManager::notifyTurnEnd(int turnNumber) {
-    for (auto& listener : listeners_) {
-        if (listener) {
-            listener->onTurnEnd(turnNumber);
-        }
-    }
+    notifyAll(turnNumber, [](BattleEventListener& listener, int turn) {
+        listener.onTurnEnd(turn);
+    });
 }
 
 void BattleEventManager::notifyMultiTurnMove(const MultiTurnMoveEvent& event) {
-    notifyAll(event, [](ListenerPtr listener, const MultiTurnMoveEvent& e) {
-        listener->onMultiTurnMove(e);
+    notifyAll(event, [](BattleEventListener& listener, const MultiTurnMoveEvent& e) {
+        listener.onMultiTurnMove(e);
+    });
+}
+
+void BattleEventManager::notifyActionChosen(const ActionChosenEvent& event) {
+    notifyAll(event, [](BattleEventListener& listener, const ActionChosenEvent& e) {
+        listener.onActionChosen(e);
     });
 }
 
 // Convenience event creation methods
 
-HealthChangeEvent BattleEventManager::createHealthChangeEvent(Pokemon* pokemon, int oldHp, int newHp, 
-                                                            const std::string& source) {
+HealthChangeEvent BattleEventManager::createHealthChangeEvent(Pokemon* pokemon, int oldHp, int newHp,
+                                                            EventSource source,
+                                                            const Pokemon* sourcePokemon,
+                                                            const Move* sourceMove) {
     return HealthChangeEvent{
         pokemon,
         oldHp,
         newHp,
         oldHp - newHp,  // Positive for damage, negative for healing
-        source
+        source,
+        sourcePokemon,
+        sourceMove,
+        WeatherCondition::NONE,
+        StatusCondition::NONE
     };
 }
 
+HealthChangeEvent BattleEventManager::createWeatherDamageEvent(Pokemon* pokemon, int oldHp, int newHp,
+                                                             WeatherCondition weather) {
+    HealthChangeEvent event = createHealthChangeEvent(pokemon, oldHp, newHp, EventSource::WEATHER);
+    event.sourceWeather = weather;
+    return event;
+}
+
+HealthChangeEvent BattleEventManager::createStatusDamageEvent(Pokemon* pokemon, int oldHp, int newHp,
+                                                            StatusCondition status) {
+    HealthChangeEvent event = createHealthChangeEvent(pokemon, oldHp, newHp, EventSource::STATUS);
+    event.sourceStatus = status;
+    return event;
+}
+
 StatusChangeEvent BattleEventManager::createStatusChangeEvent(Pokemon* pokemon, StatusCondition oldStatus, 
                                                             StatusCondition newStatus, int turns, 
-                                                            const std::string& source) {
+                                                            EventSource source) {
     return StatusChangeEvent{
         pokemon,
         oldStatus,
@@ -139,13 +218,18 @@ MultiTurnMoveEvent BattleEventManager::createMultiTurnMoveEvent(Pokemon* pokemon
 // Template implementation for safe notification
 template<typename EventType, typename NotifyFunc>
 void BattleEventManager::notifyAll(const EventType& event, NotifyFunc func) {
-    // Create a copy of listeners to avoid issues if listeners are modified during notification
-    auto listenersCopy = listeners_;
+    if (listeners_.empty()) {
+        return;
+    }
     
-    for (auto& listener : listenersCopy) {
+    // Index into the live list: listeners added by a handler are reached in the
+    // same dispatch, removed ones are tombstoned (see unsubscribe)
+    ++dispatchDepth_;
+    for (size_t i = 0; i < listeners_.size(); ++i) {
+        BattleEventListener* listener = listeners_[i].get();
         if (listener) {
             try {
-                func(listener, event);
+                func(*listener, event);
             } catch (...) {
                 // Swallow exceptions from listeners to prevent one bad listener 
                 // from breaking the notification chain
@@ -153,6 +237,9 @@ void BattleEventManager::notifyAll(const EventType& event, NotifyFunc func) {
             }
         }
     }
+    if (--dispatchDepth_ == 0 && tombstones_ > 0) {
+        compact();
+    }
 }
 
 } // namespace BattleEvents
\ No newline at end of file
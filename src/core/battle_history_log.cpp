@@ -0,0 +1,684 @@
+#include "battle_history_log.h"
+#include "binary_io.h"
+#include "json.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <random>
+
+using json = nlohmann::json;
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr char kLogMagic[4] = {'P', 'B', 'H', 'L'};
+constexpr char kSnapshotMagic[4] = {'P', 'B', 'H', 'S'};
+constexpr uint32_t kFormatVersion = 1;
+constexpr uint64_t kLogHeaderSize = 16;         // magic + version + generation
+constexpr uint32_t kMaxRecordBytes = 1 << 20;   // Anything larger is treated as corruption
+
+uint64_t newGeneration() {
+    std::random_device rd;
+    const auto now = static_cast<uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+    return (static_cast<uint64_t>(rd()) << 32) ^ rd() ^ now;
+}
+
+void ensureParentDirectory(const std::string& path) {
+    const fs::path parent = fs::path(path).parent_path();
+    if (!parent.empty() && !fs::exists(parent)) {
+        std::error_code ec;
+        fs::create_directories(parent, ec);
+    }
+}
+
+} // namespace
+
+BattleHistoryLog::BattleHistoryLog(const std::string& log_path, const std::string& snapshot_path,
+                                   const Settings& settings)
+    : log_path(log_path), snapshot_path(snapshot_path), settings(settings),
+      is_open(false), generation(0), log_size(0), dead_bytes(0),
+      live_record_count(0), appends_since_snapshot(0) {}
+
+BattleHistoryLog::~BattleHistoryLog() {
+    std::lock_guard<std::mutex> lock(log_mutex);
+    if (is_open && appends_since_snapshot > 0) {
+        writeSnapshotLocked();
+    }
+}
+
+bool BattleHistoryLog::open(const std::string& legacy_json_path) {
+    std::lock_guard<std::mutex> lock(log_mutex);
+    if (is_open) {
+        return true;
+    }
+
+    teams.clear();
+    team_cleared_at.clear();
+    dead_bytes = 0;
+    live_record_count = 0;
+    appends_since_snapshot = 0;
+
+    ensureParentDirectory(log_path);
+
+    if (!fs::exists(log_path)) {
+        if (!createEmptyLog() || !reopenAppendStream()) {
+            return false;
+        }
+        is_open = true;
+        if (!legacy_json_path.empty() && fs::exists(legacy_json_path)) {
+            importLegacyJson(legacy_json_path);
+            writeSnapshotLocked();
+        }
+        return true;
+    }
+
+    std::ifstream in(log_path, std::ios::binary);
+    if (!in.is_open() || !readHeader(in, generation)) {
+        return false;
+    }
+    in.close();
+
+    uint64_t covered_offset = kLogHeaderSize;
+    if (!loadSnapshot(covered_offset)) {
+        // Snapshot missing, stale or corrupt: rebuild everything from the log
+        teams.clear();
+        team_cleared_at.clear();
+        dead_bytes = 0;
+        live_record_count = 0;
+        covered_offset = kLogHeaderSize;
+    }
+
+    if (!replayFrom(covered_offset) || !reopenAppendStream()) {
+        return false;
+    }
+
+    is_open = true;
+    return true;
+}
+
+bool BattleHistoryLog::append(const BattleRecord& record) {
+    std::lock_guard<std::mutex> lock(log_mutex);
+    if (!is_open) {
+        return false;
+    }
+
+    const auto payload = encodeBattle(record);
+    if (!appendFrame(payload)) {
+        return false;
+    }
+
+    applyBattle(record, BinaryIO::kRecordHeaderSize + payload.size());
+    appends_since_snapshot++;
+    maybeMaintain();
+    return true;
+}
+
+bool BattleHistoryLog::clearTeam(const std::string& team_name) {
+    std::lock_guard<std::mutex> lock(log_mutex);
+    if (!is_open) {
+        return false;
+    }
+
+    const uint64_t frame_offset = log_size;
+    const auto payload = encodeClear(team_name);
+    if (!appendFrame(payload)) {
+        return false;
+    }
+
+    applyClear(team_name, frame_offset, BinaryIO::kRecordHeaderSize + payload.size());
+    appends_since_snapshot++;
+    maybeMaintain();
+    return true;
+}
+
+std::optional<BattleHistoryLog::TeamStatistics>
+BattleHistoryLog::getStatistics(const std::string& team_name) const {
+    std::lock_guard<std::mutex> lock(log_mutex);
+    const auto it = teams.find(team_name);
+    if (it == teams.end() || it->second.battles == 0) {
+        return std::nullopt;
+    }
+    return buildStatistics(team_name, it->second);
+}
+
+std::vector<BattleHistoryLog::BattleRecord>
+BattleHistoryLog::getRecords(const std::string& team_name, size_t max_records) const {
+    std::unique_lock<std::mutex> lock(log_mutex);
+    const auto it = teams.find(team_name);
+    if (it == teams.end()) {
+        return {};
+    }
+
+    const auto& acc = it->second;
+    const bool tail_is_complete = acc.recent.size() == acc.battles;
+    if (tail_is_complete || (max_records > 0 && max_records <= acc.recent.size())) {
+        const size_t count = max_records == 0 ? acc.recent.size()
+                                              : std::min(max_records, acc.recent.size());
+        return std::vector<BattleRecord>(acc.recent.end() - static_cast<std::ptrdiff_t>(count),
+                                         acc.recent.end());
+    }
+    lock.unlock();
+
+    // Older history is only on disk: stream it, keeping a sliding window
+    std::deque<BattleRecord> window;
+    forEachRecord([&](const BattleRecord& record) {
+        if (record.team_name != team_name) {
+            return;
+        }
+        window.push_back(record);
+        if (max_records > 0 && window.size() > max_records) {
+            window.pop_front();
+        }
+    });
+    return std::vector<BattleRecord>(window.begin(), window.end());
+}
+
+bool BattleHistoryLog::forEachRecord(const std::function<void(const BattleRecord&)>& visitor) const {
+    std::lock_guard<std::mutex> lock(log_mutex);
+    if (!is_open) {
+        return false;
+    }
+
+    return scanLog(kLogHeaderSize, [&](RecordType type, const uint8_t* data, size_t length,
+                                       uint64_t frame_offset) {
+        if (type != RecordType::BATTLE) {
+            return;
+        }
+        BattleRecord record;
+        if (decodeBattle(data, length, record) && isLive(record.team_name, frame_offset)) {
+            visitor(record);
+        }
+    }, nullptr);
+}
+
+bool BattleHistoryLog::writeSnapshot() {
+    std::lock_guard<std::mutex> lock(log_mutex);
+    return is_open && writeSnapshotLocked();
+}
+
+bool BattleHistoryLog::compact() {
+    std::lock_guard<std::mutex> lock(log_mutex);
+    return is_open && compactLocked();
+}
+
+std::vector<std::string> BattleHistoryLog::getTeamNames() const {
+    std::lock_guard<std::mutex> lock(log_mutex);
+    std::vector<std::string> names;
+    names.reserve(teams.size());
+    for (const auto& [name, acc] : teams) {
+        if (acc.battles > 0) {
+            names.push_back(name);
+        }
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+// Record encoding
+
+std::vector<uint8_t> BattleHistoryLog::encodeBattle(const BattleRecord& record) {
+    BinaryIO::ByteWriter writer;
+    writer.writeU8(static_cast<uint8_t>(RecordType::BATTLE));
+    writer.writeString(record.team_name);
+    writer.writeString(record.opponent_team);
+    writer.writeString(record.battle_date);
+    writer.writeU8(record.victory ? 1 : 0);
+    writer.writeI32(record.turns_taken);
+    writer.writeString(record.difficulty_level);
+    writer.writeF64(record.team_effectiveness_score);
+    writer.writeU32(static_cast<uint32_t>(record.strategies_used.size()));
+    for (const auto& strategy : record.strategies_used) {
+        writer.writeString(strategy);
+    }
+    return writer.data();
+}
+
+std::vector<uint8_t> BattleHistoryLog::encodeClear(const std::string& team_name) {
+    BinaryIO::ByteWriter writer;
+    writer.writeU8(static_cast<uint8_t>(RecordType::CLEAR_TEAM));
+    writer.writeString(team_name);
+    return writer.data();
+}
+
+bool BattleHistoryLog::decodeBattle(const uint8_t* data, size_t length, BattleRecord& record) {
+    BinaryIO::ByteReader reader(data, length);
+    record.team_name = reader.readString();
+    record.opponent_team = reader.readString();
+    record.battle_date = reader.readString();
+    record.victory = reader.readU8() != 0;
+    record.turns_taken = reader.readI32();
+    record.difficulty_level = reader.readString();
+    record.team_effectiveness_score = reader.readF64();
+    const uint32_t strategy_count = reader.readU32();
+    record.strategies_used.clear();
+    for (uint32_t i = 0; i < strategy_count && reader.ok(); ++i) {
+        record.strategies_used.push_back(reader.readString());
+    }
+    return reader.ok();
+}
+
+// State maintenance
+
+void BattleHistoryLog::applyBattle(const BattleRecord& record, uint64_t frame_bytes) {
+    auto& acc = teams[record.team_name];
+    acc.battles++;
+    if (record.victory) {
+        acc.victories++;
+    }
+    acc.total_turns += record.turns_taken;
+    acc.total_effectiveness += record.team_effectiveness_score;
+    acc.live_bytes += frame_bytes;
+
+    acc.recent.push_back(record);
+    while (acc.recent.size() > settings.recent_records_per_team) {
+        acc.recent.pop_front();
+    }
+    live_record_count++;
+}
+
+bool BattleHistoryLog::isLive(const std::string& team_name, uint64_t frame_offset) const {
+    const auto it = team_cleared_at.find(team_name);
+    return it == team_cleared_at.end() || frame_offset > it->second;
+}
+
+void BattleHistoryLog::applyClear(const std::string& team_name, uint64_t frame_offset,
+                                  uint64_t frame_bytes) {
+    const auto it = teams.find(team_name);
+    if (it != teams.end()) {
+        dead_bytes += it->second.live_bytes;
+        live_record_count -= std::min(live_record_count, it->second.battles);
+        teams.erase(it);
+    }
+    // The tombstone itself is dead weight as soon as compaction runs
+    dead_bytes += frame_bytes;
+    team_cleared_at[team_name] = frame_offset;
+}
+
+BattleHistoryLog::TeamStatistics
+BattleHistoryLog::buildStatistics(const std::string& team_name, const TeamAccumulator& acc) const {
+    TeamStatistics stats;
+    stats.team_name = team_name;
+    stats.total_battles = static_cast<int>(acc.battles);
+    stats.victories = static_cast<int>(acc.victories);
+    stats.defeats = static_cast<int>(acc.battles - acc.victories);
+
+    const double battles = static_cast<double>(acc.battles);
+    stats.win_rate = acc.battles > 0 ? (static_cast<double>(acc.victories) / battles) * 100.0 : 0.0;
+    stats.average_battle_length = acc.battles > 0 ? acc.total_turns / battles : 0.0;
+    stats.average_effectiveness_score = acc.battles > 0 ? acc.total_effectiveness / battles : 0.0;
+    return stats;
+}
+
+bool BattleHistoryLog::appendFrame(const std::vector<uint8_t>& payload) {
+    const auto frame = BinaryIO::frameRecord(payload);
+    log_stream.write(reinterpret_cast<const char*>(frame.data()),
+                     static_cast<std::streamsize>(frame.size()));
+    log_stream.flush();
+    if (!log_stream.good()) {
+        log_stream.clear();
+        return false;
+    }
+    log_size += frame.size();
+    return true;
+}
+
+void BattleHistoryLog::maybeMaintain() {
+    if (log_size >= settings.compaction_min_bytes &&
+        static_cast<double>(dead_bytes) > settings.compaction_dead_ratio * static_cast<double>(log_size)) {
+        compactLocked();
+        return;
+    }
+
+    if (settings.snapshot_interval > 0 && appends_since_snapshot >= settings.snapshot_interval) {
+        writeSnapshotLocked();
+    }
+}
+
+// File helpers
+
+bool BattleHistoryLog::createEmptyLog() {
+    generation = newGeneration();
+    BinaryIO::ByteWriter header;
+    header.writeBytes(kLogMagic, sizeof(kLogMagic));
+    header.writeU32(kFormatVersion);
+    header.writeU64(generation);
+
+    std::ofstream out(log_path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(header.data().data()),
+              static_cast<std::streamsize>(header.size()));
+    out.flush();
+    log_size = header.size();
+    return out.good();
+}
+
+bool BattleHistoryLog::readHeader(std::ifstream& in, uint64_t& header_generation) const {
+    uint8_t header[kLogHeaderSize];
+    if (!in.read(reinterpret_cast<char*>(header), sizeof(header))) {
+        return false;
+    }
+    if (std::memcmp(header, kLogMagic, sizeof(kLogMagic)) != 0) {
+        return false;
+    }
+    BinaryIO::ByteReader reader(header + sizeof(kLogMagic), sizeof(header) - sizeof(kLogMagic));
+    if (reader.readU32() != kFormatVersion) {
+        return false;
+    }
+    header_generation = reader.readU64();
+    return reader.ok();
+}
+
+bool BattleHistoryLog::loadSnapshot(uint64_t& covered_offset) {
+    std::ifstream in(snapshot_path, std::ios::binary);
+    if (!in.is_open()) {
+        return false;
+    }
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (bytes.size() < sizeof(kSnapshotMagic) + 4) {
+        return false;
+    }
+
+    const size_t body_size = bytes.size() - 4;
+    BinaryIO::ByteReader trailer(bytes.data() + body_size, 4);
+    if (trailer.readU32() != BinaryIO::crc32(bytes.data(), body_size) ||
+        std::memcmp(bytes.data(), kSnapshotMagic, sizeof(kSnapshotMagic)) != 0) {
+        return false;
+    }
+
+    BinaryIO::ByteReader reader(bytes.data() + sizeof(kSnapshotMagic), body_size - sizeof(kSnapshotMagic));
+    if (reader.readU32() != kFormatVersion || reader.readU64() != generation) {
+        return false;  // Snapshot belongs to a pre-compaction log
+    }
+
+    std::error_code ec;
+    const uint64_t file_size = fs::file_size(log_path, ec);
+    covered_offset = reader.readU64();
+    if (ec || covered_offset < kLogHeaderSize || covered_offset > file_size) {
+        return false;
+    }
+
+    dead_bytes = reader.readU64();
+    live_record_count = reader.readU64();
+
+    const uint32_t team_count = reader.readU32();
+    for (uint32_t t = 0; t < team_count && reader.ok(); ++t) {
+        const std::string name = reader.readString();
+        TeamAccumulator acc;
+        acc.battles = reader.readU64();
+        acc.victories = reader.readU64();
+        acc.total_turns = reader.readF64();
+        acc.total_effectiveness = reader.readF64();
+        acc.live_bytes = reader.readU64();
+        const uint32_t recent_count = reader.readU32();
+        for (uint32_t r = 0; r < recent_count && reader.ok(); ++r) {
+            const uint32_t length = reader.readU32();
+            if (!reader.ok() || length == 0 || length > reader.remaining()) {
+                return false;
+            }
+            std::vector<uint8_t> payload(length);
+            for (auto& byte : payload) {
+                byte = reader.readU8();
+            }
+            BattleRecord record;
+            if (!decodeBattle(payload.data() + 1, payload.size() - 1, record)) {
+                return false;
+            }
+            acc.recent.push_back(std::move(record));
+        }
+        teams[name] = std::move(acc);
+    }
+
+    const uint32_t cleared_count = reader.readU32();
+    for (uint32_t c = 0; c < cleared_count && reader.ok(); ++c) {
+        const std::string name = reader.readString();
+        team_cleared_at[name] = reader.readU64();
+    }
+
+    log_size = covered_offset;
+    return reader.ok();
+}
+
+bool BattleHistoryLog::replayFrom(uint64_t offset) {
+    uint64_t valid_end = offset;
+    const bool clean = scanLog(offset, [this](RecordType type, const uint8_t* data, size_t length,
+                                              uint64_t frame_offset) {
+        const uint64_t frame_bytes = BinaryIO::kRecordHeaderSize + 1 + length;
+        if (type == RecordType::BATTLE) {
+            BattleRecord record;
+            if (decodeBattle(data, length, record)) {
+                applyBattle(record, frame_bytes);
+            }
+        } else if (type == RecordType::CLEAR_TEAM) {
+            BinaryIO::ByteReader reader(data, length);
+            const std::string team_name = reader.readString();
+            if (reader.ok()) {
+                applyClear(team_name, frame_offset, frame_bytes);
+            }
+        }
+    }, &valid_end);
+
+    if (!clean) {
+        // Torn or corrupt tail from an interrupted append: drop it so new frames line up
+        std::error_code ec;
+        fs::resize_file(log_path, valid_end, ec);
+        if (ec) {
+            return false;
+        }
+    }
+
+    log_size = valid_end;
+    return true;
+}
+
+bool BattleHistoryLog::writeSnapshotLocked() {
+    BinaryIO::ByteWriter writer;
+    writer.writeBytes(kSnapshotMagic, sizeof(kSnapshotMagic));
+    writer.writeU32(kFormatVersion);
+    writer.writeU64(generation);
+    writer.writeU64(log_size);
+    writer.writeU64(dead_bytes);
+    writer.writeU64(live_record_count);
+
+    writer.writeU32(static_cast<uint32_t>(teams.size()));
+    for (const auto& [name, acc] : teams) {
+        writer.writeString(name);
+        writer.writeU64(acc.battles);
+        writer.writeU64(acc.victories);
+        writer.writeF64(acc.total_turns);
+        writer.writeF64(acc.total_effectiveness);
+        writer.writeU64(acc.live_bytes);
+        writer.writeU32(static_cast<uint32_t>(acc.recent.size()));
+        for (const auto& record : acc.recent) {
+            const auto payload = encodeBattle(record);
+            writer.writeU32(static_cast<uint32_t>(payload.size()));
+            writer.writeBytes(payload.data(), payload.size());
+        }
+    }
+
+    writer.writeU32(static_cast<uint32_t>(team_cleared_at.size()));
+    for (const auto& [name, offset] : team_cleared_at) {
+        writer.writeString(name);
+        writer.writeU64(offset);
+    }
+    writer.writeU32(BinaryIO::crc32(writer.data().data(), writer.size()));
+
+    // Write to a temporary file and rename so a crash never leaves a torn snapshot
+    ensureParentDirectory(snapshot_path);
+    const std::string temp_path = snapshot_path + ".tmp";
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(writer.data().data()),
+                  static_cast<std::streamsize>(writer.size()));
+        out.flush();
+        if (!out.good()) {
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    fs::rename(temp_path, snapshot_path, ec);
+    if (ec) {
+        return false;
+    }
+    appends_since_snapshot = 0;
+    return true;
+}
+
+bool BattleHistoryLog::compactLocked() {
+    const uint64_t new_generation = newGeneration();
+    const std::string temp_path = log_path + ".compact";
+
+    std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        return false;
+    }
+
+    BinaryIO::ByteWriter header;
+    header.writeBytes(kLogMagic, sizeof(kLogMagic));
+    header.writeU32(kFormatVersion);
+    header.writeU64(new_generation);
+    out.write(reinterpret_cast<const char*>(header.data().data()),
+              static_cast<std::streamsize>(header.size()));
+    uint64_t new_size = header.size();
+
+    log_stream.flush();
+    const bool scanned = scanLog(kLogHeaderSize, [&](RecordType type, const uint8_t* data,
+                                                     size_t length, uint64_t frame_offset) {
+        if (type != RecordType::BATTLE) {
+            return;
+        }
+        BinaryIO::ByteReader reader(data, length);
+        const std::string team_name = reader.readString();
+        if (!reader.ok() || !isLive(team_name, frame_offset)) {
+            return;
+        }
+        std::vector<uint8_t> payload;
+        payload.reserve(length + 1);
+        payload.push_back(static_cast<uint8_t>(type));
+        payload.insert(payload.end(), data, data + length);
+        const auto frame = BinaryIO::frameRecord(payload);
+        out.write(reinterpret_cast<const char*>(frame.data()), static_cast<std::streamsize>(frame.size()));
+        new_size += frame.size();
+    }, nullptr);
+
+    out.flush();
+    if (!scanned || !out.good()) {
+        out.close();
+        std::error_code ignored;
+        fs::remove(temp_path, ignored);
+        return false;
+    }
+    out.close();
+
+    log_stream.close();
+    std::error_code ec;
+    fs::rename(temp_path, log_path, ec);
+    if (ec) {
+        reopenAppendStream();
+        return false;
+    }
+
+    generation = new_generation;
+    log_size = new_size;
+    dead_bytes = 0;
+    team_cleared_at.clear();
+
+    if (!reopenAppendStream()) {
+        is_open = false;
+        return false;
+    }
+    return writeSnapshotLocked();
+}
+
+bool BattleHistoryLog::scanLog(uint64_t start_offset,
+                               const std::function<void(RecordType, const uint8_t*, size_t, uint64_t)>& visitor,
+                               uint64_t* valid_end) const {
+    std::ifstream in(log_path, std::ios::binary);
+    if (!in.is_open()) {
+        return false;
+    }
+    in.seekg(static_cast<std::streamoff>(start_offset));
+
+    uint64_t offset = start_offset;
+    std::vector<uint8_t> payload;
+    uint8_t frame_header[BinaryIO::kRecordHeaderSize];
+
+    while (true) {
+        if (valid_end) {
+            *valid_end = offset;
+        }
+        if (!in.read(reinterpret_cast<char*>(frame_header), sizeof(frame_header))) {
+            // Clean end of file, or a torn frame header
+            return in.gcount() == 0;
+        }
+
+        BinaryIO::ByteReader header_reader(frame_header, sizeof(frame_header));
+        const uint32_t length = header_reader.readU32();
+        const uint32_t checksum = header_reader.readU32();
+        if (length == 0 || length > kMaxRecordBytes) {
+            return false;
+        }
+
+        payload.resize(length);
+        if (!in.read(reinterpret_cast<char*>(payload.data()), length) ||
+            BinaryIO::crc32(payload.data(), length) != checksum) {
+            return false;
+        }
+
+        visitor(static_cast<RecordType>(payload[0]), payload.data() + 1, length - 1, offset);
+        offset += BinaryIO::kRecordHeaderSize + length;
+    }
+}
+
+bool BattleHistoryLog::importLegacyJson(const std::string& json_path) {
+    try {
+        std::ifstream file(json_path);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        json j;
+        file >> j;
+        if (!j.contains("battle_history")) {
+            return true;
+        }
+
+        for (const auto& [team_name, records] : j["battle_history"].items()) {
+            for (const auto& record_json : records) {
+                BattleRecord record;
+                record.team_name = record_json.value("team_name", team_name);
+                record.opponent_team = record_json.value("opponent_team", "");
+                record.battle_date = record_json.value("battle_date", "");
+                record.victory = record_json.value("victory", false);
+                record.turns_taken = record_json.value("turns_taken", 0);
+                record.difficulty_level = record_json.value("difficulty_level", "");
+                record.team_effectiveness_score = record_json.value("team_effectiveness_score", 0.0);
+
+                const auto payload = encodeBattle(record);
+                if (!appendFrame(payload)) {
+                    return false;
+                }
+                applyBattle(record, BinaryIO::kRecordHeaderSize + payload.size());
+            }
+        }
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+bool BattleHistoryLog::reopenAppendStream() {
+    if (log_stream.is_open()) {
+        log_stream.close();
+    }
+    log_stream.clear();
+    log_stream.open(log_path, std::ios::binary | std::ios::app);
+    return log_stream.is_open();
+}
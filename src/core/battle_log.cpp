@@ -0,0 +1,40 @@
+#include "battle_log.h"
+#include <charconv>
+#include <ostream>
+
+namespace BattleLog {
+
+void Arg::appendTo(std::string& out) const {
+    if (!isNumber_) {
+        out.append(text_.data(), text_.size());
+        return;
+    }
+    char digits[24];
+    const auto result = std::to_chars(digits, digits + sizeof(digits), number_);
+    out.append(digits, result.ptr);
+}
+
+void formatMessage(std::string& out, Message message, std::initializer_list<Arg> args) {
+    const char* format = kCatalog[static_cast<size_t>(message)].format;
+    auto arg = args.begin();
+    for (const char* c = format; *c; ++c) {
+        if (c[0] == '{' && c[1] == '}') {
+            if (arg != args.end()) {
+                (arg++)->appendTo(out);
+            }
+            ++c;
+        } else {
+            out += *c;
+        }
+    }
+}
+
+void StreamSink::write(const char* data, size_t size) {
+    stream_->write(data, static_cast<std::streamsize>(size));
+}
+
+void StreamSink::flush() {
+    stream_->flush();
+}
+
+} // namespace BattleLog
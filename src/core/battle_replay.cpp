@@ -0,0 +1,508 @@
+#include "battle_replay.h"
+#include "battle_team_factory.h"
+#include "binary_io.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+
+namespace {
+
+constexpr char kReplayMagic[4] = {'P', 'B', 'R', 'P'};
+constexpr size_t kActionBytes = 4;
+constexpr size_t kEventBytes = 20;
+
+void writeTeam(BinaryIO::ByteWriter& writer, const std::vector<BattleReplay::Member>& team) {
+    writer.writeU8(static_cast<uint8_t>(team.size()));
+    for (const auto& member : team) {
+        writer.writeString(member.species);
+        writer.writeU8(static_cast<uint8_t>(member.moves.size()));
+        for (const auto& move : member.moves) {
+            writer.writeString(move);
+        }
+    }
+}
+
+bool readTeam(BinaryIO::ByteReader& reader, std::vector<BattleReplay::Member>& team) {
+    const uint8_t count = reader.readU8();
+    team.clear();
+    for (uint8_t i = 0; i < count && reader.ok(); ++i) {
+        BattleReplay::Member member;
+        member.species = reader.readString();
+        const uint8_t moves = reader.readU8();
+        for (uint8_t m = 0; m < moves && reader.ok(); ++m) {
+            member.moves.push_back(reader.readString());
+        }
+        team.push_back(std::move(member));
+    }
+    return reader.ok();
+}
+
+std::vector<BattleReplay::Member> describeTeam(const Team& team) {
+    std::vector<BattleReplay::Member> members;
+    for (int slot = 0; slot < static_cast<int>(team.size()); ++slot) {
+        const Pokemon* pokemon = team.getPokemon(slot);
+        if (!pokemon) {
+            continue;
+        }
+        BattleReplay::Member member;
+        member.species = pokemon->name;
+        for (const auto& move : pokemon->moves) {
+            member.moves.push_back(move.name);
+        }
+        members.push_back(std::move(member));
+    }
+    return members;
+}
+
+Team buildTeam(const std::vector<BattleReplay::Member>& members) {
+    TeamBuilder::Team builder_team("replay");
+    for (const auto& member : members) {
+        builder_team.pokemon.emplace_back(member.species, member.moves);
+    }
+    return BattleTeamFactory::shared().build(builder_team);
+}
+
+bool sameAction(const BattleSimulator::Action& a, const BattleSimulator::Action& b) {
+    return a.turn == b.turn && a.isPlayer == b.isPlayer && a.kind == b.kind && a.index == b.index;
+}
+
+} // namespace
+
+// BattleReplay implementation
+
+BattleSimulator::Options BattleReplay::makeOptions() const {
+    BattleSimulator::Options options;
+    options.seed = seed;
+    options.team_a_ai = team_a_ai;
+    options.team_b_ai = team_b_ai;
+    options.max_turns = max_turns;
+    return options;
+}
+
+std::vector<uint8_t> BattleReplay::encode() const {
+    BinaryIO::ByteWriter writer;
+    writer.writeBytes(kReplayMagic, sizeof(kReplayMagic));
+    writer.writeU32(kFormatVersion);
+    writer.writeU64(seed);
+    writer.writeU8(static_cast<uint8_t>(team_a_ai));
+    writer.writeU8(static_cast<uint8_t>(team_b_ai));
+    writer.writeI32(max_turns);
+    writer.writeU32(data_checksum);
+    writeTeam(writer, team_a);
+    writeTeam(writer, team_b);
+
+    writer.writeU32(static_cast<uint32_t>(actions.size()));
+    for (const auto& action : actions) {
+        writer.writeU16(static_cast<uint16_t>(action.turn));
+        writer.writeU8(static_cast<uint8_t>((action.isPlayer ? 1 : 0) | (static_cast<uint8_t>(action.kind) << 1)));
+        writer.writeU8(static_cast<uint8_t>(static_cast<int8_t>(action.index)));
+    }
+
+    writer.writeU32(static_cast<uint32_t>(events.size()));
+    for (const auto& event : events) {
+        writer.writeU8(static_cast<uint8_t>(event.type));
+        writer.writeU8(static_cast<uint8_t>(event.source));
+        writer.writeU8(event.subject);
+        writer.writeU8(event.other);
+        writer.writeU8(event.old_code);
+        writer.writeU8(event.new_code);
+        writer.writeU8(event.flags);
+        writer.writeU8(static_cast<uint8_t>(event.move));
+        writer.writeI32(event.old_value);
+        writer.writeI32(event.new_value);
+        writer.writeI32(event.delta);
+    }
+
+    writer.writeI32(turns);
+    writer.writeU8(static_cast<uint8_t>(outcome));
+    writer.writeU32(final_state_hash);
+    writer.writeU32(BinaryIO::crc32(writer.data().data(), writer.size()));
+    return writer.data();
+}
+
+bool BattleReplay::decode(const std::vector<uint8_t>& data, BattleReplay& replay) {
+    if (data.size() < sizeof(kReplayMagic) + 8 || std::memcmp(data.data(), kReplayMagic, sizeof(kReplayMagic)) != 0) {
+        return false;
+    }
+    const size_t body = data.size() - 4;
+    BinaryIO::ByteReader trailer(data.data() + body, 4);
+    if (trailer.readU32() != BinaryIO::crc32(data.data(), body)) {
+        return false;
+    }
+
+    BinaryIO::ByteReader reader(data.data() + sizeof(kReplayMagic), body - sizeof(kReplayMagic));
+    if (reader.readU32() != kFormatVersion) {
+        return false;
+    }
+
+    BattleReplay decoded;
+    decoded.seed = reader.readU64();
+    decoded.team_a_ai = static_cast<AIDifficulty>(reader.readU8());
+    decoded.team_b_ai = static_cast<AIDifficulty>(reader.readU8());
+    decoded.max_turns = reader.readI32();
+    decoded.data_checksum = reader.readU32();
+    if (!readTeam(reader, decoded.team_a) || !readTeam(reader, decoded.team_b)) {
+        return false;
+    }
+
+    const uint32_t action_count = reader.readU32();
+    if (!reader.ok() || action_count > reader.remaining() / kActionBytes) {
+        return false;
+    }
+    decoded.actions.reserve(action_count);
+    for (uint32_t i = 0; i < action_count; ++i) {
+        BattleSimulator::Action action;
+        action.turn = reader.readU16();
+        const uint8_t bits = reader.readU8();
+        action.isPlayer = (bits & 1) != 0;
+        action.kind = static_cast<BattleSimulator::Action::Kind>(bits >> 1);
+        action.index = static_cast<int8_t>(reader.readU8());
+        decoded.actions.push_back(action);
+    }
+
+    const uint32_t event_count = reader.readU32();
+    if (!reader.ok() || event_count > reader.remaining() / kEventBytes) {
+        return false;
+    }
+    decoded.events.reserve(event_count);
+    for (uint32_t i = 0; i < event_count; ++i) {
+        Event event;
+        event.type = static_cast<BattleEvents::EventType>(reader.readU8());
+        event.source = static_cast<BattleEvents::EventSource>(reader.readU8());
+        event.subject = reader.readU8();
+        event.other = reader.readU8();
+        event.old_code = reader.readU8();
+        event.new_code = reader.readU8();
+        event.flags = reader.readU8();
+        event.move = static_cast<int8_t>(reader.readU8());
+        event.old_value = reader.readI32();
+        event.new_value = reader.readI32();
+        event.delta = reader.readI32();
+        decoded.events.push_back(event);
+    }
+
+    decoded.turns = reader.readI32();
+    decoded.outcome = static_cast<BattleSimulator::Outcome>(reader.readU8());
+    decoded.final_state_hash = reader.readU32();
+    if (!reader.ok() || reader.remaining() != 0) {
+        return false;
+    }
+    replay = std::move(decoded);
+    return true;
+}
+
+bool BattleReplay::save(const std::string& path) const {
+    const auto data = encode();
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    return static_cast<bool>(out);
+}
+
+bool BattleReplay::load(const std::string& path, BattleReplay& replay) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    const std::vector<uint8_t> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    return decode(data, replay);
+}
+
+uint32_t BattleReplay::teamChecksum(const Team& team_a, const Team& team_b) {
+    BinaryIO::ByteWriter writer;
+    for (const Team* team : {&team_a, &team_b}) {
+        writer.writeU8(static_cast<uint8_t>(team->size()));
+        for (int slot = 0; slot < static_cast<int>(team->size()); ++slot) {
+            const Pokemon* pokemon = team->getPokemon(slot);
+            if (!pokemon) {
+                continue;
+            }
+            writer.writeString(pokemon->name);
+            for (const auto& type : pokemon->types) {
+                writer.writeString(type);
+            }
+            for (int stat : {pokemon->hp, pokemon->attack, pokemon->defense, pokemon->special_attack,
+                             pokemon->special_defense, pokemon->speed}) {
+                writer.writeI32(stat);
+            }
+            for (const auto& move : pokemon->moves) {
+                writer.writeString(move.name);
+                writer.writeString(move.type);
+                writer.writeString(move.damage_class);
+                writer.writeString(move.category);
+                writer.writeString(move.ailment_name);
+                for (int value : {move.power, move.accuracy, move.pp, move.priority, move.ailment_chance,
+                                  move.crit_rate, move.drain, move.flinch_chance, move.healing,
+                                  move.min_hits, move.max_hits, static_cast<int>(move.multi_turn_behavior)}) {
+                    writer.writeI32(value);
+                }
+            }
+        }
+    }
+    return BinaryIO::crc32(writer.data().data(), writer.size());
+}
+
+uint32_t BattleReplay::stateHash(const Team& team_a, const Team& team_b) {
+    BinaryIO::ByteWriter writer;
+    for (const Team* team : {&team_a, &team_b}) {
+        for (int slot = 0; slot < static_cast<int>(team->size()); ++slot) {
+            const Pokemon* pokemon = team->getPokemon(slot);
+            if (!pokemon) {
+                continue;
+            }
+            for (int value : {pokemon->current_hp, static_cast<int>(pokemon->status),
+                              pokemon->status_turns_remaining, pokemon->attack_stage, pokemon->defense_stage,
+                              pokemon->special_attack_stage, pokemon->special_defense_stage, pokemon->speed_stage,
+                              pokemon->is_charging ? 1 : 0, pokemon->must_recharge ? 1 : 0}) {
+                writer.writeI32(value);
+            }
+            for (const auto& move : pokemon->moves) {
+                writer.writeI32(move.current_pp);
+            }
+        }
+    }
+    return BinaryIO::crc32(writer.data().data(), writer.size());
+}
+
+// ReplayRecorder implementation
+
+ReplayRecorder::ReplayRecorder(const Team& team_a, const Team& team_b, const BattleSimulator::Options& options,
+                               bool record_events)
+    : team_a(&team_a), team_b(&team_b), record_events(record_events) {
+    replay.seed = options.seed;
+    replay.team_a_ai = options.team_a_ai;
+    replay.team_b_ai = options.team_b_ai;
+    replay.max_turns = options.max_turns;
+    replay.data_checksum = BattleReplay::teamChecksum(team_a, team_b);
+    replay.team_a = describeTeam(team_a);
+    replay.team_b = describeTeam(team_b);
+
+    for (int slot = 0; slot < static_cast<int>(team_a.size()); ++slot) {
+        pokemon_codes.emplace(team_a.getPokemon(slot), static_cast<uint8_t>(slot));
+    }
+    for (int slot = 0; slot < static_cast<int>(team_b.size()); ++slot) {
+        pokemon_codes.emplace(team_b.getPokemon(slot), static_cast<uint8_t>(8 | slot));
+    }
+}
+
+BattleReplay ReplayRecorder::finish(const BattleSimulator::Result& result) {
+    replay.turns = result.turns;
+    replay.outcome = result.outcome;
+    replay.final_state_hash = BattleReplay::stateHash(*team_a, *team_b);
+    return replay;
+}
+
+BattleReplay ReplayRecorder::record(const Team& team_a, const Team& team_b, const BattleSimulator::Options& options,
+                                    bool record_events, BattleSimulator::Result* result) {
+    Team copy_a = team_a;
+    Team copy_b = team_b;
+    auto recorder = std::make_shared<ReplayRecorder>(copy_a, copy_b, options, record_events);
+    BattleEvents::BattleEventManager events;
+    events.subscribe(recorder);
+    const BattleSimulator::Result played = BattleSimulator::simulateInPlace(copy_a, copy_b, options, events);
+    if (result) {
+        *result = played;
+    }
+    return recorder->finish(played);
+}
+
+void ReplayRecorder::onActionChosen(const BattleEvents::ActionChosenEvent& event) {
+    replay.actions.push_back(event);
+}
+
+void ReplayRecorder::onHealthChanged(const BattleEvents::HealthChangeEvent& event) {
+    if (record_events) {
+        addEvent(BattleEvents::makeRecord(event));
+    }
+}
+
+void ReplayRecorder::onStatusChanged(const BattleEvents::StatusChangeEvent& event) {
+    if (record_events) {
+        addEvent(BattleEvents::makeRecord(event));
+    }
+}
+
+void ReplayRecorder::onMoveUsed(const BattleEvents::MoveUsedEvent& event) {
+    if (record_events) {
+        addEvent(BattleEvents::makeRecord(event));
+    }
+}
+
+void ReplayRecorder::onWeatherChanged(const BattleEvents::WeatherChangeEvent& event) {
+    if (record_events) {
+        addEvent(BattleEvents::makeRecord(event));
+    }
+}
+
+void ReplayRecorder::onPokemonSwitch(const BattleEvents::PokemonSwitchEvent& event) {
+    if (record_events) {
+        addEvent(BattleEvents::makeRecord(event));
+    }
+}
+
+void ReplayRecorder::onBattleEnd(const BattleEvents::BattleEndEvent& event) {
+    if (record_events) {
+        addEvent(BattleEvents::makeRecord(event));
+    }
+}
+
+void ReplayRecorder::onTurnStart(int turnNumber) {
+    if (record_events) {
+        addEvent(BattleEvents::makeTurnRecord(BattleEvents::EventType::TURN_START, turnNumber));
+    }
+}
+
+void ReplayRecorder::addEvent(const BattleEvents::EventRecord& record) {
+    BattleReplay::Event event;
+    event.type = record.type;
+    event.source = record.source;
+    event.subject = codeOf(record.pokemon);
+    event.other = codeOf(record.other);
+    event.old_code = record.old_code;
+    event.new_code = record.new_code;
+    event.flags = record.flags;
+    event.move = -1;
+    event.old_value = record.old_value;
+    event.new_value = record.new_value;
+    event.delta = record.delta;
+
+    // Moves are identified by their index in the acting Pokemon's moveset
+    const Pokemon* actor = record.source_pokemon ? record.source_pokemon : record.pokemon;
+    if (actor && record.move) {
+        for (size_t i = 0; i < actor->moves.size(); ++i) {
+            if (&actor->moves[i] == record.move) {
+                event.move = static_cast<int8_t>(i);
+                break;
+            }
+        }
+    }
+    replay.events.push_back(event);
+}
+
+uint8_t ReplayRecorder::codeOf(const Pokemon* pokemon) const {
+    auto it = pokemon_codes.find(pokemon);
+    return it != pokemon_codes.end() ? it->second : BattleReplay::kNoPokemon;
+}
+
+// BattleReplayer implementation
+
+BattleReplayer::BattleReplayer(const BattleReplay& replay)
+    : BattleReplayer(replay, buildTeam(replay.team_a), buildTeam(replay.team_b)) {}
+
+BattleReplayer::BattleReplayer(const BattleReplay& replay, const Team& team_a, const Team& team_b)
+    : replay(replay), base_a(team_a), base_b(team_b), current_a(team_a), current_b(team_b), current_turn(0) {}
+
+bool BattleReplayer::isValid() const {
+    return !base_a.isEmpty() && !base_b.isEmpty() &&
+           base_a.size() == replay.team_a.size() && base_b.size() == replay.team_b.size() &&
+           BattleReplay::teamChecksum(base_a, base_b) == replay.data_checksum;
+}
+
+BattleSimulator::Result BattleReplayer::run(BattleEvents::BattleEventManager* events) {
+    current_a = base_a;
+    current_b = base_b;
+    BattleSimulator::ReplayControl control;
+    control.actions = &replay.actions;
+    const auto result = BattleSimulator::replayInPlace(current_a, current_b, replay.makeOptions(), control, events);
+    current_turn = result.turns;
+    return result;
+}
+
+void BattleReplayer::buildKeyframes() {
+    Team team_a = base_a;
+    Team team_b = base_b;
+    BattleSimulator::ReplayControl control;
+    control.actions = &replay.actions;
+    control.keyframes = &keyframes;
+    control.keyframe_interval = kKeyframeInterval;
+    BattleSimulator::replayInPlace(team_a, team_b, replay.makeOptions(), control);
+}
+
+bool BattleReplayer::seek(int turn) {
+    if (turn < 0 || turn > replay.turns) {
+        return false;
+    }
+    if (keyframes.empty()) {
+        buildKeyframes();
+    }
+
+    const BattleSimulator::Keyframe* start = nullptr;
+    for (const auto& keyframe : keyframes) {
+        if (keyframe.turn <= turn) {
+            start = &keyframe;
+        }
+    }
+    if (!start) {
+        return false;
+    }
+
+    BattleSimulator::ReplayControl control;
+    control.actions = &replay.actions;
+    control.resume_from = start;
+    control.stop_after_turn = turn;
+    const auto result = BattleSimulator::replayInPlace(current_a, current_b, replay.makeOptions(), control);
+    current_turn = result.turns;
+    return current_turn == turn && !control.diverged;
+}
+
+BattleReplayer::Verification BattleReplayer::verify() {
+    Verification verification;
+    verification.data_matches = isValid();
+    verification.playback_matches = false;
+    verification.ai_matches = false;
+    verification.first_divergent_turn = -1;
+    if (base_a.isEmpty() || base_b.isEmpty()) {
+        verification.message = "Teams could not be built from the data pack";
+        return verification;
+    }
+
+    // Recorded choices must reproduce the recorded battle exactly
+    Team team_a = base_a;
+    Team team_b = base_b;
+    BattleSimulator::ReplayControl control;
+    control.actions = &replay.actions;
+    const auto played = BattleSimulator::replayInPlace(team_a, team_b, replay.makeOptions(), control);
+    verification.playback_matches = !control.diverged && played.turns == replay.turns &&
+                                    played.outcome == replay.outcome &&
+                                    BattleReplay::stateHash(team_a, team_b) == replay.final_state_hash;
+    if (control.diverged) {
+        verification.first_divergent_turn = control.diverged_turn;
+    } else if (!verification.playback_matches) {
+        verification.first_divergent_turn = played.turns;
+    }
+
+    // The AI, given the same seed, must make the same choices again
+    const BattleReplay fresh = ReplayRecorder::record(base_a, base_b, replay.makeOptions());
+    size_t common = std::min(fresh.actions.size(), replay.actions.size());
+    size_t first_mismatch = common;
+    for (size_t i = 0; i < common; ++i) {
+        if (!sameAction(fresh.actions[i], replay.actions[i])) {
+            first_mismatch = i;
+            break;
+        }
+    }
+    verification.ai_matches = first_mismatch == common && fresh.actions.size() == replay.actions.size() &&
+                              fresh.final_state_hash == replay.final_state_hash;
+    if (!verification.ai_matches) {
+        const int turn = first_mismatch < replay.actions.size() ? replay.actions[first_mismatch].turn
+                                                                : fresh.turns;
+        if (verification.first_divergent_turn < 0 || turn < verification.first_divergent_turn) {
+            verification.first_divergent_turn = turn;
+        }
+    }
+
+    if (!verification.data_matches) {
+        verification.message = "Species or move data changed since the battle was recorded";
+    } else if (!verification.playback_matches) {
+        verification.message = "Engine no longer reproduces the recorded battle";
+    } else if (!verification.ai_matches) {
+        verification.message = "AI no longer makes the recorded choices";
+    } else {
+        verification.message = "Replay matches";
+    }
+    return verification;
+}
@@ -0,0 +1,829 @@
+#include "battle_simulator.h"
+#include "ai_factory.h"
+#include "resettable_battle_team.h"
+#include "trace.h"
+#include "type_effectiveness.h"
+#include "weather.h"
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <type_traits>
+
+namespace {
+
+/**
+ * @brief Stat-stage changes of the moves the interactive battle supports
+ */
+struct StatStageMove {
+    const char* name;
+    bool targets_self;
+    int attack;
+    int defense;
+    int special_attack;
+    int special_defense;
+    int speed;
+};
+
+constexpr StatStageMove kStatStageMoves[] = {
+    {"swords-dance", true, 2, 0, 0, 0, 0},
+    {"growl", false, -1, 0, 0, 0, 0},
+    {"agility", true, 0, 0, 0, 0, 2},
+    {"harden", true, 0, 1, 0, 0, 0},
+    {"defense-curl", true, 0, 1, 0, 0, 0},
+    {"iron-defense", true, 0, 2, 0, 0, 0},
+    {"calm-mind", true, 0, 0, 1, 1, 0},
+    {"leer", false, 0, -1, 0, 0, 0},
+    {"tail-whip", false, 0, -1, 0, 0, 0},
+    {"amnesia", true, 0, 0, 0, 2, 0},
+    {"barrier", true, 0, 2, 0, 0, 0},
+    {"sharpen", true, 1, 0, 0, 0, 0},
+    {"meditate", true, 1, 0, 0, 0, 0},
+    {"dragon-dance", true, 1, 0, 0, 0, 1},
+    {"nasty-plot", true, 0, 0, 2, 0, 0},
+};
+
+constexpr int kStruggle = -1;   // Move index used when nothing else is usable
+constexpr int kLevel = 50;
+
+uint64_t splitMix64(uint64_t value) {
+    value += 0x9E3779B97F4A7C15ull;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+struct Side {
+    Team* team = nullptr;           // Played in place
+    std::unique_ptr<AIStrategy> ai;
+    Pokemon* active = nullptr;
+    int pending_switch = -1;
+    int pending_move = kStruggle;
+    std::array<int, 6> knockouts{};
+    uint32_t logged_faints = 0;     // Slots already in the knockout log
+};
+
+using BattleEvents::EventSource;
+using Action = BattleSimulator::Action;
+
+/**
+ * @brief One battle, reporting to an event sink
+ *
+ * Events is BattleEventManager or a StaticEventDispatcher. With the
+ * NullEventDispatcher every emit() compiles away, so plain simulations pay
+ * nothing for the hooks. With a ReplayControl, scripted choices replace the
+ * AI's and keyframes are captured along the way.
+ */
+template<typename Events>
+class SimulatedBattle {
+public:
+    SimulatedBattle(Team& team_a, Team& team_b, const BattleSimulator::Options& options, Events& events,
+                    BattleSimulator::ReplayControl* control = nullptr)
+        : options(options), events(events), control(control),
+          rng(static_cast<std::mt19937::result_type>(options.seed ^ (options.seed >> 32))),
+          weather(WeatherCondition::NONE), weather_turns(0), turn(0), action_cursor(0) {
+        sides[0].team = &team_a;
+        sides[1].team = &team_b;
+        sides[0].ai = AIFactory::createAI(options.team_a_ai);
+        sides[1].ai = AIFactory::createAI(options.team_b_ai);
+        for (auto& side : sides) {
+            side.active = side.team->getFirstAlivePokemon();
+        }
+    }
+
+    BattleSimulator::Result run() {
+        if (control && control->resume_from) {
+            restore(*control->resume_from);
+        } else {
+            emit([&](Events& sink) { sink.notifyBattleStart(BattleEvents::BattleStartEvent{sides[0].active, sides[1].active}); });
+            captureKeyframe();
+        }
+        while (!finished() && !stopRequested()) {
+            turn++;
+            emit([&](Events& sink) { sink.notifyTurnStart(turn); });
+            playTurn();
+            replaceFainted();
+            emit([&](Events& sink) { sink.notifyTurnEnd(turn); });
+            if (control && turn % std::max(1, control->keyframe_interval) == 0) {
+                captureKeyframe();
+            }
+        }
+        BattleSimulator::Result result = summarize();
+        if (!finished()) {
+            return result;  // Stopped early; the battle has not ended
+        }
+        emit([&](Events& sink) {
+            using Winner = BattleEvents::BattleEndEvent::Winner;
+            const Winner winner = result.outcome == BattleSimulator::Outcome::TEAM_A_WINS ? Winner::PLAYER
+                : (result.outcome == BattleSimulator::Outcome::TEAM_B_WINS ? Winner::AI : Winner::DRAW);
+            sink.notifyBattleEnd(BattleEvents::BattleEndEvent{winner, turn});
+        });
+        return result;
+    }
+
+private:
+    BattleSimulator::Options options;
+    Events& events;
+    BattleSimulator::ReplayControl* control;
+    std::mt19937 rng;
+    Side sides[2];
+    WeatherCondition weather;
+    int weather_turns;
+    int turn;
+    std::vector<BattleSimulator::Knockout> knockout_log;
+    size_t action_cursor;   // Next scripted action
+
+    bool finished() const {
+        return !sides[0].active || !sides[1].active || turn >= options.max_turns;
+    }
+
+    bool stopRequested() const {
+        return control && (control->diverged || (control->stop_after_turn >= 0 && turn >= control->stop_after_turn));
+    }
+
+    void captureKeyframe() {
+        if (!control || !control->keyframes) {
+            return;
+        }
+        BattleSimulator::Keyframe keyframe;
+        keyframe.turn = turn;
+        keyframe.team_a = *sides[0].team;
+        keyframe.team_b = *sides[1].team;
+        keyframe.active_a = sides[0].active ? activeSlot(sides[0]) : -1;
+        keyframe.active_b = sides[1].active ? activeSlot(sides[1]) : -1;
+        keyframe.rng = rng;
+        keyframe.weather = weather;
+        keyframe.weather_turns = weather_turns;
+        keyframe.team_a_knockouts = sides[0].knockouts;
+        keyframe.team_b_knockouts = sides[1].knockouts;
+        keyframe.team_a_logged_faints = sides[0].logged_faints;
+        keyframe.team_b_logged_faints = sides[1].logged_faints;
+        keyframe.knockout_log = knockout_log;
+        keyframe.action_cursor = action_cursor;
+        control->keyframes->push_back(std::move(keyframe));
+    }
+
+    // The teams themselves are restored by runBattle before the battle is built
+    void restore(const BattleSimulator::Keyframe& keyframe) {
+        sides[0].active = keyframe.active_a >= 0 ? sides[0].team->getPokemon(keyframe.active_a) : nullptr;
+        sides[1].active = keyframe.active_b >= 0 ? sides[1].team->getPokemon(keyframe.active_b) : nullptr;
+        sides[0].knockouts = keyframe.team_a_knockouts;
+        sides[1].knockouts = keyframe.team_b_knockouts;
+        sides[0].logged_faints = keyframe.team_a_logged_faints;
+        sides[1].logged_faints = keyframe.team_b_logged_faints;
+        rng = keyframe.rng;
+        weather = keyframe.weather;
+        weather_turns = keyframe.weather_turns;
+        turn = keyframe.turn;
+        knockout_log = keyframe.knockout_log;
+        action_cursor = keyframe.action_cursor;
+    }
+
+    bool diverge() {
+        if (!control->diverged) {
+            control->diverged = true;
+            control->diverged_turn = turn;
+        }
+        return false;
+    }
+
+    // The side's next scripted action, or null if the AI decides (unscripted, or the script no longer fits)
+    const Action* nextScripted(int index) {
+        if (!control || !control->actions || control->diverged) {
+            return nullptr;
+        }
+        const auto& actions = *control->actions;
+        if (action_cursor >= actions.size() || actions[action_cursor].turn != turn ||
+            actions[action_cursor].isPlayer != (index == 0)) {
+            diverge();
+            return nullptr;
+        }
+        return &actions[action_cursor++];
+    }
+
+    void reportChoice(int index, Action::Kind kind, int choice) {
+        emit([&](Events& sink) { sink.notifyActionChosen(Action{turn, index == 0, kind, choice}); });
+    }
+
+    // Calls notify(events) if anyone is listening; a no-op for the NullEventDispatcher
+    template<typename Notify>
+    void emit(Notify&& notify) {
+        if constexpr (!std::is_same_v<Events, BattleEvents::NullEventDispatcher>) {
+            if (events.hasListeners()) {
+                notify(events);
+            }
+        }
+    }
+
+    // Damage (positive amount) or healing (negative amount), reported as a health change
+    void changeHealth(Pokemon& target, int amount, EventSource source,
+                      const Pokemon* by = nullptr, const Move* move = nullptr) {
+        const int old_hp = target.current_hp;
+        if (amount >= 0) {
+            target.takeDamage(amount);
+        } else {
+            target.heal(-amount);
+        }
+        if (target.current_hp == old_hp) {
+            return;
+        }
+        emit([&](Events& sink) {
+            auto event = BattleEvents::BattleEventManager::createHealthChangeEvent(
+                &target, old_hp, target.current_hp, source, by, move);
+            if (source == EventSource::WEATHER) {
+                event.sourceWeather = weather;
+            } else if (source == EventSource::STATUS) {
+                event.sourceStatus = target.status;
+            }
+            sink.notifyHealthChanged(event);
+        });
+    }
+
+    // Reported after the move's effects, so critical hits are known
+    void reportMove(Pokemon& attacker, const Move& move, Pokemon& defender, bool hit, bool critical) {
+        emit([&](Events& sink) {
+            const double effectiveness = TypeEffectiveness::getEffectivenessMultiplier(move.type, defender.types);
+            sink.notifyMoveUsed(BattleEvents::MoveUsedEvent{&attacker, &move, &defender, hit, critical, effectiveness});
+        });
+    }
+
+    void switchIn(int index, Pokemon* replacement) {
+        Side& side = sides[index];
+        Pokemon* previous = side.active;
+        side.active = replacement;
+        emit([&](Events& sink) { sink.notifyPokemonSwitch(BattleEvents::PokemonSwitchEvent{previous, replacement, index == 0}); });
+    }
+
+    bool roll(int percent) {
+        return std::uniform_int_distribution<int>(1, 100)(rng) <= percent;
+    }
+
+    BattleState stateFor(int index) {
+        Side& self = sides[index];
+        Side& other = sides[1 - index];
+        BattleState state;
+        state.aiPokemon = self.active;
+        state.opponentPokemon = other.active;
+        state.aiTeam = self.team;
+        state.opponentTeam = other.team;
+        state.currentWeather = weather;
+        state.weatherTurnsRemaining = weather_turns;
+        state.turnNumber = turn;
+        state.deterministicRng.seed(rng());
+        return state;
+    }
+
+    void chooseAction(int index) {
+        TRACE_SCOPE("simulator", "BattleSimulator::moveSelection");
+        Side& side = sides[index];
+        side.pending_switch = -1;
+        side.pending_move = kStruggle;
+
+        Pokemon& pokemon = *side.active;
+        if (pokemon.mustRecharge() || pokemon.isCharging()) {
+            side.pending_move = pokemon.isCharging() ? pokemon.getChargingMoveIndex() : kStruggle;
+            return;
+        }
+
+        // The state is built even for scripted choices, so the generator advances identically
+        BattleState state = stateFor(index);
+        if (!playScriptedChoice(index)) {
+            chooseWithAI(index, state);
+        }
+        if (side.pending_switch >= 0) {
+            reportChoice(index, Action::Kind::SWITCH, side.pending_switch);
+        } else {
+            reportChoice(index, Action::Kind::MOVE, side.pending_move);
+        }
+    }
+
+    static bool canUseMove(const Pokemon& pokemon, int move_index) {
+        return move_index >= 0 && move_index < static_cast<int>(pokemon.moves.size()) &&
+               pokemon.moves[move_index].canUse();
+    }
+
+    void chooseWithAI(int index, BattleState& state) {
+        Side& side = sides[index];
+        if (side.ai->shouldSwitch(state)) {
+            const SwitchEvaluation choice = side.ai->chooseBestSwitch(state);
+            Pokemon* target = side.team->getPokemon(choice.pokemonIndex);
+            if (target && target->isAlive() && target != side.active) {
+                side.pending_switch = choice.pokemonIndex;
+                return;
+            }
+        }
+
+        const MoveEvaluation choice = side.ai->chooseBestMove(state);
+        if (canUseMove(*side.active, choice.moveIndex)) {
+            side.pending_move = choice.moveIndex;
+        }
+    }
+
+    // Applies the side's next scripted move or switch; false if the AI has to choose
+    bool playScriptedChoice(int index) {
+        const Action* action = nextScripted(index);
+        if (!action) {
+            return false;
+        }
+        Side& side = sides[index];
+        if (action->kind == Action::Kind::SWITCH) {
+            Pokemon* target = side.team->getPokemon(action->index);
+            if (target && target->isAlive() && target != side.active) {
+                side.pending_switch = action->index;
+                return true;
+            }
+        } else if (action->kind == Action::Kind::MOVE &&
+                   (action->index == kStruggle || canUseMove(*side.active, action->index))) {
+            side.pending_move = action->index;
+            return true;
+        }
+        return diverge();
+    }
+
+    int movePriority(const Side& side) const {
+        if (side.pending_move == kStruggle || side.pending_move >= static_cast<int>(side.active->moves.size())) {
+            return 0;
+        }
+        return side.active->moves[side.pending_move].priority;
+    }
+
+    void playTurn() {
+        TRACE_SCOPE("simulator", "BattleSimulator::turn");
+        chooseAction(0);
+        chooseAction(1);
+
+        // Switches happen before any move
+        for (int index = 0; index < 2; ++index) {
+            Side& side = sides[index];
+            if (side.pending_switch >= 0) {
+                side.active->resetStatStages();
+                switchIn(index, side.team->getPokemon(side.pending_switch));
+            }
+        }
+
+        int first = 0;
+        const int priority_a = movePriority(sides[0]);
+        const int priority_b = movePriority(sides[1]);
+        if (priority_a != priority_b) {
+            first = priority_a > priority_b ? 0 : 1;
+        } else if (sides[0].active->getEffectiveSpeed() != sides[1].active->getEffectiveSpeed()) {
+            first = sides[0].active->getEffectiveSpeed() > sides[1].active->getEffectiveSpeed() ? 0 : 1;
+        } else {
+            first = static_cast<int>(rng() & 1u);
+        }
+
+        for (int order = 0; order < 2; ++order) {
+            const int index = order == 0 ? first : 1 - first;
+            Side& attacker = sides[index];
+            Side& defender = sides[1 - index];
+            if (attacker.pending_switch >= 0 || !attacker.active->isAlive() || !defender.active->isAlive()) {
+                continue;
+            }
+            executeMove(*attacker.active, *defender.active, attacker.pending_move, order == 0);
+            if (!defender.active->isAlive()) {
+                creditKnockout(attacker);
+                logKnockout(1 - index, activeSlot(attacker));
+            }
+        }
+
+        endOfTurn();
+    }
+
+    static int activeSlot(const Side& side) {
+        for (int slot = 0; slot < static_cast<int>(side.team->size()); ++slot) {
+            if (side.team->getPokemon(slot) == side.active) {
+                return slot;
+            }
+        }
+        return -1;
+    }
+
+    // Only knockouts dealt by a move count; status and weather damage are not credited
+    static void creditKnockout(Side& side) {
+        const int slot = activeSlot(side);
+        if (slot >= 0 && slot < static_cast<int>(side.knockouts.size())) {
+            side.knockouts[slot]++;
+        }
+    }
+
+    // Logs the side's active Pokemon fainting, once per slot
+    void logKnockout(int index, int attacker_slot) {
+        if (!options.record_knockouts) {
+            return;
+        }
+        Side& side = sides[index];
+        const int slot = activeSlot(side);
+        if (slot < 0 || slot >= 32 || (side.logged_faints & (1u << slot))) {
+            return;
+        }
+        side.logged_faints |= 1u << slot;
+        knockout_log.emplace_back(turn, index == 0, slot, attacker_slot);
+    }
+
+    void executeMove(Pokemon& attacker, Pokemon& defender, int move_index, bool moved_first) {
+        TRACE_SCOPE("simulator", "BattleSimulator::moveExecution");
+        if (attacker.mustRecharge()) {
+            attacker.finishRecharge();
+            return;
+        }
+        if (!attacker.canAct(rng)) {
+            return;
+        }
+
+        if (move_index == kStruggle || move_index >= static_cast<int>(attacker.moves.size())) {
+            struggle(attacker, defender);
+            return;
+        }
+
+        Move& move = attacker.moves[move_index];
+        if (attacker.isCharging() && attacker.getChargingMoveIndex() == move_index) {
+            attacker.finishCharging();
+            move.usePP();
+        } else if (move.requiresCharging()) {
+            move.usePP();
+            if (!(move.skipChargeInSunnyWeather() && weather == WeatherCondition::SUN)) {
+                attacker.startCharging(move_index, move.name);
+                return;
+            }
+        } else {
+            move.usePP();
+            if (move.requiresRecharge()) {
+                attacker.startRecharge();
+            }
+        }
+
+        if (move.accuracy != 0 && !roll(move.accuracy)) {
+            reportMove(attacker, move, defender, false, false);
+            return;
+        }
+
+        if (move.category == "ohko") {
+            changeHealth(defender, defender.current_hp, EventSource::OHKO_MOVE, &attacker, &move);
+            reportMove(attacker, move, defender, true, false);
+            return;
+        }
+
+        if (move.healing > 0) {
+            changeHealth(attacker, -std::min((attacker.hp * move.healing) / 100, attacker.hp - attacker.current_hp),
+                         EventSource::HEALING_MOVE, &attacker, &move);
+            reportMove(attacker, move, defender, true, false);
+            return;
+        }
+
+        if (move.power <= 0) {
+            applyStatusMove(attacker, defender, move);
+            reportMove(attacker, move, defender, true, false);
+            return;
+        }
+
+        int hits = 1;
+        if (move.min_hits > 0 && move.max_hits > 0) {
+            hits = std::uniform_int_distribution<int>(move.min_hits, move.max_hits)(rng);
+        }
+
+        int total_damage = 0;
+        bool critical = false;
+        for (int hit = 0; hit < hits && defender.isAlive(); ++hit) {
+            const int damage = calculateDamage(attacker, defender, move, critical);
+            total_damage += damage;
+            changeHealth(defender, damage, EventSource::MOVE, &attacker, &move);
+        }
+        reportMove(attacker, move, defender, true, critical);
+
+        if (move.drain > 0 && total_damage > 0) {
+            changeHealth(attacker, -std::min((total_damage * move.drain) / 100, attacker.hp - attacker.current_hp),
+                         EventSource::DRAIN, &attacker, &move);
+        } else if (move.drain < 0 && total_damage > 0) {
+            changeHealth(attacker, (total_damage * -move.drain) / 100, EventSource::RECOIL, &attacker, &move);
+        }
+
+        // Flinching only matters if the defender has yet to move this turn
+        if (moved_first && move.flinch_chance > 0 && defender.isAlive() && roll(move.flinch_chance)) {
+            applyStatus(defender, StatusCondition::FLINCH);
+        }
+
+        const StatusCondition status = move.getStatusCondition();
+        if (status != StatusCondition::NONE && move.ailment_chance > 0 && defender.isAlive() &&
+            roll(move.ailment_chance) && !defender.hasStatusCondition()) {
+            applyStatus(defender, status);
+        }
+    }
+
+    void applyStatusMove(Pokemon& attacker, Pokemon& defender, const Move& move) {
+        const StatusCondition status = move.getStatusCondition();
+        if (status != StatusCondition::NONE) {
+            const bool applies = move.category == "ailment" ||
+                                 (move.ailment_chance > 0 && roll(move.ailment_chance));
+            if (applies && !defender.hasStatusCondition()) {
+                applyStatus(defender, status);
+            }
+        }
+
+        if (move.category == "net-good-stats") {
+            for (const auto& stat_move : kStatStageMoves) {
+                if (move.name == stat_move.name) {
+                    Pokemon& target = stat_move.targets_self ? attacker : defender;
+                    target.modifyAttack(stat_move.attack);
+                    target.modifyDefense(stat_move.defense);
+                    target.modifySpecialAttack(stat_move.special_attack);
+                    target.modifySpecialDefense(stat_move.special_defense);
+                    target.modifySpeed(stat_move.speed);
+                    break;
+                }
+            }
+        } else if (move.name == "rain-dance") {
+            setWeather(WeatherCondition::RAIN);
+        } else if (move.name == "sunny-day") {
+            setWeather(WeatherCondition::SUN);
+        } else if (move.name == "sandstorm") {
+            setWeather(WeatherCondition::SANDSTORM);
+        } else if (move.name == "hail") {
+            setWeather(WeatherCondition::HAIL);
+        }
+    }
+
+    void applyStatus(Pokemon& pokemon, StatusCondition status) {
+        const StatusCondition old_status = pokemon.status;
+        pokemon.applyStatusCondition(status);
+        if (status == StatusCondition::SLEEP && pokemon.status == StatusCondition::SLEEP) {
+            // Re-roll the sleep duration from the battle's own generator
+            pokemon.status_turns_remaining = std::uniform_int_distribution<int>(1, 3)(rng);
+        }
+        notifyStatus(pokemon, old_status, EventSource::MOVE);
+    }
+
+    void clearStatus(Pokemon& pokemon) {
+        const StatusCondition old_status = pokemon.status;
+        pokemon.clearStatusCondition();
+        notifyStatus(pokemon, old_status, EventSource::STATUS);
+    }
+
+    void notifyStatus(Pokemon& pokemon, StatusCondition old_status, EventSource source) {
+        if (pokemon.status == old_status) {
+            return;
+        }
+        emit([&](Events& sink) {
+            sink.notifyStatusChanged(BattleEvents::BattleEventManager::createStatusChangeEvent(
+                &pokemon, old_status, pokemon.status, pokemon.status_turns_remaining, source));
+        });
+    }
+
+    void setWeather(WeatherCondition condition) {
+        const WeatherCondition old_weather = weather;
+        weather = condition;
+        weather_turns = 5;
+        emit([&](Events& sink) { sink.notifyWeatherChanged(BattleEvents::WeatherChangeEvent{old_weather, weather, weather_turns}); });
+    }
+
+    void struggle(Pokemon& attacker, Pokemon& defender) {
+        Move struggle_move;
+        struggle_move.name = "struggle";
+        struggle_move.power = 50;
+        struggle_move.damage_class = "physical";
+        struggle_move.type = "typeless";
+        struggle_move.crit_rate = 0;
+        bool critical = false;
+        const int damage = calculateDamage(attacker, defender, struggle_move, critical);
+        changeHealth(defender, damage, EventSource::MOVE, &attacker, &struggle_move);
+        changeHealth(attacker, std::max(1, attacker.hp / 4), EventSource::RECOIL, &attacker, &struggle_move);
+    }
+
+    // Sets critical if this hit was a critical hit
+    int calculateDamage(const Pokemon& attacker, const Pokemon& defender, const Move& move, bool& critical) {
+        const bool physical = move.damage_class == "physical";
+        const int attack_stat = physical ? attacker.getEffectiveAttack() : attacker.special_attack;
+        const int defense_stat = std::max(1, physical ? defender.defense : defender.special_defense);
+
+        double damage = (((2.0 * kLevel / 5.0 + 2.0) * move.power * attack_stat / defense_stat) / 50.0) + 2.0;
+        damage *= 0.85 + std::uniform_int_distribution<int>(0, 15)(rng) / 100.0;
+
+        const double type_multiplier = move.type == "typeless"
+            ? 1.0 : TypeEffectiveness::getEffectivenessMultiplier(move.type, defender.types);
+        if (type_multiplier == 0.0) {
+            return 0;
+        }
+
+        const bool stab = std::find(attacker.types.begin(), attacker.types.end(), move.type) != attacker.types.end();
+        const double critical_ratio = move.crit_rate > 0 ? 1.0 / 8.0 : 1.0 / 16.0;
+        const bool is_critical = std::uniform_real_distribution<double>(0.0, 1.0)(rng) < critical_ratio;
+        critical = critical || is_critical;
+
+        damage = static_cast<int>(damage) * type_multiplier *
+                 Weather::getWeatherDamageMultiplier(weather, move.type) *
+                 (stab ? 1.5 : 1.0) * (is_critical ? 2.0 : 1.0);
+        return std::max(1, static_cast<int>(damage));
+    }
+
+    void endOfTurn() {
+        TRACE_SCOPE("simulator", "BattleSimulator::statusAndWeather");
+        for (auto& side : sides) {
+            Pokemon& pokemon = *side.active;
+            if (!pokemon.isAlive()) {
+                continue;
+            }
+
+            switch (pokemon.status) {
+                case StatusCondition::POISON:
+                    changeHealth(pokemon, std::max(1, pokemon.hp / 8), EventSource::STATUS);
+                    break;
+                case StatusCondition::BURN:
+                    changeHealth(pokemon, std::max(1, pokemon.hp / 16), EventSource::STATUS);
+                    break;
+                case StatusCondition::SLEEP:
+                    if (pokemon.status_turns_remaining > 0 && --pokemon.status_turns_remaining == 0) {
+                        clearStatus(pokemon);
+                    }
+                    break;
+                case StatusCondition::FREEZE:
+                    if (roll(20)) {
+                        clearStatus(pokemon);
+                    }
+                    break;
+                case StatusCondition::FLINCH:
+                    clearStatus(pokemon);
+                    break;
+                default:
+                    break;
+            }
+
+            if (pokemon.isAlive() && weather != WeatherCondition::NONE &&
+                !Weather::isImmuneToWeatherDamage(weather, pokemon.types)) {
+                changeHealth(pokemon, Weather::getWeatherDamage(weather, pokemon.hp), EventSource::WEATHER);
+            }
+        }
+
+        if (weather_turns > 0 && --weather_turns == 0) {
+            const WeatherCondition old_weather = weather;
+            weather = WeatherCondition::NONE;
+            emit([&](Events& sink) { sink.notifyWeatherChanged(BattleEvents::WeatherChangeEvent{old_weather, weather, 0}); });
+        }
+    }
+
+    void replaceFainted() {
+        for (int index = 0; index < 2; ++index) {
+            Side& side = sides[index];
+            if (side.active->isAlive()) {
+                continue;
+            }
+            logKnockout(index, -1);  // Fainted outside an opposing move, unless already logged
+            if (!side.team->hasAlivePokemon()) {
+                side.active = nullptr;
+                continue;
+            }
+
+            Pokemon* replacement = nullptr;
+            const bool chosen = sides[1 - index].active != nullptr;
+            if (chosen) {
+                BattleState state = stateFor(index);
+                if (const Action* action = nextScripted(index)) {
+                    Pokemon* scripted = side.team->getPokemon(action->index);
+                    if (action->kind == Action::Kind::REPLACEMENT && scripted && scripted->isAlive()) {
+                        replacement = scripted;
+                    } else {
+                        diverge();
+                    }
+                }
+                if (!replacement) {
+                    replacement = side.team->getPokemon(side.ai->chooseBestSwitch(state).pokemonIndex);
+                }
+            }
+            if (!replacement || !replacement->isAlive()) {
+                replacement = side.team->getFirstAlivePokemon();
+            }
+            switchIn(index, replacement);
+            if (chosen) {
+                reportChoice(index, Action::Kind::REPLACEMENT, activeSlot(side));
+            }
+        }
+    }
+
+    static void summarizeSlots(const Side& side, std::array<int, 6>& knockouts, std::array<bool, 6>& fainted,
+                               std::array<double, 6>& slot_hp) {
+        knockouts = side.knockouts;
+        for (int slot = 0; slot < static_cast<int>(std::min<size_t>(side.team->size(), fainted.size())); ++slot) {
+            const Pokemon* pokemon = side.team->getPokemon(slot);
+            fainted[slot] = pokemon && !pokemon->isAlive();
+            slot_hp[slot] = pokemon && pokemon->hp > 0 ? static_cast<double>(pokemon->current_hp) / pokemon->hp : 0.0;
+        }
+    }
+
+    static void summarizeTeam(const Team& team, int& remaining, double& hp_fraction) {
+        int current = 0;
+        int total = 0;
+        remaining = 0;
+        for (const auto& [_, pokemon] : team) {
+            current += pokemon.current_hp;
+            total += pokemon.hp;
+            if (pokemon.isAlive()) {
+                remaining++;
+            }
+        }
+        hp_fraction = total > 0 ? static_cast<double>(current) / total : 0.0;
+    }
+
+    BattleSimulator::Result summarize() const {
+        BattleSimulator::Result result;
+        result.turns = turn;
+        summarizeTeam(*sides[0].team, result.team_a_remaining, result.team_a_hp_fraction);
+        summarizeTeam(*sides[1].team, result.team_b_remaining, result.team_b_hp_fraction);
+        summarizeSlots(sides[0], result.team_a_knockouts, result.team_a_fainted, result.team_a_slot_hp);
+        summarizeSlots(sides[1], result.team_b_knockouts, result.team_b_fainted, result.team_b_slot_hp);
+        result.knockout_log = knockout_log;
+
+        if (result.team_a_remaining > 0 && result.team_b_remaining == 0) {
+            result.outcome = BattleSimulator::Outcome::TEAM_A_WINS;
+        } else if (result.team_b_remaining > 0 && result.team_a_remaining == 0) {
+            result.outcome = BattleSimulator::Outcome::TEAM_B_WINS;
+        } else {
+            result.outcome = BattleSimulator::Outcome::DRAW;
+        }
+        return result;
+    }
+};
+
+} // namespace
+
+BattleSimulator::Result BattleSimulator::simulate(const Team& team_a, const Team& team_b,
+                                                  const Options& options) {
+    Team copy_a = team_a;
+    Team copy_b = team_b;
+    return simulateInPlace(copy_a, copy_b, options);
+}
+
+namespace {
+
+template<typename Events>
+BattleSimulator::Result runBattle(Team& team_a, Team& team_b, const BattleSimulator::Options& options,
+                                  Events& events, BattleSimulator::ReplayControl* control = nullptr) {
+    if (control && control->resume_from) {
+        team_a = control->resume_from->team_a;
+        team_b = control->resume_from->team_b;
+    }
+    if (team_a.isEmpty() || team_b.isEmpty()) {
+        BattleSimulator::Result result;
+        result.outcome = team_a.isEmpty() == team_b.isEmpty() ? BattleSimulator::Outcome::DRAW
+            : (team_a.isEmpty() ? BattleSimulator::Outcome::TEAM_B_WINS : BattleSimulator::Outcome::TEAM_A_WINS);
+        return result;
+    }
+
+    SimulatedBattle<Events> battle(team_a, team_b, options, events, control);
+    return battle.run();
+}
+
+} // namespace
+
+BattleSimulator::Result BattleSimulator::simulateInPlace(Team& team_a, Team& team_b, const Options& options) {
+    BattleEvents::NullEventDispatcher events;
+    return runBattle(team_a, team_b, options, events);
+}
+
+BattleSimulator::Result BattleSimulator::simulateInPlace(Team& team_a, Team& team_b, const Options& options,
+                                                         BattleEvents::BattleEventManager& events) {
+    return runBattle(team_a, team_b, options, events);
+}
+
+BattleSimulator::Result BattleSimulator::replayInPlace(Team& team_a, Team& team_b, const Options& options,
+                                                       ReplayControl& control,
+                                                       BattleEvents::BattleEventManager* events) {
+    control.diverged = false;
+    control.diverged_turn = -1;
+    if (events) {
+        return runBattle(team_a, team_b, options, *events, &control);
+    }
+    BattleEvents::NullEventDispatcher none;
+    return runBattle(team_a, team_b, options, none, &control);
+}
+
+BattleSimulator::SeriesResult BattleSimulator::simulateSeries(const Team& team_a, const Team& team_b, int best_of,
+                                                              const Options& options) {
+    SeriesResult series;
+    series.best_of = std::max(1, best_of);
+    const int wins_needed = series.best_of / 2 + 1;
+    const int max_games = 2 * series.best_of;
+
+    long long total_turns = 0;
+    Options game_options = options;
+    ResettableBattleTeam a(team_a);
+    ResettableBattleTeam b(team_b);
+    while (series.team_a_wins < wins_needed && series.team_b_wins < wins_needed &&
+           series.games_played < max_games) {
+        if (series.games_played > 0) {
+            a.reset();
+            b.reset();
+        }
+        game_options.seed = splitMix64(options.seed + static_cast<uint64_t>(series.games_played));
+        const Result result = simulateInPlace(a.get(), b.get(), game_options);
+        series.games_played++;
+        total_turns += result.turns;
+        series.team_a_wins += result.outcome == Outcome::TEAM_A_WINS ? 1 : 0;
+        series.team_b_wins += result.outcome == Outcome::TEAM_B_WINS ? 1 : 0;
+        series.draws += result.outcome == Outcome::DRAW ? 1 : 0;
+    }
+
+    if (series.team_a_wins >= wins_needed) {
+        series.winner = Outcome::TEAM_A_WINS;
+    } else if (series.team_b_wins >= wins_needed) {
+        series.winner = Outcome::TEAM_B_WINS;
+    }
+    series.average_turns = static_cast<double>(total_turns) / series.games_played;
+    return series;
+}
@@ -0,0 +1,137 @@
+#include "battle_team_factory.h"
+#include "input_validator.h"
+#include <mutex>
+
+BattleTeamFactory& BattleTeamFactory::shared() {
+    static BattleTeamFactory factory;
+    return factory;
+}
+
+BattleTeamFactory::SpeciesId BattleTeamFactory::resolveSpecies(const std::string& name) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = species_ids.find(name);
+        if (it != species_ids.end()) {
+            return it->second;
+        }
+    }
+
+    // Load outside the lock; another thread may race us to the same name
+    Pokemon pokemon;
+    if (InputValidator::isValidPokemonName(name) && InputValidator::isSecureFileName(name)) {
+        pokemon = Pokemon(name);
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto it = species_ids.find(name);
+    if (it != species_ids.end()) {
+        return it->second;
+    }
+    SpeciesId id = kUnresolved;
+    if (!pokemon.name.empty()) {
+        id = static_cast<SpeciesId>(species.size());
+        species.push_back(std::move(pokemon));
+    }
+    species_ids.emplace(name, id);
+    return id;
+}
+
+BattleTeamFactory::MoveId BattleTeamFactory::resolveMove(const std::string& name) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = move_ids.find(name);
+        if (it != move_ids.end()) {
+            return it->second;
+        }
+    }
+
+    Move move;
+    if (InputValidator::isValidMoveName(name) && InputValidator::isSecureFileName(name)) {
+        move = Move(name);
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto it = move_ids.find(name);
+    if (it != move_ids.end()) {
+        return it->second;
+    }
+    MoveId id = kUnresolved;
+    if (!move.name.empty()) {
+        id = static_cast<MoveId>(moves.size());
+        moves.push_back(std::move(move));
+    }
+    move_ids.emplace(name, id);
+    return id;
+}
+
+BattleTeamFactory::ResolvedTeam BattleTeamFactory::resolve(const TeamBuilder::Team& team) {
+    ResolvedTeam resolved;
+    resolved.members.reserve(team.pokemon.size());
+    for (const auto& member : team.pokemon) {
+        ResolvedMember entry;
+        entry.species = resolveSpecies(member.name);
+        if (entry.species == kUnresolved) {
+            continue;
+        }
+        entry.moves.reserve(member.moves.size());
+        for (const auto& move_name : member.moves) {
+            const MoveId move = resolveMove(move_name);
+            if (move != kUnresolved) {
+                entry.moves.push_back(move);
+            }
+        }
+        resolved.members.push_back(std::move(entry));
+    }
+    return resolved;
+}
+
+Team BattleTeamFactory::build(const ResolvedTeam& team) const {
+    Team battle_team;
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    for (const auto& member : team.members) {
+        if (member.species < 0 || member.species >= static_cast<SpeciesId>(species.size())) {
+            continue;
+        }
+        Pokemon pokemon = species[member.species];
+        pokemon.moves.reserve(member.moves.size());
+        for (MoveId move : member.moves) {
+            if (move >= 0 && move < static_cast<MoveId>(moves.size())) {
+                pokemon.moves.push_back(moves[move]);
+            }
+        }
+        battle_team.addPokemon(std::move(pokemon));
+    }
+    return battle_team;
+}
+
+Team BattleTeamFactory::build(const TeamBuilder::Team& team) {
+    return build(resolve(team));
+}
+
+const Pokemon* BattleTeamFactory::getSpecies(SpeciesId id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return id >= 0 && id < static_cast<SpeciesId>(species.size()) ? &species[id] : nullptr;
+}
+
+const Move* BattleTeamFactory::getMove(MoveId id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return id >= 0 && id < static_cast<MoveId>(moves.size()) ? &moves[id] : nullptr;
+}
+
+size_t BattleTeamFactory::getSpeciesCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return species.size();
+}
+
+size_t BattleTeamFactory::getMoveCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return moves.size();
+}
+
+void BattleTeamFactory::clear() {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    species.clear();
+    moves.clear();
+    species_ids.clear();
+    move_ids.clear();
+}
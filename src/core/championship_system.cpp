@@ -1,6 +1,7 @@
 #include "championship_system.h"
 #include "battle.h"
 #include "team.h"
+#include "team_matchup_simulator.h"
 #include "json.hpp"
 #include <fstream>
 #include <filesystem>
@@ -9,10 +10,125 @@
 #include <sstream>
 #include <algorithm>
 #include <random>
+#include <unordered_set>
 
 using json = nlohmann::json;
 namespace fs = std::filesystem;
 
+namespace {
+
+// Per-record JSON encoding shared by the journal and the legacy championship file
+
+json runToJson(const ChampionshipSystem::ChampionshipRun& run) {
+    json run_json;
+    run_json["player_name"] = run.player_name;
+    run_json["player_team_name"] = run.player_team_name;
+    run_json["start_date"] = run.start_date;
+    run_json["defeated_opponents"] = run.defeated_opponents;
+    run_json["current_opponent"] = run.current_opponent;
+    run_json["current_position"] = run.current_position;
+    run_json["is_active"] = run.is_active;
+    run_json["is_completed"] = run.is_completed;
+    run_json["victory"] = run.victory;
+    run_json["battle_turns"] = run.battle_turns;
+    run_json["battle_scores"] = run.battle_scores;
+    run_json["total_time_minutes"] = run.total_time_minutes;
+    run_json["total_healing_events"] = run.total_healing_events;
+    run_json["allow_healing_between_battles"] = run.allow_healing_between_battles;
+    run_json["sequential_requirement"] = run.sequential_requirement;
+    run_json["difficulty_progression"] = run.difficulty_progression;
+    return run_json;
+}
+
+ChampionshipSystem::ChampionshipRun runFromJson(const json& run_json) {
+    ChampionshipSystem::ChampionshipRun run;
+    run.player_name = run_json.value("player_name", "");
+    run.player_team_name = run_json.value("player_team_name", "");
+    run.start_date = run_json.value("start_date", "");
+    run.defeated_opponents = run_json.value("defeated_opponents", std::vector<std::string>());
+    run.current_opponent = run_json.value("current_opponent", "");
+    run.current_position = run_json.value("current_position", 1);
+    run.is_active = run_json.value("is_active", false);
+    run.is_completed = run_json.value("is_completed", false);
+    run.victory = run_json.value("victory", false);
+    run.battle_turns = run_json.value("battle_turns", std::vector<int>());
+    run.battle_scores = run_json.value("battle_scores", std::vector<double>());
+    run.total_time_minutes = run_json.value("total_time_minutes", 0.0);
+    run.total_healing_events = run_json.value("total_healing_events", 0);
+    run.allow_healing_between_battles = run_json.value("allow_healing_between_battles", true);
+    run.sequential_requirement = run_json.value("sequential_requirement", true);
+    run.difficulty_progression = run_json.value("difficulty_progression", "progressive");
+    return run;
+}
+
+json championshipResultToJson(const ChampionshipSystem::ChampionshipBattleResult& result) {
+    json result_json;
+    result_json["player_name"] = result.player_name;
+    result_json["opponent_name"] = result.opponent_name;
+    result_json["opponent_type"] = result.opponent_type;
+    result_json["opponent_position"] = result.opponent_position;
+    result_json["victory"] = result.victory;
+    result_json["turns_taken"] = result.turns_taken;
+    result_json["difficulty_level"] = result.difficulty_level;
+    result_json["performance_score"] = result.performance_score;
+    result_json["battle_duration"] = result.battle_duration;
+    result_json["fainted_pokemon"] = result.fainted_pokemon;
+    result_json["low_health_pokemon"] = result.low_health_pokemon;
+    result_json["team_needs_healing"] = result.team_needs_healing;
+    result_json["key_moments"] = result.key_moments;
+    result_json["strategic_notes"] = result.strategic_notes;
+    result_json["mvp_pokemon"] = result.mvp_pokemon;
+    result_json["battle_seed"] = result.battle_seed;
+    return result_json;
+}
+
+ChampionshipSystem::ChampionshipBattleResult championshipResultFromJson(const json& result_json) {
+    ChampionshipSystem::ChampionshipBattleResult result;
+    result.player_name = result_json.value("player_name", "");
+    result.opponent_name = result_json.value("opponent_name", "");
+    result.opponent_type = result_json.value("opponent_type", "");
+    result.opponent_position = result_json.value("opponent_position", 0);
+    result.victory = result_json.value("victory", false);
+    result.turns_taken = result_json.value("turns_taken", 0);
+    result.difficulty_level = result_json.value("difficulty_level", "");
+    result.performance_score = result_json.value("performance_score", 0.0);
+    result.battle_duration = result_json.value("battle_duration", "");
+    result.fainted_pokemon = result_json.value("fainted_pokemon", std::vector<std::string>());
+    result.low_health_pokemon = result_json.value("low_health_pokemon", std::vector<std::string>());
+    result.team_needs_healing = result_json.value("team_needs_healing", false);
+    result.key_moments = result_json.value("key_moments", std::vector<std::string>());
+    result.strategic_notes = result_json.value("strategic_notes", std::vector<std::string>());
+    result.mvp_pokemon = result_json.value("mvp_pokemon", "");
+    result.battle_seed = result_json.value("battle_seed", uint64_t(0));
+    return result;
+}
+
+std::string slotName(const Team& team, int slot) {
+    const Pokemon* pokemon = team.getPokemon(slot);
+    return pokemon ? pokemon->name : "";
+}
+
+// Team A is the player's team
+std::string describeKnockout(const BattleSimulator::Knockout& knockout, const Team& player_team,
+                             const Team& opponent_team) {
+    const std::string fainted = knockout.team_a ? slotName(player_team, knockout.slot)
+                                                : "opposing " + slotName(opponent_team, knockout.slot);
+    std::string moment = "Turn " + std::to_string(knockout.turn) + ": ";
+    if (knockout.attacker_slot < 0) {
+        return moment + fainted + " fainted";
+    }
+    const std::string attacker = knockout.team_a ? "opposing " + slotName(opponent_team, knockout.attacker_slot)
+                                                 : slotName(player_team, knockout.attacker_slot);
+    return moment + attacker + " knocked out " + fainted;
+}
+
+uint64_t randomBattleSeed() {
+    std::random_device rd;
+    return (static_cast<uint64_t>(rd()) << 32) ^ rd();
+}
+
+} // namespace
+
 ChampionshipSystem::ChampionshipSystem(std::shared_ptr<PokemonData> data,
                                      std::shared_ptr<TeamBuilder> team_builder,
                                      std::shared_ptr<TournamentManager> tournament_manager)
@@ -61,9 +177,10 @@ bool ChampionshipSystem::startChampionshipRun(const std::string& player_name,
     // Initialize player championship stats if needed
     if (player_championship_stats.find(player_name) == player_championship_stats.end()) {
         player_championship_stats[player_name] = std::unordered_map<std::string, double>();
+        refreshLeaderboards(player_name);
     }
     
-    saveChampionshipData();
+    savePlayerChampionshipData(player_name);
     return true;
 }
 
@@ -88,7 +205,7 @@ bool ChampionshipSystem::resumeChampionshipRun(const std::string& player_name) {
     }
     
     run.is_active = true;
-    saveChampionshipData();
+    savePlayerChampionshipData(player_name);
     return true;
 }
 
@@ -122,7 +239,7 @@ bool ChampionshipSystem::endChampionshipRun(const std::string& player_name, bool
     // Update player stats
     updatePlayerChampionshipStats(player_name);
     
-    saveChampionshipData();
+    savePlayerChampionshipData(player_name);
     return true;
 }
 
@@ -153,7 +270,7 @@ ChampionshipSystem::getNextOpponent(const std::string& player_name) const {
 
 ChampionshipSystem::ChampionshipBattleResult 
 ChampionshipSystem::executeBattle(const std::string& player_name, 
-                                 const TeamBuilder::Team& /* player_team */) {
+                                 const TeamBuilder::Team& player_team) {
     ChampionshipBattleResult result;
     result.player_name = player_name;
     
@@ -174,53 +291,87 @@ ChampionshipSystem::executeBattle(const std::string& player_name,
         return result;  // Failed to create opponent team
     }
     
-    // AI difficulty will be handled by Battle constructor
-    
-    // Convert TeamBuilder::Team to Team for battle
-    // This is a simplified conversion - in practice, you'd need proper integration
-    auto battle_team = std::make_shared<Team>();
-    // TODO: Implement proper team conversion from TeamBuilder::Team to battle Team
-    
-    auto battle_opponent_team = std::make_shared<Team>();
-    // TODO: Implement proper team conversion for opponent
-    
-    // Execute the battle - simplified for now since Battle uses different interface
-    // TODO: Integrate properly with Battle system once interface is unified
-    // Battle battle(*battle_team, *battle_opponent_team, Battle::AIDifficulty::HARD);
+    const Team battle_team = TeamMatchupSimulator::buildBattleTeam(player_team);
+    const Team battle_opponent_team = TeamMatchupSimulator::buildBattleTeam(*opponent_team);
+    if (battle_team.isEmpty() || battle_opponent_team.isEmpty()) {
+        return result;  // No usable Pokemon on one side
+    }
     
-    // TODO: Execute battle and capture results
-    // For now, we'll simulate results
+    BattleSimulator::Options options = createBattleOptions(result.difficulty_level);
+    options.seed = randomBattleSeed();
+    options.record_knockouts = true;
+    const auto battle = BattleSimulator::simulate(battle_team, battle_opponent_team, options);
     
-    // Simulate battle results
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> victory_dist(0, 1);
-    std::uniform_int_distribution<> turns_dist(15, 35);
-    std::uniform_real_distribution<> score_dist(60.0, 95.0);
-    
-    result.victory = victory_dist(gen) == 1;
-    result.turns_taken = turns_dist(gen);
-    result.performance_score = score_dist(gen);
+    result.battle_seed = options.seed;
+    result.victory = battle.outcome == BattleSimulator::Outcome::TEAM_A_WINS;
+    result.turns_taken = battle.turns;
+    result.performance_score = result.victory ? 60.0 + 35.0 * battle.team_a_hp_fraction
+                                              : 50.0 * (1.0 - battle.team_b_hp_fraction);
     result.battle_duration = formatBattleDuration(static_cast<double>(result.turns_taken) * 0.5);
     
-    // Simulate team status
-    if (!result.victory) {
-        result.team_needs_healing = true;
-        result.fainted_pokemon = {"pokemon1", "pokemon2"};  // Simulate fainted
-    } else {
-        result.team_needs_healing = result.turns_taken > 25;
-        if (result.team_needs_healing) {
-            result.low_health_pokemon = {"pokemon3"};  // Simulate low health
+    // Team status from each slot's knockouts, faints and remaining HP
+    int mvp_slot = -1;
+    const int slots = std::min(static_cast<int>(battle_team.size()), static_cast<int>(battle.team_a_knockouts.size()));
+    for (int slot = 0; slot < slots; ++slot) {
+        const std::string name = slotName(battle_team, slot);
+        if (battle.team_a_fainted[slot]) {
+            result.fainted_pokemon.push_back(name);
+        } else if (battle.team_a_slot_hp[slot] < 0.25) {
+            result.low_health_pokemon.push_back(name);
         }
+        if (battle.team_a_knockouts[slot] > 0 &&
+            (mvp_slot < 0 || battle.team_a_knockouts[slot] > battle.team_a_knockouts[mvp_slot])) {
+            mvp_slot = slot;
+        }
+    }
+    result.mvp_pokemon = mvp_slot >= 0 ? slotName(battle_team, mvp_slot) : "";
+    result.team_needs_healing = !result.fainted_pokemon.empty() || !result.low_health_pokemon.empty();
+    for (const auto& knockout : battle.knockout_log) {
+        result.key_moments.push_back(describeKnockout(knockout, battle_team, battle_opponent_team));
     }
     
     // Add strategic notes
     result.strategic_notes.push_back("Opponent used " + opponent.specialization + " type advantage");
-    result.key_moments.push_back("Critical hit at turn " + std::to_string(result.turns_taken / 2));
     
     return result;
 }
 
+std::vector<ChampionshipSystem::LadderEstimate>
+ChampionshipSystem::estimateLadder(const TeamBuilder::Team& player_team, int best_of, uint64_t seed) const {
+    std::vector<LadderEstimate> estimates;
+    const Team battle_team = TeamMatchupSimulator::buildBattleTeam(player_team);
+    if (battle_team.isEmpty()) {
+        return estimates;
+    }
+    
+    std::vector<const ChampionshipOpponent*> ladder;
+    for (const auto& member : elite_four_roster) {
+        ladder.push_back(&member);
+    }
+    ladder.push_back(&champion_opponent);
+    
+    for (const auto* opponent : ladder) {
+        const auto opponent_team = createOpponentTeam(*opponent);
+        const Team battle_opponent_team = TeamMatchupSimulator::buildBattleTeam(*opponent_team);
+        if (battle_opponent_team.isEmpty()) {
+            continue;
+        }
+        
+        LadderEstimate estimate;
+        estimate.opponent_name = opponent->name;
+        estimate.opponent_position = opponent->position_in_sequence;
+        estimate.difficulty_level = calculateBattleDifficulty(opponent->position_in_sequence);
+        
+        // Series seeds sit far apart so their per-game seeds never overlap
+        BattleSimulator::Options options = createBattleOptions(estimate.difficulty_level);
+        options.seed = seed ^ (static_cast<uint64_t>(opponent->position_in_sequence) << 32);
+        estimate.series = BattleSimulator::simulateSeries(battle_team, battle_opponent_team, best_of, options);
+        estimates.push_back(estimate);
+    }
+    
+    return estimates;
+}
+
 bool ChampionshipSystem::recordBattleResult(const std::string& player_name,
                                           const ChampionshipBattleResult& battle_result) {
     auto run_it = active_runs.find(player_name);
@@ -257,7 +408,7 @@ bool ChampionshipSystem::recordBattleResult(const std::string& player_name,
         }
     }
     
-    saveChampionshipData();
+    savePlayerChampionshipData(player_name);
     return true;
 }
 
@@ -291,7 +442,7 @@ bool ChampionshipSystem::healPlayerTeam(const std::string& player_name, TeamBuil
     // TODO: Implement actual team healing
     // For now, we'll just mark it as healed
     
-    saveChampionshipData();
+    savePlayerChampionshipData(player_name);
     return true;
 }
 
@@ -395,115 +546,133 @@ ChampionshipSystem::getChampionshipHistory(const std::string& player_name) const
 
 std::vector<std::pair<std::string, double>> 
 ChampionshipSystem::getChampionshipLeaderboard(const std::string& sort_by, int max_results) const {
-    std::vector<std::pair<std::string, double>> leaderboard;
+    return findLeaderboard(sort_by).top(max_results);
+}
+
+int ChampionshipSystem::getPlayerChampionshipRank(const std::string& player_name,
+                                                  const std::string& sort_by) const {
+    return static_cast<int>(findLeaderboard(sort_by).rank(player_name));
+}
+
+void ChampionshipSystem::setSettings(const ChampionshipSettings& settings) {
+    const bool score_weights_changed =
+        settings.time_bonus_multiplier != championship_settings.time_bonus_multiplier;
+    championship_settings = settings;
+    
+    // Every championship score depends on the time bonus multiplier
+    if (score_weights_changed) {
+        for (const auto& [player_name, _] : player_championship_stats) {
+            score_leaderboard.update(player_name, calculateChampionshipScore(player_name));
+        }
+    }
+}
+
+bool ChampionshipSystem::saveChampionshipData() const {
+    if (!journal || !journal->isOpen()) {
+        return false;
+    }
     
-    for (const auto& [player_name, stats] : player_championship_stats) {
-        double score = 0.0;
+    try {
+        std::unordered_set<std::string> players;
+        for (const auto& [player_name, _] : active_runs) players.insert(player_name);
+        for (const auto& [player_name, _] : championship_history) players.insert(player_name);
+        for (const auto& [player_name, _] : player_championship_stats) players.insert(player_name);
         
-        if (sort_by == "time") {
-            const auto it = stats.find("best_completion_time");
-            if (it != stats.end()) {
-                score = it->second;
-            }
-        } else if (sort_by == "attempts") {
-            const auto it = stats.find("total_attempts");
-            if (it != stats.end()) {
-                score = it->second;
-            }
-        } else { // "score"
-            score = calculateChampionshipScore(player_name);
+        for (const auto& player_name : players) {
+            journalPlayerChampionshipData(player_name);
         }
+        return journal->commit();
         
-        leaderboard.emplace_back(player_name, score);
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+bool ChampionshipSystem::savePlayerChampionshipData(const std::string& player_name) const {
+    if (!journal || !journal->isOpen()) {
+        return false;
     }
     
-    // Sort appropriately
-    if (sort_by == "time" || sort_by == "attempts") {
-        std::sort(leaderboard.begin(), leaderboard.end(),
-                 [](const auto& a, const auto& b) { return a.second < b.second; });
-    } else {
-        std::sort(leaderboard.begin(), leaderboard.end(),
-                 [](const auto& a, const auto& b) { return a.second > b.second; });
+    try {
+        journalPlayerChampionshipData(player_name);
+        return journal->commit();
+        
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+void ChampionshipSystem::journalPlayerChampionshipData(const std::string& player_name) const {
+    const auto run_it = active_runs.find(player_name);
+    if (run_it != active_runs.end()) {
+        journal->put(ProgressJournal::makeKey(player_name, "championship_run"), runToJson(run_it->second).dump());
     }
     
-    if (max_results > 0 && static_cast<int>(leaderboard.size()) > max_results) {
-        leaderboard.resize(max_results);
+    const auto stats_it = player_championship_stats.find(player_name);
+    if (stats_it != player_championship_stats.end()) {
+        journal->put(ProgressJournal::makeKey(player_name, "championship_stats"), json(stats_it->second).dump());
     }
     
-    return leaderboard;
+    // Battle history is append-only: journal only results not yet written
+    const auto history_it = championship_history.find(player_name);
+    if (history_it != championship_history.end()) {
+        const auto& history = history_it->second;
+        const std::string history_key = ProgressJournal::makeKey(player_name, "championship_history");
+        size_t& journaled = journaled_history_count[player_name];
+        if (journaled > history.size()) {
+            journal->erasePrefix(history_key);
+            journaled = 0;
+        }
+        for (; journaled < history.size(); ++journaled) {
+            journal->appendItem(history_key, championshipResultToJson(history[journaled]).dump());
+        }
+    }
 }
 
-bool ChampionshipSystem::saveChampionshipData() const {
+bool ChampionshipSystem::loadChampionshipData() {
     try {
-        if (!ensureChampionshipDataDirectoryExists()) {
-            return false;
+        if (!journal) {
+            journal = std::make_unique<ProgressJournal>(getChampionshipDataDirectory(), "championship_data");
         }
-        
-        json championship_data;
-        
-        // Save active runs
-        json runs_json;
-        for (const auto& [player_name, run] : active_runs) {
-            json run_json;
-            run_json["player_name"] = run.player_name;
-            run_json["player_team_name"] = run.player_team_name;
-            run_json["start_date"] = run.start_date;
-            run_json["defeated_opponents"] = run.defeated_opponents;
-            run_json["current_opponent"] = run.current_opponent;
-            run_json["current_position"] = run.current_position;
-            run_json["is_active"] = run.is_active;
-            run_json["is_completed"] = run.is_completed;
-            run_json["victory"] = run.victory;
-            run_json["battle_turns"] = run.battle_turns;
-            run_json["battle_scores"] = run.battle_scores;
-            run_json["total_time_minutes"] = run.total_time_minutes;
-            run_json["total_healing_events"] = run.total_healing_events;
-            run_json["allow_healing_between_battles"] = run.allow_healing_between_battles;
-            run_json["sequential_requirement"] = run.sequential_requirement;
-            run_json["difficulty_progression"] = run.difficulty_progression;
-            
-            runs_json[player_name] = run_json;
+        if (!journal->open()) {
+            return false;
         }
-        championship_data["active_runs"] = runs_json;
         
-        // Save championship history
-        json history_json;
-        for (const auto& [player_name, history] : championship_history) {
-            json player_history = json::array();
-            for (const auto& result : history) {
-                json result_json;
-                result_json["player_name"] = result.player_name;
-                result_json["opponent_name"] = result.opponent_name;
-                result_json["opponent_type"] = result.opponent_type;
-                result_json["opponent_position"] = result.opponent_position;
-                result_json["victory"] = result.victory;
-                result_json["turns_taken"] = result.turns_taken;
-                result_json["difficulty_level"] = result.difficulty_level;
-                result_json["performance_score"] = result.performance_score;
-                result_json["battle_duration"] = result.battle_duration;
-                result_json["fainted_pokemon"] = result.fainted_pokemon;
-                result_json["low_health_pokemon"] = result.low_health_pokemon;
-                result_json["team_needs_healing"] = result.team_needs_healing;
-                result_json["key_moments"] = result.key_moments;
-                result_json["strategic_notes"] = result.strategic_notes;
-                result_json["mvp_pokemon"] = result.mvp_pokemon;
-                player_history.push_back(result_json);
+        // First run after upgrading: migrate the old JSON file into the journal
+        if (journal->isEmpty() && fs::exists(getChampionshipDataFilePath())) {
+            if (!importLegacyChampionshipData()) {
+                return false;
             }
-            history_json[player_name] = player_history;
+            saveChampionshipData();
+            journal->checkpoint();
+            rebuildLeaderboards();
+            return true;
         }
-        championship_data["championship_history"] = history_json;
         
-        // Save player stats
-        championship_data["player_championship_stats"] = player_championship_stats;
+        active_runs.clear();
+        championship_history.clear();
+        player_championship_stats.clear();
+        journaled_history_count.clear();
         
-        // Write to file
-        const std::string file_path = getChampionshipDataFilePath();
-        std::ofstream file(file_path);
-        if (!file.is_open()) {
-            return false;
-        }
+        journal->forEachWithPrefix("", [this](const std::string& key, const ProgressJournal::Entry& entry) {
+            const auto [player_name, field] = ProgressJournal::splitKey(key);
+            if (field == "championship_run") {
+                active_runs[player_name] = runFromJson(json::parse(entry.value));
+            } else if (field == "championship_stats") {
+                player_championship_stats[player_name] =
+                    json::parse(entry.value).get<std::unordered_map<std::string, double>>();
+            } else if (field == "championship_history") {
+                std::vector<ChampionshipBattleResult> history;
+                history.reserve(entry.items.size());
+                for (const auto& item : entry.items) {
+                    history.push_back(championshipResultFromJson(json::parse(item)));
+                }
+                championship_history[player_name] = std::move(history);
+                journaled_history_count[player_name] = entry.items.size();
+            }
+        });
         
-        file << championship_data.dump(2);
+        rebuildLeaderboards();
         return true;
         
     } catch (const std::exception&) {
@@ -511,15 +680,9 @@ bool ChampionshipSystem::saveChampionshipData() const {
     }
 }
 
-bool ChampionshipSystem::loadChampionshipData() {
+bool ChampionshipSystem::importLegacyChampionshipData() {
     try {
-        const std::string file_path = getChampionshipDataFilePath();
-        
-        if (!fs::exists(file_path)) {
-            return true;  // No data to load yet
-        }
-        
-        std::ifstream file(file_path);
+        std::ifstream file(getChampionshipDataFilePath());
         if (!file.is_open()) {
             return false;
         }
@@ -530,25 +693,7 @@ bool ChampionshipSystem::loadChampionshipData() {
         // Load active runs
         if (championship_data.contains("active_runs")) {
             for (const auto& [player_name, run_json] : championship_data["active_runs"].items()) {
-                ChampionshipRun run;
-                run.player_name = run_json.value("player_name", "");
-                run.player_team_name = run_json.value("player_team_name", "");
-                run.start_date = run_json.value("start_date", "");
-                run.defeated_opponents = run_json.value("defeated_opponents", std::vector<std::string>());
-                run.current_opponent = run_json.value("current_opponent", "");
-                run.current_position = run_json.value("current_position", 1);
-                run.is_active = run_json.value("is_active", false);
-                run.is_completed = run_json.value("is_completed", false);
-                run.victory = run_json.value("victory", false);
-                run.battle_turns = run_json.value("battle_turns", std::vector<int>());
-                run.battle_scores = run_json.value("battle_scores", std::vector<double>());
-                run.total_time_minutes = run_json.value("total_time_minutes", 0.0);
-                run.total_healing_events = run_json.value("total_healing_events", 0);
-                run.allow_healing_between_battles = run_json.value("allow_healing_between_battles", true);
-                run.sequential_requirement = run_json.value("sequential_requirement", true);
-                run.difficulty_progression = run_json.value("difficulty_progression", "progressive");
-                
-                active_runs[player_name] = run;
+                active_runs[player_name] = runFromJson(run_json);
             }
         }
         
@@ -557,23 +702,7 @@ bool ChampionshipSystem::loadChampionshipData() {
             for (const auto& [player_name, history_json] : championship_data["championship_history"].items()) {
                 std::vector<ChampionshipBattleResult> history;
                 for (const auto& result_json : history_json) {
-                    ChampionshipBattleResult result;
-                    result.player_name = result_json.value("player_name", "");
-                    result.opponent_name = result_json.value("opponent_name", "");
-                    result.opponent_type = result_json.value("opponent_type", "");
-                    result.opponent_position = result_json.value("opponent_position", 0);
-                    result.victory = result_json.value("victory", false);
-                    result.turns_taken = result_json.value("turns_taken", 0);
-                    result.difficulty_level = result_json.value("difficulty_level", "");
-                    result.performance_score = result_json.value("performance_score", 0.0);
-                    result.battle_duration = result_json.value("battle_duration", "");
-                    result.fainted_pokemon = result_json.value("fainted_pokemon", std::vector<std::string>());
-                    result.low_health_pokemon = result_json.value("low_health_pokemon", std::vector<std::string>());
-                    result.team_needs_healing = result_json.value("team_needs_healing", false);
-                    result.key_moments = result_json.value("key_moments", std::vector<std::string>());
-                    result.strategic_notes = result_json.value("strategic_notes", std::vector<std::string>());
-                    result.mvp_pokemon = result_json.value("mvp_pokemon", "");
-                    history.push_back(result);
+                    history.push_back(championshipResultFromJson(result_json));
                 }
                 championship_history[player_name] = history;
             }
@@ -597,12 +726,17 @@ bool ChampionshipSystem::resetPlayerChampionshipProgress(const std::string& play
         return false;
     }
     
-    // Remove from all data structures
+    // Remove from all data structures and the journal
     active_runs.erase(player_name);
     championship_history.erase(player_name);
     player_championship_stats.erase(player_name);
+    journaled_history_count.erase(player_name);
+    refreshLeaderboards(player_name);
+    if (journal && journal->isOpen()) {
+        journal->erasePrefix(ProgressJournal::ownerPrefix(player_name));
+    }
     
-    saveChampionshipData();
+    savePlayerChampionshipData(player_name);
     return true;
 }
 
@@ -624,7 +758,7 @@ ChampionshipSystem::getChampionshipSystemStatus() const {
     status["active_runs"] = std::to_string(active_runs.size());
     status["total_players_with_history"] = std::to_string(championship_history.size());
     status["data_valid"] = validateChampionshipData() ? "true" : "false";
-    status["data_file_exists"] = fs::exists(getChampionshipDataFilePath()) ? "true" : "false";
+    status["data_file_exists"] = (journal && journal->isOpen() && !journal->isEmpty()) ? "true" : "false";
     
     // Count champions
     int champion_count = 0;
@@ -710,7 +844,7 @@ void ChampionshipSystem::loadChampionshipConfiguration() {
 }
 
 std::unique_ptr<TeamBuilder::Team> 
-ChampionshipSystem::createOpponentTeam(const ChampionshipOpponent& opponent) {
+ChampionshipSystem::createOpponentTeam(const ChampionshipOpponent& opponent) const {
     auto team = std::make_unique<TeamBuilder::Team>();
     
     // Generate team based on opponent's template
@@ -730,6 +864,13 @@ ChampionshipSystem::createOpponentTeam(const ChampionshipOpponent& opponent) {
     return team;
 }
 
+BattleSimulator::Options ChampionshipSystem::createBattleOptions(const std::string& difficulty_level) const {
+    BattleSimulator::Options options;
+    options.team_a_ai = TeamMatchupSimulator::parseDifficulty(championship_settings.player_ai_difficulty)
+                            .value_or(AIDifficulty::HARD);
+    options.team_b_ai = TeamMatchupSimulator::parseDifficulty(difficulty_level).value_or(AIDifficulty::HARD);
+    return options;
+}
 
 std::string ChampionshipSystem::calculateBattleDifficulty(int position) const {
     if (!championship_settings.progressive_difficulty) {
@@ -855,12 +996,53 @@ void ChampionshipSystem::updatePlayerChampionshipStats(const std::string& player
         }
         stats["average_performance_score"] = total_score / static_cast<double>(history_it->second.size());
     }
+    
+    refreshLeaderboards(player_name);
+}
+
+void ChampionshipSystem::refreshLeaderboards(const std::string& player_name) {
+    const auto stats_it = player_championship_stats.find(player_name);
+    if (stats_it == player_championship_stats.end()) {
+        time_leaderboard.remove(player_name);
+        attempts_leaderboard.remove(player_name);
+        score_leaderboard.remove(player_name);
+        return;
+    }
+    
+    const auto& stats = stats_it->second;
+    const auto time_it = stats.find("best_completion_time");
+    const auto attempts_it = stats.find("total_attempts");
+    time_leaderboard.update(player_name, time_it != stats.end() ? time_it->second : 0.0);
+    attempts_leaderboard.update(player_name, attempts_it != stats.end() ? attempts_it->second : 0.0);
+    score_leaderboard.update(player_name, calculateChampionshipScore(player_name));
+}
+
+void ChampionshipSystem::rebuildLeaderboards() {
+    time_leaderboard.clear();
+    attempts_leaderboard.clear();
+    score_leaderboard.clear();
+    for (const auto& [player_name, _] : player_championship_stats) {
+        refreshLeaderboards(player_name);
+    }
+}
+
+const LeaderboardIndex& ChampionshipSystem::findLeaderboard(const std::string& sort_by) const {
+    if (sort_by == "time") {
+        return time_leaderboard;
+    } else if (sort_by == "attempts") {
+        return attempts_leaderboard;
+    }
+    return score_leaderboard;  // "score"
 }
 
 std::string ChampionshipSystem::getChampionshipDataFilePath() const {
     return "data/tournaments/championship_data.json";
 }
 
+std::string ChampionshipSystem::getChampionshipDataDirectory() const {
+    return "data/tournaments";
+}
+
 bool ChampionshipSystem::ensureChampionshipDataDirectoryExists() const {
     try {
         const std::string dir_path = "data/tournaments";
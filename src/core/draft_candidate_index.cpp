@@ -0,0 +1,126 @@
+#include "draft_candidate_index.h"
+#include <algorithm>
+#include <numeric>
+
+void DraftCandidateIndex::build(std::vector<Candidate> pool, int player_count) {
+    candidates = std::move(pool);
+    ids.clear();
+    for (size_t id = 0; id < candidates.size(); ++id) {
+        ids.emplace(candidates[id].name, static_cast<int>(id));
+    }
+
+    available.assign((candidates.size() + 63) / 64, 0);
+    for (size_t id = 0; id < candidates.size(); ++id) {
+        available[id >> 6] |= uint64_t(1) << (id & 63);
+    }
+    available_count = candidates.size();
+
+    by_strength.resize(candidates.size());
+    std::iota(by_strength.begin(), by_strength.end(), 0);
+    std::stable_sort(by_strength.begin(), by_strength.end(), [this](int a, int b) {
+        return candidates[a].strength > candidates[b].strength;
+    });
+
+    players.assign(std::max(0, player_count), PlayerState());
+    built = true;
+}
+
+int DraftCandidateIndex::find(const std::string& name) const {
+    auto it = ids.find(name);
+    return it != ids.end() ? it->second : -1;
+}
+
+bool DraftCandidateIndex::remove(int id) {
+    if (id < 0 || id >= static_cast<int>(candidates.size()) || !isAvailable(id)) {
+        return false;
+    }
+    available[id >> 6] &= ~(uint64_t(1) << (id & 63));
+    --available_count;
+    return true;
+}
+
+void DraftCandidateIndex::addToTeam(int player, int id) {
+    if (player < 0 || player >= static_cast<int>(players.size()) ||
+        id < 0 || id >= static_cast<int>(candidates.size())) {
+        return;
+    }
+    PlayerState& state = players[player];
+    const Candidate& candidate = candidates[id];
+    for (TypeMask types = candidate.types; types; types &= types - 1) {
+        ++state.type_counts[__builtin_ctz(types)];
+    }
+    state.types |= candidate.types;
+    state.legendaries += candidate.legendary ? 1 : 0;
+}
+
+bool DraftCandidateIndex::canPick(int player, int id, const Limits& limits) const {
+    if (player < 0 || player >= static_cast<int>(players.size()) ||
+        id < 0 || id >= static_cast<int>(candidates.size())) {
+        return false;
+    }
+    const PlayerState& state = players[player];
+    const Candidate& candidate = candidates[id];
+    if (candidate.legendary && state.legendaries >= limits.max_legendaries) {
+        return false;
+    }
+    for (TypeMask types = candidate.types; types; types &= types - 1) {
+        if (state.type_counts[__builtin_ctz(types)] >= limits.max_same_type) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<int> DraftCandidateIndex::getAvailable() const {
+    std::vector<int> result;
+    result.reserve(available_count);
+    for (size_t word = 0; word < available.size(); ++word) {
+        for (uint64_t bits = available[word]; bits; bits &= bits - 1) {
+            result.push_back(static_cast<int>(word * 64 + __builtin_ctzll(bits)));
+        }
+    }
+    return result;
+}
+
+std::vector<std::pair<int, double>> DraftCandidateIndex::suggest(int player, size_t count, const Limits& limits,
+                                                                 double coverage_weight, const BonusFunction& bonus,
+                                                                 double max_bonus) const {
+    std::vector<std::pair<int, double>> best;
+    if (count == 0 || player < 0 || player >= static_cast<int>(players.size())) {
+        return best;
+    }
+
+    const TypeMask team_types = players[player].types;
+    const double max_extra = 2.0 * std::max(0.0, coverage_weight) + (bonus ? std::max(0.0, max_bonus) : 0.0);
+    auto better = [](const std::pair<int, double>& a, const std::pair<int, double>& b) {
+        return a.second > b.second;
+    };
+
+    // Min-heap of the best `count` so far, keyed on score
+    for (int id : by_strength) {
+        if (best.size() == count && candidates[id].strength + max_extra <= best.front().second) {
+            break;  // Nothing further down the strength order can enter the top results
+        }
+        if (!isAvailable(id) || !canPick(player, id, limits)) {
+            continue;
+        }
+
+        const Candidate& candidate = candidates[id];
+        double score = candidate.strength + coverage_weight * TypeMasks::count(candidate.types & ~team_types);
+        if (bonus) {
+            score += bonus(id);
+        }
+
+        if (best.size() < count) {
+            best.emplace_back(id, score);
+            std::push_heap(best.begin(), best.end(), better);
+        } else if (score > best.front().second) {
+            std::pop_heap(best.begin(), best.end(), better);
+            best.back() = {id, score};
+            std::push_heap(best.begin(), best.end(), better);
+        }
+    }
+
+    std::sort_heap(best.begin(), best.end(), better);
+    return best;
+}
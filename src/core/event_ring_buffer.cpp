@@ -0,0 +1,272 @@
+#include "event_ring_buffer.h"
+#include "pokemon.h"
+#include "weather.h"
+#include <thread>
+
+namespace BattleEvents {
+
+namespace {
+
+EventRecord blankRecord(EventType type) {
+    EventRecord record{};
+    record.type = type;
+    record.source = EventSource::UNKNOWN;
+    record.effectiveness = 1.0f;
+    return record;
+}
+
+template<typename Enum>
+uint8_t code(Enum value) {
+    return static_cast<uint8_t>(value);
+}
+
+} // namespace
+
+EventRecord makeRecord(const HealthChangeEvent& event) {
+    EventRecord record = blankRecord(EventType::HEALTH_CHANGED);
+    record.pokemon = event.pokemon;
+    record.old_value = event.oldHealth;
+    record.new_value = event.newHealth;
+    record.delta = event.damage;
+    record.source = event.source;
+    record.source_pokemon = event.sourcePokemon;
+    record.move = event.sourceMove;
+    record.old_code = code(event.sourceWeather);
+    record.new_code = code(event.sourceStatus);
+    return record;
+}
+
+EventRecord makeRecord(const StatusChangeEvent& event) {
+    EventRecord record = blankRecord(EventType::STATUS_CHANGED);
+    record.pokemon = event.pokemon;
+    record.old_code = code(event.oldStatus);
+    record.new_code = code(event.newStatus);
+    record.new_value = event.turnsRemaining;
+    record.source = event.source;
+    return record;
+}
+
+EventRecord makeRecord(const MoveUsedEvent& event) {
+    EventRecord record = blankRecord(EventType::MOVE_USED);
+    record.pokemon = event.user;
+    record.other = event.target;
+    record.move = event.move;
+    record.flags = (event.wasSuccessful ? EventRecord::kFlagSuccessful : 0) |
+                   (event.wasCritical ? EventRecord::kFlagCritical : 0);
+    record.effectiveness = static_cast<float>(event.effectiveness);
+    return record;
+}
+
+EventRecord makeRecord(const WeatherChangeEvent& event) {
+    EventRecord record = blankRecord(EventType::WEATHER_CHANGED);
+    record.old_code = code(event.oldWeather);
+    record.new_code = code(event.newWeather);
+    record.new_value = event.turnsRemaining;
+    return record;
+}
+
+EventRecord makeRecord(const PokemonSwitchEvent& event) {
+    EventRecord record = blankRecord(EventType::POKEMON_SWITCH);
+    record.pokemon = event.oldPokemon;
+    record.other = event.newPokemon;
+    record.flags = event.isPlayerSwitch ? EventRecord::kFlagPlayer : 0;
+    return record;
+}
+
+EventRecord makeRecord(const BattleStartEvent& event) {
+    EventRecord record = blankRecord(EventType::BATTLE_START);
+    record.pokemon = event.playerStartPokemon;
+    record.other = event.aiStartPokemon;
+    return record;
+}
+
+EventRecord makeRecord(const BattleEndEvent& event) {
+    EventRecord record = blankRecord(EventType::BATTLE_END);
+    record.old_code = code(event.winner);
+    record.new_value = event.totalTurns;
+    return record;
+}
+
+EventRecord makeRecord(const MultiTurnMoveEvent& event) {
+    EventRecord record = blankRecord(EventType::MULTI_TURN_MOVE);
+    record.pokemon = event.pokemon;
+    record.move = event.move;
+    record.old_code = code(event.phase);
+    return record;
+}
+
+EventRecord makeRecord(const ActionChosenEvent& event) {
+    EventRecord record = blankRecord(EventType::ACTION_CHOSEN);
+    record.old_code = code(event.kind);
+    record.old_value = event.index;
+    record.new_value = event.turn;
+    record.flags = event.isPlayer ? EventRecord::kFlagPlayer : 0;
+    return record;
+}
+
+EventRecord makeTurnRecord(EventType type, int turnNumber) {
+    EventRecord record = blankRecord(type);
+    record.new_value = turnNumber;
+    return record;
+}
+
+void dispatchRecord(const EventRecord& record, BattleEventListener& listener) {
+    switch (record.type) {
+        case EventType::HEALTH_CHANGED:
+            listener.onHealthChanged(HealthChangeEvent{
+                record.pokemon, record.old_value, record.new_value, record.delta, record.source,
+                record.source_pokemon, record.move, static_cast<WeatherCondition>(record.old_code),
+                static_cast<StatusCondition>(record.new_code)});
+            break;
+        case EventType::STATUS_CHANGED:
+            listener.onStatusChanged(StatusChangeEvent{
+                record.pokemon, static_cast<StatusCondition>(record.old_code),
+                static_cast<StatusCondition>(record.new_code), record.new_value, record.source});
+            break;
+        case EventType::MOVE_USED:
+            listener.onMoveUsed(MoveUsedEvent{
+                record.pokemon, record.move, record.other, (record.flags & EventRecord::kFlagSuccessful) != 0,
+                (record.flags & EventRecord::kFlagCritical) != 0, record.effectiveness});
+            break;
+        case EventType::WEATHER_CHANGED:
+            listener.onWeatherChanged(WeatherChangeEvent{
+                static_cast<WeatherCondition>(record.old_code), static_cast<WeatherCondition>(record.new_code),
+                record.new_value});
+            break;
+        case EventType::POKEMON_SWITCH:
+            listener.onPokemonSwitch(PokemonSwitchEvent{
+                record.pokemon, record.other, (record.flags & EventRecord::kFlagPlayer) != 0});
+            break;
+        case EventType::BATTLE_START:
+            listener.onBattleStart(BattleStartEvent{record.pokemon, record.other});
+            break;
+        case EventType::BATTLE_END:
+            listener.onBattleEnd(BattleEndEvent{
+                static_cast<BattleEndEvent::Winner>(record.old_code), record.new_value});
+            break;
+        case EventType::TURN_START:
+            listener.onTurnStart(record.new_value);
+            break;
+        case EventType::TURN_END:
+            listener.onTurnEnd(record.new_value);
+            break;
+        case EventType::MULTI_TURN_MOVE:
+            listener.onMultiTurnMove(MultiTurnMoveEvent{
+                record.pokemon, record.move, static_cast<MultiTurnMoveEvent::Phase>(record.old_code), ""});
+            break;
+        case EventType::ACTION_CHOSEN:
+            listener.onActionChosen(ActionChosenEvent{
+                record.new_value, (record.flags & EventRecord::kFlagPlayer) != 0,
+                static_cast<ActionChosenEvent::Kind>(record.old_code), record.old_value});
+            break;
+    }
+}
+
+// EventRingBuffer implementation (bounded MPMC queue with per-cell sequence numbers)
+
+EventRingBuffer::EventRingBuffer(size_t capacity, Policy policy, uint32_t sample_rate)
+    : mask(0), policy(policy), sample_rate(sample_rate > 0 ? sample_rate : 1),
+      enqueue_pos(0), dequeue_pos(0), dropped(0), sample_counter(0), closed(false) {
+    size_t size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    mask = size - 1;
+    cells.reset(new Cell[size]);
+    for (size_t i = 0; i < size; ++i) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool EventRingBuffer::tryPush(const EventRecord& record) {
+    size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = cells[pos & mask];
+        const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell.record = record;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;  // Full
+        } else {
+            pos = enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool EventRingBuffer::pop(EventRecord& record) {
+    size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = cells[pos & mask];
+        const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+        if (diff == 0) {
+            if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                record = cell.record;
+                cell.sequence.store(pos + mask + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;  // Empty
+        } else {
+            pos = dequeue_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool EventRingBuffer::push(const EventRecord& record) {
+    if (isClosed()) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    switch (policy) {
+        case Policy::BLOCK:
+            while (!tryPush(record)) {
+                if (isClosed()) {
+                    dropped.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                std::this_thread::yield();
+            }
+            return true;
+
+        case Policy::DROP_OLDEST:
+            while (!tryPush(record)) {
+                EventRecord evicted;
+                if (pop(evicted)) {
+                    dropped.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            return true;
+
+        case Policy::SAMPLE:
+            if (size() * 2 >= getCapacity() &&
+                sample_counter.fetch_add(1, std::memory_order_relaxed) % sample_rate != 0) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            if (!tryPush(record)) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            return true;
+    }
+    return false;
+}
+
+void EventRingBuffer::close() {
+    closed.store(true, std::memory_order_release);
+}
+
+size_t EventRingBuffer::size() const {
+    const size_t head = dequeue_pos.load(std::memory_order_acquire);
+    const size_t tail = enqueue_pos.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+}
+
+} // namespace BattleEvents
@@ -1,6 +1,7 @@
 #include "gym_leader.h"
 #include "battle.h"
 #include "team.h"
+#include "team_matchup_simulator.h"
 #include "json.hpp"
 #include <fstream>
 #include <filesystem>
@@ -14,6 +15,121 @@
 using json = nlohmann::json;
 namespace fs = std::filesystem;
 
+namespace {
+
+// Per-record JSON encoding shared by the journal and the legacy gym data file
+
+json gymProgressToJson(const GymLeader::GymProgress& progress) {
+    json progress_json_entry;
+    progress_json_entry["player_name"] = progress.player_name;
+    progress_json_entry["gym_leader_name"] = progress.gym_leader_name;
+    progress_json_entry["total_attempts"] = progress.total_attempts;
+    progress_json_entry["victories"] = progress.victories;
+    progress_json_entry["defeats"] = progress.defeats;
+    progress_json_entry["badge_earned"] = progress.badge_earned;
+    progress_json_entry["attempt_scores"] = progress.attempt_scores;
+    progress_json_entry["best_score"] = progress.best_score;
+    progress_json_entry["average_score"] = progress.average_score;
+    progress_json_entry["best_turns"] = progress.best_turns;
+    progress_json_entry["last_attempt_date"] = progress.last_attempt_date;
+    progress_json_entry["losing_strategies"] = progress.losing_strategies;
+    progress_json_entry["winning_strategies"] = progress.winning_strategies;
+    progress_json_entry["pokemon_effectiveness"] = progress.pokemon_effectiveness;
+    return progress_json_entry;
+}
+
+GymLeader::GymProgress gymProgressFromJson(const json& progress_json) {
+    GymLeader::GymProgress progress;
+    progress.player_name = progress_json.value("player_name", "");
+    progress.gym_leader_name = progress_json.value("gym_leader_name", "");
+    progress.total_attempts = progress_json.value("total_attempts", 0);
+    progress.victories = progress_json.value("victories", 0);
+    progress.defeats = progress_json.value("defeats", 0);
+    progress.badge_earned = progress_json.value("badge_earned", false);
+    progress.attempt_scores = progress_json.value("attempt_scores", std::vector<double>());
+    progress.best_score = progress_json.value("best_score", 0.0);
+    progress.average_score = progress_json.value("average_score", 0.0);
+    progress.best_turns = progress_json.value("best_turns", 999);
+    progress.last_attempt_date = progress_json.value("last_attempt_date", "");
+    progress.losing_strategies = progress_json.value("losing_strategies", std::vector<std::string>());
+    progress.winning_strategies = progress_json.value("winning_strategies", std::vector<std::string>());
+    progress.pokemon_effectiveness = progress_json.value("pokemon_effectiveness", std::unordered_map<std::string, int>());
+    return progress;
+}
+
+json gymResultToJson(const GymLeader::GymBattleResult& result) {
+    json result_json;
+    result_json["player_name"] = result.player_name;
+    result_json["gym_leader_name"] = result.gym_leader_name;
+    result_json["player_team_name"] = result.player_team_name;
+    result_json["victory"] = result.victory;
+    result_json["turns_taken"] = result.turns_taken;
+    result_json["performance_score"] = result.performance_score;
+    result_json["difficulty_level"] = result.difficulty_level;
+    result_json["battle_date"] = result.battle_date;
+    result_json["battle_duration"] = result.battle_duration;
+    result_json["effective_pokemon"] = result.effective_pokemon;
+    result_json["ineffective_pokemon"] = result.ineffective_pokemon;
+    result_json["mvp_pokemon"] = result.mvp_pokemon;
+    result_json["type_matchup_effectiveness"] = result.type_matchup_effectiveness;
+    result_json["missed_opportunities"] = result.missed_opportunities;
+    result_json["good_decisions"] = result.good_decisions;
+    result_json["key_moments"] = result.key_moments;
+    result_json["fainted_pokemon"] = result.fainted_pokemon;
+    result_json["needs_healing"] = result.needs_healing;
+    result_json["battle_seed"] = result.battle_seed;
+    return result_json;
+}
+
+GymLeader::GymBattleResult gymResultFromJson(const json& result_json) {
+    GymLeader::GymBattleResult result;
+    result.player_name = result_json.value("player_name", "");
+    result.gym_leader_name = result_json.value("gym_leader_name", "");
+    result.player_team_name = result_json.value("player_team_name", "");
+    result.victory = result_json.value("victory", false);
+    result.turns_taken = result_json.value("turns_taken", 0);
+    result.performance_score = result_json.value("performance_score", 0.0);
+    result.difficulty_level = result_json.value("difficulty_level", "");
+    result.battle_date = result_json.value("battle_date", "");
+    result.battle_duration = result_json.value("battle_duration", "");
+    result.effective_pokemon = result_json.value("effective_pokemon", std::vector<std::string>());
+    result.ineffective_pokemon = result_json.value("ineffective_pokemon", std::vector<std::string>());
+    result.mvp_pokemon = result_json.value("mvp_pokemon", "");
+    result.type_matchup_effectiveness = result_json.value("type_matchup_effectiveness", std::unordered_map<std::string, double>());
+    result.missed_opportunities = result_json.value("missed_opportunities", std::vector<std::string>());
+    result.good_decisions = result_json.value("good_decisions", std::vector<std::string>());
+    result.key_moments = result_json.value("key_moments", std::vector<std::string>());
+    result.fainted_pokemon = result_json.value("fainted_pokemon", std::vector<std::string>());
+    result.needs_healing = result_json.value("needs_healing", false);
+    result.battle_seed = result_json.value("battle_seed", uint64_t(0));
+    return result;
+}
+
+std::string slotName(const Team& team, int slot) {
+    const Pokemon* pokemon = team.getPokemon(slot);
+    return pokemon ? pokemon->name : "";
+}
+
+// Team A is the player's team
+std::string describeKnockout(const BattleSimulator::Knockout& knockout, const Team& player_team, const Team& gym_team) {
+    const std::string fainted = knockout.team_a ? slotName(player_team, knockout.slot)
+                                                : "opposing " + slotName(gym_team, knockout.slot);
+    std::string moment = "Turn " + std::to_string(knockout.turn) + ": ";
+    if (knockout.attacker_slot < 0) {
+        return moment + fainted + " fainted";
+    }
+    const std::string attacker = knockout.team_a ? "opposing " + slotName(gym_team, knockout.attacker_slot)
+                                                 : slotName(player_team, knockout.attacker_slot);
+    return moment + attacker + " knocked out " + fainted;
+}
+
+uint64_t randomBattleSeed() {
+    std::random_device rd;
+    return (static_cast<uint64_t>(rd()) << 32) ^ rd();
+}
+
+} // namespace
+
 GymLeader::GymLeader(std::shared_ptr<PokemonData> data,
                      std::shared_ptr<TeamBuilder> team_builder,
                      std::shared_ptr<TournamentManager> tournament_manager)
@@ -102,54 +218,57 @@ GymLeader::challengeGymLeader(const std::string& player_name,
         return result;  // Failed to create team
     }
     
-    // AI difficulty will be handled by Battle constructor
-    
-    // Convert TeamBuilder::Team to Team for battle
-    // This is a simplified implementation - in practice would need proper conversion
-    auto battle_player_team = std::make_shared<Team>();
-    auto battle_gym_team = std::make_shared<Team>();
-    
-    // TODO: Implement proper team conversion
-    
-    // Execute the battle - simplified for now since Battle uses different interface
-    // TODO: Integrate properly with Battle system once interface is unified
-    // Battle battle(*battle_player_team, *battle_gym_team, Battle::AIDifficulty::MEDIUM);
-    
-    // TODO: Execute actual battle and capture results
-    // For now, we'll simulate the battle results
-    
-    // Simulate battle results
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    
-    // Calculate success probability based on type matchups
-    const double type_advantage = calculateTypeAdvantage(player_team, gym_leader->type_specialization);
-    const double base_win_rate = 0.6; // Base 60% win rate
-    const double adjusted_win_rate = std::min(0.95, std::max(0.05, base_win_rate + type_advantage * 0.3));
+    const Team battle_player_team = TeamMatchupSimulator::buildBattleTeam(player_team);
+    const Team battle_gym_team = TeamMatchupSimulator::buildBattleTeam(*gym_team);
+    if (battle_player_team.isEmpty() || battle_gym_team.isEmpty()) {
+        return result;  // No usable Pokemon on one side
+    }
     
-    std::uniform_real_distribution<> victory_dist(0.0, 1.0);
-    result.victory = victory_dist(gen) < adjusted_win_rate;
+    BattleSimulator::Options options = createBattleOptions(result.difficulty_level);
+    options.seed = randomBattleSeed();
+    options.record_knockouts = true;
+    const auto battle = BattleSimulator::simulate(battle_player_team, battle_gym_team, options);
     
-    // Generate battle details
-    std::uniform_int_distribution<> turns_dist(12, 30);
-    result.turns_taken = turns_dist(gen);
+    result.battle_seed = options.seed;
+    result.victory = battle.outcome == BattleSimulator::Outcome::TEAM_A_WINS;
+    result.turns_taken = battle.turns;
     result.battle_duration = formatBattleDuration(result.turns_taken);
     
+    // Team analysis from each slot's knockouts and faints
+    int mvp_slot = -1;
+    const int slots = std::min(static_cast<int>(battle_player_team.size()), static_cast<int>(battle.team_a_knockouts.size()));
+    for (int slot = 0; slot < slots; ++slot) {
+        const std::string name = slotName(battle_player_team, slot);
+        const int knockouts = battle.team_a_knockouts[slot];
+        if (knockouts > 0) {
+            result.effective_pokemon.push_back(name);
+            if (mvp_slot < 0 || knockouts > battle.team_a_knockouts[mvp_slot]) {
+                mvp_slot = slot;
+            }
+        }
+        if (battle.team_a_fainted[slot]) {
+            result.fainted_pokemon.push_back(name);
+            if (knockouts == 0) {
+                result.ineffective_pokemon.push_back(name);
+            }
+        }
+    }
+    result.mvp_pokemon = mvp_slot >= 0 ? slotName(battle_player_team, mvp_slot) : "";
+    result.needs_healing = !result.fainted_pokemon.empty() || battle.team_a_hp_fraction < 0.5;
+    for (const auto& knockout : battle.knockout_log) {
+        result.key_moments.push_back(describeKnockout(knockout, battle_player_team, battle_gym_team));
+    }
+    
     // Calculate performance score
     result.performance_score = calculateGymScore(result);
     
-    // Team analysis
+    const double type_advantage = calculateTypeAdvantage(player_team, gym_leader->type_specialization);
     if (result.victory) {
-        result.effective_pokemon = identifyTeamStrengths(player_team, gym_leader->type_specialization);
-        result.good_decisions.push_back("Effective use of type advantages");
-        result.mvp_pokemon = result.effective_pokemon.empty() ? 
-                           (player_team.pokemon.empty() ? "" : player_team.pokemon[0].name) :
-                           result.effective_pokemon[0];
+        if (type_advantage > 0.0) {
+            result.good_decisions.push_back("Effective use of type advantages");
+        }
     } else {
-        result.ineffective_pokemon = identifyTeamWeaknesses(player_team, gym_leader->type_specialization);
         result.missed_opportunities.push_back("Could have exploited " + gym_leader->type_specialization + " type weaknesses");
-        result.needs_healing = true;
-        result.fainted_pokemon = {"pokemon1", "pokemon2"};  // Simulate fainted Pokemon
     }
     
     // Type effectiveness analysis
@@ -162,6 +281,27 @@ GymLeader::challengeGymLeader(const std::string& player_name,
     return result;
 }
 
+BattleSimulator::SeriesResult GymLeader::estimateGymChallenge(const std::string& player_name,
+                                                          const std::string& gym_leader_name,
+                                                          const TeamBuilder::Team& player_team,
+                                                          int best_of, uint64_t seed) const {
+    const auto* gym_leader = findGymLeader(gym_leader_name);
+    if (!gym_leader) {
+        return BattleSimulator::SeriesResult();
+    }
+    
+    const auto gym_team = createGymLeaderTeam(*gym_leader);
+    const Team battle_player_team = TeamMatchupSimulator::buildBattleTeam(player_team);
+    const Team battle_gym_team = TeamMatchupSimulator::buildBattleTeam(*gym_team);
+    if (battle_player_team.isEmpty() || battle_gym_team.isEmpty()) {
+        return BattleSimulator::SeriesResult();
+    }
+    
+    BattleSimulator::Options options = createBattleOptions(calculateGymDifficulty(gym_leader_name, player_name));
+    options.seed = seed;
+    return BattleSimulator::simulateSeries(battle_player_team, battle_gym_team, best_of, options);
+}
+
 bool GymLeader::canChallengeGymLeader(const std::string& player_name, 
                                      const std::string& gym_leader_name) const {
     if (!isValidPlayerName(player_name) || !isValidGymLeaderName(gym_leader_name)) {
@@ -228,7 +368,7 @@ bool GymLeader::updateGymProgress(const GymBattleResult& battle_result) {
     }
     
     updateGymStatistics(battle_result.player_name, battle_result.gym_leader_name);
-    saveGymData();
+    savePlayerGymData(battle_result.player_name);
     
     return true;
 }
@@ -426,116 +566,141 @@ std::vector<std::pair<std::string, double>>
 GymLeader::getGymLeaderboard(const std::string& gym_leader_name,
                             const std::string& sort_by,
                             int max_results) const {
-    std::vector<std::pair<std::string, double>> leaderboard;
+    const auto it = gym_leaderboards.find(gym_leader_name);
+    if (it == gym_leaderboards.end()) {
+        return {};  // Nobody has challenged this gym
+    }
     
-    for (const auto& [player_name, gym_progress_map] : player_gym_progress) {
-        const auto it = gym_progress_map.find(gym_leader_name);
-        if (it == gym_progress_map.end()) {
-            continue;  // Player hasn't challenged this gym
+    if (sort_by == "attempts") {
+        return it->second.by_attempts.top(max_results);
+    } else if (sort_by == "time") {
+        return it->second.by_time.top(max_results);
+    }
+    return it->second.by_score.top(max_results);  // "score"
+}
+
+int GymLeader::getPlayerGymRank(const std::string& player_name,
+                                const std::string& gym_leader_name,
+                                const std::string& sort_by) const {
+    const auto it = gym_leaderboards.find(gym_leader_name);
+    if (it == gym_leaderboards.end()) {
+        return 0;
+    }
+    
+    if (sort_by == "attempts") {
+        return static_cast<int>(it->second.by_attempts.rank(player_name));
+    } else if (sort_by == "time") {
+        return static_cast<int>(it->second.by_time.rank(player_name));
+    }
+    return static_cast<int>(it->second.by_score.rank(player_name));
+}
+
+bool GymLeader::saveGymData() const {
+    if (!journal || !journal->isOpen()) {
+        return false;
+    }
+    
+    try {
+        for (const auto& [player_name, _] : player_gym_progress) {
+            journalPlayerGymData(player_name);
         }
-        
-        const auto& progress = it->second;
-        double score = 0.0;
-        
-        if (sort_by == "attempts") {
-            score = static_cast<double>(progress.total_attempts);
-        } else if (sort_by == "time") {
-            score = static_cast<double>(progress.best_turns);
-        } else { // "score"
-            score = progress.best_score;
+        for (const auto& [player_name, _] : player_gym_history) {
+            if (player_gym_progress.find(player_name) == player_gym_progress.end()) {
+                journalPlayerGymData(player_name);
+            }
         }
+        return journal->commit();
         
-        leaderboard.emplace_back(player_name, score);
+    } catch (const std::exception&) {
+        return false;
     }
-    
-    // Sort appropriately
-    if (sort_by == "attempts" || sort_by == "time") {
-        std::sort(leaderboard.begin(), leaderboard.end(),
-                 [](const auto& a, const auto& b) { return a.second < b.second; });
-    } else {
-        std::sort(leaderboard.begin(), leaderboard.end(),
-                 [](const auto& a, const auto& b) { return a.second > b.second; });
+}
+
+bool GymLeader::savePlayerGymData(const std::string& player_name) const {
+    if (!journal || !journal->isOpen()) {
+        return false;
     }
     
-    if (max_results > 0 && static_cast<int>(leaderboard.size()) > max_results) {
-        leaderboard.resize(max_results);
+    try {
+        journalPlayerGymData(player_name);
+        return journal->commit();
+        
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+void GymLeader::journalPlayerGymData(const std::string& player_name) const {
+    // A player's progress covers at most eight gyms, so it is rewritten as one record
+    const auto progress_it = player_gym_progress.find(player_name);
+    if (progress_it != player_gym_progress.end()) {
+        json player_progress = json::object();
+        for (const auto& [gym_name, progress] : progress_it->second) {
+            player_progress[gym_name] = gymProgressToJson(progress);
+        }
+        journal->put(ProgressJournal::makeKey(player_name, "gym_progress"), player_progress.dump());
     }
     
-    return leaderboard;
+    // Battle history is append-only: journal only results not yet written
+    const auto history_it = player_gym_history.find(player_name);
+    if (history_it != player_gym_history.end()) {
+        const auto& history = history_it->second;
+        const std::string history_key = ProgressJournal::makeKey(player_name, "gym_history");
+        size_t& journaled = journaled_history_count[player_name];
+        if (journaled > history.size()) {
+            journal->erasePrefix(history_key);
+            journaled = 0;
+        }
+        for (; journaled < history.size(); ++journaled) {
+            journal->appendItem(history_key, gymResultToJson(history[journaled]).dump());
+        }
+    }
 }
 
-bool GymLeader::saveGymData() const {
+bool GymLeader::loadGymData() {
     try {
-        if (!ensureGymDataDirectoryExists()) {
+        if (!journal) {
+            journal = std::make_unique<ProgressJournal>(getGymDataDirectory(), "gym_data");
+        }
+        if (!journal->open()) {
             return false;
         }
         
-        json gym_data;
-        
-        // Save player progress
-        json progress_json;
-        for (const auto& [player_name, gym_map] : player_gym_progress) {
-            json player_progress;
-            for (const auto& [gym_name, progress] : gym_map) {
-                json progress_json_entry;
-                progress_json_entry["player_name"] = progress.player_name;
-                progress_json_entry["gym_leader_name"] = progress.gym_leader_name;
-                progress_json_entry["total_attempts"] = progress.total_attempts;
-                progress_json_entry["victories"] = progress.victories;
-                progress_json_entry["defeats"] = progress.defeats;
-                progress_json_entry["badge_earned"] = progress.badge_earned;
-                progress_json_entry["attempt_scores"] = progress.attempt_scores;
-                progress_json_entry["best_score"] = progress.best_score;
-                progress_json_entry["average_score"] = progress.average_score;
-                progress_json_entry["best_turns"] = progress.best_turns;
-                progress_json_entry["last_attempt_date"] = progress.last_attempt_date;
-                progress_json_entry["losing_strategies"] = progress.losing_strategies;
-                progress_json_entry["winning_strategies"] = progress.winning_strategies;
-                progress_json_entry["pokemon_effectiveness"] = progress.pokemon_effectiveness;
-                
-                player_progress[gym_name] = progress_json_entry;
+        // First run after upgrading: migrate the old JSON file into the journal
+        if (journal->isEmpty() && fs::exists(getGymDataFilePath())) {
+            if (!importLegacyGymData()) {
+                return false;
             }
-            progress_json[player_name] = player_progress;
+            saveGymData();
+            journal->checkpoint();
+            rebuildGymLeaderboards();
+            return true;
         }
-        gym_data["player_gym_progress"] = progress_json;
         
-        // Save battle history
-        json history_json;
-        for (const auto& [player_name, history] : player_gym_history) {
-            json player_history = json::array();
-            for (const auto& result : history) {
-                json result_json;
-                result_json["player_name"] = result.player_name;
-                result_json["gym_leader_name"] = result.gym_leader_name;
-                result_json["player_team_name"] = result.player_team_name;
-                result_json["victory"] = result.victory;
-                result_json["turns_taken"] = result.turns_taken;
-                result_json["performance_score"] = result.performance_score;
-                result_json["difficulty_level"] = result.difficulty_level;
-                result_json["battle_date"] = result.battle_date;
-                result_json["battle_duration"] = result.battle_duration;
-                result_json["effective_pokemon"] = result.effective_pokemon;
-                result_json["ineffective_pokemon"] = result.ineffective_pokemon;
-                result_json["mvp_pokemon"] = result.mvp_pokemon;
-                result_json["type_matchup_effectiveness"] = result.type_matchup_effectiveness;
-                result_json["missed_opportunities"] = result.missed_opportunities;
-                result_json["good_decisions"] = result.good_decisions;
-                result_json["fainted_pokemon"] = result.fainted_pokemon;
-                result_json["needs_healing"] = result.needs_healing;
-                player_history.push_back(result_json);
-            }
-            history_json[player_name] = player_history;
-        }
-        gym_data["player_gym_history"] = history_json;
+        player_gym_progress.clear();
+        player_gym_history.clear();
+        journaled_history_count.clear();
         
-        // Write to file
-        const std::string file_path = getGymDataFilePath();
-        std::ofstream file(file_path);
-        if (!file.is_open()) {
-            return false;
-        }
+        journal->forEachWithPrefix("", [this](const std::string& key, const ProgressJournal::Entry& entry) {
+            const auto [player_name, field] = ProgressJournal::splitKey(key);
+            if (field == "gym_progress") {
+                std::unordered_map<std::string, GymProgress> gym_map;
+                for (const auto& [gym_name, progress_json] : json::parse(entry.value).items()) {
+                    gym_map[gym_name] = gymProgressFromJson(progress_json);
+                }
+                player_gym_progress[player_name] = gym_map;
+            } else if (field == "gym_history") {
+                std::vector<GymBattleResult> history;
+                history.reserve(entry.items.size());
+                for (const auto& item : entry.items) {
+                    history.push_back(gymResultFromJson(json::parse(item)));
+                }
+                player_gym_history[player_name] = std::move(history);
+                journaled_history_count[player_name] = entry.items.size();
+            }
+        });
         
-        file << gym_data.dump(2);
+        rebuildGymLeaderboards();
         return true;
         
     } catch (const std::exception&) {
@@ -543,15 +708,9 @@ bool GymLeader::saveGymData() const {
     }
 }
 
-bool GymLeader::loadGymData() {
+bool GymLeader::importLegacyGymData() {
     try {
-        const std::string file_path = getGymDataFilePath();
-        
-        if (!fs::exists(file_path)) {
-            return true;  // No data to load yet
-        }
-        
-        std::ifstream file(file_path);
+        std::ifstream file(getGymDataFilePath());
         if (!file.is_open()) {
             return false;
         }
@@ -564,23 +723,7 @@ bool GymLeader::loadGymData() {
             for (const auto& [player_name, player_progress_json] : gym_data["player_gym_progress"].items()) {
                 std::unordered_map<std::string, GymProgress> gym_map;
                 for (const auto& [gym_name, progress_json] : player_progress_json.items()) {
-                    GymProgress progress;
-                    progress.player_name = progress_json.value("player_name", "");
-                    progress.gym_leader_name = progress_json.value("gym_leader_name", "");
-                    progress.total_attempts = progress_json.value("total_attempts", 0);
-                    progress.victories = progress_json.value("victories", 0);
-                    progress.defeats = progress_json.value("defeats", 0);
-                    progress.badge_earned = progress_json.value("badge_earned", false);
-                    progress.attempt_scores = progress_json.value("attempt_scores", std::vector<double>());
-                    progress.best_score = progress_json.value("best_score", 0.0);
-                    progress.average_score = progress_json.value("average_score", 0.0);
-                    progress.best_turns = progress_json.value("best_turns", 999);
-                    progress.last_attempt_date = progress_json.value("last_attempt_date", "");
-                    progress.losing_strategies = progress_json.value("losing_strategies", std::vector<std::string>());
-                    progress.winning_strategies = progress_json.value("winning_strategies", std::vector<std::string>());
-                    progress.pokemon_effectiveness = progress_json.value("pokemon_effectiveness", std::unordered_map<std::string, int>());
-                    
-                    gym_map[gym_name] = progress;
+                    gym_map[gym_name] = gymProgressFromJson(progress_json);
                 }
                 player_gym_progress[player_name] = gym_map;
             }
@@ -591,25 +734,7 @@ bool GymLeader::loadGymData() {
             for (const auto& [player_name, history_json] : gym_data["player_gym_history"].items()) {
                 std::vector<GymBattleResult> history;
                 for (const auto& result_json : history_json) {
-                    GymBattleResult result;
-                    result.player_name = result_json.value("player_name", "");
-                    result.gym_leader_name = result_json.value("gym_leader_name", "");
-                    result.player_team_name = result_json.value("player_team_name", "");
-                    result.victory = result_json.value("victory", false);
-                    result.turns_taken = result_json.value("turns_taken", 0);
-                    result.performance_score = result_json.value("performance_score", 0.0);
-                    result.difficulty_level = result_json.value("difficulty_level", "");
-                    result.battle_date = result_json.value("battle_date", "");
-                    result.battle_duration = result_json.value("battle_duration", "");
-                    result.effective_pokemon = result_json.value("effective_pokemon", std::vector<std::string>());
-                    result.ineffective_pokemon = result_json.value("ineffective_pokemon", std::vector<std::string>());
-                    result.mvp_pokemon = result_json.value("mvp_pokemon", "");
-                    result.type_matchup_effectiveness = result_json.value("type_matchup_effectiveness", std::unordered_map<std::string, double>());
-                    result.missed_opportunities = result_json.value("missed_opportunities", std::vector<std::string>());
-                    result.good_decisions = result_json.value("good_decisions", std::vector<std::string>());
-                    result.fainted_pokemon = result_json.value("fainted_pokemon", std::vector<std::string>());
-                    result.needs_healing = result_json.value("needs_healing", false);
-                    history.push_back(result);
+                    history.push_back(gymResultFromJson(result_json));
                 }
                 player_gym_history[player_name] = history;
             }
@@ -633,6 +758,15 @@ bool GymLeader::resetPlayerGymProgress(const std::string& player_name,
         // Reset all gym progress for player
         player_gym_progress.erase(player_name);
         player_gym_history.erase(player_name);
+        journaled_history_count.erase(player_name);
+        if (journal && journal->isOpen()) {
+            journal->erasePrefix(ProgressJournal::ownerPrefix(player_name));
+        }
+        for (auto& [_, leaderboards] : gym_leaderboards) {
+            leaderboards.by_score.remove(player_name);
+            leaderboards.by_attempts.remove(player_name);
+            leaderboards.by_time.remove(player_name);
+        }
     } else {
         // Reset specific gym progress
         auto player_it = player_gym_progress.find(player_name);
@@ -651,9 +785,10 @@ bool GymLeader::resetPlayerGymProgress(const std::string& player_name,
                               }),
                 history.end());
         }
+        updateGymStatistics(player_name, gym_leader_name);
     }
     
-    saveGymData();
+    savePlayerGymData(player_name);
     return true;
 }
 
@@ -690,7 +825,7 @@ std::unordered_map<std::string, std::string> GymLeader::getGymSystemStatus() con
     status["players_with_progress"] = std::to_string(player_gym_progress.size());
     status["players_with_history"] = std::to_string(player_gym_history.size());
     status["data_valid"] = validateGymData() ? "true" : "false";
-    status["data_file_exists"] = fs::exists(getGymDataFilePath()) ? "true" : "false";
+    status["data_file_exists"] = (journal && journal->isOpen() && !journal->isEmpty()) ? "true" : "false";
     
     // Count total battles across all players
     int total_battles = 0;
@@ -883,7 +1018,7 @@ void GymLeader::loadGymConfiguration() {
     // Future versions could load from config files
 }
 
-std::unique_ptr<TeamBuilder::Team> GymLeader::createGymLeaderTeam(const GymLeaderInfo& gym_leader) {
+std::unique_ptr<TeamBuilder::Team> GymLeader::createGymLeaderTeam(const GymLeaderInfo& gym_leader) const {
     auto team = std::make_unique<TeamBuilder::Team>();
     
     // Generate team based on gym leader's template
@@ -909,6 +1044,12 @@ std::unique_ptr<TeamBuilder::Team> GymLeader::createGymLeaderTeam(const GymLeade
     return team;
 }
 
+BattleSimulator::Options GymLeader::createBattleOptions(const std::string& difficulty_level) const {
+    BattleSimulator::Options options;
+    options.team_a_ai = TeamMatchupSimulator::parseDifficulty(gym_settings.player_ai_difficulty).value_or(AIDifficulty::MEDIUM);
+    options.team_b_ai = TeamMatchupSimulator::parseDifficulty(difficulty_level).value_or(AIDifficulty::MEDIUM);
+    return options;
+}
 
 std::string GymLeader::calculateGymDifficulty(const std::string& gym_leader_name, 
                                              const std::string& player_name) const {
@@ -1110,16 +1251,44 @@ double GymLeader::calculateGymScore(const GymBattleResult& result) const {
     return std::min(150.0, std::max(0.0, base_score));
 }
 
-void GymLeader::updateGymStatistics(const std::string& /* player_name */, 
-                                   const std::string& /* gym_leader_name */) {
-    // Statistics are updated automatically through progress tracking
-    // Additional complex statistics could be calculated here
+void GymLeader::updateGymStatistics(const std::string& player_name, 
+                                   const std::string& gym_leader_name) {
+    // Per-player statistics are updated through progress tracking; only the
+    // leaderboard entries for this gym need to follow them
+    auto& leaderboards = gym_leaderboards[gym_leader_name];
+    
+    const auto player_it = player_gym_progress.find(player_name);
+    if (player_it == player_gym_progress.end() ||
+        player_it->second.find(gym_leader_name) == player_it->second.end()) {
+        leaderboards.by_score.remove(player_name);
+        leaderboards.by_attempts.remove(player_name);
+        leaderboards.by_time.remove(player_name);
+        return;
+    }
+    
+    const auto& progress = player_it->second.at(gym_leader_name);
+    leaderboards.by_score.update(player_name, progress.best_score);
+    leaderboards.by_attempts.update(player_name, static_cast<double>(progress.total_attempts));
+    leaderboards.by_time.update(player_name, static_cast<double>(progress.best_turns));
+}
+
+void GymLeader::rebuildGymLeaderboards() {
+    gym_leaderboards.clear();
+    for (const auto& [player_name, gym_progress_map] : player_gym_progress) {
+        for (const auto& [gym_name, _] : gym_progress_map) {
+            updateGymStatistics(player_name, gym_name);
+        }
+    }
 }
 
 std::string GymLeader::getGymDataFilePath() const {
     return "data/tournaments/gym_data.json";
 }
 
+std::string GymLeader::getGymDataDirectory() const {
+    return "data/tournaments";
+}
+
 bool GymLeader::ensureGymDataDirectoryExists() const {
     try {
         const std::string dir_path = "data/tournaments";
@@ -487,7 +487,6 @@ void Pokemon::startCharging(int moveIndex, const std::string& moveName) {
     const Move& move = moves[moveIndex];
     if (move.boostsDefenseOnCharge()) {
       modifyDefense(1);
-      std::cout << name << "'s Defense rose while charging " << moveName << "!" << std::endl;
     }
   }
 }
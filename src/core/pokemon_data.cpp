@@ -5,6 +5,8 @@
 #include <iostream>
 #include <sstream>
 
+#include "trace.h"
+
 using json = nlohmann::json;
 
 PokemonData::PokemonData() : is_initialized(false) {
@@ -18,6 +20,8 @@ PokemonData::PokemonData() : is_initialized(false) {
 
 PokemonData::LoadResult PokemonData::initialize(const std::string& pokemon_dir, 
                                                const std::string& moves_dir) {
+    TRACE_SCOPE("data", "PokemonData::initialize");
+
     // Clear any existing data
     clearCache();
     
@@ -67,6 +71,7 @@ PokemonData::LoadResult PokemonData::reloadData() {
 }
 
 PokemonData::LoadResult PokemonData::loadPokemonData(const std::string& directory) {
+    TRACE_SCOPE("data", "PokemonData::loadPokemonData");
     int loaded_count = 0;
     int failed_count = 0;
     
@@ -114,6 +119,7 @@ PokemonData::LoadResult PokemonData::loadPokemonData(const std::string& director
 }
 
 PokemonData::LoadResult PokemonData::loadMoveData(const std::string& directory) {
+    TRACE_SCOPE("data", "PokemonData::loadMoveData");
     int loaded_count = 0;
     int failed_count = 0;
     
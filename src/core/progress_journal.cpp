@@ -0,0 +1,555 @@
+#include "progress_journal.h"
+#include "binary_io.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr char kSnapshotMagic[4] = {'P', 'J', 'S', 'N'};
+constexpr uint32_t kFormatVersion = 1;
+constexpr uint32_t kMaxRecordBytes = 16 * 1024 * 1024;
+constexpr char kKeySeparator = '\x1f';   // ASCII unit separator never appears in field names
+
+// Thin portability layer over the raw file descriptor calls the WAL needs
+
+int openForAppend(const std::string& path) {
+#ifdef _WIN32
+    return _open(path.c_str(), _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY, 0644);
+#else
+    return ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+#endif
+}
+
+bool writeAll(int fd, const uint8_t* data, size_t length) {
+    while (length > 0) {
+#ifdef _WIN32
+        const int written = _write(fd, data, static_cast<unsigned int>(length));
+#else
+        const ssize_t written = ::write(fd, data, length);
+#endif
+        if (written <= 0) {
+            return false;
+        }
+        data += written;
+        length -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool syncData(int fd) {
+#ifdef _WIN32
+    return _commit(fd) == 0;
+#elif defined(__APPLE__)
+    return ::fsync(fd) == 0;
+#else
+    return ::fdatasync(fd) == 0;
+#endif
+}
+
+void closeFd(int fd) {
+#ifdef _WIN32
+    _close(fd);
+#else
+    ::close(fd);
+#endif
+}
+
+// Make a rename durable by syncing the directory entry (no-op where unsupported)
+void syncDirectory(const std::string& directory) {
+#ifndef _WIN32
+    const int fd = ::open(directory.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+        ::fsync(fd);
+        ::close(fd);
+    }
+#else
+    (void)directory;
+#endif
+}
+
+bool writeFileDurably(const std::string& path, const std::vector<uint8_t>& bytes) {
+#ifdef _WIN32
+    const int fd = _open(path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, 0644);
+#else
+    const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+#endif
+    if (fd < 0) {
+        return false;
+    }
+    const bool ok = writeAll(fd, bytes.data(), bytes.size()) && syncData(fd);
+    closeFd(fd);
+    return ok;
+}
+
+} // namespace
+
+ProgressJournal::ProgressJournal(const std::string& directory, const std::string& name,
+                                 const Settings& settings)
+    : directory(directory), name(name), settings(settings),
+      next_sequence(1), durable_sequence(0), flush_in_progress(false),
+      wal_fd(-1), wal_segment(0), wal_bytes(0), is_open(false),
+      checkpoint_requested(false), stopping(false) {}
+
+ProgressJournal::~ProgressJournal() {
+    {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        stopping = true;
+    }
+    checkpoint_wakeup.notify_all();
+    if (checkpoint_thread.joinable()) {
+        checkpoint_thread.join();
+    }
+
+    if (is_open) {
+        commit();
+        std::lock_guard<std::mutex> lock(state_mutex);
+        closeSegment();
+    }
+}
+
+bool ProgressJournal::open() {
+    std::lock_guard<std::mutex> checkpoint_lock(checkpoint_mutex);
+    std::lock_guard<std::mutex> lock(state_mutex);
+    if (is_open) {
+        return true;
+    }
+
+    std::error_code ec;
+    fs::create_directories(directory, ec);
+    if (!fs::is_directory(directory)) {
+        return false;
+    }
+
+    entries.clear();
+    uint64_t covered_segment = 0;
+    if (!loadSnapshot(covered_segment)) {
+        entries.clear();
+        covered_segment = 0;
+    }
+
+    const auto segments = listSegments();
+    uint64_t last_segment = covered_segment;
+    for (size_t i = 0; i < segments.size(); ++i) {
+        const uint64_t segment = segments[i];
+        if (segment <= covered_segment) {
+            // Left behind by a checkpoint that crashed before cleanup
+            fs::remove(segmentPath(segment), ec);
+            continue;
+        }
+        if (!replaySegment(segment, i + 1 == segments.size())) {
+            break;  // Corruption before the tail: keep what replayed cleanly
+        }
+        last_segment = segment;
+    }
+
+    // New records always go to a fresh segment so recovered files are never appended to
+    if (!openSegment(last_segment + 1)) {
+        return false;
+    }
+
+    is_open = true;
+    if (settings.background_checkpoint) {
+        checkpoint_thread = std::thread(&ProgressJournal::checkpointLoop, this);
+    }
+    return true;
+}
+
+bool ProgressJournal::put(const std::string& key, const std::string& value) {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    return record(OpType::PUT, key, value);
+}
+
+bool ProgressJournal::appendItem(const std::string& key, const std::string& item) {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    return record(OpType::APPEND_ITEM, key, item);
+}
+
+bool ProgressJournal::erasePrefix(const std::string& prefix) {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    return record(OpType::ERASE_PREFIX, prefix, "");
+}
+
+bool ProgressJournal::commit() {
+    std::unique_lock<std::mutex> lock(state_mutex);
+    if (!is_open) {
+        return false;
+    }
+
+    const bool ok = flushPendingLocked(lock, next_sequence - 1);
+    if (ok && wal_bytes >= settings.checkpoint_wal_bytes && !checkpoint_requested) {
+        if (settings.background_checkpoint) {
+            checkpoint_requested = true;
+            checkpoint_wakeup.notify_one();
+        } else {
+            lock.unlock();
+            checkpoint();
+        }
+    }
+    return ok;
+}
+
+bool ProgressJournal::checkpoint() {
+    std::lock_guard<std::mutex> checkpoint_lock(checkpoint_mutex);
+
+    std::map<std::string, Entry> state;
+    uint64_t covered_segment = 0;
+    {
+        std::unique_lock<std::mutex> lock(state_mutex);
+        if (!is_open) {
+            return false;
+        }
+        // Drain until nothing is buffered or in flight, otherwise a record could land
+        // both in the snapshot and in the next segment and be replayed twice
+        while (flush_in_progress || !pending.empty()) {
+            if (flush_in_progress) {
+                flush_done.wait(lock);
+            } else if (!flushPendingLocked(lock, next_sequence - 1)) {
+                return false;
+            }
+        }
+
+        // Seal the current segment; everything in it is captured by the copy below
+        covered_segment = wal_segment;
+        closeSegment();
+        if (!openSegment(covered_segment + 1)) {
+            return false;
+        }
+        state = entries;
+    }
+
+    if (!writeSnapshotFile(state, covered_segment)) {
+        return false;
+    }
+
+    std::error_code ec;
+    for (uint64_t segment : listSegments()) {
+        if (segment <= covered_segment) {
+            fs::remove(segmentPath(segment), ec);
+        }
+    }
+    return true;
+}
+
+std::optional<ProgressJournal::Entry> ProgressJournal::get(const std::string& key) const {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    const auto it = entries.find(key);
+    if (it == entries.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void ProgressJournal::forEachWithPrefix(
+    const std::string& prefix,
+    const std::function<void(const std::string&, const Entry&)>& visitor) const {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    for (auto it = entries.lower_bound(prefix);
+         it != entries.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it) {
+        visitor(it->first, it->second);
+    }
+}
+
+std::string ProgressJournal::makeKey(const std::string& owner, const std::string& field) {
+    return ownerPrefix(owner) + field;
+}
+
+std::string ProgressJournal::ownerPrefix(const std::string& owner) {
+    return owner + kKeySeparator;
+}
+
+std::pair<std::string, std::string> ProgressJournal::splitKey(const std::string& key) {
+    const size_t separator = key.rfind(kKeySeparator);
+    if (separator == std::string::npos) {
+        return {key, ""};
+    }
+    return {key.substr(0, separator), key.substr(separator + 1)};
+}
+
+bool ProgressJournal::isEmpty() const {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    return entries.empty();
+}
+
+uint64_t ProgressJournal::getWalBytes() const {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    return wal_bytes;
+}
+
+uint64_t ProgressJournal::getCommittedSequence() const {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    return durable_sequence;
+}
+
+// Record helpers
+
+bool ProgressJournal::record(OpType op, const std::string& key, const std::string& value) {
+    if (!is_open) {
+        return false;
+    }
+
+    BinaryIO::ByteWriter writer;
+    writer.writeU8(static_cast<uint8_t>(op));
+    writer.writeString(key);
+    writer.writeString(value);
+    const auto frame = BinaryIO::frameRecord(writer.data());
+    pending.insert(pending.end(), frame.begin(), frame.end());
+
+    apply(op, key, value);
+    next_sequence++;
+    return true;
+}
+
+void ProgressJournal::apply(OpType op, const std::string& key, const std::string& value) {
+    switch (op) {
+        case OpType::PUT:
+            entries[key].value = value;
+            break;
+        case OpType::APPEND_ITEM:
+            entries[key].items.push_back(value);
+            break;
+        case OpType::ERASE_PREFIX: {
+            auto it = entries.lower_bound(key);
+            while (it != entries.end() && it->first.compare(0, key.size(), key) == 0) {
+                it = entries.erase(it);
+            }
+            break;
+        }
+    }
+}
+
+bool ProgressJournal::flushPendingLocked(std::unique_lock<std::mutex>& lock, uint64_t target) {
+    while (durable_sequence < target) {
+        if (flush_in_progress) {
+            // Another committer is writing; our records ride along with the next batch
+            flush_done.wait(lock);
+            continue;
+        }
+
+        flush_in_progress = true;
+        std::vector<uint8_t> batch;
+        batch.swap(pending);
+        const uint64_t batch_end = next_sequence - 1;
+        const int fd = wal_fd;
+
+        lock.unlock();
+        bool ok = fd >= 0 && writeAll(fd, batch.data(), batch.size());
+        if (ok && settings.sync_on_commit) {
+            ok = syncData(fd);
+        }
+        lock.lock();
+
+        flush_in_progress = false;
+        if (ok) {
+            wal_bytes += batch.size();
+            durable_sequence = batch_end;
+        } else {
+            // Put the batch back so a later commit can retry it
+            batch.insert(batch.end(), pending.begin(), pending.end());
+            pending.swap(batch);
+        }
+        flush_done.notify_all();
+        if (!ok) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// File helpers
+
+std::string ProgressJournal::snapshotPath() const {
+    return (fs::path(directory) / (name + ".snapshot")).string();
+}
+
+std::string ProgressJournal::segmentPath(uint64_t segment) const {
+    return (fs::path(directory) / (name + ".wal." + std::to_string(segment))).string();
+}
+
+std::vector<uint64_t> ProgressJournal::listSegments() const {
+    std::vector<uint64_t> segments;
+    const std::string prefix = name + ".wal.";
+    std::error_code ec;
+    for (const auto& file : fs::directory_iterator(directory, ec)) {
+        const std::string filename = file.path().filename().string();
+        if (filename.compare(0, prefix.size(), prefix) != 0) {
+            continue;
+        }
+        const std::string suffix = filename.substr(prefix.size());
+        if (!suffix.empty() && std::all_of(suffix.begin(), suffix.end(), ::isdigit)) {
+            segments.push_back(std::stoull(suffix));
+        }
+    }
+    std::sort(segments.begin(), segments.end());
+    return segments;
+}
+
+bool ProgressJournal::loadSnapshot(uint64_t& covered_segment) {
+    std::ifstream in(snapshotPath(), std::ios::binary);
+    if (!in.is_open()) {
+        return false;
+    }
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (bytes.size() < sizeof(kSnapshotMagic) + 4 ||
+        std::memcmp(bytes.data(), kSnapshotMagic, sizeof(kSnapshotMagic)) != 0) {
+        return false;
+    }
+
+    const size_t body_size = bytes.size() - 4;
+    BinaryIO::ByteReader trailer(bytes.data() + body_size, 4);
+    if (trailer.readU32() != BinaryIO::crc32(bytes.data(), body_size)) {
+        return false;
+    }
+
+    BinaryIO::ByteReader reader(bytes.data() + sizeof(kSnapshotMagic), body_size - sizeof(kSnapshotMagic));
+    if (reader.readU32() != kFormatVersion) {
+        return false;
+    }
+    covered_segment = reader.readU64();
+
+    const uint64_t entry_count = reader.readU64();
+    for (uint64_t i = 0; i < entry_count && reader.ok(); ++i) {
+        const std::string key = reader.readString();
+        Entry entry;
+        entry.value = reader.readString();
+        const uint32_t item_count = reader.readU32();
+        for (uint32_t j = 0; j < item_count && reader.ok(); ++j) {
+            entry.items.push_back(reader.readString());
+        }
+        entries[key] = std::move(entry);
+    }
+    return reader.ok();
+}
+
+bool ProgressJournal::replaySegment(uint64_t segment, bool is_last) {
+    const std::string path = segmentPath(segment);
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) {
+        return false;
+    }
+
+    uint64_t valid_end = 0;
+    bool clean = true;
+    std::vector<uint8_t> payload;
+    uint8_t header[BinaryIO::kRecordHeaderSize];
+
+    while (in.read(reinterpret_cast<char*>(header), sizeof(header))) {
+        BinaryIO::ByteReader header_reader(header, sizeof(header));
+        const uint32_t length = header_reader.readU32();
+        const uint32_t checksum = header_reader.readU32();
+        if (length == 0 || length > kMaxRecordBytes) {
+            clean = false;
+            break;
+        }
+
+        payload.resize(length);
+        if (!in.read(reinterpret_cast<char*>(payload.data()), length) ||
+            BinaryIO::crc32(payload.data(), length) != checksum) {
+            clean = false;
+            break;
+        }
+
+        BinaryIO::ByteReader reader(payload.data(), payload.size());
+        const auto op = static_cast<OpType>(reader.readU8());
+        const std::string key = reader.readString();
+        const std::string value = reader.readString();
+        if (!reader.ok()) {
+            clean = false;
+            break;
+        }
+        apply(op, key, value);
+        valid_end += BinaryIO::kRecordHeaderSize + length;
+    }
+    if (in.gcount() != 0 && clean) {
+        clean = false;  // Torn frame header
+    }
+    in.close();
+
+    if (!clean && is_last) {
+        // A crash interrupted the final write; drop the partial record
+        std::error_code ec;
+        fs::resize_file(path, valid_end, ec);
+        return !ec;
+    }
+    return clean;
+}
+
+bool ProgressJournal::openSegment(uint64_t segment) {
+    wal_fd = openForAppend(segmentPath(segment));
+    if (wal_fd < 0) {
+        return false;
+    }
+    syncDirectory(directory);
+    wal_segment = segment;
+    wal_bytes = 0;
+    return true;
+}
+
+void ProgressJournal::closeSegment() {
+    if (wal_fd >= 0) {
+        closeFd(wal_fd);
+        wal_fd = -1;
+    }
+}
+
+bool ProgressJournal::writeSnapshotFile(const std::map<std::string, Entry>& state,
+                                        uint64_t covered_segment) const {
+    BinaryIO::ByteWriter writer;
+    writer.writeBytes(kSnapshotMagic, sizeof(kSnapshotMagic));
+    writer.writeU32(kFormatVersion);
+    writer.writeU64(covered_segment);
+    writer.writeU64(state.size());
+    for (const auto& [key, entry] : state) {
+        writer.writeString(key);
+        writer.writeString(entry.value);
+        writer.writeU32(static_cast<uint32_t>(entry.items.size()));
+        for (const auto& item : entry.items) {
+            writer.writeString(item);
+        }
+    }
+    writer.writeU32(BinaryIO::crc32(writer.data().data(), writer.size()));
+
+    // Temp file + fsync + rename: readers only ever see a complete snapshot
+    const std::string final_path = snapshotPath();
+    const std::string temp_path = final_path + ".tmp";
+    if (!writeFileDurably(temp_path, writer.data())) {
+        return false;
+    }
+
+    std::error_code ec;
+    fs::rename(temp_path, final_path, ec);
+    if (ec) {
+        return false;
+    }
+    syncDirectory(directory);
+    return true;
+}
+
+void ProgressJournal::checkpointLoop() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(state_mutex);
+            checkpoint_wakeup.wait(lock, [this]() { return stopping || checkpoint_requested; });
+            if (stopping) {
+                return;
+            }
+        }
+
+        checkpoint();
+
+        std::lock_guard<std::mutex> lock(state_mutex);
+        checkpoint_requested = false;
+    }
+}
@@ -0,0 +1,330 @@
+#include "rating_engine.h"
+#include "battle_history_log.h"
+#include "binary_io.h"
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr char kRatingsMagic[4] = {'P', 'G', 'R', 'T'};
+constexpr uint32_t kFormatVersion = 1;
+constexpr double kGlickoScale = 173.7178;       // Converts between Glicko and Glicko-2 scales
+constexpr double kConvergenceTolerance = 1e-6;
+constexpr double kPi = 3.14159265358979323846;
+
+double gFactor(double phi) {
+    return 1.0 / std::sqrt(1.0 + 3.0 * phi * phi / (kPi * kPi));
+}
+
+} // namespace
+
+RatingEngine::RatingEngine(const Settings& settings)
+    : settings(settings), periods(0), source_watermark(0) {}
+
+uint32_t RatingEngine::getEntityId(const std::string& name) {
+    const auto it = ids.find(name);
+    if (it != ids.end()) {
+        return it->second;
+    }
+
+    const auto id = static_cast<uint32_t>(names.size());
+    names.push_back(name);
+    mu.push_back((settings.initial_rating - 1500.0) / kGlickoScale);
+    phi.push_back(settings.initial_deviation / kGlickoScale);
+    sigma.push_back(settings.initial_volatility);
+    games.push_back(0);
+    ids.emplace(name, id);
+    return id;
+}
+
+std::optional<uint32_t> RatingEngine::findEntityId(const std::string& name) const {
+    const auto it = ids.find(name);
+    if (it == ids.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+bool RatingEngine::addResult(const std::string& player, const std::string& opponent, double score) {
+    if (player == opponent) {
+        return false;  // Mirror matches carry no rating information
+    }
+    const uint32_t player_id = getEntityId(player);
+    const uint32_t opponent_id = getEntityId(opponent);
+    return queue({player_id, opponent_id, static_cast<float>(score)});
+}
+
+size_t RatingEngine::addResults(const std::vector<GameResult>& results) {
+    size_t closed = 0;
+    pending.reserve(pending.size() + results.size());
+    for (const auto& result : results) {
+        if (result.player < names.size() && result.opponent < names.size() &&
+            result.player != result.opponent && queue(result)) {
+            closed++;
+        }
+    }
+    return closed;
+}
+
+size_t RatingEngine::ingestBattleHistory(const BattleHistoryLog& log, uint64_t skip_records) {
+    size_t closed = 0;
+    uint64_t seen = 0;
+    log.forEachRecord([this, &closed, &seen, skip_records](const BattleHistoryLog::BattleRecord& record) {
+        if (seen++ < skip_records) {
+            return;
+        }
+        const std::string& opponent = record.opponent_team.empty()
+            ? record.difficulty_level : record.opponent_team;
+        if (!record.team_name.empty() && !opponent.empty() &&
+            addResult(record.team_name, opponent, record.victory ? 1.0 : 0.0)) {
+            closed++;
+        }
+    });
+    return closed;
+}
+
+bool RatingEngine::queue(const GameResult& result) {
+    pending.push_back(result);
+    if (settings.games_per_period > 0 && pending.size() >= settings.games_per_period) {
+        closeRatingPeriod();
+        return true;
+    }
+    return false;
+}
+
+void RatingEngine::closeRatingPeriod() {
+    const size_t count = names.size();
+    g_scratch.resize(count);
+    variance_inverse.assign(count, 0.0);
+    improvement.assign(count, 0.0);
+
+    for (size_t i = 0; i < count; ++i) {
+        g_scratch[i] = gFactor(phi[i]);
+    }
+
+    // Pass 1: accumulate both sides of every game against pre-period ratings
+    for (const auto& game : pending) {
+        const uint32_t a = game.player;
+        const uint32_t b = game.opponent;
+        const double score = game.score;
+
+        const double expected_a = 1.0 / (1.0 + std::exp(-g_scratch[b] * (mu[a] - mu[b])));
+        const double expected_b = 1.0 / (1.0 + std::exp(-g_scratch[a] * (mu[b] - mu[a])));
+
+        variance_inverse[a] += g_scratch[b] * g_scratch[b] * expected_a * (1.0 - expected_a);
+        improvement[a] += g_scratch[b] * (score - expected_a);
+        variance_inverse[b] += g_scratch[a] * g_scratch[a] * expected_b * (1.0 - expected_b);
+        improvement[b] += g_scratch[a] * ((1.0 - score) - expected_b);
+        games[a]++;
+        games[b]++;
+    }
+
+    // Pass 2: per-entity volatility, deviation and rating updates
+    const double max_phi = settings.initial_deviation / kGlickoScale;
+    for (size_t i = 0; i < count; ++i) {
+        if (variance_inverse[i] <= 0.0) {
+            phi[i] = std::min(max_phi, std::sqrt(phi[i] * phi[i] + sigma[i] * sigma[i]));
+            continue;
+        }
+
+        const double v = 1.0 / variance_inverse[i];
+        const double delta = v * improvement[i];
+        sigma[i] = solveVolatility(phi[i], sigma[i], v, delta);
+
+        const double phi_star = std::sqrt(phi[i] * phi[i] + sigma[i] * sigma[i]);
+        phi[i] = 1.0 / std::sqrt(1.0 / (phi_star * phi_star) + variance_inverse[i]);
+        mu[i] += phi[i] * phi[i] * improvement[i];
+    }
+
+    pending.clear();
+    periods++;
+}
+
+double RatingEngine::solveVolatility(double phi_value, double sigma_value, double v, double delta) const {
+    // Illinois variant of regula falsi, as in step 5 of Glickman's Glicko-2 paper
+    const double phi_sq = phi_value * phi_value;
+    const double delta_sq = delta * delta;
+    const double tau_sq = settings.tau * settings.tau;
+    const double a = std::log(sigma_value * sigma_value);
+
+    const auto f = [&](double x) {
+        const double ex = std::exp(x);
+        const double denominator = phi_sq + v + ex;
+        return ex * (delta_sq - phi_sq - v - ex) / (2.0 * denominator * denominator) - (x - a) / tau_sq;
+    };
+
+    double lower = a;
+    double upper;
+    if (delta_sq > phi_sq + v) {
+        upper = std::log(delta_sq - phi_sq - v);
+    } else {
+        int k = 1;
+        while (f(a - k * settings.tau) < 0.0) {
+            k++;
+        }
+        upper = a - k * settings.tau;
+    }
+
+    double f_lower = f(lower);
+    double f_upper = f(upper);
+    while (std::fabs(upper - lower) > kConvergenceTolerance) {
+        const double candidate = lower + (lower - upper) * f_lower / (f_upper - f_lower);
+        const double f_candidate = f(candidate);
+        if (f_candidate * f_upper <= 0.0) {
+            lower = upper;
+            f_lower = f_upper;
+        } else {
+            f_lower /= 2.0;
+        }
+        upper = candidate;
+        f_upper = f_candidate;
+    }
+
+    return std::exp(lower / 2.0);
+}
+
+std::optional<RatingEngine::Rating> RatingEngine::getRating(const std::string& name) const {
+    const auto id = findEntityId(name);
+    if (!id) {
+        return std::nullopt;
+    }
+    return getRating(*id);
+}
+
+RatingEngine::Rating RatingEngine::getRating(uint32_t id) const {
+    Rating rating;
+    rating.rating = 1500.0 + mu[id] * kGlickoScale;
+    rating.deviation = phi[id] * kGlickoScale;
+    rating.volatility = sigma[id];
+    rating.games = games[id];
+    return rating;
+}
+
+void RatingEngine::setRating(const std::string& name, const Rating& rating) {
+    const uint32_t id = getEntityId(name);
+    mu[id] = (rating.rating - 1500.0) / kGlickoScale;
+    phi[id] = rating.deviation / kGlickoScale;
+    sigma[id] = rating.volatility;
+    games[id] = rating.games;
+}
+
+bool RatingEngine::save(const std::string& path) const {
+    BinaryIO::ByteWriter writer;
+    writer.writeBytes(kRatingsMagic, sizeof(kRatingsMagic));
+    writer.writeU32(kFormatVersion);
+    writer.writeU64(periods);
+    writer.writeU64(source_watermark);
+
+    writer.writeU32(static_cast<uint32_t>(names.size()));
+    for (size_t i = 0; i < names.size(); ++i) {
+        writer.writeString(names[i]);
+        writer.writeF64(mu[i]);
+        writer.writeF64(phi[i]);
+        writer.writeF64(sigma[i]);
+        writer.writeU32(games[i]);
+    }
+
+    // Scores are always whole or half points, so they fit in a byte
+    writer.writeU32(static_cast<uint32_t>(pending.size()));
+    for (const auto& game : pending) {
+        writer.writeU32(game.player);
+        writer.writeU32(game.opponent);
+        writer.writeU8(static_cast<uint8_t>(std::lround(game.score * 2.0f)));
+    }
+    writer.writeU32(BinaryIO::crc32(writer.data().data(), writer.size()));
+
+    std::error_code ec;
+    const fs::path parent = fs::path(path).parent_path();
+    if (!parent.empty()) {
+        fs::create_directories(parent, ec);
+    }
+
+    // Write to a temporary file and rename so a crash never leaves a torn file
+    const std::string temp_path = path + ".tmp";
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(writer.data().data()),
+                  static_cast<std::streamsize>(writer.size()));
+        out.flush();
+        if (!out.good()) {
+            return false;
+        }
+    }
+
+    fs::rename(temp_path, path, ec);
+    return !ec;
+}
+
+bool RatingEngine::load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) {
+        return false;
+    }
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (bytes.size() < sizeof(kRatingsMagic) + 4) {
+        return false;
+    }
+
+    const size_t body_size = bytes.size() - 4;
+    BinaryIO::ByteReader trailer(bytes.data() + body_size, 4);
+    if (trailer.readU32() != BinaryIO::crc32(bytes.data(), body_size) ||
+        std::memcmp(bytes.data(), kRatingsMagic, sizeof(kRatingsMagic)) != 0) {
+        return false;
+    }
+
+    BinaryIO::ByteReader reader(bytes.data() + sizeof(kRatingsMagic), body_size - sizeof(kRatingsMagic));
+    if (reader.readU32() != kFormatVersion) {
+        return false;
+    }
+
+    RatingEngine loaded(settings);
+    loaded.periods = reader.readU64();
+    loaded.source_watermark = reader.readU64();
+
+    const uint32_t entity_count = reader.readU32();
+    for (uint32_t i = 0; i < entity_count && reader.ok(); ++i) {
+        const uint32_t id = loaded.getEntityId(reader.readString());
+        loaded.mu[id] = reader.readF64();
+        loaded.phi[id] = reader.readF64();
+        loaded.sigma[id] = reader.readF64();
+        loaded.games[id] = reader.readU32();
+    }
+
+    const uint32_t pending_count = reader.readU32();
+    for (uint32_t i = 0; i < pending_count && reader.ok(); ++i) {
+        GameResult game;
+        game.player = reader.readU32();
+        game.opponent = reader.readU32();
+        game.score = static_cast<float>(reader.readU8()) / 2.0f;
+        if (game.player >= loaded.names.size() || game.opponent >= loaded.names.size()) {
+            return false;
+        }
+        loaded.pending.push_back(game);
+    }
+
+    if (!reader.ok() || loaded.names.size() != entity_count) {
+        return false;
+    }
+
+    *this = std::move(loaded);
+    return true;
+}
+
+void RatingEngine::clear() {
+    names.clear();
+    mu.clear();
+    phi.clear();
+    sigma.clear();
+    games.clear();
+    ids.clear();
+    pending.clear();
+    periods = 0;
+    source_watermark = 0;
+}
@@ -0,0 +1,22 @@
+#include "resettable_battle_team.h"
+
+void ResettableBattleTeam::assign(const Team& source) {
+    team = source;
+    reset();
+}
+
+void ResettableBattleTeam::reset() {
+    for (auto& [slot, pokemon] : team) {
+        pokemon.current_hp = pokemon.hp;
+        pokemon.fainted = false;
+        pokemon.clearStatusCondition();
+        pokemon.is_charging = false;
+        pokemon.must_recharge = false;
+        pokemon.charging_move_index = -1;
+        pokemon.charging_move_name.clear();    // Keeps its capacity
+        pokemon.resetStatStages();
+        for (auto& move : pokemon.moves) {
+            move.restorePP();
+        }
+    }
+}
@@ -0,0 +1,320 @@
+#include "species_win_matrix.h"
+#include "battle_simulator.h"
+#include "binary_io.h"
+#include "team.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr char kMatrixMagic[4] = {'P', 'G', 'W', 'M'};
+constexpr uint32_t kFormatVersion = 1;
+
+uint64_t splitMix64(uint64_t value) {
+    value += 0x9E3779B97F4A7C15ull;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+uint8_t quantize(double probability) {
+    return static_cast<uint8_t>(std::lround(std::clamp(probability, 0.0, 1.0) * 255.0));
+}
+
+} // namespace
+
+void SpeciesWinMatrix::setSpecies(const std::vector<std::string>& names) {
+    species_names = names;
+    species_index.clear();
+    for (size_t i = 0; i < species_names.size(); ++i) {
+        species_index[species_names[i]] = i;
+    }
+    probabilities.assign(species_names.size() * species_names.size(), quantize(0.5));
+}
+
+bool SpeciesWinMatrix::build(const std::vector<Pokemon>& species, const Settings& settings,
+                             const ProgressCallback& progress) {
+    if (species.size() < 2 || settings.games_per_duel <= 0) {
+        return false;
+    }
+
+    std::vector<std::string> names;
+    std::vector<Team> teams(species.size());
+    for (size_t i = 0; i < species.size(); ++i) {
+        names.push_back(species[i].name);
+        teams[i].addPokemon(species[i]);
+    }
+    setSpecies(names);
+    games_per_duel = settings.games_per_duel;
+    seed = settings.seed;
+
+    // One job per unordered pair; each job writes only its own two cells
+    std::vector<std::pair<size_t, size_t>> pairs;
+    pairs.reserve(species.size() * (species.size() - 1) / 2);
+    for (size_t i = 0; i < species.size(); ++i) {
+        for (size_t j = i + 1; j < species.size(); ++j) {
+            pairs.emplace_back(i, j);
+        }
+    }
+
+    const size_t n = species.size();
+    auto duel = [&](const std::pair<size_t, size_t>& pair) {
+        const size_t a = pair.first;
+        const size_t b = pair.second;
+        double score_a = 0.0;
+        for (int game = 0; game < settings.games_per_duel; ++game) {
+            BattleSimulator::Options options;
+            options.team_a_ai = settings.ai_difficulty;
+            options.team_b_ai = settings.ai_difficulty;
+            options.max_turns = settings.max_turns;
+            options.seed = splitMix64(splitMix64(settings.seed ^ (a * n + b)) + static_cast<uint64_t>(game));
+
+            const bool swapped = game % 2 == 1;
+            const auto result = swapped ? BattleSimulator::simulate(teams[b], teams[a], options)
+                                        : BattleSimulator::simulate(teams[a], teams[b], options);
+            if (result.outcome == BattleSimulator::Outcome::DRAW) {
+                score_a += 0.5;
+            } else if ((result.outcome == BattleSimulator::Outcome::TEAM_A_WINS) != swapped) {
+                score_a += 1.0;
+            }
+        }
+
+        const double probability = score_a / settings.games_per_duel;
+        probabilities[a * n + b] = quantize(probability);
+        probabilities[b * n + a] = quantize(1.0 - probability);
+    };
+
+    unsigned workers = settings.worker_threads > 0 ? settings.worker_threads : std::thread::hardware_concurrency();
+    workers = std::max(1u, std::min<unsigned>(workers, static_cast<unsigned>(pairs.size())));
+
+    // The calling thread works too, so progress is reported from it alone
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> completed{0};
+    auto work = [&](bool report) {
+        for (size_t index = next++; index < pairs.size(); index = next++) {
+            duel(pairs[index]);
+            const size_t done = ++completed;
+            if (report && progress) {
+                progress(done, pairs.size());
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (unsigned t = 1; t < workers; ++t) {
+        threads.emplace_back(work, false);
+    }
+    work(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (progress) {
+        progress(pairs.size(), pairs.size());
+    }
+    return true;
+}
+
+bool SpeciesWinMatrix::buildFromData(const PokemonData& data, const Settings& settings,
+                                     const ProgressCallback& progress) {
+    std::vector<Pokemon> species;
+    for (const auto& name : data.getAvailablePokemon()) {
+        Pokemon pokemon(name);
+        if (pokemon.name.empty()) {
+            continue;
+        }
+        for (const auto& move_name : data.suggestMovesForPokemon(name, 4)) {
+            Move move(move_name);
+            if (!move.name.empty()) {
+                pokemon.moves.push_back(move);
+            }
+        }
+        if (!pokemon.moves.empty()) {
+            species.push_back(pokemon);
+        }
+    }
+    return build(species, settings, progress);
+}
+
+std::optional<size_t> SpeciesWinMatrix::findSpecies(const std::string& name) const {
+    auto it = species_index.find(name);
+    if (it == species_index.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+double SpeciesWinMatrix::getWinProbability(size_t species, size_t opponent) const {
+    return probabilities[species * species_names.size() + opponent] / 255.0;
+}
+
+std::optional<double> SpeciesWinMatrix::getWinProbability(const std::string& species,
+                                                          const std::string& opponent) const {
+    const auto a = findSpecies(species);
+    const auto b = findSpecies(opponent);
+    if (!a || !b) {
+        return std::nullopt;
+    }
+    return getWinProbability(*a, *b);
+}
+
+double SpeciesWinMatrix::overallStrength(size_t species) const {
+    const size_t n = species_names.size();
+    if (n < 2) {
+        return 0.5;
+    }
+    unsigned total = 0;
+    for (size_t opponent = 0; opponent < n; ++opponent) {
+        if (opponent != species) {
+            total += probabilities[species * n + opponent];
+        }
+    }
+    return total / (255.0 * (n - 1));
+}
+
+std::vector<std::string> SpeciesWinMatrix::selectCounters(const std::vector<std::string>& targets, size_t count,
+                                                          double strictness,
+                                                          const std::function<bool(const std::string&)>& allowed) const {
+    std::vector<std::string> picks;
+    if (empty() || count == 0) {
+        return picks;
+    }
+
+    std::vector<size_t> target_indices;
+    for (const auto& target : targets) {
+        if (auto index = findSpecies(target)) {
+            target_indices.push_back(*index);
+        }
+    }
+    // Without known targets, coverage is meaningless; pick the strongest species
+    strictness = target_indices.empty() ? 0.0 : std::clamp(strictness, 0.0, 1.0);
+
+    const size_t n = species_names.size();
+    std::vector<double> strength(n);
+    std::vector<bool> candidate(n);
+    for (size_t i = 0; i < n; ++i) {
+        strength[i] = overallStrength(i);
+        candidate[i] = !allowed || allowed(species_names[i]);
+    }
+
+    // covered[t] = best win probability against target t among the picks so far
+    std::vector<double> covered(target_indices.size(), 0.0);
+    while (picks.size() < count) {
+        size_t best = n;
+        double best_gain = -1.0;
+        for (size_t i = 0; i < n; ++i) {
+            if (!candidate[i]) {
+                continue;
+            }
+            double coverage_gain = 0.0;
+            for (size_t t = 0; t < target_indices.size(); ++t) {
+                coverage_gain += std::max(0.0, getWinProbability(i, target_indices[t]) - covered[t]);
+            }
+            if (!target_indices.empty()) {
+                coverage_gain /= target_indices.size();
+            }
+
+            const double gain = strictness * coverage_gain + (1.0 - strictness) * strength[i] / count;
+            if (gain > best_gain) {
+                best_gain = gain;
+                best = i;
+            }
+        }
+        if (best == n) {
+            break;
+        }
+
+        candidate[best] = false;
+        picks.push_back(species_names[best]);
+        for (size_t t = 0; t < target_indices.size(); ++t) {
+            covered[t] = std::max(covered[t], getWinProbability(best, target_indices[t]));
+        }
+    }
+    return picks;
+}
+
+bool SpeciesWinMatrix::save(const std::string& path) const {
+    BinaryIO::ByteWriter writer;
+    writer.writeBytes(kMatrixMagic, sizeof(kMatrixMagic));
+    writer.writeU32(kFormatVersion);
+    writer.writeU32(static_cast<uint32_t>(games_per_duel));
+    writer.writeU64(seed);
+    writer.writeU32(static_cast<uint32_t>(species_names.size()));
+    for (const auto& name : species_names) {
+        writer.writeString(name);
+    }
+    writer.writeBytes(probabilities.data(), probabilities.size());
+    writer.writeU32(BinaryIO::crc32(writer.data().data(), writer.size()));
+
+    std::error_code ec;
+    const fs::path parent = fs::path(path).parent_path();
+    if (!parent.empty()) {
+        fs::create_directories(parent, ec);
+    }
+
+    // Write to a temporary file and rename so a crash never leaves a torn file
+    const std::string temp_path = path + ".tmp";
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(writer.data().data()),
+                  static_cast<std::streamsize>(writer.size()));
+        out.flush();
+        if (!out.good()) {
+            return false;
+        }
+    }
+
+    fs::rename(temp_path, path, ec);
+    return !ec;
+}
+
+bool SpeciesWinMatrix::load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) {
+        return false;
+    }
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (bytes.size() < sizeof(kMatrixMagic) + 4) {
+        return false;
+    }
+
+    const size_t body_size = bytes.size() - 4;
+    BinaryIO::ByteReader trailer(bytes.data() + body_size, 4);
+    if (trailer.readU32() != BinaryIO::crc32(bytes.data(), body_size) ||
+        std::memcmp(bytes.data(), kMatrixMagic, sizeof(kMatrixMagic)) != 0) {
+        return false;
+    }
+
+    BinaryIO::ByteReader reader(bytes.data() + sizeof(kMatrixMagic), body_size - sizeof(kMatrixMagic));
+    if (reader.readU32() != kFormatVersion) {
+        return false;
+    }
+    const int loaded_games = static_cast<int>(reader.readU32());
+    const uint64_t loaded_seed = reader.readU64();
+
+    const uint32_t count = reader.readU32();
+    std::vector<std::string> names;
+    for (uint32_t i = 0; i < count && reader.ok(); ++i) {
+        names.push_back(reader.readString());
+    }
+    const size_t cells = static_cast<size_t>(count) * count;
+    if (!reader.ok() || reader.remaining() != cells) {
+        return false;
+    }
+
+    setSpecies(names);
+    std::memcpy(probabilities.data(), bytes.data() + sizeof(kMatrixMagic) + reader.offset(), cells);
+    games_per_duel = loaded_games;
+    seed = loaded_seed;
+    return true;
+}
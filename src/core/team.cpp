@@ -1,5 +1,6 @@
 #include "team.h"
 #include "input_validator.h"
+#include "trace.h"
 
 using json = nlohmann::json;
 
@@ -11,6 +12,7 @@ void Team::loadTeams(
         std::vector<std::pair<std::string, std::vector<std::string>>>>
         &selectedMoves,
     const std::string &selectedTeamName) {
+  TRACE_SCOPE("data", "Team::loadTeams");
   int PokemonCount = 0;
 
   // Get the selected Pokémon names for the chosen team
@@ -73,6 +75,11 @@ void Team::addPokemon(const Pokemon &pokemon) {
   pokemonTeam[index] = pokemon;
 }
 
+void Team::addPokemon(Pokemon &&pokemon) {
+  int index = pokemonTeam.size();
+  pokemonTeam[index] = std::move(pokemon);
+}
+
 Pokemon *Team::getPokemon(int index) {
   auto it = pokemonTeam.find(index);
   return (it != pokemonTeam.end()) ? &it->second : nullptr;
@@ -0,0 +1,287 @@
+#include "team_batch_scorer.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace {
+
+// Per-type counters stored as bit planes: plane i holds bit i of every type's
+// count, so adding a member's mask updates all 18 counters with a few word ops
+struct SlicedCounter {
+    TypeMask planes[3] = {0, 0, 0};  // Counts up to 7
+
+    void add(TypeMask mask) {
+        for (TypeMask& plane : planes) {
+            const TypeMask carry = plane & mask;
+            plane ^= mask;
+            mask = carry;
+        }
+    }
+
+    static SlicedCounter constant(int value) {
+        SlicedCounter counter;
+        for (int i = 0; i < 3; ++i) {
+            counter.planes[i] = (value >> i) & 1 ? TypeMasks::kAllTypes : 0u;
+        }
+        return counter;
+    }
+
+    // Types whose count here is greater than in other
+    TypeMask greaterThan(const SlicedCounter& other) const {
+        TypeMask greater = 0;
+        TypeMask equal = TypeMasks::kAllTypes;
+        for (int i = 2; i >= 0; --i) {
+            greater |= equal & planes[i] & ~other.planes[i];
+            equal &= ~(planes[i] ^ other.planes[i]);
+        }
+        return greater;
+    }
+};
+
+} // namespace
+
+TeamBatchScorer::PackedTeam::PackedTeam() {
+    std::fill(std::begin(species), std::end(species), kEmptySlot);
+    for (auto& slot_moves : moves) {
+        std::fill(std::begin(slot_moves), std::end(slot_moves), kEmptySlot);
+    }
+}
+
+TeamBatchScorer::TeamBatchScorer(const PokemonData& data, const Settings& settings)
+    : settings(settings) {
+    for (const auto& name : data.getAvailablePokemon()) {
+        auto info = data.getPokemonInfo(name);
+        if (!info || species_names.size() >= kUnknownId) {
+            continue;
+        }
+
+        SpeciesEntry entry;
+        entry.stats = {static_cast<uint16_t>(info->hp), static_cast<uint16_t>(info->attack),
+                       static_cast<uint16_t>(info->defense), static_cast<uint16_t>(info->special_attack),
+                       static_cast<uint16_t>(info->special_defense), static_cast<uint16_t>(info->speed)};
+        entry.types = TypeMasks::fromTypes(info->types);
+        const auto matchups = TypeMasks::defenseProfile(entry.types);
+        entry.weak = matchups.weak;
+        entry.resisted = matchups.resist | matchups.immune;
+
+        species_ids[name] = static_cast<uint16_t>(species_names.size());
+        species_names.push_back(name);
+        species.push_back(entry);
+    }
+
+    for (const auto& name : data.getAvailableMoves()) {
+        auto info = data.getMoveInfo(name);
+        if (!info || move_names.size() >= kUnknownId) {
+            continue;
+        }
+
+        move_ids[name] = static_cast<uint16_t>(move_names.size());
+        move_names.push_back(name);
+        move_hits.push_back(TypeMasks::superEffectiveAgainst(TypeMasks::typeIndex(info->type)));
+    }
+}
+
+uint16_t TeamBatchScorer::getSpeciesId(const std::string& name) const {
+    auto it = species_ids.find(name);
+    return it != species_ids.end() ? it->second : kUnknownId;
+}
+
+uint16_t TeamBatchScorer::getMoveId(const std::string& name) const {
+    auto it = move_ids.find(name);
+    return it != move_ids.end() ? it->second : kUnknownId;
+}
+
+bool TeamBatchScorer::pack(const TeamBuilder::Team& team, PackedTeam& packed) const {
+    packed = PackedTeam();
+    if (team.pokemon.size() > static_cast<size_t>(kMaxTeamSize)) {
+        return false;
+    }
+
+    for (size_t slot = 0; slot < team.pokemon.size(); ++slot) {
+        const auto& pokemon = team.pokemon[slot];
+        if (pokemon.moves.size() > static_cast<size_t>(kMaxMoves)) {
+            return false;
+        }
+        packed.species[slot] = getSpeciesId(pokemon.name);
+        for (size_t move = 0; move < pokemon.moves.size(); ++move) {
+            packed.moves[slot][move] = getMoveId(pokemon.moves[move]);
+        }
+    }
+    return true;
+}
+
+void TeamBatchScorer::score(const PackedTeam* teams, size_t count, TeamScore* results) const {
+    if (count == 0) {
+        return;
+    }
+
+    const size_t chunk = std::max<size_t>(1, settings.chunk_size);
+    const size_t chunks = (count + chunk - 1) / chunk;
+    unsigned workers = settings.worker_threads > 0 ? settings.worker_threads : std::thread::hardware_concurrency();
+    workers = std::max(1u, std::min<unsigned>(workers, static_cast<unsigned>(std::min<size_t>(chunks, 1024))));
+
+    std::atomic<size_t> next_chunk(0);
+    auto work = [&]() {
+        for (size_t c = next_chunk.fetch_add(1); c < chunks; c = next_chunk.fetch_add(1)) {
+            const size_t begin = c * chunk;
+            scoreRange(teams + begin, std::min(chunk, count - begin), results + begin);
+        }
+    };
+
+    // The calling thread takes chunks too
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (unsigned t = 1; t < workers; ++t) {
+        threads.emplace_back(work);
+    }
+    work();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+std::vector<TeamBatchScorer::TeamScore> TeamBatchScorer::score(const std::vector<PackedTeam>& teams) const {
+    std::vector<TeamScore> results(teams.size());
+    score(teams.data(), teams.size(), results.data());
+    return results;
+}
+
+TeamBatchScorer::TeamScore TeamBatchScorer::scoreOne(const PackedTeam& team) const {
+    TeamScore result;
+    scoreRange(&team, 1, &result);
+    return result;
+}
+
+void TeamBatchScorer::scoreRange(const PackedTeam* teams, size_t count, TeamScore* results) const {
+    const auto& rules = settings.validation;
+    const uint16_t species_count = static_cast<uint16_t>(species.size());
+    const uint16_t move_count = static_cast<uint16_t>(move_hits.size());
+
+    // One bit per move ID (unknown IDs share the bit after the last move) for
+    // counting distinct moves; bits are cleared again after each team
+    uint64_t seen_moves[(kUnknownId >> 6) + 1];
+    std::fill(seen_moves, seen_moves + (move_count >> 6) + 1, 0);
+
+    for (size_t t = 0; t < count; ++t) {
+        const PackedTeam& team = teams[t];
+        TeamScore& result = results[t];
+
+        uint32_t totals[6] = {0, 0, 0, 0, 0, 0};
+        SlicedCounter weak_members;
+        SlicedCounter resisting_members;
+        SlicedCounter type_members;
+        int unique_move_count = 0;
+        TypeMask team_types = 0;
+        TypeMask coverage = 0;
+        uint16_t flags = 0;
+        int size = 0;
+
+        for (; size < kMaxTeamSize && team.species[size] != kEmptySlot; ++size) {
+            const uint16_t id = team.species[size];
+            const uint16_t* moves = team.moves[size];
+
+            // Every listed move counts toward balance, whether or not the species is known
+            int listed_moves = 0;
+            for (int m = 0; m < kMaxMoves; ++m) {
+                const uint16_t move = moves[m];
+                if (move == kEmptySlot) {
+                    continue;
+                }
+                ++listed_moves;
+                const uint16_t bit = std::min(move, move_count);
+                const uint64_t flag = uint64_t(1) << (bit & 63);
+                unique_move_count += (seen_moves[bit >> 6] & flag) == 0;
+                seen_moves[bit >> 6] |= flag;
+                if (move < move_count) {
+                    coverage |= move_hits[move];
+                }
+            }
+
+            if (id >= species_count) {
+                flags |= UNKNOWN_SPECIES;
+                continue;
+            }
+
+            // Move checks, as validatePokemonMoves (skipped for unknown species)
+            if (rules.enforce_min_moves && listed_moves < rules.min_moves_per_pokemon) {
+                flags |= TOO_FEW_MOVES;
+            }
+            for (int m = 0; m < kMaxMoves; ++m) {
+                if (moves[m] == kEmptySlot) {
+                    continue;
+                }
+                if (moves[m] >= move_count) {
+                    flags |= UNKNOWN_MOVE;
+                }
+                for (int other = m + 1; other < kMaxMoves; ++other) {
+                    if (moves[other] == moves[m] && moves[m] < move_count) {
+                        flags |= DUPLICATE_MOVES;
+                    }
+                }
+            }
+
+            if (!rules.allow_duplicate_pokemon &&
+                std::find(team.species, team.species + size, id) != team.species + size) {
+                flags |= DUPLICATE_SPECIES;
+            }
+
+            const SpeciesEntry& entry = species[id];
+            for (int stat = 0; stat < 6; ++stat) {
+                totals[stat] += entry.stats[stat];
+            }
+            team_types |= entry.types;
+            weak_members.add(entry.weak);
+            resisting_members.add(entry.resisted);
+            type_members.add(entry.types);
+        }
+
+        // Reset the distinct-move bits for the next team
+        for (int slot = 0; slot < size; ++slot) {
+            for (uint16_t move : team.moves[slot]) {
+                if (move != kEmptySlot) {
+                    seen_moves[std::min(move, move_count) >> 6] = 0;
+                }
+            }
+        }
+
+        const TypeMask shared_weaknesses = weak_members.greaterThan(resisting_members);
+        if (rules.require_type_diversity &&
+            type_members.greaterThan(SlicedCounter::constant(size / 2)) != 0) {
+            flags |= TYPE_HEAVY;
+        }
+
+        const int unique_types = TypeMasks::count(team_types);
+        if (rules.enforce_min_team_size && size < rules.min_team_size) {
+            flags |= TEAM_TOO_SMALL;
+        }
+        if (size < 3) {
+            flags |= SMALL_TEAM;
+        }
+        if (rules.require_type_diversity && unique_types < rules.min_unique_types) {
+            flags |= LOW_TYPE_DIVERSITY;
+        }
+
+        // Balance score, as calculateBalanceScore
+        int balance = 0;
+        if (size > 0) {
+            balance = 50 + unique_types * 5 + unique_move_count * 2;
+            const uint32_t min_total = *std::min_element(totals, totals + 6);
+            const uint32_t max_total = *std::max_element(totals, totals + 6);
+            if (max_total > 0) {
+                balance += static_cast<int>(static_cast<double>(min_total) / max_total * 20);
+            }
+            balance = std::min(100, std::max(0, balance));
+        }
+
+        const float divisor = size > 0 ? static_cast<float>(size) : 1.0f;
+        for (int stat = 0; stat < 6; ++stat) {
+            result.average_stats[stat] = static_cast<float>(totals[stat]) / divisor;
+        }
+        result.team_types = team_types;
+        result.coverage = coverage;
+        result.shared_weaknesses = shared_weaknesses;
+        result.flags = flags;
+        result.balance_score = static_cast<uint8_t>(balance);
+        result.team_size = static_cast<uint8_t>(size);
+    }
+}
@@ -1,4 +1,11 @@
 #include "team_builder.h"
+#include "battle_history_log.h"
+#include "rating_engine.h"
+#include "team_optimizer.h"
+#include "species_win_matrix.h"
+#include "team_share_codec.h"
+#include "team_matchup_simulator.h"
+#include "base64.h"
 #include <algorithm>
 #include <random>
 #include <fstream>
@@ -13,7 +20,7 @@
 using json = nlohmann::json;
 
 TeamBuilder::TeamBuilder(std::shared_ptr<PokemonData> data) 
-    : pokemon_data(data), validation_settings(), templates_loaded(false) {
+    : pokemon_data(data), validation_settings(), templates_loaded(false), win_matrix_loaded(false) {
     if (!pokemon_data) {
         throw std::invalid_argument("PokemonData cannot be null");
     }
@@ -333,14 +340,36 @@ TeamBuilder::TeamAnalysis TeamBuilder::analyzeTeam(const Team& team) const {
     // Analyze types
     analysis.offensive_types = getTeamTypes(team);
     
+    // Net defensive matchups: types that hit more members super effectively than they are resisted by
+    std::array<int, TypeMasks::kTypeCount> weak_count{};
+    std::array<int, TypeMasks::kTypeCount> resist_count{};
+    for (const auto& pokemon : team.pokemon) {
+        const SpeciesProfile* profile = getSpeciesProfile(pokemon.name);
+        if (!profile) {
+            continue;
+        }
+        const TypeMask resisted = profile->matchups.resist | profile->matchups.immune;
+        for (int type = 0; type < TypeMasks::kTypeCount; ++type) {
+            weak_count[type] += (profile->matchups.weak >> type) & 1u;
+            resist_count[type] += (resisted >> type) & 1u;
+        }
+    }
+    for (int type = 0; type < TypeMasks::kTypeCount; ++type) {
+        if (weak_count[type] > resist_count[type]) {
+            analysis.defensive_weaknesses.push_back(TypeMasks::typeName(type));
+        } else if (resist_count[type] > weak_count[type]) {
+            analysis.defensive_resistances.push_back(TypeMasks::typeName(type));
+        }
+    }
+    
     // Analyze moves
     for (const auto& pokemon : team.pokemon) {
         for (const auto& move_name : pokemon.moves) {
-            auto move_info = pokemon_data->getMoveInfo(move_name);
-            if (move_info.has_value()) {
-                if (move_info->damage_class == "physical") {
+            const MoveProfile* move = getMoveProfile(move_name);
+            if (move) {
+                if (move->physical) {
                     analysis.physical_moves++;
-                } else if (move_info->damage_class == "special") {
+                } else if (move->special) {
                     analysis.special_moves++;
                 } else {
                     analysis.status_moves++;
@@ -350,28 +379,14 @@ TeamBuilder::TeamAnalysis TeamBuilder::analyzeTeam(const Team& team) const {
     }
     
     // Calculate average stats
-    double total_hp = 0, total_attack = 0, total_defense = 0;
-    double total_sp_attack = 0, total_sp_defense = 0, total_speed = 0;
-    
-    for (const auto& pokemon : team.pokemon) {
-        auto pokemon_info = pokemon_data->getPokemonInfo(pokemon.name);
-        if (pokemon_info.has_value()) {
-            total_hp += pokemon_info->hp;
-            total_attack += pokemon_info->attack;
-            total_defense += pokemon_info->defense;
-            total_sp_attack += pokemon_info->special_attack;
-            total_sp_defense += pokemon_info->special_defense;
-            total_speed += pokemon_info->speed;
-        }
-    }
-    
+    const auto totals = getTeamStatTotals(team);
     double team_size = static_cast<double>(team.size());
-    analysis.average_hp = total_hp / team_size;
-    analysis.average_attack = total_attack / team_size;
-    analysis.average_defense = total_defense / team_size;
-    analysis.average_special_attack = total_sp_attack / team_size;
-    analysis.average_special_defense = total_sp_defense / team_size;
-    analysis.average_speed = total_speed / team_size;
+    analysis.average_hp = totals[0] / team_size;
+    analysis.average_attack = totals[1] / team_size;
+    analysis.average_defense = totals[2] / team_size;
+    analysis.average_special_attack = totals[3] / team_size;
+    analysis.average_special_defense = totals[4] / team_size;
+    analysis.average_speed = totals[5] / team_size;
     
     // Calculate balance score
     analysis.balance_score = calculateBalanceScore(team);
@@ -384,32 +399,52 @@ TeamBuilder::TeamAnalysis TeamBuilder::analyzeTeam(const Team& team) const {
 }
 
 std::vector<std::string> TeamBuilder::getTeamTypes(const Team& team) const {
-    std::set<std::string> unique_types;
-    
+    auto types = TypeMasks::toTypes(getTeamTypeMask(team));
+    std::sort(types.begin(), types.end());  // Callers expect alphabetical order
+    return types;
+}
+
+TypeMask TeamBuilder::getTeamTypeMask(const Team& team) const {
+    TypeMask mask = 0;
     for (const auto& pokemon : team.pokemon) {
-        auto pokemon_info = pokemon_data->getPokemonInfo(pokemon.name);
-        if (pokemon_info.has_value()) {
-            for (const auto& type : pokemon_info->types) {
-                unique_types.insert(type);
+        const SpeciesProfile* profile = getSpeciesProfile(pokemon.name);
+        if (profile) {
+            mask |= profile->types;
+        }
+    }
+    return mask;
+}
+
+std::array<double, 6> TeamBuilder::getTeamStatTotals(const Team& team) const {
+    std::array<double, 6> totals{};
+    for (const auto& pokemon : team.pokemon) {
+        const SpeciesProfile* profile = getSpeciesProfile(pokemon.name);
+        if (profile) {
+            for (size_t stat = 0; stat < totals.size(); ++stat) {
+                totals[stat] += profile->stats[stat];
             }
         }
     }
-    
-    return std::vector<std::string>(unique_types.begin(), unique_types.end());
+    return totals;
 }
 
 std::unordered_map<std::string, int> TeamBuilder::getTypeCounts(const Team& team) const {
-    std::unordered_map<std::string, int> type_counts;
-    
+    std::array<int, TypeMasks::kTypeCount> counts{};
     for (const auto& pokemon : team.pokemon) {
-        auto pokemon_info = pokemon_data->getPokemonInfo(pokemon.name);
-        if (pokemon_info.has_value()) {
-            for (const auto& type : pokemon_info->types) {
-                type_counts[type]++;
+        const SpeciesProfile* profile = getSpeciesProfile(pokemon.name);
+        if (profile) {
+            for (int type = 0; type < TypeMasks::kTypeCount; ++type) {
+                counts[type] += (profile->types >> type) & 1u;
             }
         }
     }
     
+    std::unordered_map<std::string, int> type_counts;
+    for (int type = 0; type < TypeMasks::kTypeCount; ++type) {
+        if (counts[type] > 0) {
+            type_counts[TypeMasks::typeName(type)] = counts[type];
+        }
+    }
     return type_counts;
 }
 
@@ -421,8 +456,7 @@ int TeamBuilder::calculateBalanceScore(const Team& team) const {
     int score = 50; // Base score
     
     // Type diversity bonus
-    auto unique_types = getTeamTypes(team);
-    score += static_cast<int>(unique_types.size()) * 5;
+    score += TypeMasks::count(getTeamTypeMask(team)) * 5;
     
     // Move diversity bonus
     std::set<std::string> unique_moves;
@@ -433,38 +467,14 @@ int TeamBuilder::calculateBalanceScore(const Team& team) const {
     }
     score += static_cast<int>(unique_moves.size()) * 2;
     
-    // Stat balance bonus
-    TeamAnalysis analysis;
-    double total_hp = 0, total_attack = 0, total_defense = 0;
-    double total_sp_attack = 0, total_sp_defense = 0, total_speed = 0;
-    
-    for (const auto& pokemon : team.pokemon) {
-        auto pokemon_info = pokemon_data->getPokemonInfo(pokemon.name);
-        if (pokemon_info.has_value()) {
-            total_hp += pokemon_info->hp;
-            total_attack += pokemon_info->attack;
-            total_defense += pokemon_info->defense;
-            total_sp_attack += pokemon_info->special_attack;
-            total_sp_defense += pokemon_info->special_defense;
-            total_speed += pokemon_info->speed;
-        }
-    }
-    
-    // Penalize extreme stat imbalances
-    std::vector<double> averages = {
-        total_hp / team.size(),
-        total_attack / team.size(),
-        total_defense / team.size(),
-        total_sp_attack / team.size(),
-        total_sp_defense / team.size(),
-        total_speed / team.size()
-    };
+    // Stat balance bonus: penalize extreme stat imbalances (totals have the same ratios as averages)
+    const auto totals = getTeamStatTotals(team);
     
-    double min_avg = *std::min_element(averages.begin(), averages.end());
-    double max_avg = *std::max_element(averages.begin(), averages.end());
+    double min_total = *std::min_element(totals.begin(), totals.end());
+    double max_total = *std::max_element(totals.begin(), totals.end());
     
-    if (max_avg > 0) {
-        double balance_ratio = min_avg / max_avg;
+    if (max_total > 0) {
+        double balance_ratio = min_total / max_total;
         score += static_cast<int>(balance_ratio * 20);
     }
     
@@ -789,65 +799,41 @@ std::vector<std::string> TeamBuilder::suggestPokemonForTeam(const Team& team, in
     }
     
     // Get current team types
-    auto current_types = getTeamTypes(team);
-    std::set<std::string> type_set(current_types.begin(), current_types.end());
+    const TypeMask team_types = getTeamTypeMask(team);
     
-    // Get all available Pokemon
-    auto all_pokemon = pokemon_data->getAvailablePokemon();
+    // Score every species (profiles are in name order) on type diversity and stats
+    buildSpeciesProfiles();
+    std::vector<std::pair<const SpeciesProfile*, int>> pokemon_scores;
+    pokemon_scores.reserve(species_profiles.size());
     
-    // Score Pokemon based on type diversity and team composition
-    std::vector<std::pair<std::string, int>> pokemon_scores;
-    
-    for (const auto& pokemon_name : all_pokemon) {
+    for (const auto& profile : species_profiles) {
         // Skip if already in team (unless duplicates allowed)
-        bool already_in_team = false;
-        if (!validation_settings.allow_duplicate_pokemon) {
-            for (const auto& team_pokemon : team.pokemon) {
-                if (team_pokemon.name == pokemon_name) {
-                    already_in_team = true;
-                    break;
-                }
-            }
-        }
-        
-        if (already_in_team) {
-            continue;
-        }
-        
-        auto pokemon_info = pokemon_data->getPokemonInfo(pokemon_name);
-        if (!pokemon_info.has_value()) {
+        if (!validation_settings.allow_duplicate_pokemon &&
+            std::any_of(team.pokemon.begin(), team.pokemon.end(),
+                        [&](const TeamPokemon& member) { return member.name == profile.name; })) {
             continue;
         }
         
-        int score = 0;
-        
-        // Bonus for new types
-        for (const auto& type : pokemon_info->types) {
-            if (type_set.find(type) == type_set.end()) {
-                score += 10; // Bonus for new type
-            }
-        }
+        // Bonus for each new type
+        int score = TypeMasks::count(profile.types & ~team_types) * 10;
         
         // Bonus for balanced stats
-        int total_stats = pokemon_info->hp + pokemon_info->attack + pokemon_info->defense +
-                         pokemon_info->special_attack + pokemon_info->special_defense + pokemon_info->speed;
-        if (total_stats > 450) { // Good stat total
+        if (profile.base_stat_total > 450) { // Good stat total
             score += 5;
         }
         
         // Small random factor for variety
         score += rand() % 3;
         
-        pokemon_scores.emplace_back(pokemon_name, score);
+        pokemon_scores.emplace_back(&profile, score);
     }
     
-    // Sort by score (descending)
-    std::sort(pokemon_scores.begin(), pokemon_scores.end(),
-              [](const auto& a, const auto& b) { return a.second > b.second; });
-    
-    // Take top suggestions
-    for (int i = 0; i < count && i < static_cast<int>(pokemon_scores.size()); ++i) {
-        suggestions.push_back(pokemon_scores[i].first);
+    // Take top suggestions, best score first
+    const size_t picks = std::min(pokemon_scores.size(), static_cast<size_t>(std::max(count, 0)));
+    std::partial_sort(pokemon_scores.begin(), pokemon_scores.begin() + picks, pokemon_scores.end(),
+                      [](const auto& a, const auto& b) { return a.second > b.second; });
+    for (size_t i = 0; i < picks; ++i) {
+        suggestions.push_back(pokemon_scores[i].first->name);
     }
     
     return suggestions;
@@ -910,35 +896,34 @@ std::vector<std::string> TeamBuilder::getTeamSuggestions(const Team& team) const
     }
     
     // Check for common weaknesses
-    std::unordered_map<std::string, int> weakness_count;
+    std::array<int, TypeMasks::kTypeCount> weakness_count{};
     for (const auto& pokemon : team.pokemon) {
-        auto pokemon_info = pokemon_data->getPokemonInfo(pokemon.name);
-        if (pokemon_info.has_value()) {
-            auto weak_types = getWeakTypes(pokemon_info->types);
-            for (const auto& weakness : weak_types) {
-                weakness_count[weakness]++;
+        const SpeciesProfile* profile = getSpeciesProfile(pokemon.name);
+        if (profile) {
+            for (int type = 0; type < TypeMasks::kTypeCount; ++type) {
+                weakness_count[type] += (profile->matchups.weak >> type) & 1u;
             }
         }
     }
     
-    for (const auto& [type, count] : weakness_count) {
-        if (count > static_cast<int>(team.size()) / 2) {
-            suggestions.push_back("Team is weak to " + type + " type moves");
+    for (int type = 0; type < TypeMasks::kTypeCount; ++type) {
+        if (weakness_count[type] > static_cast<int>(team.size()) / 2) {
+            suggestions.push_back("Team is weak to " + TypeMasks::typeName(type) + " type moves");
         }
     }
     
     // Check move diversity
-    std::unordered_map<std::string, int> move_type_count;
+    TypeMask move_types = 0;
     for (const auto& pokemon : team.pokemon) {
         for (const auto& move_name : pokemon.moves) {
-            auto move_info = pokemon_data->getMoveInfo(move_name);
-            if (move_info.has_value()) {
-                move_type_count[move_info->type]++;
+            const MoveProfile* move = getMoveProfile(move_name);
+            if (move) {
+                move_types |= TypeMasks::bit(move->type_index);
             }
         }
     }
     
-    if (move_type_count.size() < team_types.size()) {
+    if (static_cast<size_t>(TypeMasks::count(move_types)) < team_types.size()) {
         suggestions.push_back("Consider moves that match your Pokemon types for STAB bonus");
     }
     
@@ -946,34 +931,21 @@ std::vector<std::string> TeamBuilder::getTeamSuggestions(const Team& team) const
 }
 
 std::unordered_map<std::string, double> TeamBuilder::calculateTypeCoverage(const Team& team) const {
-    std::unordered_map<std::string, double> coverage;
-    
-    // Get all possible target types
-    std::vector<std::string> all_types = {"normal", "fire", "water", "electric", "grass", "ice",
-                                         "fighting", "poison", "ground", "flying", "psychic",
-                                         "bug", "rock", "ghost", "dragon", "dark", "steel", "fairy"};
-    
-    // Initialize coverage map
-    for (const auto& type : all_types) {
-        coverage[type] = 1.0; // Neutral effectiveness by default
-    }
-    
-    // Calculate best effectiveness against each type from team's moves
+    // Every target type starts at neutral; any move type hitting it super effectively lifts it to 2x
+    TypeMask super_effective = 0;
     for (const auto& pokemon : team.pokemon) {
         for (const auto& move_name : pokemon.moves) {
-            auto move_info = pokemon_data->getMoveInfo(move_name);
-            if (move_info.has_value()) {
-                for (const auto& target_type : all_types) {
-                    double effectiveness = pokemon_data->getTypeEffectiveness(
-                        move_info->type, {target_type}
-                    );
-                    // Keep the best effectiveness for each target type
-                    coverage[target_type] = std::max(coverage[target_type], effectiveness);
-                }
+            const MoveProfile* move = getMoveProfile(move_name);
+            if (move) {
+                super_effective |= TypeMasks::superEffectiveAgainst(move->type_index);
             }
         }
     }
     
+    std::unordered_map<std::string, double> coverage;
+    for (int type = 0; type < TypeMasks::kTypeCount; ++type) {
+        coverage[TypeMasks::typeName(type)] = (super_effective & TypeMasks::bit(type)) ? 2.0 : 1.0;
+    }
     return coverage;
 }
 
@@ -1010,28 +982,15 @@ bool TeamBuilder::isValidTeamName(const std::string& name) const {
 }
 
 std::unordered_set<std::string> TeamBuilder::getWeakTypes(const std::vector<std::string>& pokemon_types) const {
-    // Simplified weakness calculation - in reality this would be more complex
-    std::unordered_set<std::string> weaknesses;
-    
-    for (const auto& type : pokemon_types) {
-        if (type == "fire") {
-            weaknesses.insert("water");
-            weaknesses.insert("ground");
-            weaknesses.insert("rock");
-        } else if (type == "water") {
-            weaknesses.insert("grass");
-            weaknesses.insert("electric");
-        } else if (type == "grass") {
-            weaknesses.insert("fire");
-            weaknesses.insert("ice");
-            weaknesses.insert("poison");
-            weaknesses.insert("flying");
-            weaknesses.insert("bug");
-        }
-        // Add more type relationships as needed
-    }
-    
-    return weaknesses;
+    const auto matchups = TypeMasks::defenseProfile(TypeMasks::fromTypes(pokemon_types));
+    auto weaknesses = TypeMasks::toTypes(matchups.weak);
+    return std::unordered_set<std::string>(weaknesses.begin(), weaknesses.end());
+}
+
+std::unordered_set<std::string> TeamBuilder::getResistantTypes(const std::vector<std::string>& pokemon_types) const {
+    const auto matchups = TypeMasks::defenseProfile(TypeMasks::fromTypes(pokemon_types));
+    auto resistances = TypeMasks::toTypes(matchups.resist | matchups.immune);
+    return std::unordered_set<std::string>(resistances.begin(), resistances.end());
 }
 
 // ========== TEMPLATE SYSTEM IMPLEMENTATION ==========
@@ -1040,6 +999,7 @@ bool TeamBuilder::loadTemplates() {
     try {
         templates.clear();
         templates_loaded = false;
+        buildTemplateIndex();
         
         const std::string template_base_path = "data/team_templates/";
         
@@ -1072,6 +1032,7 @@ bool TeamBuilder::loadTemplates() {
             }
         }
         
+        buildTemplateIndex();
         templates_loaded = true;
         return true;
     } catch (const std::exception& e) {
@@ -1080,6 +1041,55 @@ bool TeamBuilder::loadTemplates() {
     }
 }
 
+void TeamBuilder::buildTemplateIndex() {
+    template_refs.clear();
+    template_search_index.clear();
+    template_names_by_category.clear();
+    templates_by_difficulty.clear();
+    templates_by_strategy.clear();
+    
+    for (const auto& category_pair : templates) {
+        auto& names = template_names_by_category[category_pair.first];
+        for (const auto& template_pair : category_pair.second) {
+            names.push_back(template_pair.first);
+        }
+        std::sort(names.begin(), names.end());
+    }
+    
+    std::vector<std::string> categories;
+    for (const auto& category_pair : template_names_by_category) {
+        categories.push_back(category_pair.first);
+    }
+    std::sort(categories.begin(), categories.end());
+    
+    // Names weigh most, then roles and Pokemon, then free text
+    for (const auto& category : categories) {
+        for (const auto& template_name : template_names_by_category[category]) {
+            const auto& template_data = templates[category][template_name];
+            
+            std::vector<std::pair<std::string, double>> fields = {
+                {template_data.name, 3.0},
+                {template_data.team_name, 2.0},
+                {template_data.description, 1.0},
+                {template_data.strategy, 2.0},
+                {template_data.usage_notes, 1.0}
+            };
+            for (const auto& pokemon : template_data.pokemon) {
+                fields.emplace_back(pokemon.name, 2.0);
+                fields.emplace_back(pokemon.role, 2.0);
+                fields.emplace_back(pokemon.strategy, 1.0);
+            }
+            
+            const size_t id = template_search_index.addDocument(fields);
+            template_refs.push_back({category, template_name, template_data.difficulty, template_data.strategy});
+            templates_by_difficulty[template_data.difficulty].push_back(id);
+            templates_by_strategy[template_data.strategy].push_back(id);
+        }
+    }
+    
+    template_search_index.finalize();
+}
+
 std::vector<std::string> TeamBuilder::getTemplateCategories() const {
     ensureTemplatesLoaded();
     
@@ -1101,15 +1111,11 @@ std::vector<std::string> TeamBuilder::getTemplatesInCategory(const std::string&
         return {};
     }
     
-    std::vector<std::string> template_names;
-    auto category_it = templates.find(category);
-    if (category_it != templates.end()) {
-        for (const auto& template_pair : category_it->second) {
-            template_names.push_back(template_pair.first);
-        }
-        std::sort(template_names.begin(), template_names.end());
+    auto category_it = template_names_by_category.find(category);
+    if (category_it != template_names_by_category.end()) {
+        return category_it->second;
     }
-    return template_names;
+    return {};
 }
 
 std::optional<TeamBuilder::TeamTemplate> TeamBuilder::getTemplate(const std::string& category, 
@@ -1250,33 +1256,41 @@ TeamBuilder::Team TeamBuilder::generateAdvancedRandomTeam(const RandomGeneration
 
 std::vector<std::pair<std::string, std::string>> TeamBuilder::getSuggestedTemplates(
     const std::string& difficulty, const std::string& strategy, int max_suggestions) const {
+    ensureTemplatesLoaded();
     
     std::vector<std::pair<std::string, std::string>> suggestions;
+    if (max_suggestions <= 0) {
+        return suggestions;
+    }
     
-    for (const auto& category_pair : templates) {
-        const auto& category = category_pair.first;
-        
-        for (const auto& template_pair : category_pair.second) {
-            const auto& template_name = template_pair.first;
-            const auto& template_data = template_pair.second;
-            
-            // Filter by difficulty if specified
-            if (!difficulty.empty() && template_data.difficulty != difficulty) {
-                continue;
-            }
-            
-            // Filter by strategy if specified  
-            if (!strategy.empty() && template_data.strategy != strategy) {
-                continue;
-            }
-            
-            suggestions.emplace_back(category, template_name);
-            
-            if (static_cast<int>(suggestions.size()) >= max_suggestions) {
-                break;
-            }
+    // Walk the narrowest pre-built list and check the other preference per entry
+    const std::vector<size_t>* candidates = nullptr;
+    if (!difficulty.empty()) {
+        auto it = templates_by_difficulty.find(difficulty);
+        if (it == templates_by_difficulty.end()) {
+            return suggestions;
+        }
+        candidates = &it->second;
+    }
+    if (!strategy.empty()) {
+        auto it = templates_by_strategy.find(strategy);
+        if (it == templates_by_strategy.end()) {
+            return suggestions;
+        }
+        if (!candidates || it->second.size() < candidates->size()) {
+            candidates = &it->second;
+        }
+    }
+    
+    const size_t candidate_count = candidates ? candidates->size() : template_refs.size();
+    for (size_t i = 0; i < candidate_count; ++i) {
+        const auto& ref = template_refs[candidates ? (*candidates)[i] : i];
+        if ((!difficulty.empty() && ref.difficulty != difficulty) ||
+            (!strategy.empty() && ref.strategy != strategy)) {
+            continue;
         }
         
+        suggestions.emplace_back(ref.category, ref.name);
         if (static_cast<int>(suggestions.size()) >= max_suggestions) {
             break;
         }
@@ -1287,40 +1301,12 @@ std::vector<std::pair<std::string, std::string>> TeamBuilder::getSuggestedTempla
 
 std::vector<std::pair<std::string, std::string>> TeamBuilder::searchTemplates(
     const std::vector<std::string>& keywords) const {
+    ensureTemplatesLoaded();
     
     std::vector<std::pair<std::string, std::string>> results;
-    
-    for (const auto& category_pair : templates) {
-        const auto& category = category_pair.first;
-        
-        for (const auto& template_pair : category_pair.second) {
-            const auto& template_name = template_pair.first;
-            const auto& template_data = template_pair.second;
-            
-            bool matches = false;
-            
-            // Check if any keyword matches template name or description
-            for (const auto& keyword : keywords) {
-                std::string lower_keyword = keyword;
-                std::transform(lower_keyword.begin(), lower_keyword.end(), lower_keyword.begin(), ::tolower);
-                
-                std::string lower_name = template_data.name;
-                std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), ::tolower);
-                
-                std::string lower_desc = template_data.description;
-                std::transform(lower_desc.begin(), lower_desc.end(), lower_desc.begin(), ::tolower);
-                
-                if (lower_name.find(lower_keyword) != std::string::npos ||
-                    lower_desc.find(lower_keyword) != std::string::npos) {
-                    matches = true;
-                    break;
-                }
-            }
-            
-            if (matches) {
-                results.emplace_back(category, template_name);
-            }
-        }
+    for (const auto& hit : template_search_index.search(keywords)) {
+        const auto& ref = template_refs[hit.document];
+        results.emplace_back(ref.category, ref.name);
     }
     
     return results;
@@ -1555,6 +1541,8 @@ TeamBuilder::DraftSession TeamBuilder::createDraftSession(const DraftSettings& s
         );
     }
     
+    buildDraftIndex(session);
+    
     // Store session for management
     active_draft_sessions[session.session_id] = session;
     
@@ -1565,6 +1553,7 @@ bool TeamBuilder::executeDraftBan(DraftSession& session, int player_id, const st
     if (!isDraftActionValid(session, player_id, "ban", pokemon_name)) {
         return false;
     }
+    const bool indexed = isDraftIndexCurrent(session);
     
     // Add to banned list
     session.banned_pokemon.push_back(pokemon_name);
@@ -1575,6 +1564,9 @@ bool TeamBuilder::executeDraftBan(DraftSession& session, int player_id, const st
     if (it != session.available_pokemon.end()) {
         session.available_pokemon.erase(it);
     }
+    if (indexed) {
+        session.candidate_index.remove(session.candidate_index.find(pokemon_name));
+    }
     
     // Record action in history
     DraftSession::DraftAction action;
@@ -1593,6 +1585,7 @@ bool TeamBuilder::executeDraftPick(DraftSession& session, int player_id, const s
     if (!isDraftActionValid(session, player_id, "pick", pokemon_name)) {
         return false;
     }
+    const bool indexed = isDraftIndexCurrent(session);
     
     // Add to player team
     session.player_teams[player_id].push_back(pokemon_name);
@@ -1602,6 +1595,11 @@ bool TeamBuilder::executeDraftPick(DraftSession& session, int player_id, const s
     if (it != session.available_pokemon.end()) {
         session.available_pokemon.erase(it);
     }
+    if (indexed) {
+        const int candidate = session.candidate_index.find(pokemon_name);
+        session.candidate_index.remove(candidate);
+        session.candidate_index.addToTeam(player_id, candidate);
+    }
     
     // Record action in history
     DraftSession::DraftAction action;
@@ -1618,6 +1616,28 @@ bool TeamBuilder::executeDraftPick(DraftSession& session, int player_id, const s
 
 std::vector<std::string> TeamBuilder::getAvailablePicks(const DraftSession& session, int /* player_id */,
                                                        const std::string& filter_by_strategy) const {
+    if (isDraftIndexCurrent(session)) {
+        // Same strategy rules as below, checked against the indexed type masks
+        TypeMask wanted_types = 0;
+        if (filter_by_strategy == "offensive") {
+            wanted_types = TypeMasks::fromTypes({"fire", "dragon", "fighting"});
+        } else if (filter_by_strategy == "utility") {
+            wanted_types = TypeMasks::fromTypes({"psychic", "grass"});
+        }
+        const bool defensive = filter_by_strategy == "defensive";
+        
+        std::vector<std::string> picks;
+        for (int id : session.candidate_index.getAvailable()) {
+            const auto& candidate = session.candidate_index.getCandidate(id);
+            if (filter_by_strategy.empty() || (candidate.types & wanted_types) ||
+                (defensive && (candidate.name == "snorlax" || candidate.name == "chansey" ||
+                               candidate.name == "cloyster"))) {
+                picks.push_back(candidate.name);
+            }
+        }
+        return picks;
+    }
+    
     std::vector<std::string> available = session.available_pokemon;
     
     if (filter_by_strategy.empty()) {
@@ -1666,6 +1686,9 @@ std::vector<std::pair<std::string, std::string>> TeamBuilder::getDraftSuggestion
     if (session.current_player >= static_cast<int>(session.player_teams.size())) {
         return suggestions;
     }
+    if (isDraftIndexCurrent(session)) {
+        return getIndexedDraftSuggestions(session, suggestion_count);
+    }
     
     auto current_team = session.player_teams[session.current_player];
     auto available = session.available_pokemon;
@@ -1890,12 +1913,19 @@ std::string TeamBuilder::exportTeamShareCode(const Team& team, const std::string
     share_code.description = InputValidator::sanitizeString(description);
     share_code.format_version = "1.0";
     
+    std::string code;
+    if (getShareCodec().encode(share_code, code)) {
+        return code;
+    }
     return encodeTeamToBase64(share_code);
 }
 
 TeamBuilder::Team TeamBuilder::importTeamFromShareCode(const std::string& share_code, bool validate_team) {
     try {
-        TeamShareCode decoded = decodeTeamFromBase64(share_code);
+        TeamShareCode decoded;
+        if (!getShareCodec().decode(share_code, decoded)) {
+            decoded = decodeTeamFromBase64(share_code);
+        }
         
         Team team = const_cast<TeamBuilder*>(this)->createTeam(decoded.team_name);
         
@@ -2045,6 +2075,36 @@ TeamBuilder::TeamComparison TeamBuilder::compareTeams(const Team& team1, const T
     return comparison;
 }
 
+TeamBuilder::TeamComparison TeamBuilder::compareTeams(const Team& team1, const Team& team2,
+                                                      const ComparisonSettings& settings,
+                                                      const ComparisonProgressCallback& progress) const {
+    TeamComparison comparison = compareTeams(team1, team2);
+    comparison.simulation = TeamMatchupSimulator::run(team1, team2, settings, progress);
+    
+    const SimulatedRecord& overall = comparison.simulation.overall;
+    if (!comparison.simulation.performed || overall.battles == 0) {
+        return comparison;
+    }
+    
+    comparison.team1_win_probability = overall.team1_win_rate;
+    
+    std::stringstream reasoning;
+    reasoning << std::fixed << std::setprecision(0);
+    if (overall.confidence_low > 0.5) {
+        reasoning << team1.name << " is favoured: ";
+    } else if (overall.confidence_high < 0.5) {
+        reasoning << team2.name << " is favoured: ";
+    } else {
+        reasoning << "Too close to call: ";
+    }
+    reasoning << team1.name << " won " << overall.team1_win_rate * 100 << "% of " << overall.battles
+              << " simulated battles (95% CI " << overall.confidence_low * 100 << "-"
+              << overall.confidence_high * 100 << "%)";
+    comparison.battle_prediction_reasoning = reasoning.str();
+    
+    return comparison;
+}
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // Battle History and Statistics Implementation
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -2052,7 +2112,7 @@ TeamBuilder::TeamComparison TeamBuilder::compareTeams(const Team& team1, const T
 void TeamBuilder::recordBattleResult(const std::string& team_name, const std::string& opponent_name,
                                      bool victory, int turns_taken, const std::string& difficulty,
                                      double effectiveness_score) {
-    // Load existing battle history
+    // Open the history log on first use
     loadBattleHistory();
     
     // Create battle record
@@ -2065,60 +2125,68 @@ void TeamBuilder::recordBattleResult(const std::string& team_name, const std::st
     record.difficulty_level = difficulty;
     record.team_effectiveness_score = std::max(0.0, std::min(100.0, effectiveness_score));
     
-    // Add to history
-    battle_history[record.team_name].push_back(record);
-    
-    // Update statistics
-    updateTeamStatistics(record.team_name);
+    // Append to the log; statistics are updated incrementally
+    if (!history_log->append(record)) {
+        return;
+    }
     
-    // Save to file
-    saveBattleHistory();
+    // Ratings move in batched periods, persisted whenever one closes
+    const std::string& rated_opponent = record.opponent_team.empty() ? record.difficulty_level : record.opponent_team;
+    const bool period_closed = !record.team_name.empty() && !rated_opponent.empty() &&
+        rating_engine->addResult(record.team_name, rated_opponent, victory ? 1.0 : 0.0);
+    rating_engine->setSourceWatermark(history_log->getRecordCount());
+    if (period_closed) {
+        refreshRatingLeaderboard();
+        saveTeamRatings();
+    }
 }
 
 std::optional<TeamBuilder::TeamStatistics> TeamBuilder::getTeamStatistics(const std::string& team_name) const {
     loadBattleHistory();
-    
-    auto it = team_statistics.find(team_name);
-    if (it != team_statistics.end()) {
-        return it->second;
+    auto stats = history_log->getStatistics(team_name);
+    if (stats) {
+        const auto rating = rating_engine->getRating(team_name);
+        if (rating) {
+            stats->rating = rating->rating;
+            stats->rating_deviation = rating->deviation;
+            stats->rating_volatility = rating->volatility;
+        }
     }
-    
-    return std::nullopt;
+    return stats;
+}
+
+std::vector<std::pair<std::string, double>> TeamBuilder::getTeamRatingLeaderboard(int max_results) const {
+    loadBattleHistory();
+    return rating_leaderboard.top(max_results);
+}
+
+void TeamBuilder::closeTeamRatingPeriod() {
+    loadBattleHistory();
+    if (rating_engine->getPendingGameCount() == 0) {
+        return;
+    }
+    rating_engine->closeRatingPeriod();
+    refreshRatingLeaderboard();
+    saveTeamRatings();
 }
 
 std::vector<TeamBuilder::BattleRecord> TeamBuilder::getTeamBattleHistory(const std::string& team_name, 
                                                                         int max_records) const {
     loadBattleHistory();
-    
-    auto it = battle_history.find(team_name);
-    if (it == battle_history.end()) {
-        return {};
-    }
-    
-    const auto& records = it->second;
-    if (max_records <= 0 || static_cast<int>(records.size()) <= max_records) {
-        return records;
-    }
-    
-    // Return most recent records
-    auto start_it = records.end() - max_records;
-    return std::vector<BattleRecord>(start_it, records.end());
+    return history_log->getRecords(team_name, max_records > 0 ? static_cast<size_t>(max_records) : 0);
 }
 
 bool TeamBuilder::clearTeamBattleHistory(const std::string& team_name) {
     loadBattleHistory();
-    
-    auto history_it = battle_history.find(team_name);
-    if (history_it != battle_history.end()) {
-        battle_history.erase(history_it);
-    }
-    
-    auto stats_it = team_statistics.find(team_name);
-    if (stats_it != team_statistics.end()) {
-        team_statistics.erase(stats_it);
+    if (!history_log->clearTeam(team_name)) {
+        return false;
     }
     
-    saveBattleHistory();
+    // Ratings are path dependent, so re-derive them without the cleared battles
+    rating_engine.reset();
+    std::error_code ec;
+    std::filesystem::remove(getTeamRatingsFilePath(), ec);
+    loadTeamRatings();
     return true;
 }
 
@@ -2151,6 +2219,10 @@ TeamBuilder::Team TeamBuilder::generateMetaOptimizedTeam(const RandomGenerationS
         }
     }
     
+    if (settings.simulate_battles) {
+        return generateSimulationOptimizedTeam(settings, selected_pokemon);
+    }
+    
     // Fill remaining slots with balanced selection
     auto all_pokemon = pokemon_data->getAvailablePokemon();
     std::random_device rd;
@@ -2199,10 +2271,98 @@ TeamBuilder::Team TeamBuilder::generateMetaOptimizedTeam(const RandomGenerationS
     return team;
 }
 
+TeamBuilder::Team TeamBuilder::generateSimulationOptimizedTeam(const RandomGenerationSettings& settings,
+                                                               const std::vector<std::string>& seed_pokemon) const {
+    TeamOptimizer::Settings optimizer_settings;
+    optimizer_settings.team_size = std::max(1, std::min(settings.team_size, 6));
+    optimizer_settings.evaluation_budget = settings.evaluation_budget;
+    optimizer_settings.seed = settings.seed;
+    TeamOptimizer optimizer(pokemon_data, optimizer_settings);
+    
+    // Same species constraints as the heuristic path
+    std::vector<std::string> species_pool;
+    for (const auto& pokemon : pokemon_data->getAvailablePokemon()) {
+        if (!settings.allow_legendaries && isPokemonLegendary(pokemon)) {
+            continue;
+        }
+        auto types = getCachedPokemonTypes(pokemon);
+        bool is_banned_type = std::any_of(types.begin(), types.end(), [&](const std::string& type) {
+            return std::find(settings.banned_types.begin(), settings.banned_types.end(), type) != settings.banned_types.end();
+        });
+        if (!is_banned_type) {
+            species_pool.push_back(pokemon);
+        }
+    }
+    optimizer.setSpeciesPool(species_pool);
+    
+    // The meta-tier picks start out as one member of the first generation
+    if (!seed_pokemon.empty()) {
+        std::vector<TeamPokemon> seed_team;
+        for (const auto& pokemon : seed_pokemon) {
+            seed_team.emplace_back(pokemon, pokemon_data->suggestMovesForPokemon(pokemon, 4));
+        }
+        optimizer.addSeedTeam(seed_team);
+    }
+    
+    for (const auto& opponent : settings.gauntlet) {
+        optimizer.addGauntletTeam(opponent);
+    }
+    if (optimizer.getGauntletSize() == 0) {
+        // Default gauntlet: S, A and B tier Pokemon split into full teams
+        std::vector<std::string> meta_pokemon;
+        for (const auto& tier : {"S", "A", "B"}) {
+            auto tier_pokemon = getMetaTierPokemon(tier);
+            meta_pokemon.insert(meta_pokemon.end(), tier_pokemon.begin(), tier_pokemon.end());
+        }
+        
+        const size_t team_size = static_cast<size_t>(optimizer_settings.team_size);
+        for (size_t start = 0; start < meta_pokemon.size(); start += team_size) {
+            if (start > 0 && start + team_size > meta_pokemon.size()) {
+                break;  // Leftovers would make an undersized team
+            }
+            Team opponent("Meta Gauntlet " + std::to_string(start / team_size + 1));
+            for (size_t i = start; i < std::min(start + team_size, meta_pokemon.size()); ++i) {
+                opponent.pokemon.emplace_back(meta_pokemon[i], pokemon_data->suggestMovesForPokemon(meta_pokemon[i], 4));
+            }
+            optimizer.addGauntletTeam(opponent);
+        }
+    }
+    
+    std::string team_name = "Meta-Optimized Team";
+    auto result = optimizer.optimize(team_name);
+    
+    Team team = const_cast<TeamBuilder*>(this)->createTeam(team_name);
+    for (const auto& pokemon : result.team.pokemon) {
+        const_cast<TeamBuilder*>(this)->addPokemonToTeam(team, pokemon.name, pokemon.moves);
+    }
+    return team;
+}
+
 TeamBuilder::Team TeamBuilder::generateCounterTeam(const Team& target_team, const std::string& team_name,
                                                    double strictness) const {
     Team counter_team = const_cast<TeamBuilder*>(this)->createTeam(team_name);
     
+    // Prefer picks backed by simulated 1v1 results when the matrix has been built
+    if (!win_matrix_loaded) {
+        loadSpeciesWinMatrix(SpeciesWinMatrix::defaultPath());
+    }
+    if (win_matrix) {
+        std::vector<std::string> targets;
+        for (const auto& pokemon : target_team.pokemon) {
+            targets.push_back(pokemon.name);
+        }
+        auto picks = win_matrix->selectCounters(targets, 6, strictness, [this](const std::string& pokemon) {
+            return pokemon_data->hasPokemon(pokemon);
+        });
+        for (const auto& pokemon : picks) {
+            auto moves = generateMovesForPokemon(pokemon);
+            const_cast<TeamBuilder*>(this)->addPokemonToTeam(counter_team, pokemon, moves);
+        }
+        if (!counter_team.pokemon.empty()) {
+            return counter_team;
+        }
+    }
+    
     // Analyze target team weaknesses
     std::vector<std::string> target_weaknesses;
     for (const auto& pokemon : target_team.pokemon) {
@@ -2268,6 +2428,16 @@ TeamBuilder::Team TeamBuilder::generateCounterTeam(const Team& target_team, cons
     return counter_team;
 }
 
+bool TeamBuilder::loadSpeciesWinMatrix(const std::string& file_path) const {
+    win_matrix_loaded = true;
+    auto matrix = std::make_shared<SpeciesWinMatrix>();
+    if (!matrix->load(file_path) || matrix->empty()) {
+        return false;
+    }
+    win_matrix = matrix;
+    return true;
+}
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // Helper Methods Implementation
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -2292,14 +2462,28 @@ bool TeamBuilder::isDraftActionValid(const DraftSession& session, int player_id,
     // Check if Pokemon exists and is available
     if (!pokemon_data->hasPokemon(pokemon_name)) return false;
     
+    const bool indexed = isDraftIndexCurrent(session);
+    const int candidate = indexed ? session.candidate_index.find(pokemon_name) : -1;
+    auto is_available = [&]() {
+        if (indexed) {
+            return candidate >= 0 && session.candidate_index.isAvailable(candidate);
+        }
+        return std::find(session.available_pokemon.begin(), session.available_pokemon.end(), pokemon_name) 
+            != session.available_pokemon.end();
+    };
+    
     if (action_type == "pick") {
         // Check if Pokemon is available for picking
-        if (std::find(session.available_pokemon.begin(), session.available_pokemon.end(), pokemon_name) 
-            == session.available_pokemon.end()) {
+        if (!is_available()) {
             return false;
         }
         
         // Check if adding this Pokemon would exceed limits
+        if (indexed) {
+            const DraftCandidateIndex::Limits limits(session.settings.max_legendaries_per_team,
+                                                     session.settings.max_same_type_per_team);
+            return session.candidate_index.canPick(player_id, candidate, limits);
+        }
         if (exceedsLegendaryLimit(session, player_id, pokemon_name)) return false;
         if (exceedsTypeLimit(session, player_id, pokemon_name)) return false;
         
@@ -2308,8 +2492,7 @@ bool TeamBuilder::isDraftActionValid(const DraftSession& session, int player_id,
         if (session.current_phase != 0) return false;
         
         // Check if Pokemon is available for banning
-        if (std::find(session.available_pokemon.begin(), session.available_pokemon.end(), pokemon_name) 
-            == session.available_pokemon.end()) {
+        if (!is_available()) {
             return false;
         }
     }
@@ -2387,6 +2570,99 @@ bool TeamBuilder::exceedsLegendaryLimit(const DraftSession& session, int player_
     return legendary_count >= session.settings.max_legendaries_per_team;
 }
 
+void TeamBuilder::buildDraftIndex(DraftSession& session) const {
+    const auto legendary_list = getLegendaryPokemon();
+    const std::unordered_set<std::string> legendaries(legendary_list.begin(), legendary_list.end());
+    
+    // Rank by mean simulated win rate when asked to and a matrix exists, otherwise by base stats
+    if (session.settings.rank_by_win_rate && !win_matrix_loaded) {
+        loadSpeciesWinMatrix(SpeciesWinMatrix::defaultPath());
+    }
+    const SpeciesWinMatrix* matrix = session.settings.rank_by_win_rate ? win_matrix.get() : nullptr;
+    
+    std::vector<DraftCandidateIndex::Candidate> candidates;
+    candidates.reserve(session.available_pokemon.size());
+    for (const auto& pokemon_name : session.available_pokemon) {
+        const SpeciesProfile* profile = getSpeciesProfile(pokemon_name);
+        double strength = profile ? profile->base_stat_total / 600.0 : 0.0;
+        if (matrix) {
+            strength = 0.5;
+            if (auto row = matrix->findSpecies(pokemon_name)) {
+                double total = 0.0;
+                for (size_t opponent = 0; opponent < matrix->size(); ++opponent) {
+                    total += matrix->getWinProbability(*row, opponent);
+                }
+                strength = total / matrix->size();
+            }
+        }
+        candidates.emplace_back(pokemon_name, profile ? profile->types : 0,
+                                legendaries.count(pokemon_name) > 0, strength);
+    }
+    
+    session.candidate_index.build(std::move(candidates), static_cast<int>(session.player_teams.size()));
+}
+
+bool TeamBuilder::isDraftIndexCurrent(const DraftSession& session) const {
+    return session.candidate_index.isBuilt() &&
+           session.candidate_index.availableCount() == session.available_pokemon.size();
+}
+
+std::vector<std::pair<std::string, std::string>> TeamBuilder::getIndexedDraftSuggestions(
+    const DraftSession& session, int suggestion_count) const {
+    constexpr double kCoverageWeight = 0.2;    // Per type new to the team; strengths span about 0.3-1.1
+    
+    const auto& index = session.candidate_index;
+    const int player = session.current_player;
+    const DraftCandidateIndex::Limits limits(session.settings.max_legendaries_per_team,
+                                             session.settings.max_same_type_per_team);
+    
+    // Re-rank by how well each candidate does against what the opponents already hold
+    std::vector<std::string> opponent_picks;
+    DraftCandidateIndex::BonusFunction matchup_bonus;
+    if (session.settings.rank_by_win_rate && win_matrix) {
+        for (size_t other = 0; other < session.player_teams.size(); ++other) {
+            if (static_cast<int>(other) != player) {
+                opponent_picks.insert(opponent_picks.end(), session.player_teams[other].begin(),
+                                      session.player_teams[other].end());
+            }
+        }
+        if (!opponent_picks.empty()) {
+            matchup_bonus = [&](int candidate) {
+                double total = 0.0;
+                for (const auto& opponent : opponent_picks) {
+                    total += win_matrix->getWinProbability(index.getCandidate(candidate).name, opponent).value_or(0.5);
+                }
+                return total / opponent_picks.size();
+            };
+        }
+    }
+    
+    std::vector<std::pair<std::string, std::string>> suggestions;
+    const TypeMask team_types = index.getTeamTypes(player);
+    for (const auto& ranked : index.suggest(player, static_cast<size_t>(std::max(0, suggestion_count)),
+                                            limits, kCoverageWeight, matchup_bonus, 1.0)) {
+        const auto& candidate = index.getCandidate(ranked.first);
+        std::string reasoning;
+        
+        const TypeMask new_types = candidate.types & ~team_types;
+        for (const auto& type : getCachedPokemonTypes(candidate.name)) {
+            if (new_types & TypeMasks::bit(TypeMasks::typeIndex(type))) {
+                reasoning = "Adds " + type + " type coverage";
+                break;
+            }
+        }
+        if (candidate.legendary) {
+            reasoning += reasoning.empty() ? "Legendary - high power" : " (Legendary - high power)";
+        }
+        if (reasoning.empty()) {
+            reasoning = "Meta pick - strong overall Pokemon";
+        }
+        suggestions.emplace_back(candidate.name, reasoning);
+    }
+    
+    return suggestions;
+}
+
 std::string TeamBuilder::getCurrentTimestamp() const {
     auto now = std::chrono::system_clock::now();
     auto time_t = std::chrono::system_clock::to_time_t(now);
@@ -2414,74 +2690,20 @@ std::string TeamBuilder::encodeTeamToBase64(const TeamShareCode& share_code) con
     }
     
     std::string json_str = j.dump();
-    
-    // Simple base64 encoding (for demonstration - in production, use a proper base64 library)
-    std::string encoded;
-    const std::string chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-    
-    for (size_t i = 0; i < json_str.length(); i += 3) {
-        unsigned char b1 = json_str[i];
-        unsigned char b2 = (i + 1 < json_str.length()) ? json_str[i + 1] : 0;
-        unsigned char b3 = (i + 2 < json_str.length()) ? json_str[i + 2] : 0;
-        
-        encoded += chars[b1 >> 2];
-        encoded += chars[((b1 & 0x03) << 4) | ((b2 & 0xf0) >> 4)];
-        encoded += (i + 1 < json_str.length()) ? chars[((b2 & 0x0f) << 2) | ((b3 & 0xc0) >> 6)] : '=';
-        encoded += (i + 2 < json_str.length()) ? chars[b3 & 0x3f] : '=';
-    }
-    
-    return encoded;
+    return Base64::encode(reinterpret_cast<const uint8_t*>(json_str.data()), json_str.size());
 }
 
 TeamBuilder::TeamShareCode TeamBuilder::decodeTeamFromBase64(const std::string& base64_data) const {
     TeamShareCode share_code;
     
     try {
-        // Simple base64 decoding (for demonstration)
-        std::string decoded;
-        const std::string chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-        
-        for (size_t i = 0; i < base64_data.length(); i += 4) {
-            // Safe bounds checking for base64 characters
-            if (i + 3 >= base64_data.length()) break;
-            
-            auto pos1 = chars.find(base64_data[i]);
-            auto pos2 = chars.find(base64_data[i + 1]);
-            if (pos1 == std::string::npos || pos2 == std::string::npos) {
-                throw std::invalid_argument("Invalid base64 character");
-            }
-            
-            unsigned char c1 = static_cast<unsigned char>(pos1);
-            unsigned char c2 = static_cast<unsigned char>(pos2);
-            unsigned char c3 = 0, c4 = 0;
-            
-            if (base64_data[i + 2] != '=') {
-                auto pos3 = chars.find(base64_data[i + 2]);
-                if (pos3 == std::string::npos) {
-                    throw std::invalid_argument("Invalid base64 character");
-                }
-                c3 = static_cast<unsigned char>(pos3);
-            }
-            
-            if (base64_data[i + 3] != '=') {
-                auto pos4 = chars.find(base64_data[i + 3]);
-                if (pos4 == std::string::npos) {
-                    throw std::invalid_argument("Invalid base64 character");
-                }
-                c4 = static_cast<unsigned char>(pos4);
-            }
-            
-            decoded += static_cast<char>((c1 << 2) | (c2 >> 4));
-            if (base64_data[i + 2] != '=') {
-                decoded += static_cast<char>((c2 << 4) | (c3 >> 2));
-            }
-            if (base64_data[i + 3] != '=') {
-                decoded += static_cast<char>((c3 << 6) | c4);
-            }
+        std::vector<uint8_t> bytes;
+        if (!Base64::decode(base64_data, bytes)) {
+            throw std::invalid_argument("Invalid base64 share code");
         }
         
         // Parse JSON
-        json j = json::parse(decoded);
+        json j = json::parse(bytes.begin(), bytes.end());
         
         share_code.team_name = j["team_name"];
         share_code.creator_name = j["creator_name"];
@@ -2503,6 +2725,13 @@ TeamBuilder::TeamShareCode TeamBuilder::decodeTeamFromBase64(const std::string&
     return share_code;
 }
 
+const TeamShareCodec& TeamBuilder::getShareCodec() const {
+    if (!share_codec) {
+        share_codec = std::make_shared<TeamShareCodec>(*pokemon_data);
+    }
+    return *share_codec;
+}
+
 std::string TeamBuilder::getCustomTeamsDirectory() const {
     return "data/teams/custom";
 }
@@ -2638,146 +2867,76 @@ double TeamBuilder::predictBattleOutcome(const Team& team1, const Team& team2) c
 
 // Battle history helper methods
 void TeamBuilder::loadBattleHistory() const {
-    try {
-        std::string history_file = getBattleHistoryFilePath();
-        if (!std::filesystem::exists(history_file)) {
-            return;
-        }
-        
-        std::ifstream file(history_file);
-        if (!file.is_open()) {
-            return;
-        }
-        
-        json j;
-        file >> j;
-        
-        battle_history.clear();
-        team_statistics.clear();
-        
-        if (j.contains("battle_history")) {
-            for (const auto& [team_name, records] : j["battle_history"].items()) {
-                std::vector<BattleRecord> team_records;
-                for (const auto& record_json : records) {
-                    BattleRecord record;
-                    record.team_name = record_json["team_name"];
-                    record.opponent_team = record_json["opponent_team"];
-                    record.battle_date = record_json["battle_date"];
-                    record.victory = record_json["victory"];
-                    record.turns_taken = record_json["turns_taken"];
-                    record.difficulty_level = record_json["difficulty_level"];
-                    record.team_effectiveness_score = record_json["team_effectiveness_score"];
-                    team_records.push_back(record);
-                }
-                battle_history[team_name] = team_records;
-            }
-        }
-        
-        if (j.contains("team_statistics")) {
-            for (const auto& [team_name, stats_json] : j["team_statistics"].items()) {
-                TeamStatistics stats;
-                stats.team_name = stats_json["team_name"];
-                stats.total_battles = stats_json["total_battles"];
-                stats.victories = stats_json["victories"];
-                stats.defeats = stats_json["defeats"];
-                stats.win_rate = stats_json["win_rate"];
-                stats.average_battle_length = stats_json["average_battle_length"];
-                stats.average_effectiveness_score = stats_json["average_effectiveness_score"];
-                team_statistics[team_name] = stats;
-            }
-        }
-    } catch (const std::exception& e) {
-        // Ignore errors in loading
+    if (!history_log || !history_log->isOpen()) {
+        history_log = std::make_shared<BattleHistoryLog>(getBattleHistoryFilePath(), getTeamStatisticsFilePath());
+        history_log->open(getLegacyBattleHistoryFilePath());
+    }
+    
+    if (!rating_engine) {
+        loadTeamRatings();
     }
 }
 
 void TeamBuilder::saveBattleHistory() const {
-    try {
-        json j;
-        
-        // Save battle history
-        j["battle_history"] = json::object();
-        for (const auto& [team_name, records] : battle_history) {
-            j["battle_history"][team_name] = json::array();
-            for (const auto& record : records) {
-                json record_json;
-                record_json["team_name"] = record.team_name;
-                record_json["opponent_team"] = record.opponent_team;
-                record_json["battle_date"] = record.battle_date;
-                record_json["victory"] = record.victory;
-                record_json["turns_taken"] = record.turns_taken;
-                record_json["difficulty_level"] = record.difficulty_level;
-                record_json["team_effectiveness_score"] = record.team_effectiveness_score;
-                j["battle_history"][team_name].push_back(record_json);
-            }
-        }
-        
-        // Save team statistics
-        j["team_statistics"] = json::object();
-        for (const auto& [team_name, stats] : team_statistics) {
-            json stats_json;
-            stats_json["team_name"] = stats.team_name;
-            stats_json["total_battles"] = stats.total_battles;
-            stats_json["victories"] = stats.victories;
-            stats_json["defeats"] = stats.defeats;
-            stats_json["win_rate"] = stats.win_rate;
-            stats_json["average_battle_length"] = stats.average_battle_length;
-            stats_json["average_effectiveness_score"] = stats.average_effectiveness_score;
-            j["team_statistics"][team_name] = stats_json;
-        }
-        
-        std::string history_file = getBattleHistoryFilePath();
-        std::ofstream file(history_file);
-        if (file.is_open()) {
-            file << j.dump(2);
-        }
-    } catch (const std::exception& e) {
-        // Ignore save errors
+    // Records are persisted as they are appended; a snapshot just speeds up the next open
+    if (history_log && history_log->isOpen()) {
+        history_log->writeSnapshot();
     }
+    saveTeamRatings();
 }
 
-void TeamBuilder::updateTeamStatistics(const std::string& team_name) const {
-    auto it = battle_history.find(team_name);
-    if (it == battle_history.end()) {
-        return;
-    }
-    
-    const auto& records = it->second;
-    TeamStatistics stats;
-    stats.team_name = team_name;
-    stats.total_battles = static_cast<int>(records.size());
-    stats.victories = 0;
-    stats.defeats = 0;
-    
-    double total_turns = 0.0;
-    double total_effectiveness = 0.0;
+void TeamBuilder::loadTeamRatings() const {
+    RatingEngine::Settings settings;
+    settings.games_per_period = kRatingPeriodBattles;
+    rating_engine = std::make_shared<RatingEngine>(settings);
     
-    for (const auto& record : records) {
-        if (record.victory) {
-            stats.victories++;
-        } else {
-            stats.defeats++;
-        }
-        total_turns += record.turns_taken;
-        total_effectiveness += record.team_effectiveness_score;
+    // Saved ratings cover the first `watermark` live records; rate only what came after.
+    // A watermark past the end means battles were cleared since, so start over.
+    const uint64_t record_count = history_log->getRecordCount();
+    if (!rating_engine->load(getTeamRatingsFilePath()) ||
+        rating_engine->getSourceWatermark() > record_count) {
+        rating_engine->clear();
     }
     
-    stats.win_rate = stats.total_battles > 0 ? 
-        (static_cast<double>(stats.victories) / stats.total_battles) * 100.0 : 0.0;
-    stats.average_battle_length = stats.total_battles > 0 ? 
-        total_turns / stats.total_battles : 0.0;
-    stats.average_effectiveness_score = stats.total_battles > 0 ? 
-        total_effectiveness / stats.total_battles : 0.0;
+    const uint64_t already_rated = rating_engine->getSourceWatermark();
+    if (already_rated < record_count) {
+        rating_engine->ingestBattleHistory(*history_log, already_rated);
+        rating_engine->setSourceWatermark(record_count);
+        saveTeamRatings();
+    }
     
-    team_statistics[team_name] = stats;
+    rating_leaderboard.clear();
+    refreshRatingLeaderboard();
+}
+
+void TeamBuilder::saveTeamRatings() const {
+    if (rating_engine) {
+        rating_engine->save(getTeamRatingsFilePath());
+    }
+}
+
+void TeamBuilder::refreshRatingLeaderboard() const {
+    // Every entity's deviation moves when a period closes, so the whole index is refreshed
+    for (uint32_t id = 0; id < rating_engine->getEntityCount(); ++id) {
+        rating_leaderboard.update(rating_engine->getEntityName(id),
+                                  RatingEngine::conservativeRating(rating_engine->getRating(id)));
+    }
 }
 
 std::string TeamBuilder::getBattleHistoryFilePath() const {
-    return "data/teams/battle_history.json";
+    return "data/teams/battle_history.log";
 }
 
 std::string TeamBuilder::getTeamStatisticsFilePath() const {
-    return "data/teams/team_statistics.json";
+    return "data/teams/team_statistics.snapshot";
+}
+
+std::string TeamBuilder::getLegacyBattleHistoryFilePath() const {
+    return "data/teams/battle_history.json";
+}
+
+std::string TeamBuilder::getTeamRatingsFilePath() const {
+    return "data/teams/team_ratings.bin";
 }
 
 // Performance optimization helper methods
@@ -2792,6 +2951,62 @@ void TeamBuilder::preloadPokemonData() const {
 void TeamBuilder::clearPerformanceCaches() const {
     pokemon_type_cache.clear();
     pokemon_moves_cache.clear();
+    species_profiles.clear();
+    species_profile_index.clear();
+    move_profiles.clear();
+}
+
+void TeamBuilder::buildSpeciesProfiles() const {
+    if (!species_profiles.empty()) {
+        return;
+    }
+    
+    auto all_pokemon = pokemon_data->getAvailablePokemon();
+    species_profiles.reserve(all_pokemon.size());
+    for (const auto& pokemon_name : all_pokemon) {
+        auto pokemon_info = pokemon_data->getPokemonInfo(pokemon_name);
+        if (!pokemon_info) {
+            continue;
+        }
+        
+        SpeciesProfile profile;
+        profile.name = pokemon_name;
+        profile.types = TypeMasks::fromTypes(pokemon_info->types);
+        profile.matchups = TypeMasks::defenseProfile(profile.types);
+        profile.stats = {pokemon_info->hp, pokemon_info->attack, pokemon_info->defense,
+                         pokemon_info->special_attack, pokemon_info->special_defense, pokemon_info->speed};
+        profile.base_stat_total = 0;
+        for (int stat : profile.stats) {
+            profile.base_stat_total += stat;
+        }
+        
+        species_profile_index[pokemon_name] = species_profiles.size();
+        species_profiles.push_back(std::move(profile));
+    }
+}
+
+const TeamBuilder::SpeciesProfile* TeamBuilder::getSpeciesProfile(const std::string& pokemon_name) const {
+    buildSpeciesProfiles();
+    auto it = species_profile_index.find(pokemon_name);
+    return it != species_profile_index.end() ? &species_profiles[it->second] : nullptr;
+}
+
+const TeamBuilder::MoveProfile* TeamBuilder::getMoveProfile(const std::string& move_name) const {
+    auto it = move_profiles.find(move_name);
+    if (it != move_profiles.end()) {
+        return &it->second;
+    }
+    
+    auto move_info = pokemon_data->getMoveInfo(move_name);
+    if (!move_info) {
+        return nullptr;
+    }
+    
+    MoveProfile profile;
+    profile.type_index = TypeMasks::typeIndex(move_info->type);
+    profile.physical = move_info->damage_class == "physical";
+    profile.special = move_info->damage_class == "special";
+    return &move_profiles.emplace(move_name, profile).first->second;
 }
 
 std::vector<std::string> TeamBuilder::getCachedPokemonTypes(const std::string& pokemon_name) const {
@@ -0,0 +1,294 @@
+#include "team_matchup_simulator.h"
+#include "battle_team_factory.h"
+#include "resettable_battle_team.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <thread>
+
+namespace {
+
+constexpr int kRoundBattles = 16;       // Battles per AI level in each round after the first
+constexpr double kZ95 = 1.959963984540054;
+
+uint64_t splitMix64(uint64_t value) {
+    value += 0x9E3779B97F4A7C15ull;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+struct BattleJob {
+    size_t level;       // Index into the AI levels being played
+    int battle;         // Battle number at that level
+};
+
+struct LevelState {
+    AIDifficulty difficulty;
+    uint64_t seed_index;            // Position in ComparisonSettings::difficulties
+    bool done;
+    double score;                   // Team 1 wins plus half the draws
+    long long total_turns;
+    TeamBuilder::SimulatedRecord record;
+};
+
+// Builds a team and records which member each battle slot came from
+Team loadTeam(const TeamBuilder::Team& team, std::vector<size_t>& member_of_slot) {
+    BattleTeamFactory& factory = BattleTeamFactory::shared();
+    member_of_slot.clear();
+    for (size_t member = 0; member < team.pokemon.size(); ++member) {
+        if (factory.resolveSpecies(team.pokemon[member].name) != BattleTeamFactory::kUnresolved) {
+            member_of_slot.push_back(member);
+        }
+    }
+    return factory.build(team);
+}
+
+std::vector<TeamBuilder::SimulatedMemberStats> memberStats(const TeamBuilder::Team& team) {
+    std::vector<TeamBuilder::SimulatedMemberStats> stats(team.pokemon.size());
+    for (size_t member = 0; member < team.pokemon.size(); ++member) {
+        stats[member].name = team.pokemon[member].name;
+    }
+    return stats;
+}
+
+void recordSide(const std::array<int, 6>& knockouts, const std::array<bool, 6>& fainted, bool won,
+                const std::vector<size_t>& member_of_slot, std::vector<TeamBuilder::SimulatedMemberStats>& stats) {
+    const size_t slots = std::min(member_of_slot.size(), knockouts.size());
+    size_t mvp = slots;
+    for (size_t slot = 0; slot < slots; ++slot) {
+        auto& member = stats[member_of_slot[slot]];
+        member.knockouts += knockouts[slot];
+        member.faints += fainted[slot] ? 1 : 0;
+        if (knockouts[slot] > 0 && (mvp == slots || knockouts[slot] > knockouts[mvp])) {
+            mvp = slot;
+        }
+    }
+    if (won && mvp < slots) {
+        stats[member_of_slot[mvp]].mvp_awards++;
+    }
+}
+
+void finishRecord(TeamBuilder::SimulatedRecord& record, double score, long long total_turns) {
+    record.team1_win_rate = record.battles > 0 ? score / record.battles : 0.0;
+    record.average_turns = record.battles > 0 ? static_cast<double>(total_turns) / record.battles : 0.0;
+    TeamMatchupSimulator::wilsonInterval(score, record.battles, record.confidence_low, record.confidence_high);
+}
+
+} // namespace
+
+Team TeamMatchupSimulator::buildBattleTeam(const TeamBuilder::Team& team) {
+    return BattleTeamFactory::shared().build(team);
+}
+
+std::optional<AIDifficulty> TeamMatchupSimulator::parseDifficulty(const std::string& difficulty) {
+    std::string name = difficulty;
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+    if (name == "easy") return AIDifficulty::EASY;
+    if (name == "medium") return AIDifficulty::MEDIUM;
+    if (name == "hard") return AIDifficulty::HARD;
+    if (name == "expert") return AIDifficulty::EXPERT;
+    return std::nullopt;
+}
+
+void TeamMatchupSimulator::wilsonInterval(double score, int battles, double& low, double& high) {
+    if (battles <= 0) {
+        low = 0.0;
+        high = 1.0;
+        return;
+    }
+    const double n = battles;
+    const double p = std::clamp(score / n, 0.0, 1.0);
+    const double z2 = kZ95 * kZ95;
+    const double denominator = 1.0 + z2 / n;
+    const double center = (p + z2 / (2.0 * n)) / denominator;
+    const double half_width = kZ95 * std::sqrt(p * (1.0 - p) / n + z2 / (4.0 * n * n)) / denominator;
+    // The interval always contains p; clamp so rounding cannot push it out
+    low = std::clamp(center - half_width, 0.0, p);
+    high = std::clamp(center + half_width, p, 1.0);
+}
+
+TeamBuilder::MatchupSimulation TeamMatchupSimulator::run(const TeamBuilder::Team& team1, const TeamBuilder::Team& team2,
+                                                         const TeamBuilder::ComparisonSettings& settings,
+                                                         const TeamBuilder::ComparisonProgressCallback& progress) {
+    TeamBuilder::MatchupSimulation simulation;
+    simulation.team1_members = memberStats(team1);
+    simulation.team2_members = memberStats(team2);
+
+    std::vector<size_t> slots1;
+    std::vector<size_t> slots2;
+    const Team battle_team1 = loadTeam(team1, slots1);
+    const Team battle_team2 = loadTeam(team2, slots2);
+    if (battle_team1.isEmpty() || battle_team2.isEmpty()) {
+        return simulation;
+    }
+
+    const int max_battles = std::max(1, settings.max_battles_per_difficulty);
+    const int min_battles = std::clamp(settings.min_battles_per_difficulty, 1, max_battles);
+    const int max_turns = std::max(1, settings.max_turns);
+    const size_t buckets = static_cast<size_t>(max_turns / TeamBuilder::kTurnHistogramBucket + 1);
+
+    std::vector<LevelState> levels;
+    for (size_t i = 0; i < settings.difficulties.size(); ++i) {
+        if (auto difficulty = parseDifficulty(settings.difficulties[i])) {
+            LevelState level{*difficulty, i, false, 0.0, 0, TeamBuilder::SimulatedRecord()};
+            level.record.difficulty = settings.difficulties[i];
+            level.record.turn_histogram.assign(buckets, 0);
+            levels.push_back(level);
+        }
+    }
+    if (levels.empty()) {
+        return simulation;
+    }
+    simulation.performed = true;
+
+    unsigned workers = settings.worker_threads > 0 ? settings.worker_threads : std::thread::hardware_concurrency();
+    workers = std::max(1u, workers);
+
+    size_t planned = levels.size() * static_cast<size_t>(max_battles);
+    size_t completed_total = 0;
+    std::vector<BattleJob> jobs;
+    std::vector<BattleSimulator::Result> results;
+    std::vector<char> finished;
+
+    while (true) {
+        jobs.clear();
+        for (size_t l = 0; l < levels.size(); ++l) {
+            const int played = levels[l].record.battles;
+            if (levels[l].done) {
+                continue;
+            }
+            const int count = std::min(played == 0 ? min_battles : kRoundBattles, max_battles - played);
+            for (int b = 0; b < count; ++b) {
+                jobs.push_back({l, played + b});
+            }
+        }
+        if (jobs.empty()) {
+            break;
+        }
+
+        results.assign(jobs.size(), BattleSimulator::Result());
+        finished.assign(jobs.size(), 0);
+
+        // The calling thread works too, so progress is reported from it alone
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> completed{completed_total};
+        std::atomic<bool> cancelled{false};
+        auto work = [&](bool report) {
+            // Each worker copies the teams once and resets them between battles
+            ResettableBattleTeam side1(battle_team1);
+            ResettableBattleTeam side2(battle_team2);
+            for (size_t index = next++; index < jobs.size() && !cancelled; index = next++) {
+                const BattleJob& job = jobs[index];
+                const LevelState& level = levels[job.level];
+                BattleSimulator::Options options;
+                options.team_a_ai = level.difficulty;
+                options.team_b_ai = level.difficulty;
+                options.max_turns = max_turns;
+                options.seed = splitMix64(splitMix64(settings.seed ^ level.seed_index) + static_cast<uint64_t>(job.battle));
+
+                side1.reset();
+                side2.reset();
+                const bool swapped = job.battle % 2 == 1;
+                results[index] = swapped ? BattleSimulator::simulateInPlace(side2.get(), side1.get(), options)
+                                         : BattleSimulator::simulateInPlace(side1.get(), side2.get(), options);
+                finished[index] = 1;
+
+                const size_t done = ++completed;
+                if (report && progress && !progress(done, planned)) {
+                    cancelled = true;
+                }
+            }
+        };
+
+        const unsigned round_workers = std::min<unsigned>(workers, static_cast<unsigned>(jobs.size()));
+        std::vector<std::thread> threads;
+        threads.reserve(round_workers - 1);
+        for (unsigned t = 1; t < round_workers; ++t) {
+            threads.emplace_back(work, false);
+        }
+        work(true);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        completed_total = completed;
+
+        // Fold results in job order so totals do not depend on thread timing
+        for (size_t index = 0; index < jobs.size(); ++index) {
+            if (!finished[index]) {
+                continue;
+            }
+            const BattleSimulator::Result& result = results[index];
+            LevelState& level = levels[jobs[index].level];
+            const bool swapped = jobs[index].battle % 2 == 1;
+            const bool team1_won = result.outcome == (swapped ? BattleSimulator::Outcome::TEAM_B_WINS
+                                                              : BattleSimulator::Outcome::TEAM_A_WINS);
+            const bool team2_won = result.outcome == (swapped ? BattleSimulator::Outcome::TEAM_A_WINS
+                                                              : BattleSimulator::Outcome::TEAM_B_WINS);
+
+            TeamBuilder::SimulatedRecord& record = level.record;
+            record.battles++;
+            record.team1_wins += team1_won ? 1 : 0;
+            record.team2_wins += team2_won ? 1 : 0;
+            record.draws += (!team1_won && !team2_won) ? 1 : 0;
+            level.score += team1_won ? 1.0 : (team2_won ? 0.0 : 0.5);
+            level.total_turns += result.turns;
+            record.turn_histogram[std::min(buckets - 1, static_cast<size_t>(result.turns / TeamBuilder::kTurnHistogramBucket))]++;
+
+            recordSide(swapped ? result.team_b_knockouts : result.team_a_knockouts,
+                       swapped ? result.team_b_fainted : result.team_a_fainted,
+                       team1_won, slots1, simulation.team1_members);
+            recordSide(swapped ? result.team_a_knockouts : result.team_b_knockouts,
+                       swapped ? result.team_a_fainted : result.team_b_fainted,
+                       team2_won, slots2, simulation.team2_members);
+        }
+
+        if (cancelled) {
+            simulation.cancelled = true;
+            break;
+        }
+
+        for (auto& level : levels) {
+            if (level.done) {
+                continue;
+            }
+            const int played = level.record.battles;
+            double low = 0.0;
+            double high = 1.0;
+            wilsonInterval(level.score, played, low, high);
+            if (played >= max_battles) {
+                level.done = true;
+            } else if (played >= min_battles && (high - low) / 2.0 <= settings.target_margin) {
+                level.done = true;
+                planned -= static_cast<size_t>(max_battles - played);
+            }
+        }
+    }
+
+    // Per-level and overall summaries
+    double overall_score = 0.0;
+    long long overall_turns = 0;
+    simulation.overall.difficulty = "all";
+    simulation.overall.turn_histogram.assign(buckets, 0);
+    for (auto& level : levels) {
+        finishRecord(level.record, level.score, level.total_turns);
+        TeamBuilder::SimulatedRecord& overall = simulation.overall;
+        overall.battles += level.record.battles;
+        overall.team1_wins += level.record.team1_wins;
+        overall.team2_wins += level.record.team2_wins;
+        overall.draws += level.record.draws;
+        for (size_t bucket = 0; bucket < buckets; ++bucket) {
+            overall.turn_histogram[bucket] += level.record.turn_histogram[bucket];
+        }
+        overall_score += level.score;
+        overall_turns += level.total_turns;
+        simulation.by_difficulty.push_back(std::move(level.record));
+    }
+    finishRecord(simulation.overall, overall_score, overall_turns);
+
+    if (progress && !simulation.cancelled) {
+        progress(completed_total, completed_total);
+    }
+    return simulation;
+}
@@ -0,0 +1,479 @@
+#include "team_optimizer.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace {
+
+uint64_t splitMix64(uint64_t value) {
+    value += 0x9E3779B97F4A7C15ull;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+uint64_t gameSeed(uint64_t seed, int generation, size_t candidate, size_t opponent, int game) {
+    uint64_t value = splitMix64(seed ^ static_cast<uint64_t>(generation));
+    value = splitMix64(value ^ static_cast<uint64_t>(candidate));
+    value = splitMix64(value ^ (static_cast<uint64_t>(opponent) << 32));
+    return splitMix64(value + static_cast<uint64_t>(game));
+}
+
+struct GameJob {
+    size_t candidate;   // Index into the population
+    size_t team;        // Index into the rung's battle teams
+    size_t opponent;
+    int game;           // Game number against this opponent across rungs
+};
+
+bool hasSpecies(const std::vector<TeamBuilder::TeamPokemon>& members, const std::string& species) {
+    return std::any_of(members.begin(), members.end(),
+                       [&](const TeamBuilder::TeamPokemon& member) { return member.name == species; });
+}
+
+} // namespace
+
+TeamOptimizer::TeamOptimizer(std::shared_ptr<PokemonData> data, const Settings& settings)
+    : pokemon_data(data), settings(settings) {
+    if (!pokemon_data) {
+        throw std::invalid_argument("PokemonData cannot be null");
+    }
+}
+
+bool TeamOptimizer::addGauntletTeam(const TeamBuilder::Team& team) {
+    for (const auto& member : team.pokemon) {
+        if (loadSpecies(member.name)) {
+            for (const auto& move : member.moves) {
+                loadMove(move);
+            }
+        }
+    }
+
+    Team battle_team = buildBattleTeam(team.pokemon);
+    if (battle_team.isEmpty()) {
+        return false;
+    }
+    gauntlet.push_back(std::move(battle_team));
+    return true;
+}
+
+void TeamOptimizer::addSeedTeam(const std::vector<TeamBuilder::TeamPokemon>& members) {
+    seed_teams.push_back(members);
+}
+
+void TeamOptimizer::setSpeciesPool(const std::vector<std::string>& species) {
+    species_pool = species;
+}
+
+bool TeamOptimizer::loadSpecies(const std::string& name) {
+    if (species_cache.count(name)) {
+        return true;
+    }
+    if (!pokemon_data->hasPokemon(name)) {
+        return false;
+    }
+
+    Pokemon pokemon(name);
+    if (pokemon.name.empty()) {
+        return false;
+    }
+    species_cache.emplace(name, std::move(pokemon));
+    return true;
+}
+
+bool TeamOptimizer::loadMove(const std::string& name) {
+    if (move_cache.count(name)) {
+        return true;
+    }
+    if (!pokemon_data->hasMove(name)) {
+        return false;
+    }
+
+    Move move(name);
+    if (move.name.empty()) {
+        return false;
+    }
+    move_cache.emplace(name, std::move(move));
+    return true;
+}
+
+std::vector<std::string> TeamOptimizer::candidateMovesFor(const std::string& species) const {
+    // suggestMovesForPokemon stops at four moves, so widen the pool with the
+    // species' other own-type damaging moves
+    std::vector<std::string> candidates = pokemon_data->suggestMovesForPokemon(species, 4);
+    const size_t limit = static_cast<size_t>(std::max(settings.move_candidates, 1));
+
+    auto info = pokemon_data->getPokemonInfo(species);
+    if (info) {
+        for (const auto& type : info->types) {
+            auto type_moves = pokemon_data->getMovesByType(type);
+            std::sort(type_moves.begin(), type_moves.end());
+            for (const auto& move : type_moves) {
+                if (candidates.size() >= limit) {
+                    break;
+                }
+                auto move_info = pokemon_data->getMoveInfo(move);
+                if (move_info && move_info->power > 0 &&
+                    std::find(candidates.begin(), candidates.end(), move) == candidates.end()) {
+                    candidates.push_back(move);
+                }
+            }
+        }
+    }
+
+    if (candidates.size() > limit) {
+        candidates.resize(limit);
+    }
+    return candidates;
+}
+
+Team TeamOptimizer::buildBattleTeam(const std::vector<TeamBuilder::TeamPokemon>& members) const {
+    Team team;
+    for (const auto& member : members) {
+        auto species = species_cache.find(member.name);
+        if (species == species_cache.end()) {
+            continue;
+        }
+
+        Pokemon pokemon = species->second;
+        for (const auto& move_name : member.moves) {
+            auto move = move_cache.find(move_name);
+            if (move != move_cache.end()) {
+                pokemon.moves.push_back(move->second);
+            }
+        }
+        team.addPokemon(pokemon);
+    }
+    return team;
+}
+
+std::vector<std::string> TeamOptimizer::randomMoveset(const std::string& species, std::mt19937_64& rng) const {
+    auto it = move_candidates.find(species);
+    if (it == move_candidates.end()) {
+        return {};
+    }
+
+    std::vector<std::string> moves = it->second;
+    std::shuffle(moves.begin(), moves.end(), rng);
+    if (moves.size() > 4) {
+        moves.resize(4);
+    }
+    return moves;
+}
+
+std::string TeamOptimizer::randomSpecies(const Candidate& candidate, std::mt19937_64& rng) const {
+    std::uniform_int_distribution<size_t> pick(0, species_pool.size() - 1);
+    for (size_t attempt = 0; attempt < species_pool.size() * 2; ++attempt) {
+        const auto& species = species_pool[pick(rng)];
+        if (!hasSpecies(candidate.members, species)) {
+            return species;
+        }
+    }
+    for (const auto& species : species_pool) {
+        if (!hasSpecies(candidate.members, species)) {
+            return species;
+        }
+    }
+    return "";
+}
+
+TeamOptimizer::Candidate TeamOptimizer::randomCandidate(std::mt19937_64& rng) const {
+    Candidate candidate;
+    while (static_cast<int>(candidate.members.size()) < settings.team_size) {
+        const std::string species = randomSpecies(candidate, rng);
+        if (species.empty()) {
+            break;
+        }
+        candidate.members.emplace_back(species, randomMoveset(species, rng));
+    }
+    return candidate;
+}
+
+TeamOptimizer::Candidate TeamOptimizer::crossover(const Candidate& a, const Candidate& b,
+                                                  std::mt19937_64& rng) const {
+    // Uniform crossover per slot, skipping species the child already has
+    Candidate child;
+    std::bernoulli_distribution coin(0.5);
+    const size_t slots = std::max(a.members.size(), b.members.size());
+    for (size_t i = 0; i < slots; ++i) {
+        const bool prefer_a = coin(rng);
+        const Candidate& first = prefer_a ? a : b;
+        const Candidate& second = prefer_a ? b : a;
+
+        if (i < first.members.size() && !hasSpecies(child.members, first.members[i].name)) {
+            child.members.push_back(first.members[i]);
+        } else if (i < second.members.size() && !hasSpecies(child.members, second.members[i].name)) {
+            child.members.push_back(second.members[i]);
+        } else {
+            const std::string species = randomSpecies(child, rng);
+            if (!species.empty()) {
+                child.members.emplace_back(species, randomMoveset(species, rng));
+            }
+        }
+    }
+    return child;
+}
+
+void TeamOptimizer::mutate(Candidate& candidate, std::mt19937_64& rng) const {
+    std::bernoulli_distribution mutate_slot(settings.mutation_rate);
+    std::bernoulli_distribution swap_species(0.5);
+
+    for (auto& member : candidate.members) {
+        if (!mutate_slot(rng)) {
+            continue;
+        }
+
+        if (swap_species(rng)) {
+            const std::string species = randomSpecies(candidate, rng);
+            if (!species.empty()) {
+                member = TeamBuilder::TeamPokemon(species, randomMoveset(species, rng));
+            }
+            continue;
+        }
+
+        // Replace one move with a candidate the Pokemon does not know yet
+        auto it = move_candidates.find(member.name);
+        if (it == move_candidates.end() || member.moves.empty()) {
+            continue;
+        }
+        std::vector<std::string> unused;
+        for (const auto& move : it->second) {
+            if (std::find(member.moves.begin(), member.moves.end(), move) == member.moves.end()) {
+                unused.push_back(move);
+            }
+        }
+        if (unused.empty()) {
+            continue;
+        }
+        std::uniform_int_distribution<size_t> slot(0, member.moves.size() - 1);
+        std::uniform_int_distribution<size_t> replacement(0, unused.size() - 1);
+        member.moves[slot(rng)] = unused[replacement(rng)];
+    }
+}
+
+size_t TeamOptimizer::evaluateGeneration(std::vector<Candidate>& population, int generation,
+                                         size_t budget) const {
+    for (auto& candidate : population) {
+        candidate.score = 0.0;
+        candidate.games = 0;
+        candidate.rung = 0;
+    }
+
+    std::vector<size_t> alive(population.size());
+    for (size_t i = 0; i < alive.size(); ++i) {
+        alive[i] = i;
+    }
+
+    const int halving_rate = std::max(settings.halving_rate, 2);
+    int games_per_opponent = std::max(settings.initial_games, 1);
+    int games_so_far = 0;
+    size_t games_played = 0;
+
+    for (int rung = 0; !alive.empty(); ++rung) {
+        const size_t rung_games = alive.size() * gauntlet.size() * static_cast<size_t>(games_per_opponent);
+        if (budget > 0 && games_played + rung_games > budget) {
+            break;
+        }
+
+        std::vector<Team> teams;
+        std::vector<GameJob> jobs;
+        teams.reserve(alive.size());
+        jobs.reserve(rung_games);
+        for (size_t t = 0; t < alive.size(); ++t) {
+            teams.push_back(buildBattleTeam(population[alive[t]].members));
+            for (size_t opponent = 0; opponent < gauntlet.size(); ++opponent) {
+                for (int g = 0; g < games_per_opponent; ++g) {
+                    jobs.push_back({alive[t], t, opponent, games_so_far + g});
+                }
+            }
+        }
+
+        std::vector<double> scores(jobs.size(), 0.0);
+        auto play = [&](size_t index) {
+            const GameJob& job = jobs[index];
+            BattleSimulator::Options options;
+            options.team_a_ai = settings.ai_difficulty;
+            options.team_b_ai = settings.ai_difficulty;
+            options.max_turns = settings.max_turns;
+            options.seed = gameSeed(settings.seed, generation, job.candidate, job.opponent, job.game);
+
+            // Alternate sides so the candidate does not always win speed ties
+            const bool swapped = job.game % 2 == 1;
+            const auto result = swapped
+                ? BattleSimulator::simulate(gauntlet[job.opponent], teams[job.team], options)
+                : BattleSimulator::simulate(teams[job.team], gauntlet[job.opponent], options);
+            if (result.outcome == BattleSimulator::Outcome::DRAW) {
+                scores[index] = 0.5;
+            } else if ((result.outcome == BattleSimulator::Outcome::TEAM_A_WINS) != swapped) {
+                scores[index] = 1.0;
+            }
+        };
+
+        unsigned workers = settings.worker_threads > 0 ? settings.worker_threads : std::thread::hardware_concurrency();
+        workers = std::max(1u, std::min<unsigned>(workers, static_cast<unsigned>(jobs.size())));
+        if (workers == 1) {
+            for (size_t i = 0; i < jobs.size(); ++i) {
+                play(i);
+            }
+        } else {
+            std::atomic<size_t> next{0};
+            std::vector<std::thread> threads;
+            threads.reserve(workers);
+            for (unsigned t = 0; t < workers; ++t) {
+                threads.emplace_back([&]() {
+                    for (size_t index = next++; index < jobs.size(); index = next++) {
+                        play(index);
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+
+        for (size_t i = 0; i < jobs.size(); ++i) {
+            Candidate& candidate = population[jobs[i].candidate];
+            candidate.score += scores[i];
+            candidate.games++;
+        }
+        for (size_t index : alive) {
+            population[index].rung = rung + 1;
+        }
+        games_played += rung_games;
+        games_so_far += games_per_opponent;
+
+        if (alive.size() == 1) {
+            break;
+        }
+
+        // Keep the best 1/halving_rate; ties go to the earlier candidate
+        std::stable_sort(alive.begin(), alive.end(), [&](size_t a, size_t b) {
+            return population[a].fitness() > population[b].fitness();
+        });
+        alive.resize(std::max<size_t>(1, alive.size() / halving_rate));
+        games_per_opponent *= halving_rate;
+    }
+
+    return games_played;
+}
+
+TeamOptimizer::Result TeamOptimizer::optimize(const std::string& team_name) {
+    Result result;
+    result.team = TeamBuilder::Team(team_name);
+    if (gauntlet.empty() || settings.team_size <= 0) {
+        return result;
+    }
+
+    // Load every usable species and its candidate moves before any threads start
+    if (species_pool.empty()) {
+        species_pool = pokemon_data->getAvailablePokemon();
+    }
+    std::vector<std::string> usable;
+    for (const auto& species : species_pool) {
+        if (!loadSpecies(species)) {
+            continue;
+        }
+        std::vector<std::string> moves;
+        for (const auto& move : candidateMovesFor(species)) {
+            if (loadMove(move)) {
+                moves.push_back(move);
+            }
+        }
+        if (!moves.empty()) {
+            move_candidates[species] = std::move(moves);
+            usable.push_back(species);
+        }
+    }
+    species_pool = usable;
+    if (species_pool.empty()) {
+        return result;
+    }
+
+    std::mt19937_64 rng(settings.seed);
+    const int population_size = std::max(settings.population_size, 2);
+    std::vector<Candidate> population;
+    for (const auto& members : seed_teams) {
+        if (static_cast<int>(population.size()) >= population_size) {
+            break;
+        }
+        Candidate candidate;
+        for (const auto& member : members) {
+            if (move_candidates.count(member.name) && !hasSpecies(candidate.members, member.name) &&
+                static_cast<int>(candidate.members.size()) < settings.team_size) {
+                for (const auto& move : member.moves) {
+                    loadMove(move);
+                }
+                candidate.members.push_back(member);
+            }
+        }
+        while (static_cast<int>(candidate.members.size()) < settings.team_size) {
+            const std::string species = randomSpecies(candidate, rng);
+            if (species.empty()) {
+                break;
+            }
+            candidate.members.emplace_back(species, randomMoveset(species, rng));
+        }
+        population.push_back(std::move(candidate));
+    }
+    while (static_cast<int>(population.size()) < population_size) {
+        population.push_back(randomCandidate(rng));
+    }
+
+    Candidate best;
+    for (int generation = 0; generation < settings.generations; ++generation) {
+        size_t remaining = 0;  // 0 = unlimited
+        if (settings.evaluation_budget > 0) {
+            if (result.games_played >= settings.evaluation_budget) {
+                break;
+            }
+            remaining = settings.evaluation_budget - result.games_played;
+        }
+        const size_t played = evaluateGeneration(population, generation, remaining);
+        if (played == 0) {
+            break;  // Budget cannot cover even the first rung
+        }
+        result.games_played += played;
+        result.generations_completed++;
+
+        // Candidates that survived more rungs rank first; within a rung, by fitness
+        std::stable_sort(population.begin(), population.end(), [](const Candidate& a, const Candidate& b) {
+            if (a.rung != b.rung) return a.rung > b.rung;
+            return a.fitness() > b.fitness();
+        });
+        if (best.games == 0 || population.front().fitness() > best.fitness()) {
+            best = population.front();
+        }
+
+        if (generation + 1 == settings.generations) {
+            break;
+        }
+
+        // Elites carry over; the rest are bred from rank-based tournament selection
+        std::vector<Candidate> next;
+        const int elites = std::min(std::max(settings.elite_count, 0), population_size);
+        for (int i = 0; i < elites; ++i) {
+            next.push_back(population[i]);
+        }
+        std::uniform_int_distribution<size_t> pick(0, population.size() - 1);
+        auto select = [&]() -> const Candidate& {
+            const size_t first = pick(rng);
+            const size_t second = pick(rng);
+            return population[std::min(first, second)];
+        };
+        while (static_cast<int>(next.size()) < population_size) {
+            const Candidate& a = select();
+            const Candidate& b = select();
+            Candidate child = crossover(a, b, rng);
+            mutate(child, rng);
+            next.push_back(std::move(child));
+        }
+        population = std::move(next);
+    }
+
+    if (best.games > 0) {
+        result.team.pokemon = best.members;
+        result.fitness = best.fitness();
+        result.fitness_games = best.games;
+    }
+    return result;
+}
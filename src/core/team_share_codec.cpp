@@ -0,0 +1,262 @@
+#include "team_share_codec.h"
+#include "base64.h"
+#include "binary_io.h"
+#include <algorithm>
+
+namespace {
+
+constexpr size_t kHeaderSize = 4;     // Version, fingerprint, ID widths
+constexpr size_t kChecksumSize = 4;
+constexpr int kCountBits = 3;         // Holds 0-6 Pokemon and 0-4 moves
+
+int bitWidth(uint32_t value) {
+    int bits = 1;
+    while (bits < 32 && (value >> bits) != 0) {
+        ++bits;
+    }
+    return bits;
+}
+
+// Packs values of arbitrary bit width, most significant bit first
+class BitWriter {
+public:
+    explicit BitWriter(std::vector<uint8_t>& out) : out_(out), accumulator_(0), pending_(0) {}
+
+    void write(uint32_t value, int bits) {
+        accumulator_ = (accumulator_ << bits) | (value & ((uint64_t(1) << bits) - 1));
+        pending_ += bits;
+        while (pending_ >= 8) {
+            pending_ -= 8;
+            out_.push_back(static_cast<uint8_t>(accumulator_ >> pending_));
+        }
+    }
+
+    void flush() {
+        if (pending_ > 0) {
+            out_.push_back(static_cast<uint8_t>(accumulator_ << (8 - pending_)));
+            pending_ = 0;
+        }
+        accumulator_ = 0;
+    }
+
+private:
+    std::vector<uint8_t>& out_;
+    uint64_t accumulator_;
+    int pending_;
+};
+
+class BitReader {
+public:
+    BitReader(const uint8_t* data, size_t length) : data_(data), length_(length), offset_(0), accumulator_(0), available_(0) {}
+
+    bool read(int bits, uint32_t& value) {
+        while (available_ < bits) {
+            if (offset_ >= length_) {
+                return false;
+            }
+            accumulator_ = (accumulator_ << 8) | data_[offset_++];
+            available_ += 8;
+        }
+        available_ -= bits;
+        value = static_cast<uint32_t>(accumulator_ >> available_) & ((uint32_t(1) << bits) - 1);
+        return true;
+    }
+
+    size_t bytesConsumed() const { return offset_; }
+
+private:
+    const uint8_t* data_;
+    size_t length_;
+    size_t offset_;
+    uint64_t accumulator_;
+    int available_;
+};
+
+void writeString(std::vector<uint8_t>& out, const std::string& value) {
+    // LEB128 length, then the bytes
+    size_t length = value.size();
+    do {
+        const uint8_t byte = length & 0x7F;
+        length >>= 7;
+        out.push_back(static_cast<uint8_t>(byte | (length ? 0x80 : 0)));
+    } while (length);
+    out.insert(out.end(), value.begin(), value.end());
+}
+
+// Reads a LEB128 length and returns where the string's bytes are
+bool readStringRange(const uint8_t* data, size_t length, size_t& offset, std::pair<size_t, size_t>& range) {
+    size_t size = 0;
+    for (int shift = 0; ; shift += 7) {
+        if (offset >= length || shift > 28) {
+            return false;
+        }
+        const uint8_t byte = data[offset++];
+        size |= static_cast<size_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            break;
+        }
+    }
+    if (size > length - offset) {
+        return false;
+    }
+    range = {offset, size};
+    offset += size;
+    return true;
+}
+
+} // namespace
+
+TeamShareCodec::TeamShareCodec(const PokemonData& data) {
+    uint32_t max_dex = 0;
+    std::string table_text;
+    for (const auto& name : data.getAvailablePokemon()) {
+        auto info = data.getPokemonInfo(name);
+        if (!info || info->id <= 0) {
+            continue;
+        }
+        const uint32_t dex = static_cast<uint32_t>(info->id);
+        if (dex >= species_by_dex.size()) {
+            species_by_dex.resize(dex + 1);
+        }
+        if (!species_by_dex[dex].empty()) {
+            continue;  // Keep the first species claiming a dex number
+        }
+        species_by_dex[dex] = name;
+        dex_by_species[name] = dex;
+        max_dex = std::max(max_dex, dex);
+        table_text += std::to_string(dex) + ' ' + name + '\n';
+    }
+
+    move_names = data.getAvailableMoves();
+    std::sort(move_names.begin(), move_names.end());
+    for (size_t i = 0; i < move_names.size(); ++i) {
+        move_ids[move_names[i]] = static_cast<uint32_t>(i);
+        table_text += move_names[i] + '\n';
+    }
+
+    species_bits = static_cast<uint8_t>(std::min(15, bitWidth(max_dex)));
+    move_bits = static_cast<uint8_t>(std::min(15, bitWidth(move_names.empty() ? 0 : static_cast<uint32_t>(move_names.size() - 1))));
+    fingerprint = static_cast<uint16_t>(BinaryIO::crc32(table_text.data(), table_text.size()));
+}
+
+bool TeamShareCodec::encode(const TeamBuilder::TeamShareCode& share_code, std::string& code) const {
+    if (share_code.pokemon.size() > 6) {
+        return false;
+    }
+
+    std::vector<uint8_t> payload;
+    payload.reserve(64 + share_code.team_name.size() + share_code.creator_name.size() +
+                    share_code.description.size() + share_code.creation_date.size());
+    payload.push_back(kFormatVersion);
+    payload.push_back(static_cast<uint8_t>(fingerprint));
+    payload.push_back(static_cast<uint8_t>(fingerprint >> 8));
+    payload.push_back(static_cast<uint8_t>((species_bits << 4) | move_bits));
+
+    BitWriter bits(payload);
+    bits.write(static_cast<uint32_t>(share_code.pokemon.size()), kCountBits);
+    for (const auto& pokemon : share_code.pokemon) {
+        auto species = dex_by_species.find(pokemon.name);
+        if (species == dex_by_species.end() || pokemon.moves.size() > 4) {
+            return false;
+        }
+        bits.write(species->second, species_bits);
+        bits.write(static_cast<uint32_t>(pokemon.moves.size()), kCountBits);
+        for (const auto& move : pokemon.moves) {
+            auto move_id = move_ids.find(move);
+            if (move_id == move_ids.end()) {
+                return false;
+            }
+            bits.write(move_id->second, move_bits);
+        }
+    }
+    bits.flush();
+
+    writeString(payload, share_code.team_name);
+    writeString(payload, share_code.creator_name);
+    writeString(payload, share_code.description);
+    writeString(payload, share_code.creation_date);
+
+    const uint32_t checksum = BinaryIO::crc32(payload.data(), payload.size());
+    for (int shift = 0; shift < 32; shift += 8) {
+        payload.push_back(static_cast<uint8_t>(checksum >> shift));
+    }
+
+    code = Base64::encodeUrl(payload.data(), payload.size());
+    return true;
+}
+
+bool TeamShareCodec::decode(const std::string& code, TeamBuilder::TeamShareCode& share_code) const {
+    std::vector<uint8_t> payload;
+    if (!Base64::decode(code, payload) || payload.size() < kHeaderSize + kChecksumSize ||
+        payload[0] != kFormatVersion) {
+        return false;
+    }
+
+    const size_t body_size = payload.size() - kChecksumSize;
+    uint32_t stored_checksum = 0;
+    for (size_t i = 0; i < kChecksumSize; ++i) {
+        stored_checksum |= static_cast<uint32_t>(payload[body_size + i]) << (8 * i);
+    }
+    if (BinaryIO::crc32(payload.data(), body_size) != stored_checksum) {
+        return false;
+    }
+
+    const uint16_t code_fingerprint = static_cast<uint16_t>(payload[1] | (payload[2] << 8));
+    const int code_species_bits = payload[3] >> 4;
+    const int code_move_bits = payload[3] & 0x0F;
+    if (code_fingerprint != fingerprint || code_species_bits != species_bits || code_move_bits != move_bits) {
+        return false;
+    }
+
+    // Read and check every ID before touching the output
+    uint32_t species[6];
+    uint32_t move_counts[6];
+    uint32_t moves[6][4];
+    BitReader bits(payload.data() + kHeaderSize, body_size - kHeaderSize);
+    uint32_t pokemon_count = 0;
+    if (!bits.read(kCountBits, pokemon_count) || pokemon_count > 6) {
+        return false;
+    }
+    for (uint32_t slot = 0; slot < pokemon_count; ++slot) {
+        if (!bits.read(species_bits, species[slot]) || species[slot] >= species_by_dex.size() ||
+            species_by_dex[species[slot]].empty() ||
+            !bits.read(kCountBits, move_counts[slot]) || move_counts[slot] > 4) {
+            return false;
+        }
+        for (uint32_t m = 0; m < move_counts[slot]; ++m) {
+            if (!bits.read(move_bits, moves[slot][m]) || moves[slot][m] >= move_names.size()) {
+                return false;
+            }
+        }
+    }
+
+    // Locate the strings, then copy everything out (reusing the output's storage)
+    size_t offset = kHeaderSize + bits.bytesConsumed();
+    std::pair<size_t, size_t> strings[4];
+    for (auto& range : strings) {
+        if (!readStringRange(payload.data(), body_size, offset, range)) {
+            return false;
+        }
+    }
+    if (offset != body_size) {
+        return false;
+    }
+
+    const char* text = reinterpret_cast<const char*>(payload.data());
+    share_code.team_name.assign(text + strings[0].first, strings[0].second);
+    share_code.creator_name.assign(text + strings[1].first, strings[1].second);
+    share_code.description.assign(text + strings[2].first, strings[2].second);
+    share_code.creation_date.assign(text + strings[3].first, strings[3].second);
+    share_code.format_version = "2.0";
+
+    share_code.pokemon.resize(pokemon_count);
+    for (uint32_t slot = 0; slot < pokemon_count; ++slot) {
+        auto& pokemon = share_code.pokemon[slot];
+        pokemon.name = species_by_dex[species[slot]];
+        pokemon.moves.resize(move_counts[slot]);
+        for (uint32_t m = 0; m < move_counts[slot]; ++m) {
+            pokemon.moves[m] = move_names[moves[slot][m]];
+        }
+    }
+    return true;
+}
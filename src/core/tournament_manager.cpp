@@ -11,9 +11,136 @@
 using json = nlohmann::json;
 namespace fs = std::filesystem;
 
+namespace {
+
+RatingEngine::Settings playerRatingSettings(size_t games_per_period) {
+    RatingEngine::Settings settings;
+    settings.games_per_period = games_per_period;
+    return settings;
+}
+
+// Per-record JSON encoding shared by the journal and the legacy progress file
+
+json progressToJson(const TournamentManager::TournamentProgress& progress) {
+    json player_json;
+    player_json["player_name"] = progress.player_name;
+    
+    // Badges
+    json badges_json = json::array();
+    for (const auto& badge : progress.earned_badges) {
+        json badge_json;
+        badge_json["gym_name"] = badge.gym_name;
+        badge_json["gym_type"] = badge.gym_type;
+        badge_json["gym_leader_name"] = badge.gym_leader_name;
+        badge_json["earned_date"] = badge.earned_date;
+        badge_json["attempts_to_earn"] = badge.attempts_to_earn;
+        badge_json["final_battle_score"] = badge.final_battle_score;
+        badges_json.push_back(badge_json);
+    }
+    player_json["earned_badges"] = badges_json;
+    
+    // Defeated gyms
+    player_json["defeated_gyms"] = json::array();
+    for (const auto& gym : progress.defeated_gyms) {
+        player_json["defeated_gyms"].push_back(gym);
+    }
+    
+    // Elite Four progress
+    player_json["elite_four_unlocked"] = progress.elite_four_unlocked;
+    player_json["defeated_elite_four"] = progress.defeated_elite_four;
+    player_json["elite_four_completed"] = progress.elite_four_completed;
+    
+    // Champion progress
+    player_json["champion_unlocked"] = progress.champion_unlocked;
+    player_json["champion_defeated"] = progress.champion_defeated;
+    player_json["championship_date"] = progress.championship_date;
+    
+    // Statistics
+    player_json["total_gym_attempts"] = progress.total_gym_attempts;
+    player_json["total_elite_four_attempts"] = progress.total_elite_four_attempts;
+    player_json["total_champion_attempts"] = progress.total_champion_attempts;
+    player_json["average_battle_performance"] = progress.average_battle_performance;
+    return player_json;
+}
+
+TournamentManager::TournamentProgress progressFromJson(const json& player_json) {
+    TournamentManager::TournamentProgress progress;
+    progress.player_name = player_json.value("player_name", "");
+    
+    // Load badges
+    if (player_json.contains("earned_badges")) {
+        for (const auto& badge_json : player_json["earned_badges"]) {
+            TournamentManager::Badge badge;
+            badge.gym_name = badge_json.value("gym_name", "");
+            badge.gym_type = badge_json.value("gym_type", "");
+            badge.gym_leader_name = badge_json.value("gym_leader_name", "");
+            badge.earned_date = badge_json.value("earned_date", "");
+            badge.attempts_to_earn = badge_json.value("attempts_to_earn", 1);
+            badge.final_battle_score = badge_json.value("final_battle_score", 0.0);
+            progress.earned_badges.push_back(badge);
+        }
+    }
+    
+    // Load defeated gyms
+    if (player_json.contains("defeated_gyms")) {
+        for (const auto& gym : player_json["defeated_gyms"]) {
+            progress.defeated_gyms.insert(gym);
+        }
+    }
+    
+    // Load Elite Four progress
+    progress.elite_four_unlocked = player_json.value("elite_four_unlocked", false);
+    progress.defeated_elite_four = player_json.value("defeated_elite_four", std::vector<std::string>());
+    progress.elite_four_completed = player_json.value("elite_four_completed", false);
+    
+    // Load Champion progress
+    progress.champion_unlocked = player_json.value("champion_unlocked", false);
+    progress.champion_defeated = player_json.value("champion_defeated", false);
+    progress.championship_date = player_json.value("championship_date", "");
+    
+    // Load statistics
+    progress.total_gym_attempts = player_json.value("total_gym_attempts", 0);
+    progress.total_elite_four_attempts = player_json.value("total_elite_four_attempts", 0);
+    progress.total_champion_attempts = player_json.value("total_champion_attempts", 0);
+    progress.average_battle_performance = player_json.value("average_battle_performance", 0.0);
+    return progress;
+}
+
+json battleResultToJson(const TournamentManager::TournamentBattleResult& result) {
+    json result_json;
+    result_json["challenge_name"] = result.challenge_name;
+    result_json["challenge_type"] = result.challenge_type;
+    result_json["player_team_name"] = result.player_team_name;
+    result_json["opponent_name"] = result.opponent_name;
+    result_json["victory"] = result.victory;
+    result_json["turns_taken"] = result.turns_taken;
+    result_json["difficulty_level"] = result.difficulty_level;
+    result_json["performance_score"] = result.performance_score;
+    result_json["battle_date"] = result.battle_date;
+    result_json["strategy_notes"] = result.strategy_notes;
+    return result_json;
+}
+
+TournamentManager::TournamentBattleResult battleResultFromJson(const json& result_json) {
+    TournamentManager::TournamentBattleResult result;
+    result.challenge_name = result_json.value("challenge_name", "");
+    result.challenge_type = result_json.value("challenge_type", "");
+    result.player_team_name = result_json.value("player_team_name", "");
+    result.opponent_name = result_json.value("opponent_name", "");
+    result.victory = result_json.value("victory", false);
+    result.turns_taken = result_json.value("turns_taken", 0);
+    result.difficulty_level = result_json.value("difficulty_level", "");
+    result.performance_score = result_json.value("performance_score", 0.0);
+    result.battle_date = result_json.value("battle_date", "");
+    result.strategy_notes = result_json.value("strategy_notes", std::vector<std::string>());
+    return result;
+}
+
+} // namespace
+
 TournamentManager::TournamentManager(std::shared_ptr<PokemonData> data, 
                                    std::shared_ptr<TeamBuilder> team_builder)
-    : pokemon_data(data), team_builder(team_builder) {
+    : pokemon_data(data), team_builder(team_builder), player_ratings(playerRatingSettings(kRatingPeriodBattles)) {
     
     if (!pokemon_data || !team_builder) {
         throw std::invalid_argument("TournamentManager requires valid PokemonData and TeamBuilder instances");
@@ -58,6 +185,7 @@ bool TournamentManager::initializePlayerProgress(const std::string& player_name)
     
     player_progress[normalized_name] = progress;
     player_battle_history[normalized_name] = std::vector<TournamentBattleResult>();
+    refreshLeaderboards(normalized_name);
     
     saveTournamentProgress(normalized_name);
     return true;
@@ -128,6 +256,12 @@ bool TournamentManager::updatePlayerProgress(const std::string& player_name,
     
     // Recalculate player statistics
     recalculatePlayerStats(normalized_name);
+    refreshLeaderboards(normalized_name);
+    
+    if (!battle_result.opponent_name.empty() &&
+        player_ratings.addResult(normalized_name, battle_result.opponent_name, battle_result.victory ? 1.0 : 0.0)) {
+        refreshRatingLeaderboard();
+    }
     
     // Save progress
     saveTournamentProgress(normalized_name);
@@ -240,7 +374,12 @@ TournamentManager::getNextRecommendedChallenge(const std::string& player_name) c
 
 bool TournamentManager::awardBadge(const std::string& player_name, const Badge& badge) {
     const std::string normalized_name = normalizePlayerName(player_name);
-    return updateBadgeProgress(normalized_name, badge);
+    if (!updateBadgeProgress(normalized_name, badge)) {
+        return false;
+    }
+    
+    refreshLeaderboards(normalized_name);
+    return true;
 }
 
 std::vector<TournamentManager::Badge> 
@@ -345,6 +484,12 @@ TournamentManager::getPlayerTournamentStats(const std::string& player_name) cons
     
     stats["average_battle_performance"] = progress.average_battle_performance;
     
+    const auto rating = player_ratings.getRating(normalized_name);
+    if (rating) {
+        stats["rating"] = rating->rating;
+        stats["rating_deviation"] = rating->deviation;
+    }
+    
     // Calculate success rates
     if (progress.total_gym_attempts > 0) {
         stats["gym_success_rate"] = (static_cast<double>(progress.earned_badges.size()) / 
@@ -386,127 +531,62 @@ TournamentManager::getPlayerBattleHistory(const std::string& player_name,
 
 std::vector<std::pair<std::string, double>> 
 TournamentManager::getTournamentLeaderboard(const std::string& sort_by, int max_results) const {
-    std::vector<std::pair<std::string, double>> leaderboard;
-    
-    for (const auto& [player_name, progress] : player_progress) {
-        double score = 0.0;
-        
-        if (sort_by == "badges") {
-            score = static_cast<double>(progress.earned_badges.size());
-        } else if (sort_by == "completion") {
-            score = getTournamentCompletionPercentage(player_name) * 100.0;
-        } else if (sort_by == "score") {
-            score = calculateOverallPlayerScore(player_name);
-        }
-        
-        leaderboard.emplace_back(player_name, score);
+    const LeaderboardIndex* leaderboard = findLeaderboard(sort_by);
+    if (leaderboard) {
+        return leaderboard->top(max_results);
     }
     
-    // Sort descending by score
-    std::sort(leaderboard.begin(), leaderboard.end(), 
-              [](const auto& a, const auto& b) { return a.second > b.second; });
-    
-    // Limit results
-    if (max_results > 0 && static_cast<int>(leaderboard.size()) > max_results) {
-        leaderboard.resize(max_results);
+    // Unknown criteria rank nobody ahead of anybody else
+    std::vector<std::pair<std::string, double>> unranked;
+    for (const auto& [player_name, _] : player_progress) {
+        if (max_results > 0 && static_cast<int>(unranked.size()) >= max_results) {
+            break;
+        }
+        unranked.emplace_back(player_name, 0.0);
     }
-    
-    return leaderboard;
+    return unranked;
+}
+
+int TournamentManager::getPlayerLeaderboardRank(const std::string& player_name,
+                                                const std::string& sort_by) const {
+    const LeaderboardIndex* leaderboard = findLeaderboard(sort_by);
+    return leaderboard ? static_cast<int>(leaderboard->rank(normalizePlayerName(player_name))) : 0;
 }
 
 bool TournamentManager::saveTournamentProgress(const std::string& player_name) const {
+    if (!journal || !journal->isOpen()) {
+        return false;
+    }
+    
     try {
-        if (!ensureTournamentDataDirectoryExists()) {
-            return false;
-        }
-        
-        json tournament_data;
+        const std::string filter = player_name.empty() ? "" : normalizePlayerName(player_name);
         
-        // Save player progress
-        json players_json;
+        // Player progress is small, so each save rewrites just that player's record
         for (const auto& [name, progress] : player_progress) {
-            if (!player_name.empty() && name != normalizePlayerName(player_name)) {
+            if (!filter.empty() && name != filter) {
                 continue;  // Skip other players if specific player requested
             }
-            
-            json player_json;
-            player_json["player_name"] = progress.player_name;
-            
-            // Badges
-            json badges_json = json::array();
-            for (const auto& badge : progress.earned_badges) {
-                json badge_json;
-                badge_json["gym_name"] = badge.gym_name;
-                badge_json["gym_type"] = badge.gym_type;
-                badge_json["gym_leader_name"] = badge.gym_leader_name;
-                badge_json["earned_date"] = badge.earned_date;
-                badge_json["attempts_to_earn"] = badge.attempts_to_earn;
-                badge_json["final_battle_score"] = badge.final_battle_score;
-                badges_json.push_back(badge_json);
-            }
-            player_json["earned_badges"] = badges_json;
-            
-            // Defeated gyms
-            player_json["defeated_gyms"] = json::array();
-            for (const auto& gym : progress.defeated_gyms) {
-                player_json["defeated_gyms"].push_back(gym);
-            }
-            
-            // Elite Four progress
-            player_json["elite_four_unlocked"] = progress.elite_four_unlocked;
-            player_json["defeated_elite_four"] = progress.defeated_elite_four;
-            player_json["elite_four_completed"] = progress.elite_four_completed;
-            
-            // Champion progress
-            player_json["champion_unlocked"] = progress.champion_unlocked;
-            player_json["champion_defeated"] = progress.champion_defeated;
-            player_json["championship_date"] = progress.championship_date;
-            
-            // Statistics
-            player_json["total_gym_attempts"] = progress.total_gym_attempts;
-            player_json["total_elite_four_attempts"] = progress.total_elite_four_attempts;
-            player_json["total_champion_attempts"] = progress.total_champion_attempts;
-            player_json["average_battle_performance"] = progress.average_battle_performance;
-            
-            players_json[name] = player_json;
+            journal->put(ProgressJournal::makeKey(name, "progress"), progressToJson(progress).dump());
         }
-        tournament_data["players"] = players_json;
         
-        // Save battle history
-        json history_json;
+        // Battle history is append-only: journal only results not yet written
         for (const auto& [name, history] : player_battle_history) {
-            if (!player_name.empty() && name != normalizePlayerName(player_name)) {
+            if (!filter.empty() && name != filter) {
                 continue;
             }
             
-            json player_history = json::array();
-            for (const auto& result : history) {
-                json result_json;
-                result_json["challenge_name"] = result.challenge_name;
-                result_json["challenge_type"] = result.challenge_type;
-                result_json["player_team_name"] = result.player_team_name;
-                result_json["opponent_name"] = result.opponent_name;
-                result_json["victory"] = result.victory;
-                result_json["turns_taken"] = result.turns_taken;
-                result_json["difficulty_level"] = result.difficulty_level;
-                result_json["performance_score"] = result.performance_score;
-                result_json["battle_date"] = result.battle_date;
-                result_json["strategy_notes"] = result.strategy_notes;
-                player_history.push_back(result_json);
+            const std::string history_key = ProgressJournal::makeKey(name, "battle_history");
+            size_t& journaled = journaled_history_count[name];
+            if (journaled > history.size()) {
+                journal->erasePrefix(history_key);
+                journaled = 0;
+            }
+            for (; journaled < history.size(); ++journaled) {
+                journal->appendItem(history_key, battleResultToJson(history[journaled]).dump());
             }
-            history_json[name] = player_history;
-        }
-        tournament_data["battle_history"] = history_json;
-        
-        // Write to file
-        const std::string file_path = getTournamentDataFilePath();
-        std::ofstream file(file_path);
-        if (!file.is_open()) {
-            return false;
         }
         
-        file << tournament_data.dump(2);
-        return true;
+        return journal->commit();
         
     } catch (const std::exception&) {
         return false;
@@ -515,13 +595,60 @@ bool TournamentManager::saveTournamentProgress(const std::string& player_name) c
 
 bool TournamentManager::loadTournamentProgress(const std::string& player_name) {
     try {
-        const std::string file_path = getTournamentDataFilePath();
+        if (!journal) {
+            journal = std::make_unique<ProgressJournal>(getTournamentDataDirectory(), "tournament_progress");
+        }
+        if (!journal->open()) {
+            return false;
+        }
         
-        if (!fs::exists(file_path)) {
-            return true;  // No data to load yet, that's okay
+        // First run after upgrading: migrate the old JSON file into the journal
+        if (journal->isEmpty() && fs::exists(getTournamentDataFilePath())) {
+            if (!importLegacyTournamentData()) {
+                return false;
+            }
+            saveTournamentProgress();
+            journal->checkpoint();
+            rebuildLeaderboards();
+            return true;
         }
         
-        std::ifstream file(file_path);
+        const std::string filter = player_name.empty() ? "" : normalizePlayerName(player_name);
+        
+        // Clear existing data if loading all players
+        if (filter.empty()) {
+            player_progress.clear();
+            player_battle_history.clear();
+            journaled_history_count.clear();
+        }
+        
+        const std::string prefix = filter.empty() ? "" : ProgressJournal::ownerPrefix(filter);
+        journal->forEachWithPrefix(prefix, [&](const std::string& key, const ProgressJournal::Entry& entry) {
+            const auto [name, field] = ProgressJournal::splitKey(key);
+            if (field == "progress") {
+                player_progress[name] = progressFromJson(json::parse(entry.value));
+            } else if (field == "battle_history") {
+                std::vector<TournamentBattleResult> history;
+                history.reserve(entry.items.size());
+                for (const auto& item : entry.items) {
+                    history.push_back(battleResultFromJson(json::parse(item)));
+                }
+                player_battle_history[name] = std::move(history);
+                journaled_history_count[name] = entry.items.size();
+            }
+        });
+        
+        rebuildLeaderboards();
+        return true;
+        
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+bool TournamentManager::importLegacyTournamentData() {
+    try {
+        std::ifstream file(getTournamentDataFilePath());
         if (!file.is_open()) {
             return false;
         }
@@ -529,84 +656,21 @@ bool TournamentManager::loadTournamentProgress(const std::string& player_name) {
         json tournament_data;
         file >> tournament_data;
         
-        // Clear existing data if loading all players
-        if (player_name.empty()) {
-            player_progress.clear();
-            player_battle_history.clear();
-        }
+        player_progress.clear();
+        player_battle_history.clear();
+        journaled_history_count.clear();
         
-        // Load player progress
         if (tournament_data.contains("players")) {
             for (const auto& [name, player_json] : tournament_data["players"].items()) {
-                if (!player_name.empty() && name != normalizePlayerName(player_name)) {
-                    continue;
-                }
-                
-                TournamentProgress progress;
-                progress.player_name = player_json.value("player_name", "");
-                
-                // Load badges
-                if (player_json.contains("earned_badges")) {
-                    for (const auto& badge_json : player_json["earned_badges"]) {
-                        Badge badge;
-                        badge.gym_name = badge_json.value("gym_name", "");
-                        badge.gym_type = badge_json.value("gym_type", "");
-                        badge.gym_leader_name = badge_json.value("gym_leader_name", "");
-                        badge.earned_date = badge_json.value("earned_date", "");
-                        badge.attempts_to_earn = badge_json.value("attempts_to_earn", 1);
-                        badge.final_battle_score = badge_json.value("final_battle_score", 0.0);
-                        progress.earned_badges.push_back(badge);
-                    }
-                }
-                
-                // Load defeated gyms
-                if (player_json.contains("defeated_gyms")) {
-                    for (const auto& gym : player_json["defeated_gyms"]) {
-                        progress.defeated_gyms.insert(gym);
-                    }
-                }
-                
-                // Load Elite Four progress
-                progress.elite_four_unlocked = player_json.value("elite_four_unlocked", false);
-                progress.defeated_elite_four = player_json.value("defeated_elite_four", std::vector<std::string>());
-                progress.elite_four_completed = player_json.value("elite_four_completed", false);
-                
-                // Load Champion progress
-                progress.champion_unlocked = player_json.value("champion_unlocked", false);
-                progress.champion_defeated = player_json.value("champion_defeated", false);
-                progress.championship_date = player_json.value("championship_date", "");
-                
-                // Load statistics
-                progress.total_gym_attempts = player_json.value("total_gym_attempts", 0);
-                progress.total_elite_four_attempts = player_json.value("total_elite_four_attempts", 0);
-                progress.total_champion_attempts = player_json.value("total_champion_attempts", 0);
-                progress.average_battle_performance = player_json.value("average_battle_performance", 0.0);
-                
-                player_progress[name] = progress;
+                player_progress[name] = progressFromJson(player_json);
             }
         }
         
-        // Load battle history
         if (tournament_data.contains("battle_history")) {
             for (const auto& [name, history_json] : tournament_data["battle_history"].items()) {
-                if (!player_name.empty() && name != normalizePlayerName(player_name)) {
-                    continue;
-                }
-                
                 std::vector<TournamentBattleResult> history;
                 for (const auto& result_json : history_json) {
-                    TournamentBattleResult result;
-                    result.challenge_name = result_json.value("challenge_name", "");
-                    result.challenge_type = result_json.value("challenge_type", "");
-                    result.player_team_name = result_json.value("player_team_name", "");
-                    result.opponent_name = result_json.value("opponent_name", "");
-                    result.victory = result_json.value("victory", false);
-                    result.turns_taken = result_json.value("turns_taken", 0);
-                    result.difficulty_level = result_json.value("difficulty_level", "");
-                    result.performance_score = result_json.value("performance_score", 0.0);
-                    result.battle_date = result_json.value("battle_date", "");
-                    result.strategy_notes = result_json.value("strategy_notes", std::vector<std::string>());
-                    history.push_back(result);
+                    history.push_back(battleResultFromJson(result_json));
                 }
                 player_battle_history[name] = history;
             }
@@ -626,9 +690,17 @@ bool TournamentManager::resetPlayerProgress(const std::string& player_name, bool
     
     const std::string normalized_name = normalizePlayerName(player_name);
     
-    // Remove from data structures
+    // Remove from data structures and the journal
     player_progress.erase(normalized_name);
     player_battle_history.erase(normalized_name);
+    journaled_history_count.erase(normalized_name);
+    badge_leaderboard.remove(normalized_name);
+    completion_leaderboard.remove(normalized_name);
+    score_leaderboard.remove(normalized_name);
+    if (journal && journal->isOpen()) {
+        journal->erasePrefix(ProgressJournal::ownerPrefix(normalized_name));
+    }
+    rebuildPlayerRatings();
     
     // Reinitialize
     return initializePlayerProgress(normalized_name);
@@ -665,7 +737,7 @@ TournamentManager::getTournamentSystemStatus() const {
     std::unordered_map<std::string, std::string> status;
     
     status["total_players"] = std::to_string(player_progress.size());
-    status["data_file_exists"] = fs::exists(getTournamentDataFilePath()) ? "true" : "false";
+    status["data_file_exists"] = (journal && journal->isOpen() && !journal->isEmpty()) ? "true" : "false";
     status["data_valid"] = validateTournamentData() ? "true" : "false";
     
     // Count completed challenges across all players
@@ -790,6 +862,10 @@ std::string TournamentManager::getTournamentDataFilePath() const {
     return "data/tournaments/tournament_progress.json";
 }
 
+std::string TournamentManager::getTournamentDataDirectory() const {
+    return "data/tournaments";
+}
+
 bool TournamentManager::ensureTournamentDataDirectoryExists() const {
     try {
         const std::string dir_path = "data/tournaments";
@@ -860,6 +936,76 @@ double TournamentManager::calculateOverallPlayerScore(const std::string& player_
     return score;
 }
 
+void TournamentManager::refreshLeaderboards(const std::string& player_name) {
+    const auto progress_it = player_progress.find(player_name);
+    if (progress_it == player_progress.end()) {
+        badge_leaderboard.remove(player_name);
+        completion_leaderboard.remove(player_name);
+        score_leaderboard.remove(player_name);
+        return;
+    }
+    
+    badge_leaderboard.update(player_name, static_cast<double>(progress_it->second.earned_badges.size()));
+    completion_leaderboard.update(player_name, getTournamentCompletionPercentage(player_name) * 100.0);
+    score_leaderboard.update(player_name, calculateOverallPlayerScore(player_name));
+}
+
+void TournamentManager::rebuildLeaderboards() {
+    badge_leaderboard.clear();
+    completion_leaderboard.clear();
+    score_leaderboard.clear();
+    for (const auto& [player_name, _] : player_progress) {
+        refreshLeaderboards(player_name);
+    }
+    rebuildPlayerRatings();
+}
+
+void TournamentManager::rebuildPlayerRatings() {
+    // Replay every recorded battle in chronological order through fresh rating periods
+    std::vector<std::pair<const std::string*, const TournamentBattleResult*>> battles;
+    for (const auto& [player_name, history] : player_battle_history) {
+        for (const auto& result : history) {
+            battles.emplace_back(&player_name, &result);
+        }
+    }
+    std::stable_sort(battles.begin(), battles.end(), [](const auto& a, const auto& b) {
+        return a.second->battle_date < b.second->battle_date;
+    });
+    
+    player_ratings.clear();
+    for (const auto& [player_name, result] : battles) {
+        if (!result->opponent_name.empty()) {
+            player_ratings.addResult(*player_name, result->opponent_name, result->victory ? 1.0 : 0.0);
+        }
+    }
+    
+    rating_leaderboard.clear();
+    refreshRatingLeaderboard();
+}
+
+void TournamentManager::refreshRatingLeaderboard() {
+    // A closed period moves every deviation, so all rated players are refreshed
+    for (const auto& [player_name, _] : player_progress) {
+        const auto rating = player_ratings.getRating(player_name);
+        if (rating && rating->games > 0) {
+            rating_leaderboard.update(player_name, RatingEngine::conservativeRating(*rating));
+        }
+    }
+}
+
+const LeaderboardIndex* TournamentManager::findLeaderboard(const std::string& sort_by) const {
+    if (sort_by == "badges") {
+        return &badge_leaderboard;
+    } else if (sort_by == "completion") {
+        return &completion_leaderboard;
+    } else if (sort_by == "score") {
+        return &score_leaderboard;
+    } else if (sort_by == "rating") {
+        return &rating_leaderboard;
+    }
+    return nullptr;
+}
+
 bool TournamentManager::isValidPlayerName(const std::string& player_name) const {
     return !player_name.empty() && player_name.length() <= 50;
 }
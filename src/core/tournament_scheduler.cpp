@@ -0,0 +1,442 @@
+#include "tournament_scheduler.h"
+#include "battle_team_factory.h"
+#include "resettable_battle_team.h"
+#include "json.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using json = nlohmann::json;
+namespace fs = std::filesystem;
+
+namespace {
+
+uint64_t splitMix64(uint64_t value) {
+    value += 0x9E3779B97F4A7C15ull;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+constexpr size_t kSwissSearchBudget = 200000;
+
+// Depth-first search pairing the highest unpaired entrant with the next
+// closest-ranked one they have not met; `paired` is restored on failure
+bool pairWithoutRematches(const std::vector<int>& order, const std::vector<std::vector<bool>>& played,
+                          std::vector<bool>& paired, std::vector<std::pair<int, int>>& matches,
+                          size_t& budget) {
+    auto first = std::find_if(order.begin(), order.end(), [&](int index) { return !paired[index]; });
+    if (first == order.end()) {
+        return true;
+    }
+
+    const int team_a = *first;
+    paired[team_a] = true;
+    for (auto it = first + 1; it != order.end() && budget > 0; ++it) {
+        const int team_b = *it;
+        if (paired[team_b] || played[team_a][team_b]) {
+            continue;
+        }
+        --budget;
+        paired[team_b] = true;
+        matches.emplace_back(team_a, team_b);
+        if (pairWithoutRematches(order, played, paired, matches, budget)) {
+            return true;
+        }
+        matches.pop_back();
+        paired[team_b] = false;
+    }
+    paired[team_a] = false;
+    return false;
+}
+
+std::string formatName(TournamentScheduler::Format format) {
+    return format == TournamentScheduler::Format::ROUND_ROBIN ? "round_robin" : "swiss";
+}
+
+} // namespace
+
+TournamentScheduler::TournamentScheduler(const Settings& settings) : settings(settings) {}
+
+bool TournamentScheduler::addEntrant(const std::string& name, const Team& team) {
+    if (name.empty() || team.isEmpty() || !schedule.empty()) {
+        return false;
+    }
+    for (const auto& entrant : entrants) {
+        if (entrant.name == name) {
+            return false;
+        }
+    }
+
+    Entrant entrant;
+    entrant.name = name;
+    entrant.team = team;
+    entrants.push_back(std::move(entrant));
+    return true;
+}
+
+bool TournamentScheduler::addEntrant(const TeamBuilder::Team& team) {
+    return addEntrant(team.name, BattleTeamFactory::shared().build(team));
+}
+
+int TournamentScheduler::getRoundCount() const {
+    const int count = static_cast<int>(entrants.size());
+    if (count < 2) {
+        return 0;
+    }
+    if (settings.format == Format::ROUND_ROBIN) {
+        return count % 2 == 0 ? count - 1 : count;
+    }
+    if (settings.swiss_rounds > 0) {
+        return std::min(settings.swiss_rounds, count - 1);
+    }
+    return std::min(count - 1, static_cast<int>(std::ceil(std::log2(static_cast<double>(count)))));
+}
+
+bool TournamentScheduler::run() {
+    if (entrants.size() < 2) {
+        return false;
+    }
+
+    schedule.clear();
+    for (auto& entrant : entrants) {
+        entrant.had_bye = false;
+    }
+
+    const int rounds = getRoundCount();
+    for (int round = 1; round <= rounds; ++round) {
+        std::vector<Pairing> pairings = settings.format == Format::ROUND_ROBIN
+            ? roundRobinRound(round) : swissRound(round);
+        playRound(pairings);
+        schedule.insert(schedule.end(), pairings.begin(), pairings.end());
+    }
+    return true;
+}
+
+std::vector<TournamentScheduler::Pairing> TournamentScheduler::roundRobinRound(int round) const {
+    // Circle method: entrant 0 stays fixed while the others rotate; an odd
+    // field gets a phantom entrant whose opponent sits the round out
+    const int count = static_cast<int>(entrants.size());
+    const int slots = count % 2 == 0 ? count : count + 1;
+    const int rotation = round - 1;
+
+    std::vector<int> positions(slots);
+    positions[0] = 0;
+    for (int i = 1; i < slots; ++i) {
+        positions[i] = ((i - 1 + rotation) % (slots - 1)) + 1;
+    }
+
+    std::vector<Pairing> pairings;
+    for (int i = 0; i < slots / 2; ++i) {
+        int team_a = positions[i];
+        int team_b = positions[slots - 1 - i];
+        if (i == 0 && rotation % 2 == 1) {
+            std::swap(team_a, team_b);  // Keep entrant 0 from always being team A
+        }
+
+        Pairing pairing;
+        pairing.round = round;
+        if (team_a >= count || team_b >= count) {
+            pairing.team_a = team_a >= count ? team_b : team_a;
+            pairing.team_b = -1;
+        } else {
+            pairing.team_a = team_a;
+            pairing.team_b = team_b;
+        }
+        pairing.seed = pairingSeed(round, pairing.team_a, pairing.team_b);
+        pairings.push_back(pairing);
+    }
+    return pairings;
+}
+
+std::vector<TournamentScheduler::Pairing> TournamentScheduler::swissRound(int round) {
+    // Pair top-down within the current standings, avoiding rematches where possible
+    const auto standings = getStandings();
+    std::vector<int> order;
+    order.reserve(entrants.size());
+    for (const auto& standing : standings) {
+        for (size_t i = 0; i < entrants.size(); ++i) {
+            if (entrants[i].name == standing.team_name) {
+                order.push_back(static_cast<int>(i));
+                break;
+            }
+        }
+    }
+
+    std::vector<Pairing> pairings;
+    std::vector<bool> paired(entrants.size(), false);
+
+    // The lowest-ranked entrant without a bye sits out an odd round
+    if (order.size() % 2 == 1) {
+        for (auto it = order.rbegin(); it != order.rend(); ++it) {
+            if (!entrants[*it].had_bye) {
+                Pairing bye;
+                bye.round = round;
+                bye.team_a = *it;
+                bye.seed = pairingSeed(round, *it, -1);
+                pairings.push_back(bye);
+                paired[*it] = true;
+                entrants[*it].had_bye = true;
+                break;
+            }
+        }
+    }
+
+    // Look for a rematch-free pairing first; fall back to greedy top-down
+    // pairing (allowing rematches) if none turns up within the search budget
+    const auto previous_opponents = opponentsOf();
+    std::vector<std::vector<bool>> played(entrants.size(), std::vector<bool>(entrants.size(), false));
+    for (size_t i = 0; i < previous_opponents.size(); ++i) {
+        for (int opponent : previous_opponents[i]) {
+            played[i][opponent] = true;
+        }
+    }
+
+    std::vector<std::pair<int, int>> matches;
+    size_t budget = kSwissSearchBudget;
+    if (!pairWithoutRematches(order, played, paired, matches, budget)) {
+        matches.clear();
+        for (size_t i = 0; i < order.size(); ++i) {
+            if (paired[order[i]]) {
+                continue;
+            }
+            for (size_t j = i + 1; j < order.size(); ++j) {
+                if (!paired[order[j]]) {
+                    matches.emplace_back(order[i], order[j]);
+                    paired[order[i]] = paired[order[j]] = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    for (const auto& match : matches) {
+        Pairing pairing;
+        pairing.round = round;
+        pairing.team_a = match.first;
+        pairing.team_b = match.second;
+        pairing.seed = pairingSeed(round, match.first, match.second);
+        pairings.push_back(pairing);
+    }
+    return pairings;
+}
+
+uint64_t TournamentScheduler::pairingSeed(int round, int team_a, int team_b) const {
+    uint64_t seed = splitMix64(settings.seed ^ static_cast<uint64_t>(round));
+    seed = splitMix64(seed ^ static_cast<uint64_t>(static_cast<uint32_t>(team_a)));
+    return splitMix64(seed ^ (static_cast<uint64_t>(static_cast<uint32_t>(team_b)) << 32));
+}
+
+void TournamentScheduler::playRound(std::vector<Pairing>& pairings) const {
+    unsigned workers = settings.worker_threads > 0 ? settings.worker_threads : std::thread::hardware_concurrency();
+    workers = std::max(1u, std::min<unsigned>(workers, static_cast<unsigned>(pairings.size())));
+
+    if (workers == 1) {
+        for (auto& pairing : pairings) {
+            playPairing(pairing);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next{0};
+    std::vector<std::thread> threads;
+    threads.reserve(workers);
+    for (unsigned t = 0; t < workers; ++t) {
+        threads.emplace_back([this, &pairings, &next]() {
+            for (size_t index = next++; index < pairings.size(); index = next++) {
+                playPairing(pairings[index]);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void TournamentScheduler::playPairing(Pairing& pairing) const {
+    pairing.wins_a = pairing.wins_b = pairing.draws = 0;
+    if (pairing.isBye()) {
+        return;
+    }
+
+    // Copied once per pairing and reset between games
+    ResettableBattleTeam team_a(entrants[pairing.team_a].team);
+    ResettableBattleTeam team_b(entrants[pairing.team_b].team);
+    for (int game = 0; game < settings.games_per_pairing; ++game) {
+        BattleSimulator::Options options;
+        options.team_a_ai = settings.ai_difficulty;
+        options.team_b_ai = settings.ai_difficulty;
+        options.max_turns = settings.max_turns;
+        options.seed = splitMix64(pairing.seed + static_cast<uint64_t>(game));
+
+        // Alternate sides so neither entrant always wins speed ties as team A
+        const bool swapped = game % 2 == 1;
+        team_a.reset();
+        team_b.reset();
+        const auto result = swapped ? BattleSimulator::simulateInPlace(team_b.get(), team_a.get(), options)
+                                    : BattleSimulator::simulateInPlace(team_a.get(), team_b.get(), options);
+
+        if (result.outcome == BattleSimulator::Outcome::DRAW) {
+            pairing.draws++;
+        } else if ((result.outcome == BattleSimulator::Outcome::TEAM_A_WINS) != swapped) {
+            pairing.wins_a++;
+        } else {
+            pairing.wins_b++;
+        }
+    }
+}
+
+TournamentScheduler::Pairing TournamentScheduler::replayPairing(const Pairing& pairing) const {
+    Pairing replayed = pairing;
+    if (replayed.team_a >= 0 && replayed.team_a < static_cast<int>(entrants.size()) &&
+        replayed.team_b < static_cast<int>(entrants.size())) {
+        playPairing(replayed);
+    }
+    return replayed;
+}
+
+std::vector<double> TournamentScheduler::matchPoints() const {
+    std::vector<double> points(entrants.size(), 0.0);
+    for (const auto& pairing : schedule) {
+        if (pairing.isBye()) {
+            points[pairing.team_a] += 1.0;
+        } else if (pairing.wins_a > pairing.wins_b) {
+            points[pairing.team_a] += 1.0;
+        } else if (pairing.wins_b > pairing.wins_a) {
+            points[pairing.team_b] += 1.0;
+        } else {
+            points[pairing.team_a] += 0.5;
+            points[pairing.team_b] += 0.5;
+        }
+    }
+    return points;
+}
+
+std::vector<std::vector<int>> TournamentScheduler::opponentsOf() const {
+    std::vector<std::vector<int>> opponents(entrants.size());
+    for (const auto& pairing : schedule) {
+        if (!pairing.isBye()) {
+            opponents[pairing.team_a].push_back(pairing.team_b);
+            opponents[pairing.team_b].push_back(pairing.team_a);
+        }
+    }
+    return opponents;
+}
+
+std::vector<TournamentScheduler::Standing> TournamentScheduler::getStandings() const {
+    const auto points = matchPoints();
+    std::vector<Standing> standings(entrants.size());
+    for (size_t i = 0; i < entrants.size(); ++i) {
+        standings[i].team_name = entrants[i].name;
+        standings[i].match_points = points[i];
+    }
+
+    for (const auto& pairing : schedule) {
+        if (pairing.isBye()) {
+            standings[pairing.team_a].match_wins++;
+            continue;
+        }
+
+        auto& a = standings[pairing.team_a];
+        auto& b = standings[pairing.team_b];
+        a.game_wins += pairing.wins_a;
+        a.game_losses += pairing.wins_b;
+        a.game_draws += pairing.draws;
+        b.game_wins += pairing.wins_b;
+        b.game_losses += pairing.wins_a;
+        b.game_draws += pairing.draws;
+        a.buchholz += points[pairing.team_b];
+        b.buchholz += points[pairing.team_a];
+
+        if (pairing.wins_a > pairing.wins_b) {
+            a.match_wins++;
+            b.match_losses++;
+            a.sonneborn_berger += points[pairing.team_b];
+        } else if (pairing.wins_b > pairing.wins_a) {
+            b.match_wins++;
+            a.match_losses++;
+            b.sonneborn_berger += points[pairing.team_a];
+        } else {
+            a.match_draws++;
+            b.match_draws++;
+            a.sonneborn_berger += 0.5 * points[pairing.team_b];
+            b.sonneborn_berger += 0.5 * points[pairing.team_a];
+        }
+    }
+
+    for (auto& standing : standings) {
+        const int games = standing.game_wins + standing.game_losses + standing.game_draws;
+        standing.game_win_percentage = games > 0
+            ? (standing.game_wins + 0.5 * standing.game_draws) / games * 100.0 : 0.0;
+    }
+
+    std::sort(standings.begin(), standings.end(), [](const Standing& a, const Standing& b) {
+        if (a.match_points != b.match_points) return a.match_points > b.match_points;
+        if (a.buchholz != b.buchholz) return a.buchholz > b.buchholz;
+        if (a.sonneborn_berger != b.sonneborn_berger) return a.sonneborn_berger > b.sonneborn_berger;
+        if (a.game_win_percentage != b.game_win_percentage) return a.game_win_percentage > b.game_win_percentage;
+        return a.team_name < b.team_name;
+    });
+    for (size_t i = 0; i < standings.size(); ++i) {
+        standings[i].rank = static_cast<int>(i + 1);
+    }
+    return standings;
+}
+
+bool TournamentScheduler::saveSchedule(const std::string& file_path) const {
+    try {
+        json data;
+        data["format"] = formatName(settings.format);
+        data["seed"] = settings.seed;
+        data["games_per_pairing"] = settings.games_per_pairing;
+        data["ai_difficulty"] = static_cast<int>(settings.ai_difficulty);
+        data["max_turns"] = settings.max_turns;
+
+        data["entrants"] = json::array();
+        for (const auto& entrant : entrants) {
+            data["entrants"].push_back(entrant.name);
+        }
+
+        data["pairings"] = json::array();
+        for (const auto& pairing : schedule) {
+            json entry;
+            entry["round"] = pairing.round;
+            entry["team_a"] = entrants[pairing.team_a].name;
+            entry["team_b"] = pairing.isBye() ? std::string() : entrants[pairing.team_b].name;
+            entry["seed"] = pairing.seed;
+            entry["wins_a"] = pairing.wins_a;
+            entry["wins_b"] = pairing.wins_b;
+            entry["draws"] = pairing.draws;
+            data["pairings"].push_back(entry);
+        }
+
+        data["standings"] = json::array();
+        for (const auto& standing : getStandings()) {
+            json entry;
+            entry["rank"] = standing.rank;
+            entry["team_name"] = standing.team_name;
+            entry["match_points"] = standing.match_points;
+            entry["buchholz"] = standing.buchholz;
+            entry["sonneborn_berger"] = standing.sonneborn_berger;
+            entry["game_win_percentage"] = standing.game_win_percentage;
+            data["standings"].push_back(entry);
+        }
+
+        const fs::path parent = fs::path(file_path).parent_path();
+        if (!parent.empty()) {
+            fs::create_directories(parent);
+        }
+        std::ofstream file(file_path);
+        if (!file.is_open()) {
+            return false;
+        }
+        file << data.dump(2);
+        return file.good();
+
+    } catch (const std::exception&) {
+        return false;
+    }
+}
@@ -9,10 +9,12 @@
 #include <algorithm>
 
 #include "battle.h"
+#include "battle_team_factory.h"
 #include "input_validator.h"
 #include "team_builder.h"
 #include "pokemon_data.h"
 #include "tournament_manager.h"
+#include "trace.h"
 
 // Signal handler for graceful exit
 void signalHandler(int /* signal */) {
@@ -48,15 +50,9 @@ void displayTemplateInfo(const TeamBuilder::TeamTemplate& template_data) {
 }
 
 // Helper function to create a team from template for battle
-Team createBattleTeamFromTemplate(const TeamBuilder::Team& builderTeam, std::shared_ptr<TeamBuilder> teamBuilder) {
-  // Export the team data to the legacy format
-  auto exported = teamBuilder->exportTeamForBattle(builderTeam);
-  
-  // Create a new Team object and load it with the exported data
-  Team battleTeam;
-  battleTeam.loadTeams(exported.first, exported.second, builderTeam.name);
-  
-  return battleTeam;
+Team createBattleTeamFromTemplate(const TeamBuilder::Team& builderTeam) {
+  // Species and moves are loaded once and reused from the shared cache
+  return BattleTeamFactory::shared().build(builderTeam);
 }
 
 // Helper function to show template categories and get user selection
@@ -399,6 +395,61 @@ void conductTournamentBattle(std::shared_ptr<TournamentManager> tournamentManage
                             const std::string& playerName,
                             const TournamentManager::ChallengeInfo& challenge);
 
+// Set by Ctrl+C while simulated comparison battles are running
+volatile std::sig_atomic_t comparisonCancelRequested = 0;
+
+void comparisonInterruptHandler(int /* signal */) {
+  comparisonCancelRequested = 1;
+}
+
+// Helper function to draw a one-line progress bar
+void displayProgressBar(size_t completed, size_t total, const std::string& label) {
+  const int width = 30;
+  const double fraction = total > 0 ? static_cast<double>(completed) / total : 1.0;
+  const int filled = static_cast<int>(fraction * width);
+  std::cout << "\r[" << std::string(filled, '#') << std::string(width - filled, '.') << "] "
+            << static_cast<int>(fraction * 100) << "% (" << completed << "/" << total << " " << label << ")"
+            << std::flush;
+}
+
+// Helper function to show simulated comparison results
+void displayMatchupSimulation(const TeamBuilder::TeamComparison& comparison) {
+  const auto& simulation = comparison.simulation;
+  const auto percent = [](double value) { return std::to_string(static_cast<int>(value * 100 + 0.5)) + "%"; };
+  
+  std::cout << "\n🎲 Simulated Battles" << (simulation.cancelled ? " (stopped early)" : "") << ":\n";
+  for (const auto& record : simulation.by_difficulty) {
+    std::cout << "  " << record.difficulty << ": " << comparison.team1_name << " won " << percent(record.team1_win_rate)
+              << " of " << record.battles << " (95% CI " << percent(record.confidence_low) << "-"
+              << percent(record.confidence_high) << "), avg " << static_cast<int>(record.average_turns + 0.5)
+              << " turns\n";
+  }
+  
+  const auto& overall = simulation.overall;
+  std::cout << "\n⏱️ Battle Length (all levels):\n";
+  const int peak = overall.turn_histogram.empty()
+    ? 0 : *std::max_element(overall.turn_histogram.begin(), overall.turn_histogram.end());
+  for (size_t bucket = 0; bucket < overall.turn_histogram.size(); ++bucket) {
+    const int count = overall.turn_histogram[bucket];
+    if (count == 0) continue;
+    const int first_turn = static_cast<int>(bucket) * TeamBuilder::kTurnHistogramBucket;
+    std::cout << "  " << first_turn << "-" << first_turn + TeamBuilder::kTurnHistogramBucket - 1 << " turns: "
+              << std::string(peak > 0 ? std::max(1, count * 30 / peak) : 0, '#') << " " << count << "\n";
+  }
+  
+  const auto displayMembers = [](const std::string& header, const std::vector<TeamBuilder::SimulatedMemberStats>& members) {
+    std::cout << header << "\n";
+    for (const auto& member : members) {
+      std::cout << "  - " << member.name << ": " << member.knockouts << " KOs, fainted " << member.faints
+                << " times, MVP " << member.mvp_awards << "x\n";
+    }
+  };
+  std::cout << "\n";
+  displayMembers("🔵 " + comparison.team1_name + " Members:", simulation.team1_members);
+  displayMembers("🔴 " + comparison.team2_name + " Members:", simulation.team2_members);
+  std::cout << "\n";
+}
+
 // Helper function to handle team comparison
 void handleTeamComparison(std::shared_ptr<TeamBuilder> teamBuilder) {
   std::cout << "\n⚔️ Team Comparison Tool\n";
@@ -420,7 +471,29 @@ void handleTeamComparison(std::shared_ptr<TeamBuilder> teamBuilder) {
     std::cout << "  - " << pokemon.name << "\n";
   }
   
-  auto comparison = teamBuilder->compareTeams(team1, team2);
+  std::cout << "\nRun simulated battles for an empirical win rate? (y/n): ";
+  char simulate_choice;
+  std::cin >> simulate_choice;
+  std::cin.ignore();
+  
+  TeamBuilder::TeamComparison comparison;
+  if (simulate_choice == 'y' || simulate_choice == 'Y') {
+    TeamBuilder::ComparisonSettings settings;
+    settings.max_battles_per_difficulty = 100;
+    settings.seed = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    
+    std::cout << "\nSimulating at every AI level (press Ctrl+C to stop early)...\n";
+    comparisonCancelRequested = 0;
+    auto previous_handler = signal(SIGINT, comparisonInterruptHandler);
+    comparison = teamBuilder->compareTeams(team1, team2, settings, [](size_t completed, size_t total) {
+      displayProgressBar(completed, total, "battles");
+      return comparisonCancelRequested == 0;
+    });
+    signal(SIGINT, previous_handler);
+    std::cout << "\n";
+  } else {
+    comparison = teamBuilder->compareTeams(team1, team2);
+  }
   
   std::cout << "\n📊 Comparison Results:\n";
   std::cout << "═══════════════════════\n";
@@ -431,6 +504,10 @@ void handleTeamComparison(std::shared_ptr<TeamBuilder> teamBuilder) {
   
   std::cout << "💭 Battle Prediction: " << comparison.battle_prediction_reasoning << "\n\n";
   
+  if (comparison.simulation.performed) {
+    displayMatchupSimulation(comparison);
+  }
+  
   if (!comparison.team1_coverage_advantages.empty()) {
     std::cout << "🔵 " << comparison.team1_name << " Advantages:\n";
     for (const auto& advantage : comparison.team1_coverage_advantages) {
@@ -1134,8 +1211,8 @@ void conductTournamentBattle(std::shared_ptr<TournamentManager> tournamentManage
   }
 
   // Convert to battle format
-  Team battlePlayerTeam = createBattleTeamFromTemplate(playerTeam, teamBuilder);
-  Team battleOpponentTeam = createBattleTeamFromTemplate(opponentTeam, teamBuilder);
+  Team battlePlayerTeam = createBattleTeamFromTemplate(playerTeam);
+  Team battleOpponentTeam = createBattleTeamFromTemplate(opponentTeam);
 
   // Determine AI difficulty based on challenge
   Battle::AIDifficulty aiDifficulty = Battle::AIDifficulty::MEDIUM;
@@ -1219,6 +1296,9 @@ void conductTournamentBattle(std::shared_ptr<TournamentManager> tournamentManage
 int main() {
   // Set up signal handler for graceful interruption
   signal(SIGINT, signalHandler);
+
+  // POKEMON_TRACE=trace.json records a Chrome trace of the session
+  Trace::startFromEnvironment();
   
   // Get user's name with validation and sanitization
   std::string userName;
@@ -1363,7 +1443,7 @@ int main() {
   }
 
   // Convert TeamBuilder team to Battle team format
-  Team PlayerTeam = createBattleTeamFromTemplate(playerTeam, teamBuilder);
+  Team PlayerTeam = createBattleTeamFromTemplate(playerTeam);
 
   // Display player's team
   std::cout << "\n========================================================== Your Team ==========================================================\n";
@@ -1429,6 +1509,8 @@ int main() {
           std::cout << "Victories: " << stats->victories << "\n";
           std::cout << "Defeats: " << stats->defeats << "\n";
           std::cout << "Win Rate: " << static_cast<int>(stats->win_rate) << "%\n";
+          std::cout << "Rating: " << static_cast<int>(stats->rating) << " ± "
+                    << static_cast<int>(stats->rating_deviation) << "\n";
           std::cout << "Average Battle Length: " << static_cast<int>(stats->average_battle_length) << " turns\n";
           std::cout << "Average Effectiveness: " << static_cast<int>(stats->average_effectiveness_score) << "/100\n";
         } else {
@@ -1531,7 +1613,7 @@ int main() {
 
   // Get the opponent team from templates
   TeamBuilder::Team opponentBuilderTeam = opponentTemplateTeams[chosenOpponentNum - 1];
-  Team OppTeam = createBattleTeamFromTemplate(opponentBuilderTeam, teamBuilder);
+  Team OppTeam = createBattleTeamFromTemplate(opponentBuilderTeam);
 
   std::cout << "\nYou have selected " << opponentBuilderTeam.name << std::endl;
 
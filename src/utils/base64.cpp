@@ -0,0 +1,120 @@
+#include "base64.h"
+#include <array>
+
+namespace {
+
+constexpr char kStandardAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+constexpr char kUrlAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+constexpr uint8_t kInvalid = 0xFF;
+
+// Sextet value of every byte; both alphabets decode
+const std::array<uint8_t, 256>& decodeTable() {
+    static const std::array<uint8_t, 256> table = [] {
+        std::array<uint8_t, 256> values;
+        values.fill(kInvalid);
+        for (uint8_t i = 0; i < 64; ++i) {
+            values[static_cast<uint8_t>(kStandardAlphabet[i])] = i;
+            values[static_cast<uint8_t>(kUrlAlphabet[i])] = i;
+        }
+        return values;
+    }();
+    return table;
+}
+
+std::string encodeWith(const char* alphabet, const uint8_t* data, size_t length, bool pad) {
+    std::string text;
+    text.resize((length + 2) / 3 * 4);
+    char* out = &text[0];
+
+    size_t i = 0;
+    for (; i + 3 <= length; i += 3) {
+        const uint32_t group = (uint32_t(data[i]) << 16) | (uint32_t(data[i + 1]) << 8) | data[i + 2];
+        out[0] = alphabet[group >> 18];
+        out[1] = alphabet[(group >> 12) & 0x3F];
+        out[2] = alphabet[(group >> 6) & 0x3F];
+        out[3] = alphabet[group & 0x3F];
+        out += 4;
+    }
+
+    const size_t tail = length - i;
+    if (tail > 0) {
+        const uint32_t group = (uint32_t(data[i]) << 16) | (tail > 1 ? uint32_t(data[i + 1]) << 8 : 0);
+        *out++ = alphabet[group >> 18];
+        *out++ = alphabet[(group >> 12) & 0x3F];
+        if (tail > 1) {
+            *out++ = alphabet[(group >> 6) & 0x3F];
+        } else if (pad) {
+            *out++ = '=';
+        }
+        if (pad) {
+            *out++ = '=';
+        }
+    }
+
+    text.resize(static_cast<size_t>(out - text.data()));
+    return text;
+}
+
+} // namespace
+
+namespace Base64 {
+
+std::string encode(const uint8_t* data, size_t length) {
+    return encodeWith(kStandardAlphabet, data, length, true);
+}
+
+std::string encodeUrl(const uint8_t* data, size_t length) {
+    return encodeWith(kUrlAlphabet, data, length, false);
+}
+
+bool decode(const std::string& text, std::vector<uint8_t>& output) {
+    const auto& table = decodeTable();
+
+    size_t length = text.size();
+    while (length > 0 && text[length - 1] == '=') {
+        --length;
+    }
+    if (length % 4 == 1 || text.size() - length > 2) {
+        return false;
+    }
+
+    output.resize(length / 4 * 3 + (length % 4 == 0 ? 0 : length % 4 - 1));
+    const auto* in = reinterpret_cast<const uint8_t*>(text.data());
+    uint8_t* out = output.data();
+
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        const uint32_t a = table[in[i]], b = table[in[i + 1]], c = table[in[i + 2]], d = table[in[i + 3]];
+        if ((a | b | c | d) & 0x80) {
+            return false;
+        }
+        const uint32_t group = (a << 18) | (b << 12) | (c << 6) | d;
+        out[0] = static_cast<uint8_t>(group >> 16);
+        out[1] = static_cast<uint8_t>(group >> 8);
+        out[2] = static_cast<uint8_t>(group);
+        out += 3;
+    }
+
+    const size_t tail = length - i;
+    if (tail > 0) {
+        uint32_t group = 0;
+        for (size_t k = 0; k < tail; ++k) {
+            const uint32_t value = table[in[i + k]];
+            if (value & 0x80) {
+                return false;
+            }
+            group |= value << (18 - 6 * k);
+        }
+        // Bits past the last whole byte must be zero, so each byte string has one encoding
+        if (group & (tail == 2 ? 0xFFFFu : 0xFFu)) {
+            return false;
+        }
+        *out++ = static_cast<uint8_t>(group >> 16);
+        if (tail == 3) {
+            *out++ = static_cast<uint8_t>(group >> 8);
+        }
+    }
+    return true;
+}
+
+} // namespace Base64
@@ -0,0 +1,139 @@
+#include "binary_io.h"
+
+#include <array>
+#include <cstring>
+
+namespace BinaryIO {
+
+namespace {
+
+std::array<uint32_t, 256> buildCrcTable() {
+    std::array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1u) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+        }
+        table[i] = crc;
+    }
+    return table;
+}
+
+const std::array<uint32_t, 256>& crcTable() {
+    static const std::array<uint32_t, 256> table = buildCrcTable();
+    return table;
+}
+
+} // namespace
+
+uint32_t crc32(const void* data, size_t length, uint32_t seed) {
+    const auto& table = crcTable();
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint32_t crc = ~seed;
+    for (size_t i = 0; i < length; ++i) {
+        crc = table[(crc ^ bytes[i]) & 0xFFu] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+// ByteWriter implementation
+
+void ByteWriter::writeU16(uint16_t value) {
+    buffer_.push_back(static_cast<uint8_t>(value));
+    buffer_.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+void ByteWriter::writeU32(uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) {
+        buffer_.push_back(static_cast<uint8_t>(value >> shift));
+    }
+}
+
+void ByteWriter::writeU64(uint64_t value) {
+    for (int shift = 0; shift < 64; shift += 8) {
+        buffer_.push_back(static_cast<uint8_t>(value >> shift));
+    }
+}
+
+void ByteWriter::writeF64(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    writeU64(bits);
+}
+
+void ByteWriter::writeString(const std::string& value) {
+    writeU32(static_cast<uint32_t>(value.size()));
+    writeBytes(value.data(), value.size());
+}
+
+void ByteWriter::writeBytes(const void* data, size_t length) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    buffer_.insert(buffer_.end(), bytes, bytes + length);
+}
+
+// ByteReader implementation
+
+bool ByteReader::require(size_t bytes) {
+    if (!ok_ || length_ - offset_ < bytes) {
+        ok_ = false;
+        return false;
+    }
+    return true;
+}
+
+uint8_t ByteReader::readU8() {
+    if (!require(1)) return 0;
+    return data_[offset_++];
+}
+
+uint16_t ByteReader::readU16() {
+    if (!require(2)) return 0;
+    uint16_t value = static_cast<uint16_t>(data_[offset_] | (data_[offset_ + 1] << 8));
+    offset_ += 2;
+    return value;
+}
+
+uint32_t ByteReader::readU32() {
+    if (!require(4)) return 0;
+    uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) {
+        value |= static_cast<uint32_t>(data_[offset_ + i]) << (8 * i);
+    }
+    offset_ += 4;
+    return value;
+}
+
+uint64_t ByteReader::readU64() {
+    if (!require(8)) return 0;
+    uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value |= static_cast<uint64_t>(data_[offset_ + i]) << (8 * i);
+    }
+    offset_ += 8;
+    return value;
+}
+
+double ByteReader::readF64() {
+    uint64_t bits = readU64();
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+std::string ByteReader::readString() {
+    uint32_t length = readU32();
+    if (!require(length)) return std::string();
+    std::string value(reinterpret_cast<const char*>(data_ + offset_), length);
+    offset_ += length;
+    return value;
+}
+
+std::vector<uint8_t> frameRecord(const std::vector<uint8_t>& payload) {
+    ByteWriter framed;
+    framed.writeU32(static_cast<uint32_t>(payload.size()));
+    framed.writeU32(crc32(payload.data(), payload.size()));
+    framed.writeBytes(payload.data(), payload.size());
+    return framed.data();
+}
+
+} // namespace BinaryIO
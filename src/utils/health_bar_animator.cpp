@@ -2,8 +2,6 @@
 #include <algorithm>
 #include <cmath>
 #include <sstream>
-#include <thread>
-#include <chrono>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -17,42 +15,54 @@ void HealthBarAnimator::displayAnimatedHealth(const std::string& pokemonName,
                                             int currentHP, int maxHP,
                                             int previousHP,
                                             const std::string& statusCondition) const {
-    if (config_.speed == AnimationSpeed::DISABLED || previousHP == -1) {
-        displayStaticHealth(pokemonName, currentHP, maxHP, statusCondition);
+    postHealth(isPokemonPlayer(pokemonName) ? 0 : 1, pokemonName, currentHP, maxHP, previousHP, statusCondition);
+    updateHealthState(pokemonName, currentHP, maxHP);
+}
+
+void HealthBarAnimator::postHealth(int row, const std::string& pokemonName,
+                                   int currentHP, int maxHP,
+                                   int previousHP,
+                                   const std::string& statusCondition) const {
+    if (HealthBarRenderer* renderer = getRenderer()) {
+        renderer->post(row, pokemonName, currentHP, maxHP, previousHP, statusCondition);
         return;
     }
-
-    animateHealthTransition(pokemonName, previousHP, currentHP, maxHP, statusCondition);
-    updateHealthState(pokemonName, currentHP, maxHP);
+    displayStaticHealth(pokemonName, currentHP, maxHP, statusCondition);
 }
 
 void HealthBarAnimator::displayStaticHealth(const std::string& pokemonName,
                                           int currentHP, int maxHP,
                                           const std::string& statusCondition) const {
+    std::cout << formatHealthLine(pokemonName, currentHP, maxHP, statusCondition) + "\n";
+}
+
+std::string HealthBarAnimator::formatHealthLine(const std::string& pokemonName,
+                                                int currentHP, int maxHP,
+                                                const std::string& statusCondition) const {
     double healthPercent = calculateHealthPercentage(currentHP, maxHP);
     
-    std::cout << pokemonName << " HP: ";
+    std::string line = pokemonName + " HP: ";
     
     if (config_.colorTheme != ColorTheme::NONE) {
-        std::cout << getHealthColor(healthPercent);
+        line += getHealthColor(healthPercent);
     }
     
-    std::cout << renderHealthBar(healthPercent, config_.barLength);
+    line += renderHealthBar(healthPercent, config_.barLength);
     
     if (config_.colorTheme != ColorTheme::NONE) {
-        std::cout << getResetColor();
+        line += getResetColor();
     }
     
     if (config_.showPercentage) {
-        std::cout << " " << currentHP << "/" << maxHP;
-        std::cout << " (" << static_cast<int>(healthPercent) << "%)";
+        line += " " + std::to_string(currentHP) + "/" + std::to_string(maxHP);
+        line += " (" + std::to_string(static_cast<int>(healthPercent)) + "%)";
     }
     
     if (config_.showStatusCondition && !statusCondition.empty()) {
-        std::cout << " (" << statusCondition << ")";
+        line += " (" + statusCondition + ")";
     }
     
-    std::cout << std::endl;
+    return line;
 }
 
 bool HealthBarAnimator::supportsColors() {
@@ -149,69 +159,21 @@ std::string HealthBarAnimator::getResetColor() const {
     return "\033[0m";
 }
 
-void HealthBarAnimator::clearLine() const {
-    std::cout << "\r\033[K";  // Clear line and return to beginning
-    std::cout.flush();
-}
-
-void HealthBarAnimator::moveCursorUp(int lines) const {
-    if (lines > 0) {
-        std::cout << "\033[" << lines << "A";
-        std::cout.flush();
-    }
-}
-
-void HealthBarAnimator::animateHealthTransition(const std::string& pokemonName,
-                                              int fromHP, int toHP, int maxHP,
-                                              const std::string& statusCondition) const {
-    if (fromHP == toHP) {
-        displayStaticHealth(pokemonName, toHP, maxHP, statusCondition);
-        return;
-    }
-    
-    int hpDifference = std::abs(toHP - fromHP);
-    int steps = std::min(std::max(5, hpDifference / 5), 20);  // 5-20 steps
-    
-    for (int step = 0; step <= steps; ++step) {
-        double progress = static_cast<double>(step) / steps;
-        int currentAnimHP = fromHP + static_cast<int>((toHP - fromHP) * progress);
-        
-        // Clear previous line and display current state
-        if (step > 0) {
-            clearLine();
-        }
-        
-        double healthPercent = calculateHealthPercentage(currentAnimHP, maxHP);
-        
-        std::cout << pokemonName << " HP: ";
-        
-        if (config_.colorTheme != ColorTheme::NONE) {
-            std::cout << getHealthColor(healthPercent);
-        }
-        
-        std::cout << renderHealthBar(healthPercent, config_.barLength);
-        
-        if (config_.colorTheme != ColorTheme::NONE) {
-            std::cout << getResetColor();
-        }
-        
-        if (config_.showPercentage) {
-            std::cout << " " << currentAnimHP << "/" << maxHP;
-            std::cout << " (" << static_cast<int>(healthPercent) << "%)";
-        }
-        
-        if (config_.showStatusCondition && !statusCondition.empty()) {
-            std::cout << " (" << statusCondition << ")";
-        }
-        
-        std::cout.flush();
-        
-        if (step < steps) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(config_.stepDelayMs));
+HealthBarRenderer* HealthBarAnimator::getRenderer() const {
+    if (!rendererChecked_) {
+        rendererChecked_ = true;
+        if (config_.speed != AnimationSpeed::DISABLED) {
+            renderer_ = std::make_unique<HealthBarRenderer>(
+                [this](const std::string& name, int hp, int maxHP, const std::string& statusCondition) {
+                    return formatHealthLine(name, hp, maxHP, statusCondition);
+                },
+                config_.stepDelayMs);
+            if (!renderer_->start()) {
+                renderer_.reset();  // Not a terminal: print final values instead
+            }
         }
     }
-    
-    std::cout << std::endl;
+    return renderer_.get();
 }
 
 void HealthBarAnimator::updateHealthState(const std::string& pokemonName, int hp, int maxHP) const {
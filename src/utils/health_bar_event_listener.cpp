@@ -14,7 +14,8 @@ void HealthBarEventListener::onHealthChanged(const BattleEvents::HealthChangeEve
         return;
     }
     
-    updateHealthBar(event.pokemon, event.newHealth, event.oldHealth, event.source);
+    const std::string source = BattleEvents::describeSource(event);
+    updateHealthBar(event.pokemon, event.newHealth, event.oldHealth, source);
     
     // Optionally log the health change for debugging
     std::string pokemonName = getPokemonDisplayName(event.pokemon);
@@ -24,10 +25,10 @@ void HealthBarEventListener::onHealthChanged(const BattleEvents::HealthChangeEve
         std::cout << pokemonName << " healed " << (-event.damage) << " HP";
     }
     
-    if (!event.source.empty()) {
-        std::cout << " from " << event.source;
+    if (!source.empty()) {
+        std::cout << " from " << source;
     }
-    std::cout << std::endl;
+    std::cout << '\n';
 }
 
 void HealthBarEventListener::onBattleStart(const BattleEvents::BattleStartEvent& event) {
@@ -42,11 +43,9 @@ void HealthBarEventListener::onBattleStart(const BattleEvents::BattleStartEvent&
 
 void HealthBarEventListener::onPokemonSwitch(const BattleEvents::PokemonSwitchEvent& event) {
     if (event.newPokemon) {
+        // Registering shows the new Pokemon's bar (no previous health for switches)
         std::string prefix = event.isPlayerSwitch ? "Player" : "AI";
         registerPokemon(event.newPokemon, prefix);
-        
-        // Initialize health bar for the new Pokemon (no previous health for switches)
-        updateHealthBar(event.newPokemon, event.newPokemon->current_hp, -1, "switch");
     }
 }
 
@@ -73,16 +72,15 @@ void HealthBarEventListener::registerPokemon(Pokemon* pokemon, const std::string
     
     std::string name = displayName.empty() ? pokemon->name : displayName + " (" + pokemon->name + ")";
     pokemonDisplayNames_[pokemon] = name;
+    pokemonRows_[pokemon] = displayName == "Player" ? 0 : 1;
     
     // Display initial health bar
-    if (animator_) {
-        animator_->displayStaticHealth(name, pokemon->current_hp, pokemon->hp);
-        std::cout << "Registered " << name << " - HP: " << pokemon->current_hp << "/" << pokemon->hp << std::endl;
-    }
+    updateHealthBar(pokemon, pokemon->current_hp, -1, "");
 }
 
 void HealthBarEventListener::unregisterPokemon(Pokemon* pokemon) {
     pokemonDisplayNames_.erase(pokemon);
+    pokemonRows_.erase(pokemon);
 }
 
 bool HealthBarEventListener::isPokemonRegistered(Pokemon* pokemon) const {
@@ -98,9 +96,12 @@ void HealthBarEventListener::updateHealthBar(Pokemon* pokemon, int newHealth, in
     if (!animator_ || !pokemon) return;
     
     std::string pokemonName = getPokemonDisplayName(pokemon);
+    auto row = pokemonRows_.find(pokemon);
+    std::string statusCondition = pokemon->hasStatusCondition() ? pokemon->getStatusConditionName() : "";
     
-    // Display animated health transition  
-    animator_->displayAnimatedHealth(pokemonName, newHealth, pokemon->hp, previousHealth);
+    // Post the transition; the animator's render thread animates it
+    animator_->postHealth(row != pokemonRows_.end() ? row->second : 0, pokemonName, newHealth, pokemon->hp,
+                          previousHealth, statusCondition);
 }
 
 // Factory function implementation
@@ -0,0 +1,216 @@
+#include "health_bar_renderer.h"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+std::string moveTo(int row) {
+    return "\033[" + std::to_string(row) + ";1H";
+}
+
+} // namespace
+
+HealthBarRenderer::HealthBarRenderer(LineFormatter formatter, int frameDelayMs, int fd)
+    : formatter_(std::move(formatter)), frameDelay_(std::max(0, frameDelayMs)), fd_(fd), terminalRows_(0),
+      dirty_(false), drawing_(false), running_(false), framesWritten_(0) {}
+
+HealthBarRenderer::~HealthBarRenderer() {
+    stop();
+}
+
+bool HealthBarRenderer::start(int terminalRows) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return true;
+    }
+    if (terminalRows <= 0) {
+#ifdef _WIN32
+        return false;
+#else
+        winsize size{};
+        if (!isatty(fd_) || ioctl(fd_, TIOCGWINSZ, &size) != 0 || size.ws_row == 0) {
+            return false;
+        }
+        terminalRows = size.ws_row;
+#endif
+    }
+    terminalRows_ = terminalRows;
+    running_ = true;
+    thread_ = std::thread(&HealthBarRenderer::renderLoop, this);
+    return true;
+}
+
+void HealthBarRenderer::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    wake_.notify_all();
+    thread_.join();
+}
+
+bool HealthBarRenderer::isRunning() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return running_;
+}
+
+void HealthBarRenderer::post(int row, const std::string& name, int targetHP, int maxHP, int fromHP,
+                             const std::string& statusCondition) {
+    if (row < 0) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (static_cast<size_t>(row) >= bars_.size()) {
+            bars_.resize(row + 1, Bar{"", "", 0, 0, 0.0, 0.0, false});
+        }
+        Bar& bar = bars_[row];
+        if (!bar.used || bar.name != name) {
+            bar.shownHP = fromHP >= 0 ? fromHP : targetHP;  // A new Pokemon in this row starts fresh
+        }
+        bar.name = name;
+        bar.statusCondition = statusCondition;
+        bar.maxHP = maxHP;
+        bar.targetHP = targetHP;
+        bar.used = true;
+        if (frameDelay_.count() == 0) {
+            bar.shownHP = targetHP;
+        }
+
+        // Same pacing as the original blocking animation: 5-20 frames per change
+        const double distance = targetHP - bar.shownHP;
+        const int steps = std::min(std::max(5, static_cast<int>(std::abs(distance)) / 5), 20);
+        bar.step = distance / steps;
+        dirty_ = true;
+    }
+    wake_.notify_one();
+}
+
+void HealthBarRenderer::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this] { return !running_ || (!dirty_ && !drawing_ && !animating()); });
+}
+
+size_t HealthBarRenderer::getFramesWritten() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return framesWritten_;
+}
+
+std::string HealthBarRenderer::composeFrame(const std::vector<std::string>& shown,
+                                            const std::vector<std::string>& next, int terminalRows) {
+    const int rows = static_cast<int>(next.size());
+    const bool layout = next.size() > shown.size() && terminalRows > rows;
+
+    std::string frame;
+    for (int row = 0; row < rows; ++row) {
+        if (static_cast<size_t>(row) < shown.size() && shown[row] == next[row]) {
+            continue;
+        }
+        frame += moveTo(row + 1);
+        frame += "\033[2K";
+        frame += next[row];
+    }
+    if (frame.empty() && !layout) {
+        return frame;
+    }
+
+    if (layout) {
+        // Scroll only below the bars and continue the battle output at the bottom
+        const std::string region = "\033[" + std::to_string(rows + 1) + ";" + std::to_string(terminalRows) + "r";
+        return "\0337" + region + frame + moveTo(terminalRows);
+    }
+    return "\0337" + frame + "\0338";
+}
+
+bool HealthBarRenderer::animating() const {
+    return std::any_of(bars_.begin(), bars_.end(),
+                       [](const Bar& bar) { return bar.used && bar.shownHP != bar.targetHP; });
+}
+
+void HealthBarRenderer::advance() {
+    for (auto& bar : bars_) {
+        if (!bar.used || bar.shownHP == bar.targetHP) {
+            continue;
+        }
+        bar.shownHP += bar.step;
+        if ((bar.step > 0 && bar.shownHP >= bar.targetHP) || (bar.step <= 0 && bar.shownHP <= bar.targetHP)) {
+            bar.shownHP = bar.targetHP;
+        }
+    }
+}
+
+void HealthBarRenderer::renderLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        wake_.wait(lock, [this] { return !running_ || dirty_ || animating(); });
+        const bool stopping = !running_;
+        if (stopping) {
+            for (auto& bar : bars_) {
+                bar.shownHP = bar.targetHP;
+            }
+        } else if (!dirty_) {
+            advance();  // New targets are drawn as they are before they start moving
+        }
+        dirty_ = false;
+        drawing_ = true;
+        const std::vector<Bar> bars = bars_;
+        lock.unlock();
+
+        // Format and write outside the lock so posting never waits on the terminal
+        std::vector<std::string> next(bars.size());
+        for (size_t row = 0; row < bars.size(); ++row) {
+            if (bars[row].used) {
+                next[row] = formatter_(bars[row].name, static_cast<int>(std::lround(bars[row].shownHP)),
+                                       bars[row].maxHP, bars[row].statusCondition);
+            }
+        }
+        std::string frame = composeFrame(shownRows_, next, terminalRows_);
+        if (stopping && !next.empty()) {
+            frame += "\0337\033[r\0338";  // Release the scroll region
+        }
+        writeFrame(frame);
+        shownRows_ = stopping ? std::vector<std::string>() : std::move(next);
+
+        lock.lock();
+        drawing_ = false;
+        framesWritten_ += frame.empty() ? 0 : 1;
+        if (stopping) {
+            break;
+        }
+        if (animating()) {
+            wake_.wait_for(lock, frameDelay_, [this] { return !running_; });
+        } else {
+            idle_.notify_all();
+        }
+    }
+    idle_.notify_all();
+}
+
+void HealthBarRenderer::writeFrame(const std::string& frame) const {
+    size_t written = 0;
+    while (written < frame.size()) {
+#ifdef _WIN32
+        const int result = _write(fd_, frame.data() + written, static_cast<unsigned int>(frame.size() - written));
+#else
+        const ssize_t result = write(fd_, frame.data() + written, frame.size() - written);
+#endif
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        written += static_cast<size_t>(result);
+    }
+}
@@ -0,0 +1,183 @@
+#include "leaderboard_index.h"
+#include <algorithm>
+
+LeaderboardIndex::LeaderboardIndex(Order order)
+    : order(order), root(kNull), rng_state(0x9E3779B9u) {}
+
+void LeaderboardIndex::update(const std::string& player_name, double score) {
+    const auto it = scores.find(player_name);
+    if (it != scores.end()) {
+        if (it->second == score) {
+            return;  // Unchanged scores cost nothing
+        }
+        remove(player_name);
+    }
+
+    int32_t before = kNull;
+    int32_t after = kNull;
+    split(root, score, player_name, before, after);
+    root = merge(merge(before, allocate(player_name, score)), after);
+    scores[player_name] = score;
+}
+
+bool LeaderboardIndex::remove(const std::string& player_name) {
+    const auto it = scores.find(player_name);
+    if (it == scores.end()) {
+        return false;
+    }
+
+    root = erase(root, it->second, player_name);
+    scores.erase(it);
+    return true;
+}
+
+void LeaderboardIndex::clear() {
+    nodes.clear();
+    free_nodes.clear();
+    scores.clear();
+    root = kNull;
+}
+
+std::vector<std::pair<std::string, double>> LeaderboardIndex::top(int count) const {
+    const size_t limit = count > 0 ? std::min(static_cast<size_t>(count), scores.size()) : scores.size();
+    std::vector<std::pair<std::string, double>> result;
+    result.reserve(limit);
+    collect(root, limit, result);
+    return result;
+}
+
+size_t LeaderboardIndex::rank(const std::string& player_name) const {
+    const auto it = scores.find(player_name);
+    if (it == scores.end()) {
+        return 0;
+    }
+
+    size_t ahead = 0;
+    int32_t current = root;
+    while (current != kNull) {
+        const Node& node = nodes[current];
+        if (node.name == player_name) {
+            return ahead + sizeOf(node.left) + 1;
+        }
+        if (ranksBefore(it->second, player_name, node.score, node.name)) {
+            current = node.left;
+        } else {
+            ahead += sizeOf(node.left) + 1;
+            current = node.right;
+        }
+    }
+    return 0;
+}
+
+std::pair<std::string, double> LeaderboardIndex::at(size_t index) const {
+    int32_t current = root;
+    while (current != kNull) {
+        const Node& node = nodes[current];
+        const size_t left_size = sizeOf(node.left);
+        if (index < left_size) {
+            current = node.left;
+        } else if (index == left_size) {
+            return {node.name, node.score};
+        } else {
+            index -= left_size + 1;
+            current = node.right;
+        }
+    }
+    return {std::string(), 0.0};
+}
+
+bool LeaderboardIndex::ranksBefore(double score_a, const std::string& name_a,
+                                   double score_b, const std::string& name_b) const {
+    if (score_a != score_b) {
+        return order == Order::HIGHER_IS_BETTER ? score_a > score_b : score_a < score_b;
+    }
+    return name_a < name_b;
+}
+
+uint32_t LeaderboardIndex::nextPriority() {
+    // xorshift32: cheap, deterministic treap priorities
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+void LeaderboardIndex::pull(int32_t node) {
+    nodes[node].size = 1 + sizeOf(nodes[node].left) + sizeOf(nodes[node].right);
+}
+
+int32_t LeaderboardIndex::allocate(const std::string& name, double score) {
+    const Node node{name, score, nextPriority(), kNull, kNull, 1};
+    if (!free_nodes.empty()) {
+        const int32_t index = free_nodes.back();
+        free_nodes.pop_back();
+        nodes[index] = node;
+        return index;
+    }
+    nodes.push_back(node);
+    return static_cast<int32_t>(nodes.size() - 1);
+}
+
+void LeaderboardIndex::split(int32_t node, double score, const std::string& name,
+                             int32_t& before, int32_t& after) {
+    if (node == kNull) {
+        before = after = kNull;
+        return;
+    }
+
+    if (ranksBefore(nodes[node].score, nodes[node].name, score, name)) {
+        split(nodes[node].right, score, name, nodes[node].right, after);
+        before = node;
+    } else {
+        split(nodes[node].left, score, name, before, nodes[node].left);
+        after = node;
+    }
+    pull(node);
+}
+
+int32_t LeaderboardIndex::erase(int32_t node, double score, const std::string& name) {
+    if (node == kNull) {
+        return kNull;
+    }
+
+    if (nodes[node].name == name) {
+        const int32_t replacement = merge(nodes[node].left, nodes[node].right);
+        nodes[node].name.clear();
+        free_nodes.push_back(node);
+        return replacement;
+    }
+
+    if (ranksBefore(score, name, nodes[node].score, nodes[node].name)) {
+        nodes[node].left = erase(nodes[node].left, score, name);
+    } else {
+        nodes[node].right = erase(nodes[node].right, score, name);
+    }
+    pull(node);
+    return node;
+}
+
+int32_t LeaderboardIndex::merge(int32_t before, int32_t after) {
+    if (before == kNull) return after;
+    if (after == kNull) return before;
+
+    if (nodes[before].priority > nodes[after].priority) {
+        nodes[before].right = merge(nodes[before].right, after);
+        pull(before);
+        return before;
+    }
+    nodes[after].left = merge(before, nodes[after].left);
+    pull(after);
+    return after;
+}
+
+void LeaderboardIndex::collect(int32_t node, size_t limit,
+                               std::vector<std::pair<std::string, double>>& out) const {
+    if (node == kNull || out.size() >= limit) {
+        return;
+    }
+    collect(nodes[node].left, limit, out);
+    if (out.size() < limit) {
+        out.emplace_back(nodes[node].name, nodes[node].score);
+        collect(nodes[node].right, limit, out);
+    }
+}
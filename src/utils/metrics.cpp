@@ -0,0 +1,376 @@
+#include "metrics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+#include <thread>
+
+namespace Metrics {
+
+namespace detail {
+
+size_t nextShard() {
+    static std::atomic<size_t> next{0};
+    return next.fetch_add(1, std::memory_order_relaxed) % kShards;
+}
+
+} // namespace detail
+
+namespace {
+
+int highestBit(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#else
+    int bit = 0;
+    while (value >>= 1) {
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+uint64_t toBits(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+double fromBits(uint64_t bits) {
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void appendEscaped(std::string& out, const std::string& text) {
+    for (char c : text) {
+        if (c == '\\' || c == '"') {
+            out += '\\';
+            out += c;
+        } else if (c == '\n') {
+            out += "\\n";
+        } else {
+            out += c;
+        }
+    }
+}
+
+// {key="value",...}, or empty without labels
+std::string renderLabels(const Labels& labels, const char* quantile = nullptr) {
+    if (labels.empty() && !quantile) {
+        return "";
+    }
+    std::string text = "{";
+    for (const auto& [key, value] : labels) {
+        text += text.size() > 1 ? "," : "";
+        text += key + "=\"";
+        appendEscaped(text, value);
+        text += "\"";
+    }
+    if (quantile) {
+        text += text.size() > 1 ? "," : "";
+        text += "quantile=\"" + std::string(quantile) + "\"";
+    }
+    return text + "}";
+}
+
+std::string formatNumber(double value) {
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.9g", value);
+    return text;
+}
+
+template <typename Sample>
+const Sample* findSample(const std::vector<Sample>& samples, const std::string& name, const Labels& labels) {
+    for (const auto& sample : samples) {
+        if (sample.name == name && sample.labels == labels) {
+            return &sample;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+// ────────────────────────────────
+//  Counter / Gauge
+// ────────────────────────────────
+
+uint64_t Counter::value() const {
+    uint64_t total = 0;
+    for (const auto& shard : shards) {
+        total += shard.value.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void Gauge::set(double value) {
+    bits.store(toBits(value), std::memory_order_relaxed);
+}
+
+void Gauge::add(double delta) {
+    uint64_t expected = bits.load(std::memory_order_relaxed);
+    while (!bits.compare_exchange_weak(expected, toBits(fromBits(expected) + delta), std::memory_order_relaxed)) {
+    }
+}
+
+double Gauge::value() const {
+    return fromBits(bits.load(std::memory_order_relaxed));
+}
+
+// ────────────────────────────────
+//  Histogram
+// ────────────────────────────────
+
+size_t Histogram::bucketIndex(uint64_t value) {
+    constexpr uint64_t kExact = uint64_t{2} << kSubBucketBits;
+    if (value < kExact) {
+        return static_cast<size_t>(value);
+    }
+    const int exponent = highestBit(value);
+    const uint64_t sub_bucket = (value >> (exponent - kSubBucketBits)) & ((uint64_t{1} << kSubBucketBits) - 1);
+    return (static_cast<size_t>(exponent - kSubBucketBits + 1) << kSubBucketBits) + static_cast<size_t>(sub_bucket);
+}
+
+uint64_t Histogram::bucketLowerBound(size_t index) {
+    constexpr size_t kExact = size_t{2} << kSubBucketBits;
+    if (index < kExact) {
+        return index;
+    }
+    const int exponent = static_cast<int>(index >> kSubBucketBits) + kSubBucketBits - 1;
+    const uint64_t sub_bucket = index & ((size_t{1} << kSubBucketBits) - 1);
+    return ((uint64_t{1} << kSubBucketBits) + sub_bucket) << (exponent - kSubBucketBits);
+}
+
+uint64_t Histogram::bucketWidth(size_t index) {
+    constexpr size_t kExact = size_t{2} << kSubBucketBits;
+    if (index < kExact) {
+        return 1;
+    }
+    const int exponent = static_cast<int>(index >> kSubBucketBits) + kSubBucketBits - 1;
+    return uint64_t{1} << (exponent - kSubBucketBits);
+}
+
+void Histogram::record(uint64_t value) {
+    buckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    total.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(value, std::memory_order_relaxed);
+    uint64_t seen = maximum.load(std::memory_order_relaxed);
+    while (value > seen && !maximum.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t Histogram::quantile(double q) const {
+    const uint64_t count = total.load(std::memory_order_relaxed);
+    const uint64_t largest = maximum.load(std::memory_order_relaxed);
+    if (count == 0) {
+        return 0;
+    }
+    const double clamped = std::min(1.0, std::max(0.0, q));
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped * count)));
+
+    uint64_t seen = 0;
+    for (size_t index = 0; index < kBuckets; ++index) {
+        seen += buckets[index].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            // Middle of the bucket, never past the largest value recorded
+            return std::min(largest, bucketLowerBound(index) + bucketWidth(index) / 2);
+        }
+    }
+    return largest;   // Buckets still catching up with a concurrent record()
+}
+
+HistogramSummary Histogram::summarize() const {
+    HistogramSummary summary;
+    summary.count = count();
+    summary.sum = static_cast<double>(sum.load(std::memory_order_relaxed)) * unit;
+    summary.max = static_cast<double>(maximum.load(std::memory_order_relaxed)) * unit;
+    summary.p50 = static_cast<double>(quantile(0.5)) * unit;
+    summary.p90 = static_cast<double>(quantile(0.9)) * unit;
+    summary.p99 = static_cast<double>(quantile(0.99)) * unit;
+    return summary;
+}
+
+// ────────────────────────────────
+//  Snapshot
+// ────────────────────────────────
+
+double Snapshot::counter(const std::string& name, const Labels& labels) const {
+    const Value* sample = findSample(counters, name, labels);
+    return sample ? sample->value : 0.0;
+}
+
+double Snapshot::gauge(const std::string& name, const Labels& labels) const {
+    const Value* sample = findSample(gauges, name, labels);
+    return sample ? sample->value : 0.0;
+}
+
+const HistogramSummary* Snapshot::histogram(const std::string& name, const Labels& labels) const {
+    const Distribution* sample = findSample(histograms, name, labels);
+    return sample ? &sample->summary : nullptr;
+}
+
+// ────────────────────────────────
+//  Registry
+// ────────────────────────────────
+
+Registry& Registry::global() {
+    // Never destroyed: metrics may still be updated by other static destructors
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+Registry::Series& Registry::findOrAdd(const std::string& name, const std::string& help, const Labels& labels,
+                                      Type type, double unit) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto family = families.find(name);
+    if (family == families.end()) {
+        family = families.emplace(name, Family{type, help, {}}).first;
+    } else if (family->second.type != type) {
+        throw std::invalid_argument("Metric " + name + " is already registered with another type");
+    }
+
+    const std::string key = renderLabels(labels);
+    auto series = family->second.series.find(key);
+    if (series == family->second.series.end()) {
+        series = family->second.series.emplace(key, Series()).first;
+        series->second.labels = labels;
+        switch (type) {
+            case Type::COUNTER: series->second.counter = std::make_unique<Counter>(); break;
+            case Type::GAUGE: series->second.gauge = std::make_unique<Gauge>(); break;
+            case Type::HISTOGRAM: series->second.histogram = std::make_unique<Histogram>(unit); break;
+        }
+    }
+    return series->second;
+}
+
+Counter& Registry::counter(const std::string& name, const std::string& help, const Labels& labels) {
+    return *findOrAdd(name, help, labels, Type::COUNTER).counter;
+}
+
+Gauge& Registry::gauge(const std::string& name, const std::string& help, const Labels& labels) {
+    return *findOrAdd(name, help, labels, Type::GAUGE).gauge;
+}
+
+Histogram& Registry::histogram(const std::string& name, const std::string& help, const Labels& labels,
+                               double unit) {
+    return *findOrAdd(name, help, labels, Type::HISTOGRAM, unit).histogram;
+}
+
+Snapshot Registry::snapshot() const {
+    Snapshot snapshot;
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& [name, family] : families) {
+        for (const auto& entry : family.series) {
+            const Series& series = entry.second;
+            if (series.counter) {
+                snapshot.counters.push_back({name, series.labels, static_cast<double>(series.counter->value())});
+            } else if (series.gauge) {
+                snapshot.gauges.push_back({name, series.labels, series.gauge->value()});
+            } else if (series.histogram) {
+                snapshot.histograms.push_back({name, series.labels, series.histogram->summarize()});
+            }
+        }
+    }
+    return snapshot;
+}
+
+void Registry::writePrometheus(std::ostream& out) const {
+    static const char* const kTypeNames[] = {"counter", "gauge", "summary"};
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& [name, family] : families) {
+        out << "# HELP " << name << " " << family.help << "\n"
+            << "# TYPE " << name << " " << kTypeNames[static_cast<int>(family.type)] << "\n";
+        for (const auto& [labels, series] : family.series) {
+            if (series.counter) {
+                out << name << labels << " " << series.counter->value() << "\n";
+            } else if (series.gauge) {
+                out << name << labels << " " << formatNumber(series.gauge->value()) << "\n";
+            } else if (series.histogram) {
+                const HistogramSummary summary = series.histogram->summarize();
+                out << name << renderLabels(series.labels, "0.5") << " " << formatNumber(summary.p50) << "\n"
+                    << name << renderLabels(series.labels, "0.9") << " " << formatNumber(summary.p90) << "\n"
+                    << name << renderLabels(series.labels, "0.99") << " " << formatNumber(summary.p99) << "\n"
+                    << name << "_sum" << labels << " " << formatNumber(summary.sum) << "\n"
+                    << name << "_count" << labels << " " << summary.count << "\n";
+            }
+        }
+    }
+}
+
+bool Registry::writePrometheusFile(const std::string& path) const {
+    const std::string temp_path = path + ".tmp";
+    {
+        std::ofstream file(temp_path);
+        if (!file.is_open()) {
+            return false;
+        }
+        writePrometheus(file);
+        if (!file) {
+            return false;
+        }
+    }
+    return std::rename(temp_path.c_str(), path.c_str()) == 0;
+}
+
+// ────────────────────────────────
+//  File exporter
+// ────────────────────────────────
+
+namespace {
+
+struct FileExporter {
+    std::string path;
+    std::chrono::seconds interval{10};
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    bool stopping = false;
+    std::thread thread;
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!wakeup.wait_for(lock, interval, [this] { return stopping; })) {
+            Registry::global().writePrometheusFile(path);
+        }
+    }
+};
+
+} // namespace
+
+bool startFromEnvironment() {
+    // Leaked like the global registry, so the exit handler can still use it
+    static FileExporter* exporter = nullptr;
+    const char* path = std::getenv("POKEMON_METRICS");
+    if (!path || !*path || exporter) {
+        return false;
+    }
+
+    exporter = new FileExporter();
+    exporter->path = path;
+    if (const char* interval = std::getenv("POKEMON_METRICS_INTERVAL")) {
+        exporter->interval = std::chrono::seconds(std::max(1, std::atoi(interval)));
+    }
+    Registry::global();
+    exporter->thread = std::thread([] { exporter->run(); });
+    std::atexit([] {
+        {
+            std::lock_guard<std::mutex> lock(exporter->mutex);
+            exporter->stopping = true;
+        }
+        exporter->wakeup.notify_all();
+        exporter->thread.join();
+        if (!Registry::global().writePrometheusFile(exporter->path)) {
+            std::fprintf(stderr, "Could not write metrics to %s\n", exporter->path.c_str());
+        }
+    });
+    return true;
+}
+
+} // namespace Metrics
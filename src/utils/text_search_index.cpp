@@ -0,0 +1,137 @@
+#include "text_search_index.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+
+void TextSearchIndex::clear() {
+    term_ids.clear();
+    postings.clear();
+    vocabulary.clear();
+    document_count = 0;
+}
+
+std::vector<std::string> TextSearchIndex::tokenize(const std::string& text) {
+    std::vector<std::string> tokens;
+    std::string token;
+    for (char c : text) {
+        const unsigned char byte = static_cast<unsigned char>(c);
+        if (std::isalnum(byte)) {
+            token.push_back(static_cast<char>(std::tolower(byte)));
+        } else if (!token.empty()) {
+            tokens.push_back(std::move(token));
+            token.clear();
+        }
+    }
+    if (!token.empty()) {
+        tokens.push_back(std::move(token));
+    }
+    return tokens;
+}
+
+size_t TextSearchIndex::addDocument(const std::vector<std::pair<std::string, double>>& fields) {
+    const uint32_t document = static_cast<uint32_t>(document_count++);
+
+    std::unordered_map<uint32_t, float> frequencies;
+    for (const auto& [text, weight] : fields) {
+        for (const auto& token : tokenize(text)) {
+            auto it = term_ids.find(token);
+            if (it == term_ids.end()) {
+                it = term_ids.emplace(token, static_cast<uint32_t>(postings.size())).first;
+                postings.emplace_back();
+            }
+            frequencies[it->second] += static_cast<float>(weight);
+        }
+    }
+
+    for (const auto& [term, frequency] : frequencies) {
+        postings[term].push_back({document, frequency, 0.0f});
+    }
+    return document;
+}
+
+void TextSearchIndex::finalize() {
+    vocabulary.assign(term_ids.begin(), term_ids.end());
+    std::sort(vocabulary.begin(), vocabulary.end());
+
+    for (auto& list : postings) {
+        const double idf = std::log(1.0 + static_cast<double>(document_count) / list.size());
+        for (auto& posting : list) {
+            posting.weight = static_cast<float>(std::log1p(posting.frequency) * idf);
+        }
+    }
+}
+
+std::vector<TextSearchIndex::Hit> TextSearchIndex::search(const std::vector<std::string>& keywords,
+                                                          size_t max_results) const {
+    std::vector<double> totals(document_count, 0.0);
+    std::vector<char> matched_any(document_count, 0);
+
+    // Per-keyword state, reset through the touched list after each keyword
+    std::vector<double> keyword_scores(document_count, 0.0);
+    std::vector<uint16_t> tokens_matched(document_count, 0);
+    std::vector<uint32_t> token_stamp(document_count, 0);
+    std::vector<uint32_t> touched;
+    uint32_t stamp = 0;
+
+    for (const auto& keyword : keywords) {
+        const auto tokens = tokenize(keyword);
+        if (tokens.empty()) {
+            continue;
+        }
+
+        for (size_t t = 0; t < tokens.size(); ++t) {
+            const std::string& token = tokens[t];
+            ++stamp;
+
+            // Terms starting with the token form one range of the sorted vocabulary
+            auto it = std::lower_bound(vocabulary.begin(), vocabulary.end(), token,
+                                       [](const auto& entry, const std::string& value) { return entry.first < value; });
+            for (; it != vocabulary.end() && it->first.compare(0, token.size(), token) == 0; ++it) {
+                const double factor = it->first.size() == token.size() ? 1.0 : 0.5;
+                for (const auto& posting : postings[it->second]) {
+                    const uint32_t document = posting.document;
+                    if (token_stamp[document] != stamp) {
+                        // Only documents that matched every earlier token stay in the running
+                        if (tokens_matched[document] != t) {
+                            continue;
+                        }
+                        token_stamp[document] = stamp;
+                        tokens_matched[document] = static_cast<uint16_t>(t + 1);
+                        if (t == 0) {
+                            touched.push_back(document);
+                        }
+                    }
+                    keyword_scores[document] += factor * posting.weight;
+                }
+            }
+        }
+
+        for (uint32_t document : touched) {
+            if (tokens_matched[document] == tokens.size()) {
+                totals[document] += keyword_scores[document];
+                matched_any[document] = 1;
+            }
+            tokens_matched[document] = 0;
+            keyword_scores[document] = 0.0;
+        }
+        touched.clear();
+    }
+
+    std::vector<Hit> hits;
+    for (size_t document = 0; document < document_count; ++document) {
+        if (matched_any[document]) {
+            hits.push_back({document, totals[document]});
+        }
+    }
+
+    auto better = [](const Hit& a, const Hit& b) {
+        return a.score != b.score ? a.score > b.score : a.document < b.document;
+    };
+    if (max_results > 0 && max_results < hits.size()) {
+        std::partial_sort(hits.begin(), hits.begin() + max_results, hits.end(), better);
+        hits.resize(max_results);
+    } else {
+        std::sort(hits.begin(), hits.end(), better);
+    }
+    return hits;
+}
@@ -0,0 +1,184 @@
+#include "trace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+
+namespace Trace {
+
+namespace detail {
+std::atomic<bool> recording{false};
+}
+
+namespace {
+
+struct ThreadBuffer {
+    explicit ThreadBuffer(uint32_t id) : thread_id(id), events(kEventsPerThread) {}
+
+    uint32_t thread_id;
+    std::vector<Event> events;
+    std::atomic<uint64_t> written{0};   // Total appended; the ring holds the newest kEventsPerThread
+};
+
+// Buffers outlive their threads so short-lived workers still show up in the dump
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+std::atomic<int64_t> epoch_ns{0};
+
+int64_t steadyNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+ThreadBuffer& localBuffer() {
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+    if (!buffer) {
+        Registry& shared = registry();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        buffer = std::make_shared<ThreadBuffer>(static_cast<uint32_t>(shared.buffers.size() + 1));
+        shared.buffers.push_back(buffer);
+    }
+    return *buffer;
+}
+
+void writeEscaped(std::ostream& out, const char* text) {
+    for (const char* c = text; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+            out << '\\' << *c;
+        } else if (static_cast<unsigned char>(*c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(*c));
+            out << escaped;
+        } else {
+            out << *c;
+        }
+    }
+}
+
+void writeMicroseconds(std::ostream& out, uint64_t nanoseconds) {
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.3f", static_cast<double>(nanoseconds) / 1000.0);
+    out << text;
+}
+
+} // namespace
+
+void start() {
+    clear();
+    epoch_ns.store(steadyNanoseconds(), std::memory_order_relaxed);
+    detail::recording.store(true, std::memory_order_release);
+}
+
+void stop() {
+    detail::recording.store(false, std::memory_order_release);
+}
+
+void clear() {
+    Registry& shared = registry();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    for (const auto& buffer : shared.buffers) {
+        buffer->written.store(0, std::memory_order_relaxed);
+    }
+}
+
+uint64_t now() {
+    const int64_t elapsed = steadyNanoseconds() - epoch_ns.load(std::memory_order_relaxed);
+    return elapsed > 0 ? static_cast<uint64_t>(elapsed) : 0;
+}
+
+void record(const char* category, const char* name, uint64_t start_ns, uint64_t duration_ns) {
+    ThreadBuffer& buffer = localBuffer();
+    const uint64_t index = buffer.written.load(std::memory_order_relaxed);
+    buffer.events[index % kEventsPerThread] = Event{name, category, start_ns, duration_ns, buffer.thread_id};
+    buffer.written.store(index + 1, std::memory_order_release);
+}
+
+std::vector<Event> collect() {
+    std::vector<Event> events;
+    {
+        Registry& shared = registry();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        for (const auto& buffer : shared.buffers) {
+            const uint64_t written = buffer->written.load(std::memory_order_acquire);
+            const uint64_t kept = std::min<uint64_t>(written, kEventsPerThread);
+            for (uint64_t index = written - kept; index < written; ++index) {
+                events.push_back(buffer->events[index % kEventsPerThread]);
+            }
+        }
+    }
+    std::stable_sort(events.begin(), events.end(),
+                     [](const Event& lhs, const Event& rhs) { return lhs.start_ns < rhs.start_ns; });
+    return events;
+}
+
+uint64_t getDroppedCount() {
+    Registry& shared = registry();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    uint64_t dropped = 0;
+    for (const auto& buffer : shared.buffers) {
+        const uint64_t written = buffer->written.load(std::memory_order_acquire);
+        dropped += written > kEventsPerThread ? written - kEventsPerThread : 0;
+    }
+    return dropped;
+}
+
+void writeChromeTrace(std::ostream& out) {
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+        << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,"
+           "\"args\":{\"name\":\"Pokemon Battle Simulator\"}}";
+    for (const Event& event : collect()) {
+        out << ",\n{\"name\":\"";
+        writeEscaped(out, event.name);
+        out << "\",\"cat\":\"";
+        writeEscaped(out, event.category);
+        out << "\",\"ph\":\"X\",\"ts\":";
+        writeMicroseconds(out, event.start_ns);
+        out << ",\"dur\":";
+        writeMicroseconds(out, event.duration_ns);
+        out << ",\"pid\":1,\"tid\":" << event.thread_id << "}";
+    }
+    out << "\n]}\n";
+}
+
+bool writeChromeTrace(const std::string& path) {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+    writeChromeTrace(file);
+    return static_cast<bool>(file);
+}
+
+bool startFromEnvironment() {
+    static std::string exit_path;
+    const char* path = std::getenv("POKEMON_TRACE");
+    if (!path || !*path || !exit_path.empty()) {
+        return false;
+    }
+    exit_path = path;
+    registry();   // Constructed first, so it is still alive when the exit handler runs
+    std::atexit([] {
+        stop();
+        if (!writeChromeTrace(exit_path)) {
+            std::fprintf(stderr, "Could not write trace to %s\n", exit_path.c_str());
+        }
+    });
+    start();
+    return true;
+}
+
+} // namespace Trace
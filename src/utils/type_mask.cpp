@@ -0,0 +1,99 @@
+#include "type_mask.h"
+#include "type_effectiveness.h"
+#include <array>
+#include <unordered_map>
+
+namespace {
+
+// Multipliers in quarters (0, 2, 4, 8) so dual-type products stay exact
+struct MatchupTable {
+    std::vector<std::string> names;
+    std::unordered_map<std::string, int> indices;
+    std::array<std::array<int, TypeMasks::kTypeCount>, TypeMasks::kTypeCount> quarters;
+    std::array<TypeMask, TypeMasks::kTypeCount> super_effective;
+
+    MatchupTable() : names(TypeEffectiveness::getAllTypes()) {
+        for (int i = 0; i < TypeMasks::kTypeCount; ++i) {
+            indices[names[i]] = i;
+        }
+        for (int attacker = 0; attacker < TypeMasks::kTypeCount; ++attacker) {
+            super_effective[attacker] = 0;
+            for (int defender = 0; defender < TypeMasks::kTypeCount; ++defender) {
+                const double multiplier = TypeEffectiveness::getMultiplier(
+                    TypeEffectiveness::getEffectiveness(names[attacker], names[defender]));
+                quarters[attacker][defender] = static_cast<int>(multiplier * 4.0);
+                if (multiplier > 1.0) {
+                    super_effective[attacker] |= TypeMasks::bit(defender);
+                }
+            }
+        }
+    }
+};
+
+const MatchupTable& table() {
+    static const MatchupTable instance;  // Built once, thread-safe initialization
+    return instance;
+}
+
+} // namespace
+
+namespace TypeMasks {
+
+int typeIndex(const std::string& type) {
+    const auto& indices = table().indices;
+    auto it = indices.find(type);
+    return it != indices.end() ? it->second : -1;
+}
+
+const std::string& typeName(int type_index) {
+    return table().names[type_index];
+}
+
+TypeMask fromTypes(const std::vector<std::string>& types) {
+    TypeMask mask = 0;
+    for (const auto& type : types) {
+        mask |= bit(typeIndex(type));
+    }
+    return mask;
+}
+
+std::vector<std::string> toTypes(TypeMask mask) {
+    std::vector<std::string> types;
+    for (int i = 0; i < kTypeCount; ++i) {
+        if (mask & bit(i)) {
+            types.push_back(typeName(i));
+        }
+    }
+    return types;
+}
+
+TypeMask superEffectiveAgainst(int attacking_type) {
+    if (attacking_type < 0 || attacking_type >= kTypeCount) {
+        return 0;
+    }
+    return table().super_effective[attacking_type];
+}
+
+DefenseProfile defenseProfile(TypeMask defending_types) {
+    const auto& matchups = table();
+    DefenseProfile profile;
+    for (int attacker = 0; attacker < kTypeCount; ++attacker) {
+        int multiplier = 4;  // 1x in quarters
+        for (int defender = 0; defender < kTypeCount; ++defender) {
+            if (defending_types & bit(defender)) {
+                multiplier = multiplier * matchups.quarters[attacker][defender] / 4;
+            }
+        }
+
+        if (multiplier == 0) {
+            profile.immune |= bit(attacker);
+        } else if (multiplier > 4) {
+            profile.weak |= bit(attacker);
+        } else if (multiplier < 4) {
+            profile.resist |= bit(attacker);
+        }
+    }
+    return profile;
+}
+
+} // namespace TypeMasks
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "test_utils.h"
+#include "core/async_event_bus.h"
+#include "core/battle_simulator.h"
+
+using namespace BattleEvents;
+
+namespace {
+
+EventRecord turnRecord(int turn) {
+    return makeTurnRecord(EventType::TURN_START, turn);
+}
+
+class RecordingListener : public BattleEventListener {
+public:
+    std::vector<int> turns;
+    int health_changes = 0;
+    int battle_ends = 0;
+
+    void onTurnStart(int turnNumber) override { turns.push_back(turnNumber); }
+    void onHealthChanged(const HealthChangeEvent&) override { health_changes++; }
+    void onBattleEnd(const BattleEndEvent&) override { battle_ends++; }
+};
+
+Team makeTeam(int strength) {
+    std::vector<Pokemon> members;
+    for (int i = 0; i < 2; ++i) {
+        Pokemon pokemon = TestUtils::createTestPokemon(
+            "mon" + std::to_string(strength) + "_" + std::to_string(i),
+            80 + strength * 10, 60 + strength * 10, 60, 60, 60, 50, {"normal"}, {});
+        Move move = TestUtils::createTestMove("tackle", 40 + strength * 10, 100, 35, "normal", "physical");
+        move.multi_turn_behavior = MultiTurnBehavior::NONE;
+        move.is_weather_dependent = false;
+        move.boosts_defense_on_charge = false;
+        pokemon.moves.push_back(move);
+        members.push_back(pokemon);
+    }
+    return TestUtils::createTestTeam(members);
+}
+
+} // namespace
+
+TEST(EventRingBufferTest, PoliciesHandleAFullBuffer) {
+    EventRingBuffer drop_oldest(3, EventRingBuffer::Policy::DROP_OLDEST);
+    EXPECT_EQ(drop_oldest.getCapacity(), 4u);
+    for (int turn = 1; turn <= 6; ++turn) {
+        EXPECT_TRUE(drop_oldest.push(turnRecord(turn)));
+    }
+    EXPECT_EQ(drop_oldest.getDroppedCount(), 2u);
+    EventRecord record;
+    ASSERT_TRUE(drop_oldest.pop(record));
+    EXPECT_EQ(record.new_value, 3);  // Turns 1 and 2 were evicted
+
+    EventRingBuffer sample(8, EventRingBuffer::Policy::SAMPLE, 4);
+    int kept = 0;
+    for (int turn = 0; turn < 20; ++turn) {
+        kept += sample.push(turnRecord(turn)) ? 1 : 0;
+    }
+    // Four fill the empty half, then one in four of the rest until full
+    EXPECT_EQ(kept, 8);
+    EXPECT_EQ(sample.size(), 8u);
+    EXPECT_EQ(sample.getDroppedCount(), static_cast<uint64_t>(20 - kept));
+
+    EventRingBuffer block(2, EventRingBuffer::Policy::BLOCK);
+    EXPECT_TRUE(block.push(turnRecord(1)));
+    EXPECT_TRUE(block.push(turnRecord(2)));
+    EXPECT_FALSE(block.tryPush(turnRecord(3)));
+    block.close();
+    EXPECT_FALSE(block.push(turnRecord(3)));  // Would block forever if not closed
+    EXPECT_EQ(block.getDroppedCount(), 1u);
+}
+
+TEST(EventRingBufferTest, ConcurrentProducersLoseNothingWhenBlocking) {
+    EventRingBuffer ring(16, EventRingBuffer::Policy::BLOCK);
+    constexpr int kProducers = 3;
+    constexpr int kPerProducer = 2000;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&ring, p]() {
+            for (int i = 0; i < kPerProducer; ++i) {
+                EventRecord record = turnRecord(i);
+                record.sequence = static_cast<uint64_t>(p);
+                ring.push(record);
+            }
+        });
+    }
+
+    std::vector<int> next(kProducers, 0);
+    int received = 0;
+    EventRecord record;
+    while (received < kProducers * kPerProducer) {
+        if (!ring.pop(record)) {
+            std::this_thread::yield();
+            continue;
+        }
+        // Each producer's records arrive in its own order
+        EXPECT_EQ(record.new_value, next[record.sequence]++);
+        received++;
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_EQ(ring.getDroppedCount(), 0u);
+}
+
+TEST(AsyncEventBusTest, DeliversSimulatedBattleToListeners) {
+    AsyncEventBus bus;
+    auto listener = std::make_shared<RecordingListener>();
+    std::mutex mutex;
+    std::vector<uint64_t> sequences;
+    const int listener_index = bus.addConsumer(listener);
+    bus.addConsumer([&](const EventRecord& record) {
+        std::lock_guard<std::mutex> lock(mutex);
+        sequences.push_back(record.sequence);
+    });
+    bus.start();
+    EXPECT_EQ(bus.addConsumer(listener), -1);  // Too late once running
+
+    auto forwarder = std::shared_ptr<AsyncEventBus>(&bus, [](AsyncEventBus*) {});
+    BattleEventManager manager;
+    manager.subscribe(forwarder);
+    Team a = makeTeam(3);
+    Team b = makeTeam(1);
+    BattleSimulator::Options options;
+    options.seed = 42;
+    const auto result = BattleSimulator::simulateInPlace(a, b, options, manager);
+    bus.flush();
+
+    EXPECT_EQ(bus.getConsumedCount(listener_index), bus.getPublishedCount());
+    ASSERT_EQ(listener->turns.size(), static_cast<size_t>(result.turns));
+    for (int turn = 0; turn < result.turns; ++turn) {
+        EXPECT_EQ(listener->turns[turn], turn + 1);
+    }
+    EXPECT_GT(listener->health_changes, 0);
+    EXPECT_EQ(listener->battle_ends, 1);
+    bus.stop();
+
+    ASSERT_EQ(sequences.size(), bus.getPublishedCount());
+    for (size_t i = 0; i < sequences.size(); ++i) {
+        EXPECT_EQ(sequences[i], i);
+    }
+}
+
+TEST(AsyncEventBusTest, SlowConsumerDoesNotStallPublisher) {
+    AsyncEventBus bus;
+    AsyncEventBus::ConsumerOptions options;
+    options.capacity = 8;
+    options.policy = EventRingBuffer::Policy::DROP_OLDEST;
+    const int slow = bus.addConsumer([](const EventRecord&) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }, options);
+    bus.start();
+
+    const auto started = std::chrono::steady_clock::now();
+    for (int turn = 0; turn < 500; ++turn) {
+        bus.onTurnStart(turn);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - started;
+    EXPECT_LT(elapsed, std::chrono::milliseconds(500));  // 500 handled events would take 10s
+
+    bus.flush();
+    EXPECT_GT(bus.getDroppedCount(slow), 0u);
+    EXPECT_EQ(bus.getConsumedCount(slow) + bus.getDroppedCount(slow), 500u);
+    bus.stop();
+    bus.onTurnStart(1);  // Ignored once stopped
+    EXPECT_EQ(bus.getPublishedCount(), 500u);
+}
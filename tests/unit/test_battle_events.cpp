@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include "test_utils.h"
+#include "core/battle_events.h"
+#include "core/battle_simulator.h"
+#include "core/weather.h"
+
+using namespace BattleEvents;
+
+namespace {
+
+class CountingListener : public BattleEventListener {
+public:
+    int health_changes = 0;
+    int turns_started = 0;
+    int turns_ended = 0;
+    int moves = 0;
+    int switches = 0;
+    int battle_starts = 0;
+    int battle_ends = 0;
+    int damage_taken = 0;
+    std::function<void()> on_health;
+
+    void onHealthChanged(const HealthChangeEvent& event) override {
+        health_changes++;
+        if (event.damage > 0) {
+            damage_taken += event.damage;
+        }
+        if (on_health) {
+            on_health();
+        }
+    }
+    void onTurnStart(int) override { turns_started++; }
+    void onTurnEnd(int) override { turns_ended++; }
+    void onMoveUsed(const MoveUsedEvent&) override { moves++; }
+    void onPokemonSwitch(const PokemonSwitchEvent&) override { switches++; }
+    void onBattleStart(const BattleStartEvent&) override { battle_starts++; }
+    void onBattleEnd(const BattleEndEvent&) override { battle_ends++; }
+};
+
+// Listener for the compile-time dispatcher; no base class needed
+struct TurnCounter {
+    int turns = 0;
+    void onTurnStart(int) { turns++; }
+    void onTurnEnd(int) {}
+    void onHealthChanged(const HealthChangeEvent&) {}
+};
+
+} // namespace
+
+class BattleEventsTest : public ::testing::Test {
+protected:
+    static Team makeTeam(int strength) {
+        std::vector<Pokemon> members;
+        for (int i = 0; i < 2; ++i) {
+            Pokemon pokemon = TestUtils::createTestPokemon(
+                "mon" + std::to_string(strength) + "_" + std::to_string(i),
+                80 + strength * 10, 60 + strength * 10, 60, 60, 60, 50 + strength * 5, {"normal"}, {});
+            Move move = TestUtils::createTestMove("tackle", 40 + strength * 10, 100, 35, "normal", "physical");
+            move.multi_turn_behavior = MultiTurnBehavior::NONE;
+            move.is_weather_dependent = false;
+            move.boosts_defense_on_charge = false;
+            pokemon.moves.push_back(move);
+            members.push_back(pokemon);
+        }
+        return TestUtils::createTestTeam(members);
+    }
+
+    Pokemon pokemon = TestUtils::createTestPokemon("target", 100, 50, 50, 50, 50, 50, {"normal"}, {});
+};
+
+TEST_F(BattleEventsTest, ListenersMayUnsubscribeDuringDispatch) {
+    BattleEventManager manager;
+    auto first = std::make_shared<CountingListener>();
+    auto second = std::make_shared<CountingListener>();
+    manager.subscribe(first);
+    manager.subscribe(second);
+    manager.subscribe(first);  // Duplicate is ignored
+    EXPECT_EQ(manager.getListenerCount(), 2u);
+
+    const uint64_t generation = manager.getGeneration();
+    first->on_health = [&]() { manager.unsubscribe(second); };
+    const auto event = BattleEventManager::createHealthChangeEvent(&pokemon, 100, 90, EventSource::MOVE);
+    manager.notifyHealthChanged(event);
+
+    // Removal takes effect immediately, including for the running dispatch
+    EXPECT_EQ(first->health_changes, 1);
+    EXPECT_EQ(second->health_changes, 0);
+    EXPECT_EQ(manager.getListenerCount(), 1u);
+    EXPECT_GT(manager.getGeneration(), generation);
+
+    first->on_health = [&]() { manager.clear(); };
+    manager.notifyHealthChanged(event);
+    EXPECT_FALSE(manager.hasListeners());
+    manager.notifyHealthChanged(event);
+    EXPECT_EQ(first->health_changes, 2);
+}
+
+TEST_F(BattleEventsTest, SourceTagsDescribeTheirCause) {
+    Pokemon attacker = TestUtils::createTestPokemon("pikachu", 100, 50, 50, 50, 50, 50, {"electric"}, {});
+    Move move = TestUtils::createTestMove("thunderbolt", 90, 100, 15, "electric", "special");
+
+    EXPECT_EQ(describeSource(BattleEventManager::createHealthChangeEvent(
+        &pokemon, 100, 50, EventSource::MOVE, &attacker, &move)), "pikachu's thunderbolt");
+    EXPECT_EQ(describeSource(BattleEventManager::createHealthChangeEvent(
+        &pokemon, 100, 0, EventSource::OHKO_MOVE, &attacker, &move)), "pikachu's thunderbolt (OHKO)");
+    EXPECT_EQ(describeSource(BattleEventManager::createHealthChangeEvent(
+        &attacker, 50, 75, EventSource::DRAIN, &attacker, &move)), "thunderbolt (drain)");
+    EXPECT_EQ(describeSource(BattleEventManager::createWeatherDamageEvent(
+        &pokemon, 100, 94, WeatherCondition::SANDSTORM)), Weather::getWeatherName(WeatherCondition::SANDSTORM) + " damage");
+    EXPECT_EQ(describeSource(BattleEventManager::createStatusDamageEvent(
+        &pokemon, 100, 88, StatusCondition::POISON)), "Poisoned damage");
+}
+
+TEST_F(BattleEventsTest, StaticDispatcherCallsListenersDirectly) {
+    TurnCounter counter;
+    StaticEventDispatcher<TurnCounter> dispatcher(counter);
+    static_assert(StaticEventDispatcher<TurnCounter>::hasListeners(), "one listener");
+    static_assert(!NullEventDispatcher::hasListeners(), "no listeners");
+
+    dispatcher.notifyTurnStart(1);
+    dispatcher.notifyTurnStart(2);
+    EXPECT_EQ(counter.turns, 2);
+}
+
+TEST_F(BattleEventsTest, SimulatorReportsEventsWithoutChangingTheBattle) {
+    const Team strong = makeTeam(4);
+    const Team weak = makeTeam(1);
+    BattleSimulator::Options options;
+    options.seed = 41;
+
+    Team a = strong;
+    Team b = weak;
+    BattleEventManager manager;
+    auto listener = std::make_shared<CountingListener>();
+    manager.subscribe(listener);
+    const auto observed = BattleSimulator::simulateInPlace(a, b, options, manager);
+    const auto plain = BattleSimulator::simulate(strong, weak, options);
+
+    EXPECT_EQ(observed.outcome, plain.outcome);
+    EXPECT_EQ(observed.turns, plain.turns);
+    EXPECT_DOUBLE_EQ(observed.team_a_hp_fraction, plain.team_a_hp_fraction);
+
+    EXPECT_EQ(listener->battle_starts, 1);
+    EXPECT_EQ(listener->battle_ends, 1);
+    EXPECT_EQ(listener->turns_started, observed.turns);
+    EXPECT_EQ(listener->turns_ended, observed.turns);
+    EXPECT_GE(listener->moves, observed.turns);
+    EXPECT_GT(listener->health_changes, 0);
+    EXPECT_GE(listener->switches, 1);  // The weak team's lead fainted and was replaced
+
+    // All damage reported adds up to the HP the teams lost
+    int lost = 0;
+    for (const Team* team : {&a, &b}) {
+        for (const auto& [_, member] : *team) {
+            lost += member.hp - member.current_hp;
+        }
+    }
+    EXPECT_GE(listener->damage_taken, lost);
+}
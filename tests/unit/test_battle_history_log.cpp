@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include "core/battle_history_log.h"
+
+namespace fs = std::filesystem;
+
+class BattleHistoryLogTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_dir = fs::temp_directory_path() /
+                   ("battle_history_log_test_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) +
+                    "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        fs::remove_all(test_dir);
+        fs::create_directories(test_dir);
+        log_path = (test_dir / "battle_history.log").string();
+        snapshot_path = (test_dir / "team_statistics.snapshot").string();
+    }
+
+    void TearDown() override {
+        fs::remove_all(test_dir);
+    }
+
+    static BattleHistoryLog::BattleRecord makeRecord(const std::string& team, bool victory, int turns,
+                                                     double effectiveness) {
+        BattleHistoryLog::BattleRecord record;
+        record.team_name = team;
+        record.opponent_team = "Rival";
+        record.battle_date = "2024-01-01 12:00:00";
+        record.victory = victory;
+        record.turns_taken = turns;
+        record.difficulty_level = "Medium";
+        record.team_effectiveness_score = effectiveness;
+        record.strategies_used = {"sweep"};
+        return record;
+    }
+
+    fs::path test_dir;
+    std::string log_path;
+    std::string snapshot_path;
+};
+
+TEST_F(BattleHistoryLogTest, AppendUpdatesStatisticsIncrementally) {
+    BattleHistoryLog log(log_path, snapshot_path);
+    ASSERT_TRUE(log.open());
+
+    EXPECT_TRUE(log.append(makeRecord("Alpha", true, 10, 80.0)));
+    EXPECT_TRUE(log.append(makeRecord("Alpha", false, 20, 40.0)));
+    EXPECT_TRUE(log.append(makeRecord("Beta", true, 5, 90.0)));
+
+    auto stats = log.getStatistics("Alpha");
+    ASSERT_TRUE(stats.has_value());
+    EXPECT_EQ(stats->total_battles, 2);
+    EXPECT_EQ(stats->victories, 1);
+    EXPECT_EQ(stats->defeats, 1);
+    EXPECT_DOUBLE_EQ(stats->win_rate, 50.0);
+    EXPECT_DOUBLE_EQ(stats->average_battle_length, 15.0);
+    EXPECT_DOUBLE_EQ(stats->average_effectiveness_score, 60.0);
+
+    EXPECT_FALSE(log.getStatistics("Gamma").has_value());
+    EXPECT_EQ(log.getRecordCount(), 3u);
+}
+
+TEST_F(BattleHistoryLogTest, ReopenReplaysLogWithoutSnapshot) {
+    {
+        BattleHistoryLog log(log_path, snapshot_path);
+        ASSERT_TRUE(log.open());
+        for (int i = 0; i < 10; ++i) {
+            log.append(makeRecord("Alpha", i % 2 == 0, i + 1, 50.0));
+        }
+    }
+    fs::remove(snapshot_path);
+
+    BattleHistoryLog reopened(log_path, snapshot_path);
+    ASSERT_TRUE(reopened.open());
+    auto stats = reopened.getStatistics("Alpha");
+    ASSERT_TRUE(stats.has_value());
+    EXPECT_EQ(stats->total_battles, 10);
+    EXPECT_EQ(stats->victories, 5);
+
+    auto records = reopened.getRecords("Alpha", 3);
+    ASSERT_EQ(records.size(), 3u);
+    EXPECT_EQ(records.back().turns_taken, 10);
+    EXPECT_EQ(records.back().strategies_used.size(), 1u);
+}
+
+TEST_F(BattleHistoryLogTest, SnapshotPlusTailReplay) {
+    BattleHistoryLog::Settings settings;
+    settings.snapshot_interval = 0;
+    {
+        BattleHistoryLog log(log_path, snapshot_path, settings);
+        ASSERT_TRUE(log.open());
+        log.append(makeRecord("Alpha", true, 10, 70.0));
+        log.append(makeRecord("Alpha", true, 12, 70.0));
+        ASSERT_TRUE(log.writeSnapshot());
+        log.append(makeRecord("Alpha", false, 30, 10.0));
+    }
+
+    BattleHistoryLog reopened(log_path, snapshot_path, settings);
+    ASSERT_TRUE(reopened.open());
+    auto stats = reopened.getStatistics("Alpha");
+    ASSERT_TRUE(stats.has_value());
+    EXPECT_EQ(stats->total_battles, 3);
+    EXPECT_EQ(stats->victories, 2);
+    EXPECT_EQ(reopened.getRecords("Alpha", 0).size(), 3u);
+}
+
+TEST_F(BattleHistoryLogTest, TornTailIsDiscarded) {
+    BattleHistoryLog::Settings settings;
+    settings.snapshot_interval = 0;
+    uint64_t size_before_last = 0;
+    {
+        BattleHistoryLog log(log_path, snapshot_path, settings);
+        ASSERT_TRUE(log.open());
+        log.append(makeRecord("Alpha", true, 10, 70.0));
+        size_before_last = log.getLogSizeBytes();
+        log.append(makeRecord("Alpha", false, 10, 70.0));
+    }
+    fs::remove(snapshot_path);
+
+    // Simulate a crash halfway through the last append
+    fs::resize_file(log_path, fs::file_size(log_path) - 5);
+
+    BattleHistoryLog reopened(log_path, snapshot_path, settings);
+    ASSERT_TRUE(reopened.open());
+    EXPECT_EQ(reopened.getLogSizeBytes(), size_before_last);
+    auto stats = reopened.getStatistics("Alpha");
+    ASSERT_TRUE(stats.has_value());
+    EXPECT_EQ(stats->total_battles, 1);
+
+    // New appends land after the last intact frame
+    EXPECT_TRUE(reopened.append(makeRecord("Alpha", true, 8, 70.0)));
+    EXPECT_EQ(reopened.getRecords("Alpha", 0).size(), 2u);
+}
+
+TEST_F(BattleHistoryLogTest, ClearTeamAndCompaction) {
+    BattleHistoryLog::Settings settings;
+    settings.compaction_min_bytes = 1ull << 40;  // Compact manually only
+    BattleHistoryLog log(log_path, snapshot_path, settings);
+    ASSERT_TRUE(log.open());
+
+    for (int i = 0; i < 20; ++i) {
+        log.append(makeRecord("Alpha", true, 10, 50.0));
+    }
+    log.append(makeRecord("Beta", false, 7, 25.0));
+
+    ASSERT_TRUE(log.clearTeam("Alpha"));
+    EXPECT_FALSE(log.getStatistics("Alpha").has_value());
+    EXPECT_GT(log.getDeadBytes(), 0u);
+
+    // Records written after a clear are live again
+    log.append(makeRecord("Alpha", false, 3, 10.0));
+
+    const uint64_t size_before = log.getLogSizeBytes();
+    ASSERT_TRUE(log.compact());
+    EXPECT_LT(log.getLogSizeBytes(), size_before);
+    EXPECT_EQ(log.getDeadBytes(), 0u);
+
+    size_t streamed = 0;
+    EXPECT_TRUE(log.forEachRecord([&](const BattleHistoryLog::BattleRecord&) { streamed++; }));
+    EXPECT_EQ(streamed, 2u);
+
+    auto alpha = log.getStatistics("Alpha");
+    ASSERT_TRUE(alpha.has_value());
+    EXPECT_EQ(alpha->total_battles, 1);
+
+    // Compaction installs a snapshot matching the rewritten log
+    BattleHistoryLog reopened(log_path, snapshot_path, settings);
+    ASSERT_TRUE(reopened.open());
+    EXPECT_EQ(reopened.getRecordCount(), 2u);
+    EXPECT_EQ(reopened.getStatistics("Alpha")->total_battles, 1);
+}
+
+TEST_F(BattleHistoryLogTest, ImportsLegacyJsonOnFirstOpen) {
+    const std::string legacy_path = (test_dir / "battle_history.json").string();
+    {
+        std::ofstream legacy(legacy_path);
+        legacy << R"({"battle_history": {"Legacy": [
+            {"team_name": "Legacy", "opponent_team": "A", "battle_date": "d", "victory": true,
+             "turns_taken": 4, "difficulty_level": "Easy", "team_effectiveness_score": 60.0},
+            {"team_name": "Legacy", "opponent_team": "B", "battle_date": "d", "victory": false,
+             "turns_taken": 8, "difficulty_level": "Hard", "team_effectiveness_score": 20.0}
+        ]}})";
+    }
+
+    BattleHistoryLog log(log_path, snapshot_path);
+    ASSERT_TRUE(log.open(legacy_path));
+    auto stats = log.getStatistics("Legacy");
+    ASSERT_TRUE(stats.has_value());
+    EXPECT_EQ(stats->total_battles, 2);
+    EXPECT_DOUBLE_EQ(stats->average_battle_length, 6.0);
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <type_traits>
+#include "core/battle_log.h"
+
+using BattleLog::Level;
+using BattleLog::Message;
+
+TEST(BattleLogTest, CatalogMessagesFormatTheirArguments) {
+    std::string line;
+    BattleLog::formatMessage(line, Message::RESTORED_HP, {"Chansey", 120, 50});
+    EXPECT_EQ(line, "Chansey restored 120 HP! (50% heal)");
+
+    line.clear();
+    BattleLog::formatMessage(line, Message::HURT_BY_WEATHER, {std::string("Pikachu"), "Hail", 6});
+    EXPECT_EQ(line, "Pikachu is hurt by Hail! (-6 HP)");
+
+    line.clear();
+    BattleLog::formatMessage(line, Message::ONE_HIT_KO, {});
+    EXPECT_EQ(line, "It's a one-hit KO!");
+}
+
+TEST(BattleLogTest, LevelsFilterMessages) {
+    std::ostringstream out;
+    BattleLog::Logger log(Level::SUMMARY, out);
+    log.log(Message::USED_MOVE, "Charizard", "flamethrower");   // VERBOSE
+    log.log(Message::FAINTED, "Venusaur");                      // SUMMARY
+    EXPECT_EQ(out.str(), "\nVenusaur has fainted!\n");
+
+    log.setLevel(Level::VERBOSE);
+    log.log(Message::USED_MOVE, "Charizard", "flamethrower");
+    log.log(Message::FALLBACK_RECHARGE);                        // DEBUG
+    EXPECT_EQ(out.str(), "\nVenusaur has fainted!\nCharizard used flamethrower!\n");
+
+    log.setLevel(Level::SILENT);
+    EXPECT_FALSE(log.enabled(Level::SUMMARY));
+    log.log(Message::PLAYER_WINS);
+    EXPECT_EQ(out.str(), "\nVenusaur has fainted!\nCharizard used flamethrower!\n");
+}
+
+TEST(BattleLogTest, FragmentsBuildOneLine) {
+    std::ostringstream out;
+    BattleLog::Logger log(Level::VERBOSE, out);
+    log.append(Message::HIT_NUMBER, 2);
+    log.append(Message::DAMAGE_DEALT, 17);
+    log.append(Message::CRITICAL_HIT);
+    log.append(Message::SUPER_EFFECTIVE);
+    log.endLine(Level::VERBOSE);
+    log.append(Message::WEATHER_STATUS, "Rain");
+    log.append(Message::WEATHER_TURNS_LEFT, 3);
+    log.append(Message::RAIN_EFFECTS);
+    log.endLine(Level::VERBOSE);
+    EXPECT_EQ(out.str(),
+              "Hit 2: It dealt 17 damage! A critical hit! It's super effective!\n"
+              "Weather: Rain (3 turns left) [Water +50%, Fire -50%]\n");
+}
+
+TEST(BattleLogTest, BannersKeepTheirLayout) {
+    std::stringbuf buffer;
+    std::ostream stream(&buffer);
+    BattleLog::Logger log(Level::VERBOSE, stream);
+    log.log(Message::BATTLE_START);
+    log.log(Message::TURN_SEPARATOR);
+    log.flush();
+    const std::string text = buffer.str();
+    EXPECT_EQ(text.find("\n===="), 0u);
+    EXPECT_NE(text.find(" BATTLE START "), std::string::npos);
+    EXPECT_EQ(text.substr(text.size() - 3), "=\n\n");   // Separator is followed by a blank line
+}
+
+TEST(BattleLogTest, NullLoggerIsDisabledAtCompileTime) {
+    BattleLog::NullLogger log(Level::DEBUG);
+    static_assert(!BattleLog::NullSink::kEnabled, "Null sink must compile away");
+    static_assert(std::is_empty<BattleLog::NullSink>::value, "Null sink holds no state");
+    EXPECT_FALSE(log.enabled(Level::SUMMARY));
+    log.log(Message::USED_MOVE, "Mew", "psychic");
+    log.flush();
+}
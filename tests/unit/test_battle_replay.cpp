@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include "test_utils.h"
+#include "core/battle_replay.h"
+
+namespace fs = std::filesystem;
+
+class BattleReplayTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        team_a = makeTeam(3, "fire");
+        team_b = makeTeam(2, "water");
+        options.seed = 43;
+    }
+
+    static Team makeTeam(int strength, const std::string& type) {
+        std::vector<Pokemon> members;
+        for (int i = 0; i < 3; ++i) {
+            Pokemon pokemon = TestUtils::createTestPokemon(
+                type + std::to_string(i), 90 + strength * 10, 60 + strength * 5, 60, 60, 60, 40 + i * 20,
+                {type}, {});
+            for (const auto& [name, power] : {std::make_pair("strike", 50), std::make_pair("blast", 70)}) {
+                Move move = TestUtils::createTestMove(name, power + strength * 5, 90, 20, type, "special");
+                move.multi_turn_behavior = MultiTurnBehavior::NONE;
+                move.is_weather_dependent = false;
+                move.boosts_defense_on_charge = false;
+                pokemon.moves.push_back(move);
+            }
+            members.push_back(pokemon);
+        }
+        return TestUtils::createTestTeam(members);
+    }
+
+    Team team_a;
+    Team team_b;
+    BattleSimulator::Options options;
+};
+
+TEST_F(BattleReplayTest, RecordsAndRoundTripsThroughFile) {
+    BattleSimulator::Result result;
+    const BattleReplay replay = ReplayRecorder::record(team_a, team_b, options, true, &result);
+    EXPECT_EQ(replay.turns, result.turns);
+    EXPECT_EQ(replay.outcome, result.outcome);
+    ASSERT_GE(replay.actions.size(), static_cast<size_t>(result.turns));
+    EXPECT_FALSE(replay.events.empty());
+    ASSERT_EQ(replay.team_a.size(), 3u);
+    EXPECT_EQ(replay.team_a[0].moves.size(), 2u);
+
+    const std::string path = (fs::temp_directory_path() / "battle_replay_test.pbrp").string();
+    ASSERT_TRUE(replay.save(path));
+    BattleReplay loaded;
+    ASSERT_TRUE(BattleReplay::load(path, loaded));
+    fs::remove(path);
+    EXPECT_EQ(loaded.seed, replay.seed);
+    EXPECT_EQ(loaded.data_checksum, replay.data_checksum);
+    EXPECT_EQ(loaded.final_state_hash, replay.final_state_hash);
+    ASSERT_EQ(loaded.actions.size(), replay.actions.size());
+    for (size_t i = 0; i < loaded.actions.size(); ++i) {
+        EXPECT_EQ(loaded.actions[i].turn, replay.actions[i].turn);
+        EXPECT_EQ(loaded.actions[i].kind, replay.actions[i].kind);
+        EXPECT_EQ(loaded.actions[i].index, replay.actions[i].index);
+    }
+    ASSERT_EQ(loaded.events.size(), replay.events.size());
+    EXPECT_EQ(loaded.events.back().type, BattleEvents::EventType::BATTLE_END);
+
+    // Corruption is detected by the checksum
+    auto bytes = replay.encode();
+    bytes[bytes.size() / 2] ^= 0x40;
+    EXPECT_FALSE(BattleReplay::decode(bytes, loaded));
+}
+
+TEST_F(BattleReplayTest, PlaybackReproducesBattleAndSeeksByKeyframe) {
+    const BattleReplay replay = ReplayRecorder::record(team_a, team_b, options);
+    ASSERT_GT(replay.turns, 2);
+
+    BattleReplayer replayer(replay, team_a, team_b);
+    ASSERT_TRUE(replayer.isValid());
+    const auto result = replayer.run();
+    EXPECT_EQ(result.turns, replay.turns);
+    EXPECT_EQ(result.outcome, replay.outcome);
+    EXPECT_EQ(BattleReplay::stateHash(replayer.getTeamA(), replayer.getTeamB()), replay.final_state_hash);
+
+    // Seeking lands on the same state as playing straight to that turn
+    for (int turn : {replay.turns, 1, replay.turns / 2, 0}) {
+        ASSERT_TRUE(replayer.seek(turn)) << "turn " << turn;
+        EXPECT_EQ(replayer.getCurrentTurn(), turn);
+        const uint32_t seeked = BattleReplay::stateHash(replayer.getTeamA(), replayer.getTeamB());
+
+        Team a = team_a;
+        Team b = team_b;
+        BattleSimulator::ReplayControl control;
+        control.actions = &replay.actions;
+        control.stop_after_turn = turn;
+        BattleSimulator::replayInPlace(a, b, options, control);
+        EXPECT_EQ(seeked, BattleReplay::stateHash(a, b)) << "turn " << turn;
+    }
+    EXPECT_FALSE(replayer.seek(replay.turns + 1));
+}
+
+TEST_F(BattleReplayTest, VerifyDetectsDataChangesAndDivergence) {
+    const BattleReplay replay = ReplayRecorder::record(team_a, team_b, options);
+    BattleReplayer replayer(replay, team_a, team_b);
+    const auto verification = replayer.verify();
+    EXPECT_TRUE(verification.matches()) << verification.message;
+    EXPECT_EQ(verification.first_divergent_turn, -1);
+
+    Team changed = team_b;
+    changed.getPokemon(0)->speed += 1;
+    BattleReplayer changed_replayer(replay, team_a, changed);
+    EXPECT_FALSE(changed_replayer.isValid());
+    EXPECT_FALSE(changed_replayer.verify().data_matches);
+
+    // A tampered choice replays differently and no longer matches the AI
+    BattleReplay tampered = replay;
+    BattleSimulator::Action* move = nullptr;
+    for (auto& action : tampered.actions) {
+        if (action.kind == BattleSimulator::Action::Kind::MOVE && action.index >= 0) {
+            move = &action;
+            break;
+        }
+    }
+    ASSERT_NE(move, nullptr);
+    move->index = move->index == 0 ? 1 : 0;
+    const int tampered_turn = move->turn;
+    BattleReplayer tampered_replayer(tampered, team_a, team_b);
+    const auto tampered_check = tampered_replayer.verify();
+    EXPECT_FALSE(tampered_check.ai_matches);
+    EXPECT_EQ(tampered_check.first_divergent_turn, tampered_turn);
+}
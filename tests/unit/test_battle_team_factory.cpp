@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "core/battle_simulator.h"
+#include "core/battle_team_factory.h"
+#include "core/resettable_battle_team.h"
+
+class BattleTeamFactoryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        team = TeamBuilder::Team("Alpha");
+        team.pokemon.emplace_back("testmona", std::vector<std::string>{"testmove", "nosuchmove"});
+        team.pokemon.emplace_back("nosuchmon", std::vector<std::string>{"testmove"});
+        team.pokemon.emplace_back("testmonb", std::vector<std::string>{"testmove"});
+    }
+
+    TeamBuilder::Team team;
+};
+
+TEST_F(BattleTeamFactoryTest, ResolvesEachNameOnceAndBuildsFromCache) {
+    BattleTeamFactory factory;
+    const auto resolved = factory.resolve(team);
+    ASSERT_EQ(resolved.members.size(), 2u);
+    EXPECT_EQ(resolved.members[0].moves.size(), 1u);
+    EXPECT_EQ(factory.getSpeciesCount(), 2u);
+    EXPECT_EQ(factory.getMoveCount(), 1u);
+
+    // Repeat lookups, including failed ones, hit the cache
+    EXPECT_EQ(factory.resolveSpecies("testmona"), resolved.members[0].species);
+    EXPECT_EQ(factory.resolveSpecies("nosuchmon"), BattleTeamFactory::kUnresolved);
+    EXPECT_EQ(factory.resolveSpecies("../testmona"), BattleTeamFactory::kUnresolved);
+    EXPECT_EQ(factory.getSpeciesCount(), 2u);
+
+    const Team battle_team = factory.build(resolved);
+    ASSERT_EQ(battle_team.size(), 2u);
+    const Pokemon* first = battle_team.getPokemon(0);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first->name, "testmona");
+    ASSERT_EQ(first->moves.size(), 1u);
+    EXPECT_EQ(first->moves[0].name, "testmove");
+    EXPECT_EQ(battle_team.getPokemon(1)->name, "testmonb");
+    EXPECT_EQ(first->current_hp, factory.getSpecies(resolved.members[0].species)->hp);
+
+    factory.clear();
+    EXPECT_EQ(factory.getSpeciesCount(), 0u);
+    EXPECT_EQ(factory.getSpecies(0), nullptr);
+}
+
+TEST_F(BattleTeamFactoryTest, ResetRestoresBattleStateInPlace) {
+    ResettableBattleTeam resettable(BattleTeamFactory::shared().build(team));
+    Pokemon* pokemon = resettable.get().getPokemon(0);
+    ASSERT_NE(pokemon, nullptr);
+
+    pokemon->takeDamage(pokemon->hp);
+    pokemon->applyStatusCondition(StatusCondition::BURN);
+    pokemon->modifyAttack(2);
+    pokemon->startCharging(0, "testmove");
+    pokemon->moves[0].usePP();
+
+    resettable.reset();
+    EXPECT_EQ(resettable.get().getPokemon(0), pokemon);  // Same storage
+    EXPECT_EQ(pokemon->current_hp, pokemon->hp);
+    EXPECT_TRUE(pokemon->isAlive());
+    EXPECT_FALSE(pokemon->hasStatusCondition());
+    EXPECT_EQ(pokemon->attack_stage, 0);
+    EXPECT_FALSE(pokemon->isCharging());
+    EXPECT_EQ(pokemon->moves[0].current_pp, pokemon->moves[0].pp);
+}
+
+TEST_F(BattleTeamFactoryTest, ResetTeamsReplayLikeFreshCopies) {
+    TeamBuilder::Team rival("Beta");
+    rival.pokemon.emplace_back("testmonc", std::vector<std::string>{"testmove"});
+    const Team team_a = BattleTeamFactory::shared().build(team);
+    const Team team_b = BattleTeamFactory::shared().build(rival);
+
+    ResettableBattleTeam a(team_a);
+    ResettableBattleTeam b(team_b);
+    BattleSimulator::Options options;
+    for (uint64_t seed = 0; seed < 8; ++seed) {
+        options.seed = seed;
+        a.reset();
+        b.reset();
+        const auto in_place = BattleSimulator::simulateInPlace(a.get(), b.get(), options);
+        const auto copied = BattleSimulator::simulate(team_a, team_b, options);
+        EXPECT_EQ(in_place.outcome, copied.outcome) << "seed " << seed;
+        EXPECT_EQ(in_place.turns, copied.turns) << "seed " << seed;
+        EXPECT_DOUBLE_EQ(in_place.team_a_hp_fraction, copied.team_a_hp_fraction) << "seed " << seed;
+    }
+}
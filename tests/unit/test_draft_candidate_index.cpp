@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include "core/draft_candidate_index.h"
+#include "core/team_builder.h"
+
+namespace {
+
+std::vector<DraftCandidateIndex::Candidate> samplePool() {
+    return {
+        {"flarey", TypeMasks::fromTypes({"fire"}), false, 0.80},
+        {"soaky", TypeMasks::fromTypes({"water", "ice"}), false, 0.85},
+        {"legend", TypeMasks::fromTypes({"psychic"}), true, 1.10},
+        {"blazer", TypeMasks::fromTypes({"fire", "flying"}), false, 0.90},
+        {"myth", TypeMasks::fromTypes({"psychic", "fairy"}), true, 1.00},
+        {"plain", TypeMasks::fromTypes({"normal"}), false, 0.50},
+    };
+}
+
+} // namespace
+
+TEST(DraftCandidateIndexTest, TracksAvailabilityAndPickLimits) {
+    DraftCandidateIndex index;
+    index.build(samplePool(), 2);
+    ASSERT_TRUE(index.isBuilt());
+    EXPECT_EQ(index.availableCount(), 6u);
+    EXPECT_EQ(index.find("missing"), -1);
+
+    const int flarey = index.find("flarey");
+    const int blazer = index.find("blazer");
+    const int legend = index.find("legend");
+    const int myth = index.find("myth");
+
+    EXPECT_TRUE(index.remove(flarey));
+    EXPECT_FALSE(index.remove(flarey));
+    EXPECT_FALSE(index.isAvailable(flarey));
+    EXPECT_EQ(index.availableCount(), 5u);
+    const auto available = index.getAvailable();
+    EXPECT_EQ(std::count(available.begin(), available.end(), flarey), 0);
+
+    // One fire and one legendary per team
+    const DraftCandidateIndex::Limits limits(1, 1);
+    index.remove(legend);
+    index.addToTeam(0, legend);
+    index.addToTeam(0, flarey);
+    EXPECT_FALSE(index.canPick(0, blazer, limits));
+    EXPECT_FALSE(index.canPick(0, myth, limits));
+    EXPECT_TRUE(index.canPick(1, blazer, limits));
+    EXPECT_FALSE(index.canPick(0, myth, DraftCandidateIndex::Limits(2, 1)));  // Second psychic
+    EXPECT_TRUE(index.canPick(0, myth, DraftCandidateIndex::Limits(2, 2)));
+    EXPECT_EQ(index.getTeamTypes(0), TypeMasks::fromTypes({"fire", "psychic"}));
+
+    // Copies are independent, as draft sessions are copied around
+    DraftCandidateIndex copy = index;
+    copy.remove(myth);
+    EXPECT_TRUE(index.isAvailable(myth));
+    EXPECT_FALSE(copy.isAvailable(myth));
+}
+
+TEST(DraftCandidateIndexTest, SuggestionsMatchExhaustiveRanking) {
+    std::mt19937 rng(37);
+    std::uniform_int_distribution<int> type_dist(0, TypeMasks::kTypeCount - 1);
+    std::uniform_real_distribution<double> strength_dist(0.2, 1.2);
+
+    std::vector<DraftCandidateIndex::Candidate> pool;
+    for (int i = 0; i < 300; ++i) {
+        const TypeMask types = TypeMasks::bit(type_dist(rng)) | (i % 2 ? TypeMasks::bit(type_dist(rng)) : 0);
+        pool.emplace_back("mon" + std::to_string(i), types, i % 37 == 0, strength_dist(rng));
+    }
+
+    DraftCandidateIndex index;
+    index.build(pool, 4);
+    const DraftCandidateIndex::Limits limits(1, 2);
+    for (int pick = 0; pick < 40; ++pick) {
+        const int id = static_cast<int>(rng() % pool.size());
+        if (index.remove(id) && pick % 2 == 0) {
+            index.addToTeam(pick % 4, id);
+        }
+    }
+
+    auto bonus = [](int id) { return (id % 7) / 10.0; };
+    for (int player = 0; player < 4; ++player) {
+        const auto suggestions = index.suggest(player, 8, limits, 0.2, bonus, 0.6);
+
+        std::vector<std::pair<double, int>> expected;
+        for (int id = 0; id < static_cast<int>(pool.size()); ++id) {
+            if (index.isAvailable(id) && index.canPick(player, id, limits)) {
+                const int new_types = TypeMasks::count(pool[id].types & ~index.getTeamTypes(player));
+                expected.emplace_back(pool[id].strength + 0.2 * new_types + bonus(id), id);
+            }
+        }
+        std::sort(expected.begin(), expected.end(), std::greater<>());
+
+        ASSERT_EQ(suggestions.size(), 8u);
+        for (size_t i = 0; i < suggestions.size(); ++i) {
+            EXPECT_NEAR(suggestions[i].second, expected[i].first, 1e-12) << "player " << player << " rank " << i;
+        }
+    }
+}
+
+TEST(DraftCandidateIndexTest, DraftSessionKeepsIndexInSync) {
+    auto pokemon_data = std::make_shared<PokemonData>();
+    ASSERT_TRUE(pokemon_data->initialize().success);
+    TeamBuilder builder(pokemon_data);
+
+    TeamBuilder::DraftSettings settings;
+    settings.max_same_type_per_team = 1;
+    auto session = builder.createDraftSession(settings, {"Ash", "Gary"});
+    ASSERT_TRUE(session.is_active);
+    ASSERT_TRUE(session.candidate_index.isBuilt());
+    EXPECT_EQ(session.candidate_index.availableCount(), session.available_pokemon.size());
+
+    ASSERT_TRUE(builder.executeDraftBan(session, 0, "testmona"));
+    EXPECT_FALSE(builder.executeDraftBan(session, 0, "testmona"));
+    auto picks = builder.getAvailablePicks(session, 0);
+    EXPECT_EQ(picks, session.available_pokemon);
+    EXPECT_EQ(std::count(picks.begin(), picks.end(), "testmona"), 0);
+    EXPECT_EQ(builder.getAvailablePicks(session, 0, "offensive"), std::vector<std::string>{"testmonb"});
+
+    ASSERT_TRUE(builder.executeDraftPick(session, 0, "testmonb"));
+    EXPECT_EQ(session.candidate_index.availableCount(), 1u);
+
+    // Only testmonc is left, and it adds water to a fire team
+    auto suggestions = builder.getDraftSuggestions(session, 3);
+    ASSERT_EQ(suggestions.size(), 1u);
+    EXPECT_EQ(suggestions[0].first, "testmonc");
+    EXPECT_EQ(suggestions[0].second, "Adds water type coverage");
+}
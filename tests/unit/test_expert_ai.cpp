@@ -1,8 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include "ai_factory.h"
 #include "expert_ai.h"
 #include "test_utils.h"
+#include "trace.h"
 #include "weather.h"
 
 class ExpertAITest : public ::testing::Test {
@@ -154,6 +157,33 @@ TEST_F(ExpertAITest, MiniMaxGameTreeSearch) {
   EXPECT_TRUE(evaluation >= shallow_eval - 10.0);  // Allow for small variance
 }
 
+// Tests that searches and decisions report their statistics and trace scopes
+TEST_F(ExpertAITest, SearchStatisticsAndMethodTimings) {
+  std::vector<int> line;
+  expertAI->miniMaxSearch(battleState, 1, -1000.0, 1000.0, true, line);
+  const int shallow_nodes = expertAI->getLastSearchStatistics().nodes_evaluated;
+  expertAI->miniMaxSearch(battleState, 3, -1000.0, 1000.0, true, line);
+  const auto deep = expertAI->getLastSearchStatistics();
+
+  EXPECT_GE(shallow_nodes, 1);
+  EXPECT_GT(deep.nodes_evaluated, shallow_nodes);  // Reset per search, counted across the whole tree
+  EXPECT_GE(deep.search_time.count(), 0);
+
+  Trace::start();
+  expertAI->chooseBestMove(battleState);
+  Trace::stop();
+
+  const auto& timings = expertAI->getMethodTimings();
+  EXPECT_EQ(timings.count("miniMaxSearch"), 1u);
+  EXPECT_EQ(timings.count("chooseBestMove"), 1u);
+#if POKEMON_TRACING
+  const auto events = Trace::collect();
+  EXPECT_TRUE(std::any_of(events.begin(), events.end(), [](const Trace::Event& event) {
+    return std::string(event.name) == "ExpertAI::chooseBestMove";
+  }));
+#endif
+}
+
 // Tests position evaluation accuracy in game tree search
 TEST_F(ExpertAITest, MiniMaxPositionEvaluation) {
   // Test that position evaluation correctly assesses advantages and disadvantages
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include "utils/health_bar_renderer.h"
+
+namespace {
+
+std::string formatLine(const std::string& name, int hp, int maxHP, const std::string& status) {
+    return name + " " + std::to_string(hp) + "/" + std::to_string(maxHP) + (status.empty() ? "" : " " + status);
+}
+
+std::string drain(int fd) {
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    std::string output;
+    char buffer[4096];
+    ssize_t count;
+    while ((count = read(fd, buffer, sizeof(buffer))) > 0) {
+        output.append(buffer, static_cast<size_t>(count));
+    }
+    return output;
+}
+
+class HealthBarRendererTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(pipe(fds), 0);
+    }
+
+    void TearDown() override {
+        close(fds[0]);
+        close(fds[1]);
+    }
+
+    int fds[2];
+};
+
+} // namespace
+
+TEST_F(HealthBarRendererTest, FramesRedrawOnlyChangedRows) {
+    const std::vector<std::string> first = {"Player 50/50", "AI 40/40"};
+    const std::string layout = HealthBarRenderer::composeFrame({}, first, 24);
+    EXPECT_NE(layout.find("\033[3;24r"), std::string::npos);   // Scroll region below the bars
+    EXPECT_NE(layout.find("\033[1;1H\033[2KPlayer 50/50"), std::string::npos);
+    EXPECT_NE(layout.find("\033[2;1H\033[2KAI 40/40"), std::string::npos);
+
+    const std::vector<std::string> second = {"Player 50/50", "AI 31/40"};
+    const std::string diff = HealthBarRenderer::composeFrame(first, second, 24);
+    EXPECT_EQ(diff, "\0337\033[2;1H\033[2KAI 31/40\0338");
+
+    EXPECT_TRUE(HealthBarRenderer::composeFrame(second, second, 24).empty());
+}
+
+TEST_F(HealthBarRendererTest, PostedChangesAnimateOnTheRenderThread) {
+    HealthBarRenderer renderer(formatLine, 1, fds[1]);
+    ASSERT_TRUE(renderer.start(24));
+    renderer.post(0, "Player", 100, 100);
+    renderer.post(1, "AI", 10, 100, 100, "PSN");
+    renderer.waitIdle();
+    const size_t frames = renderer.getFramesWritten();
+    renderer.stop();
+
+    // 90 HP animates over 18 frames, plus the first frame
+    EXPECT_GE(frames, 18u);
+    const std::string output = drain(fds[0]);
+    EXPECT_NE(output.find("AI 100/100 PSN"), std::string::npos);
+    EXPECT_NE(output.find("AI 55/100 PSN"), std::string::npos);
+    EXPECT_NE(output.find("AI 10/100 PSN"), std::string::npos);
+    EXPECT_EQ(output.find("Player 100/100"), output.rfind("Player 100/100"));   // Unchanged row drawn once
+    EXPECT_NE(output.find("\0337\033[r\0338"), std::string::npos);   // Scroll region released on stop
+}
+
+TEST_F(HealthBarRendererTest, StopShowsFinalValuesAndNeedsATerminal) {
+    HealthBarRenderer renderer(formatLine, 1000, fds[1]);
+    EXPECT_FALSE(renderer.start());   // A pipe has no terminal height
+    ASSERT_TRUE(renderer.start(24));
+    renderer.post(0, "Player", 20, 100, 100);
+    renderer.stop();
+    EXPECT_FALSE(renderer.isRunning());
+    EXPECT_NE(drain(fds[0]).find("Player 20/100"), std::string::npos);
+}
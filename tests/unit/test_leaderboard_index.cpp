@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+#include "utils/leaderboard_index.h"
+
+TEST(LeaderboardIndexTest, OrdersByScoreAndBreaksTiesByName) {
+    LeaderboardIndex leaderboard;
+    leaderboard.update("Misty", 50.0);
+    leaderboard.update("Brock", 75.0);
+    leaderboard.update("Ash", 50.0);
+
+    const auto top = leaderboard.top(0);
+    ASSERT_EQ(top.size(), 3u);
+    EXPECT_EQ(top[0].first, "Brock");
+    EXPECT_EQ(top[1].first, "Ash");
+    EXPECT_EQ(top[2].first, "Misty");
+
+    EXPECT_EQ(leaderboard.top(2).size(), 2u);
+    EXPECT_EQ(leaderboard.rank("Brock"), 1u);
+    EXPECT_EQ(leaderboard.rank("Misty"), 3u);
+    EXPECT_EQ(leaderboard.rank("Gary"), 0u);
+    EXPECT_EQ(leaderboard.at(1).first, "Ash");
+    EXPECT_TRUE(leaderboard.at(3).first.empty());
+}
+
+TEST(LeaderboardIndexTest, UpdateMovesAndRemoveDropsPlayers) {
+    LeaderboardIndex leaderboard;
+    leaderboard.update("Ash", 10.0);
+    leaderboard.update("Gary", 20.0);
+    EXPECT_EQ(leaderboard.rank("Ash"), 2u);
+
+    leaderboard.update("Ash", 30.0);
+    EXPECT_EQ(leaderboard.size(), 2u);
+    EXPECT_EQ(leaderboard.rank("Ash"), 1u);
+    EXPECT_DOUBLE_EQ(leaderboard.top(1)[0].second, 30.0);
+
+    EXPECT_TRUE(leaderboard.remove("Ash"));
+    EXPECT_FALSE(leaderboard.remove("Ash"));
+    EXPECT_FALSE(leaderboard.contains("Ash"));
+    EXPECT_EQ(leaderboard.rank("Gary"), 1u);
+
+    leaderboard.clear();
+    EXPECT_TRUE(leaderboard.empty());
+    EXPECT_TRUE(leaderboard.top(5).empty());
+}
+
+TEST(LeaderboardIndexTest, LowerIsBetterOrdering) {
+    LeaderboardIndex leaderboard(LeaderboardIndex::Order::LOWER_IS_BETTER);
+    leaderboard.update("Ash", 12.0);
+    leaderboard.update("Gary", 8.0);
+    leaderboard.update("Red", 15.0);
+
+    const auto top = leaderboard.top(0);
+    EXPECT_EQ(top[0].first, "Gary");
+    EXPECT_EQ(top[2].first, "Red");
+    EXPECT_EQ(leaderboard.rank("Ash"), 2u);
+}
+
+TEST(LeaderboardIndexTest, MatchesFullSortUnderRandomUpdates) {
+    LeaderboardIndex leaderboard;
+    std::unordered_map<std::string, double> expected_scores;
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> player_dist(0, 199);
+    std::uniform_int_distribution<int> score_dist(0, 50);
+
+    for (int step = 0; step < 5000; ++step) {
+        const std::string name = "player" + std::to_string(player_dist(rng));
+        if (step % 7 == 0) {
+            leaderboard.remove(name);
+            expected_scores.erase(name);
+        } else {
+            const double score = static_cast<double>(score_dist(rng));
+            leaderboard.update(name, score);
+            expected_scores[name] = score;
+        }
+    }
+
+    std::vector<std::pair<std::string, double>> expected(expected_scores.begin(), expected_scores.end());
+    std::sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) {
+        return a.second != b.second ? a.second > b.second : a.first < b.first;
+    });
+
+    ASSERT_EQ(leaderboard.size(), expected.size());
+    EXPECT_EQ(leaderboard.top(0), expected);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(leaderboard.rank(expected[i].first), i + 1);
+    }
+}
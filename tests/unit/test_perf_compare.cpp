@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "perf_compare.h"
+
+namespace {
+
+// Google Benchmark JSON with one "iteration" entry per sample
+std::string benchmarkJson(const std::vector<std::pair<std::string, std::vector<double>>>& runs,
+                          const std::string& unit = "ns") {
+    std::string text = "{\"context\": {\"host_name\": \"test\", \"num_cpus\": 1}, \"benchmarks\": [";
+    bool first = true;
+    for (const auto& [name, samples] : runs) {
+        for (double sample : samples) {
+            text += first ? "" : ",";
+            text += "{\"name\": \"" + name + "\", \"run_name\": \"" + name +
+                    "\", \"run_type\": \"iteration\", \"real_time\": " + std::to_string(sample) +
+                    ", \"time_unit\": \"" + unit + "\"}";
+            first = false;
+        }
+    }
+    return text + "]}";
+}
+
+PerfCompare::ResultFile load(const std::string& text) {
+    std::istringstream input(text);
+    PerfCompare::ResultFile result;
+    std::string error;
+    EXPECT_TRUE(PerfCompare::loadResults(input, result, error)) << error;
+    return result;
+}
+
+} // namespace
+
+TEST(PerfCompareTest, LoadsRepetitionsAndContext) {
+    const auto result = load(benchmarkJson({{"BM_A", {1.0, 2.0, 3.0}}, {"BM_B/depth:2", {4.0}}}, "us"));
+    ASSERT_EQ(result.samples.size(), 2u);
+    EXPECT_EQ(result.samples.at("BM_A"), (std::vector<double>{1000.0, 2000.0, 3000.0}));
+    EXPECT_EQ(result.context.at("host_name"), "test");
+    EXPECT_EQ(result.context.at("num_cpus"), "1");
+
+    std::istringstream bad("{\"not\": \"benchmarks\"}");
+    PerfCompare::ResultFile ignored;
+    std::string error;
+    EXPECT_FALSE(PerfCompare::loadResults(bad, ignored, error));
+    EXPECT_FALSE(error.empty());
+}
+
+TEST(PerfCompareTest, MedianIntervalAndRankTest) {
+    EXPECT_DOUBLE_EQ(PerfCompare::median({5.0, 1.0, 3.0}), 3.0);
+    EXPECT_DOUBLE_EQ(PerfCompare::median({4.0, 1.0, 3.0, 2.0}), 2.5);
+
+    // 10 samples: the 95% interval of the median is [x(2), x(9)]
+    const std::vector<double> samples = {10, 1, 9, 2, 8, 3, 7, 4, 6, 5};
+    const auto interval = PerfCompare::medianInterval(samples);
+    EXPECT_DOUBLE_EQ(interval.first, 2.0);
+    EXPECT_DOUBLE_EQ(interval.second, 9.0);
+    EXPECT_DOUBLE_EQ(PerfCompare::medianInterval({3.0, 1.0}).first, 1.0);   // Too few: full range
+
+    const std::vector<double> fast = {100, 101, 99, 100, 102, 98, 100, 101, 99, 100};
+    const std::vector<double> slow = {120, 121, 119, 120, 122, 118, 120, 121, 119, 120};
+    EXPECT_LT(PerfCompare::mannWhitneyPValue(fast, slow), 0.001);
+    EXPECT_GT(PerfCompare::mannWhitneyPValue(fast, fast), 0.9);
+}
+
+TEST(PerfCompareTest, OnlySignificantSlowdownsBeyondTheThresholdFail) {
+    const std::vector<double> base = {100, 101, 99, 100, 102, 98, 100, 101, 99, 100};
+    const std::vector<double> slower = {120, 121, 119, 120, 122, 118, 120, 121, 119, 120};
+    const std::vector<double> noisy = {60, 200, 70, 190, 80, 180, 90, 170, 95, 175};
+    const auto baseline = load(benchmarkJson({{"BM_Damage", base}, {"BM_Minimax/depth:2", base},
+                                              {"BM_Noisy", base}, {"BM_Removed", base}}));
+    const auto current = load(benchmarkJson({{"BM_Damage", slower}, {"BM_Minimax/depth:2", slower},
+                                             {"BM_Noisy", noisy}, {"BM_Added", base}}));
+
+    std::istringstream limits("{\"default\": 0.10, \"benchmarks\": {\"BM_Minimax\": 0.25}}");
+    PerfCompare::Thresholds thresholds;
+    std::string error;
+    ASSERT_TRUE(PerfCompare::loadThresholds(limits, thresholds, error)) << error;
+
+    const auto comparisons = PerfCompare::compare(baseline, current, thresholds);
+    ASSERT_EQ(comparisons.size(), 5u);
+    using Verdict = PerfCompare::Comparison::Verdict;
+    EXPECT_EQ(comparisons[0].name, "BM_Added");
+    EXPECT_EQ(comparisons[0].verdict, Verdict::NEW);
+    EXPECT_EQ(comparisons[1].verdict, Verdict::REGRESSION);   // BM_Damage: +20% over 10%
+    EXPECT_NEAR(comparisons[1].change, 0.20, 1e-9);
+    EXPECT_EQ(comparisons[2].verdict, Verdict::UNCHANGED);    // BM_Minimax: +20% under its 25%
+    EXPECT_DOUBLE_EQ(comparisons[2].threshold, 0.25);
+    EXPECT_EQ(comparisons[4].verdict, Verdict::MISSING);      // BM_Removed
+    EXPECT_TRUE(PerfCompare::hasRegression(comparisons));
+
+    const std::string table = PerfCompare::formatTable(comparisons);
+    EXPECT_NE(table.find("BM_Damage"), std::string::npos);
+    EXPECT_NE(table.find("+20.0%"), std::string::npos);
+    EXPECT_NE(table.find("REGRESSION"), std::string::npos);
+
+    // The same medians with heavy overlap are not significant
+    const auto noisy_only = PerfCompare::compare(load(benchmarkJson({{"BM_Noisy", base}})),
+                                                 load(benchmarkJson({{"BM_Noisy", noisy}})), thresholds);
+    EXPECT_NE(noisy_only[0].verdict, Verdict::REGRESSION);
+}
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <thread>
+#include "core/progress_journal.h"
+
+namespace fs = std::filesystem;
+
+class ProgressJournalTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_dir = (fs::temp_directory_path() /
+                    ("progress_journal_test_" +
+                     std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()))).string();
+        fs::remove_all(test_dir);
+
+        // Keep tests fast and deterministic: no background thread, no fsync
+        settings.sync_on_commit = false;
+        settings.background_checkpoint = false;
+    }
+
+    void TearDown() override {
+        fs::remove_all(test_dir);
+    }
+
+    size_t countSegments() const {
+        size_t count = 0;
+        for (const auto& file : fs::directory_iterator(test_dir)) {
+            if (file.path().filename().string().find(".wal.") != std::string::npos) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    std::string test_dir;
+    ProgressJournal::Settings settings;
+};
+
+TEST_F(ProgressJournalTest, PutAppendAndErase) {
+    ProgressJournal journal(test_dir, "progress", settings);
+    ASSERT_TRUE(journal.open());
+    EXPECT_TRUE(journal.isEmpty());
+
+    journal.put(ProgressJournal::makeKey("Ash", "progress"), "{\"badges\":1}");
+    journal.appendItem(ProgressJournal::makeKey("Ash", "history"), "win");
+    journal.appendItem(ProgressJournal::makeKey("Ash", "history"), "loss");
+    journal.put(ProgressJournal::makeKey("Ashley", "progress"), "{}");
+    ASSERT_TRUE(journal.commit());
+
+    auto history = journal.get(ProgressJournal::makeKey("Ash", "history"));
+    ASSERT_TRUE(history.has_value());
+    ASSERT_EQ(history->items.size(), 2u);
+    EXPECT_EQ(history->items[1], "loss");
+
+    // Erasing one owner must not touch owners whose names share a prefix
+    journal.erasePrefix(ProgressJournal::ownerPrefix("Ash"));
+    EXPECT_FALSE(journal.get(ProgressJournal::makeKey("Ash", "progress")).has_value());
+    EXPECT_TRUE(journal.get(ProgressJournal::makeKey("Ashley", "progress")).has_value());
+
+    const auto [owner, field] = ProgressJournal::splitKey(ProgressJournal::makeKey("Misty", "runs"));
+    EXPECT_EQ(owner, "Misty");
+    EXPECT_EQ(field, "runs");
+}
+
+TEST_F(ProgressJournalTest, RecoversCommittedRecordsAfterReopen) {
+    {
+        ProgressJournal journal(test_dir, "progress", settings);
+        ASSERT_TRUE(journal.open());
+        journal.put("a", "1");
+        journal.put("a", "2");
+        journal.appendItem("b", "x");
+        ASSERT_TRUE(journal.commit());
+    }
+
+    ProgressJournal reopened(test_dir, "progress", settings);
+    ASSERT_TRUE(reopened.open());
+    EXPECT_EQ(reopened.get("a")->value, "2");
+    EXPECT_EQ(reopened.get("b")->items.size(), 1u);
+}
+
+TEST_F(ProgressJournalTest, CheckpointReplacesCoveredSegments) {
+    {
+        ProgressJournal journal(test_dir, "progress", settings);
+        ASSERT_TRUE(journal.open());
+        for (int i = 0; i < 50; ++i) {
+            journal.appendItem("history", std::to_string(i));
+            journal.commit();
+        }
+        ASSERT_TRUE(journal.checkpoint());
+        EXPECT_EQ(countSegments(), 1u);
+        EXPECT_EQ(journal.getWalBytes(), 0u);
+
+        journal.appendItem("history", "after");
+        journal.commit();
+    }
+
+    // Snapshot plus the newer segment, with nothing replayed twice
+    ProgressJournal reopened(test_dir, "progress", settings);
+    ASSERT_TRUE(reopened.open());
+    auto history = reopened.get("history");
+    ASSERT_TRUE(history.has_value());
+    ASSERT_EQ(history->items.size(), 51u);
+    EXPECT_EQ(history->items.back(), "after");
+}
+
+TEST_F(ProgressJournalTest, TornTailIsDiscarded) {
+    {
+        ProgressJournal journal(test_dir, "progress", settings);
+        ASSERT_TRUE(journal.open());
+        journal.put("kept", "yes");
+        journal.commit();
+        journal.put("torn", "yes");
+        journal.commit();
+    }
+
+    // Simulate kill -9 in the middle of the last write
+    fs::path segment;
+    for (const auto& file : fs::directory_iterator(test_dir)) {
+        if (file.path().filename().string().find(".wal.") != std::string::npos) {
+            segment = file.path();
+        }
+    }
+    ASSERT_FALSE(segment.empty());
+    fs::resize_file(segment, fs::file_size(segment) - 3);
+
+    {
+        ProgressJournal reopened(test_dir, "progress", settings);
+        ASSERT_TRUE(reopened.open());
+        EXPECT_TRUE(reopened.get("kept").has_value());
+        EXPECT_FALSE(reopened.get("torn").has_value());
+        reopened.put("later", "yes");
+        reopened.commit();
+    }
+
+    // The truncated segment is no longer the last one but still replays cleanly
+    ProgressJournal again(test_dir, "progress", settings);
+    ASSERT_TRUE(again.open());
+    EXPECT_TRUE(again.get("kept").has_value());
+    EXPECT_TRUE(again.get("later").has_value());
+}
+
+TEST_F(ProgressJournalTest, ConcurrentCommittersShareGroupCommits) {
+    settings.background_checkpoint = true;
+    settings.checkpoint_wal_bytes = 4 * 1024;
+
+    {
+        ProgressJournal journal(test_dir, "progress", settings);
+        ASSERT_TRUE(journal.open());
+
+        std::vector<std::thread> writers;
+        for (int t = 0; t < 4; ++t) {
+            writers.emplace_back([&journal, t]() {
+                for (int i = 0; i < 100; ++i) {
+                    journal.appendItem("player" + std::to_string(t), std::to_string(i));
+                    EXPECT_TRUE(journal.commit());
+                }
+            });
+        }
+        for (auto& writer : writers) {
+            writer.join();
+        }
+        EXPECT_EQ(journal.getCommittedSequence(), 400u);
+    }
+
+    ProgressJournal reopened(test_dir, "progress", settings);
+    ASSERT_TRUE(reopened.open());
+    for (int t = 0; t < 4; ++t) {
+        auto entry = reopened.get("player" + std::to_string(t));
+        ASSERT_TRUE(entry.has_value());
+        EXPECT_EQ(entry->items.size(), 100u);
+    }
+}
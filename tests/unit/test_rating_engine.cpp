@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include "core/battle_history_log.h"
+#include "core/rating_engine.h"
+
+namespace fs = std::filesystem;
+
+class RatingEngineTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_dir = (fs::temp_directory_path() /
+                    ("rating_engine_test_" +
+                     std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()))).string();
+        fs::remove_all(test_dir);
+        fs::create_directories(test_dir);
+    }
+
+    void TearDown() override {
+        fs::remove_all(test_dir);
+    }
+
+    static RatingEngine::Rating makeRating(double rating, double deviation) {
+        RatingEngine::Rating result;
+        result.rating = rating;
+        result.deviation = deviation;
+        return result;
+    }
+
+    std::string test_dir;
+};
+
+TEST_F(RatingEngineTest, MatchesGlickmanWorkedExample) {
+    RatingEngine::Settings settings;
+    settings.tau = 0.5;
+    RatingEngine engine(settings);
+
+    engine.setRating("player", makeRating(1500.0, 200.0));
+    engine.setRating("a", makeRating(1400.0, 30.0));
+    engine.setRating("b", makeRating(1550.0, 100.0));
+    engine.setRating("c", makeRating(1700.0, 300.0));
+
+    engine.addResult("player", "a", 1.0);
+    engine.addResult("player", "b", 0.0);
+    engine.addResult("player", "c", 0.0);
+    EXPECT_EQ(engine.getPendingGameCount(), 3u);
+    engine.closeRatingPeriod();
+
+    const auto rating = engine.getRating("player");
+    ASSERT_TRUE(rating.has_value());
+    EXPECT_NEAR(rating->rating, 1464.06, 0.01);
+    EXPECT_NEAR(rating->deviation, 151.52, 0.01);
+    EXPECT_NEAR(rating->volatility, 0.05999, 0.00001);
+    EXPECT_EQ(rating->games, 3u);
+    EXPECT_EQ(engine.getPeriodCount(), 1u);
+}
+
+TEST_F(RatingEngineTest, InactiveEntitiesOnlyWidenDeviation) {
+    RatingEngine engine;
+    engine.setRating("idle", makeRating(1600.0, 50.0));
+    engine.addResult("x", "y", 1.0);
+    engine.closeRatingPeriod();
+
+    const auto idle = engine.getRating("idle");
+    EXPECT_DOUBLE_EQ(idle->rating, 1600.0);
+    EXPECT_GT(idle->deviation, 50.0);
+    EXPECT_GT(engine.getRating("x")->rating, engine.getRating("y")->rating);
+}
+
+TEST_F(RatingEngineTest, BulkResultsCloseAutomaticPeriods) {
+    RatingEngine::Settings settings;
+    settings.games_per_period = 1000;
+    RatingEngine engine(settings);
+
+    const uint32_t strong = engine.getEntityId("strong");
+    const uint32_t average = engine.getEntityId("average");
+    const uint32_t weak = engine.getEntityId("weak");
+
+    std::vector<RatingEngine::GameResult> results;
+    for (int i = 0; i < 30000; ++i) {
+        results.push_back({strong, average, (i % 4 == 0) ? 0.0f : 1.0f});
+        results.push_back({average, weak, (i % 4 == 0) ? 0.0f : 1.0f});
+    }
+
+    EXPECT_EQ(engine.addResults(results), 60u);
+    EXPECT_EQ(engine.getPendingGameCount(), 0u);
+    EXPECT_GT(engine.getRating(strong).rating, engine.getRating(average).rating);
+    EXPECT_GT(engine.getRating(average).rating, engine.getRating(weak).rating);
+}
+
+TEST_F(RatingEngineTest, SaveAndLoadRoundTrip) {
+    const std::string path = test_dir + "/ratings.bin";
+    RatingEngine engine;
+    engine.addResult("Ash", "Gary", 1.0);
+    engine.closeRatingPeriod();
+    engine.addResult("Gary", "Ash", 0.5);
+    engine.setSourceWatermark(42);
+    ASSERT_TRUE(engine.save(path));
+
+    RatingEngine loaded;
+    ASSERT_TRUE(loaded.load(path));
+    EXPECT_EQ(loaded.getEntityCount(), 2u);
+    EXPECT_EQ(loaded.getPendingGameCount(), 1u);
+    EXPECT_EQ(loaded.getPeriodCount(), 1u);
+    EXPECT_EQ(loaded.getSourceWatermark(), 42u);
+    EXPECT_DOUBLE_EQ(loaded.getRating("Ash")->rating, engine.getRating("Ash")->rating);
+
+    // The queued draw survives the round trip
+    loaded.closeRatingPeriod();
+    engine.closeRatingPeriod();
+    EXPECT_DOUBLE_EQ(loaded.getRating("Gary")->rating, engine.getRating("Gary")->rating);
+
+    // Corruption is detected rather than half-loaded
+    fs::resize_file(path, fs::file_size(path) - 1);
+    EXPECT_FALSE(loaded.load(path));
+    EXPECT_EQ(loaded.getEntityCount(), 2u);
+}
+
+TEST_F(RatingEngineTest, IngestsBattleHistoryAfterWatermark) {
+    BattleHistoryLog log(test_dir + "/history.log", test_dir + "/history.snapshot");
+    ASSERT_TRUE(log.open());
+
+    BattleHistoryLog::BattleRecord record;
+    record.team_name = "Kanto";
+    record.difficulty_level = "hard";
+    record.victory = true;
+    log.append(record);
+    record.opponent_team = "Johto";
+    log.append(record);
+
+    RatingEngine engine;
+    engine.ingestBattleHistory(log, 1);
+    EXPECT_EQ(engine.getPendingGameCount(), 1u);
+    EXPECT_FALSE(engine.findEntityId("hard").has_value());
+
+    engine.clear();
+    engine.ingestBattleHistory(log);
+    EXPECT_EQ(engine.getPendingGameCount(), 2u);
+    EXPECT_TRUE(engine.findEntityId("hard").has_value());
+    EXPECT_TRUE(engine.findEntityId("Johto").has_value());
+}
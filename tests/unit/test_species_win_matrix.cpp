@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include "test_utils.h"
+#include "core/species_win_matrix.h"
+#include "core/team_builder.h"
+
+namespace fs = std::filesystem;
+
+class SpeciesWinMatrixTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_dir = (fs::temp_directory_path() /
+                    ("species_win_matrix_test_" +
+                     std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()))).string();
+        fs::remove_all(test_dir);
+        fs::create_directories(test_dir);
+    }
+
+    void TearDown() override {
+        fs::remove_all(test_dir);
+    }
+
+    static Pokemon makeSpecies(const std::string& name, int strength) {
+        Pokemon pokemon = TestUtils::createTestPokemon(name, 60 + strength * 20, 50 + strength * 20,
+                                                       60 + strength * 10, 60, 60, 50 + strength * 10,
+                                                       {"normal"}, {});
+        Move move = TestUtils::createTestMove("tackle", 40 + strength * 15, 100, 35, "normal", "physical");
+        move.multi_turn_behavior = MultiTurnBehavior::NONE;
+        move.is_weather_dependent = false;
+        move.boosts_defense_on_charge = false;
+        pokemon.moves.push_back(move);
+        return pokemon;
+    }
+
+    static SpeciesWinMatrix buildMatrix(unsigned threads = 2) {
+        SpeciesWinMatrix::Settings settings;
+        settings.games_per_duel = 8;
+        settings.worker_threads = threads;
+        settings.seed = 3;
+        SpeciesWinMatrix matrix;
+        EXPECT_TRUE(matrix.build({makeSpecies("weakling", 0), makeSpecies("average", 2),
+                                  makeSpecies("champion", 5), makeSpecies("middling", 1)}, settings));
+        return matrix;
+    }
+
+    std::string test_dir;
+};
+
+TEST_F(SpeciesWinMatrixTest, StrongerSpeciesWinsAndPairsAreComplementary) {
+    const auto matrix = buildMatrix();
+    ASSERT_EQ(matrix.size(), 4u);
+
+    EXPECT_GT(*matrix.getWinProbability("champion", "weakling"), 0.9);
+    EXPECT_LT(*matrix.getWinProbability("weakling", "champion"), 0.1);
+    EXPECT_DOUBLE_EQ(*matrix.getWinProbability("average", "average"), 128 / 255.0);
+    EXPECT_FALSE(matrix.getWinProbability("missingno", "average").has_value());
+
+    for (size_t a = 0; a < matrix.size(); ++a) {
+        for (size_t b = 0; b < matrix.size(); ++b) {
+            if (a != b) {
+                EXPECT_NEAR(matrix.getWinProbability(a, b) + matrix.getWinProbability(b, a), 1.0, 1.0 / 255.0);
+            }
+        }
+    }
+}
+
+TEST_F(SpeciesWinMatrixTest, BuildIsDeterministicAcrossThreadCounts) {
+    const auto parallel = buildMatrix(3);
+    const auto serial = buildMatrix(1);
+    for (size_t a = 0; a < parallel.size(); ++a) {
+        for (size_t b = 0; b < parallel.size(); ++b) {
+            EXPECT_DOUBLE_EQ(parallel.getWinProbability(a, b), serial.getWinProbability(a, b));
+        }
+    }
+}
+
+TEST_F(SpeciesWinMatrixTest, SelectCountersCoversTargets) {
+    const auto matrix = buildMatrix();
+
+    const auto picks = matrix.selectCounters({"average"}, 2, 1.0);
+    ASSERT_EQ(picks.size(), 2u);
+    EXPECT_EQ(picks[0], "champion");
+
+    const auto filtered = matrix.selectCounters({"average"}, 4, 1.0,
+                                                [](const std::string& name) { return name != "champion"; });
+    EXPECT_EQ(filtered.size(), 3u);
+    EXPECT_EQ(std::find(filtered.begin(), filtered.end(), "champion"), filtered.end());
+
+    // No known targets falls back to overall strength
+    const auto strongest = matrix.selectCounters({"missingno"}, 1, 1.0);
+    ASSERT_EQ(strongest.size(), 1u);
+    EXPECT_EQ(strongest[0], "champion");
+}
+
+TEST_F(SpeciesWinMatrixTest, SaveAndLoadRoundTrip) {
+    const auto matrix = buildMatrix();
+    const std::string path = test_dir + "/matrix.bin";
+    ASSERT_TRUE(matrix.save(path));
+
+    SpeciesWinMatrix loaded;
+    ASSERT_TRUE(loaded.load(path));
+    EXPECT_EQ(loaded.getSpeciesNames(), matrix.getSpeciesNames());
+    EXPECT_EQ(loaded.getGamesPerDuel(), 8);
+    for (size_t a = 0; a < matrix.size(); ++a) {
+        for (size_t b = 0; b < matrix.size(); ++b) {
+            EXPECT_DOUBLE_EQ(loaded.getWinProbability(a, b), matrix.getWinProbability(a, b));
+        }
+    }
+
+    // A flipped byte fails the checksum and leaves the loaded matrix untouched
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(20);
+        file.put('\x7f');
+    }
+    EXPECT_FALSE(loaded.load(path));
+    EXPECT_EQ(loaded.size(), 4u);
+    EXPECT_FALSE(loaded.load(test_dir + "/missing.bin"));
+}
+
+TEST_F(SpeciesWinMatrixTest, TeamBuilderCounterTeamUsesMatrix) {
+    auto pokemon_data = std::make_shared<PokemonData>();
+    ASSERT_TRUE(pokemon_data->initialize().success);
+
+    SpeciesWinMatrix::Settings settings;
+    settings.games_per_duel = 4;
+    SpeciesWinMatrix matrix;
+    ASSERT_TRUE(matrix.buildFromData(*pokemon_data, settings));
+    const std::string path = test_dir + "/data_matrix.bin";
+    ASSERT_TRUE(matrix.save(path));
+
+    TeamBuilder builder(pokemon_data);
+    ASSERT_TRUE(builder.loadSpeciesWinMatrix(path));
+
+    TeamBuilder::Team target("Target");
+    target.pokemon.emplace_back("testmonb", std::vector<std::string>{"testmove"});
+    const auto counter = builder.generateCounterTeam(target, "Counter", 1.0);
+    ASSERT_EQ(counter.pokemon.size(), matrix.size());
+
+    // The first pick is the species with the best simulated record against the target
+    double best = 0.0;
+    for (const auto& species : matrix.getSpeciesNames()) {
+        best = std::max(best, *matrix.getWinProbability(species, "testmonb"));
+    }
+    EXPECT_DOUBLE_EQ(*matrix.getWinProbability(counter.pokemon[0].name, "testmonb"), best);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include "core/team_batch_scorer.h"
+#include "core/team_builder.h"
+
+class TeamBatchScorerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        pokemon_data = std::make_shared<PokemonData>();
+        ASSERT_TRUE(pokemon_data->initialize().success);
+    }
+
+    // Random packed teams over the loaded species and moves, sizes 1-6
+    std::vector<TeamBatchScorer::PackedTeam> randomTeams(const TeamBatchScorer& scorer, size_t count) const {
+        std::mt19937 rng(11);
+        std::vector<TeamBatchScorer::PackedTeam> teams(count);
+        for (auto& team : teams) {
+            const int size = 1 + static_cast<int>(rng() % 6);
+            for (int slot = 0; slot < size; ++slot) {
+                team.species[slot] = static_cast<uint16_t>(rng() % scorer.getSpeciesCount());
+                const int moves = static_cast<int>(rng() % 5);
+                for (int move = 0; move < moves; ++move) {
+                    team.moves[slot][move] = static_cast<uint16_t>(rng() % scorer.getMoveCount());
+                }
+            }
+        }
+        return teams;
+    }
+
+    TeamBuilder::Team unpack(const TeamBatchScorer& scorer, const TeamBatchScorer::PackedTeam& packed) const {
+        TeamBuilder::Team team("Unpacked");
+        for (int slot = 0; slot < TeamBatchScorer::kMaxTeamSize && packed.species[slot] != TeamBatchScorer::kEmptySlot; ++slot) {
+            std::vector<std::string> moves;
+            for (uint16_t move : packed.moves[slot]) {
+                if (move != TeamBatchScorer::kEmptySlot) {
+                    moves.push_back(scorer.getMoveName(move));
+                }
+            }
+            team.pokemon.emplace_back(scorer.getSpeciesName(packed.species[slot]), moves);
+        }
+        return team;
+    }
+
+    std::shared_ptr<PokemonData> pokemon_data;
+};
+
+TEST_F(TeamBatchScorerTest, PacksNamedTeams) {
+    TeamBatchScorer scorer(*pokemon_data);
+    ASSERT_GT(scorer.getSpeciesCount(), 0u);
+
+    TeamBuilder::Team team("Named");
+    team.pokemon.emplace_back("testmona", std::vector<std::string>{"testmove", "nosuchmove"});
+    team.pokemon.emplace_back("missingno", std::vector<std::string>{});
+
+    TeamBatchScorer::PackedTeam packed;
+    ASSERT_TRUE(scorer.pack(team, packed));
+    EXPECT_EQ(scorer.getSpeciesName(packed.species[0]), "testmona");
+    EXPECT_EQ(scorer.getMoveName(packed.moves[0][0]), "testmove");
+    EXPECT_EQ(packed.moves[0][1], TeamBatchScorer::kUnknownId);
+    EXPECT_EQ(packed.moves[0][2], TeamBatchScorer::kEmptySlot);
+    EXPECT_EQ(packed.species[1], TeamBatchScorer::kUnknownId);
+    EXPECT_EQ(packed.species[2], TeamBatchScorer::kEmptySlot);
+
+    const auto result = scorer.scoreOne(packed);
+    EXPECT_EQ(result.team_size, 2);
+    EXPECT_FALSE(result.isValid());
+    EXPECT_TRUE(result.flags & TeamBatchScorer::UNKNOWN_SPECIES);
+    EXPECT_TRUE(result.flags & TeamBatchScorer::UNKNOWN_MOVE);
+    EXPECT_TRUE(result.flags & TeamBatchScorer::SMALL_TEAM);
+
+    team.pokemon.resize(7, team.pokemon[0]);
+    EXPECT_FALSE(scorer.pack(team, packed));
+}
+
+TEST_F(TeamBatchScorerTest, MatchesTeamBuilderAnalysis) {
+    TeamBatchScorer scorer(*pokemon_data);
+    TeamBuilder builder(pokemon_data);
+    const auto teams = randomTeams(scorer, 200);
+    const auto results = scorer.score(teams);
+    ASSERT_EQ(results.size(), teams.size());
+
+    for (size_t i = 0; i < teams.size(); ++i) {
+        auto team = unpack(scorer, teams[i]);
+        const auto& result = results[i];
+        const auto analysis = builder.analyzeTeam(team);
+
+        EXPECT_EQ(result.balance_score, analysis.balance_score) << i;
+        EXPECT_FLOAT_EQ(result.average_stats[0], static_cast<float>(analysis.average_hp)) << i;
+        EXPECT_FLOAT_EQ(result.average_stats[5], static_cast<float>(analysis.average_speed)) << i;
+        EXPECT_EQ(TypeMasks::fromTypes(analysis.defensive_weaknesses), result.shared_weaknesses) << i;
+        EXPECT_EQ(TypeMasks::fromTypes(analysis.offensive_types), result.team_types) << i;
+
+        TypeMask coverage = 0;
+        for (const auto& [type, multiplier] : builder.calculateTypeCoverage(team)) {
+            coverage |= multiplier > 1.0 ? TypeMasks::bit(TypeMasks::typeIndex(type)) : 0u;
+        }
+        EXPECT_EQ(coverage, result.coverage) << i;
+
+        EXPECT_EQ(builder.validateTeam(team), result.isValid()) << i;
+    }
+}
+
+TEST_F(TeamBatchScorerTest, ParallelBatchMatchesSerialScoring) {
+    TeamBatchScorer::Settings settings;
+    settings.worker_threads = 3;
+    settings.chunk_size = 7;
+    TeamBatchScorer scorer(*pokemon_data, settings);
+    const auto teams = randomTeams(scorer, 500);
+    const auto results = scorer.score(teams);
+
+    for (size_t i = 0; i < teams.size(); ++i) {
+        const auto expected = scorer.scoreOne(teams[i]);
+        EXPECT_EQ(results[i].balance_score, expected.balance_score);
+        EXPECT_EQ(results[i].flags, expected.flags);
+        EXPECT_EQ(results[i].coverage, expected.coverage);
+        EXPECT_EQ(results[i].team_size, expected.team_size);
+    }
+    EXPECT_TRUE(scorer.score(std::vector<TeamBatchScorer::PackedTeam>()).empty());
+}
+
+TEST_F(TeamBatchScorerTest, ValidationFlagsFollowSettings) {
+    TeamBatchScorer::Settings settings;
+    settings.validation.allow_duplicate_pokemon = true;
+    settings.validation.require_type_diversity = false;
+    TeamBatchScorer lenient(*pokemon_data, settings);
+    TeamBatchScorer strict(*pokemon_data);
+
+    TeamBatchScorer::PackedTeam team;
+    const uint16_t species = strict.getSpeciesId("testmona");
+    const uint16_t move = strict.getMoveId("testmove");
+    team.species[0] = team.species[1] = species;
+    team.moves[0][0] = team.moves[1][0] = team.moves[1][1] = move;
+
+    const auto strict_result = strict.scoreOne(team);
+    EXPECT_TRUE(strict_result.flags & TeamBatchScorer::DUPLICATE_SPECIES);
+    EXPECT_TRUE(strict_result.flags & TeamBatchScorer::LOW_TYPE_DIVERSITY);
+    EXPECT_TRUE(strict_result.flags & TeamBatchScorer::DUPLICATE_MOVES);
+    EXPECT_TRUE(strict_result.flags & TeamBatchScorer::TYPE_HEAVY);
+
+    const auto lenient_result = lenient.scoreOne(team);
+    EXPECT_TRUE(lenient_result.isValid());
+    EXPECT_TRUE(lenient_result.flags & TeamBatchScorer::DUPLICATE_MOVES);
+
+    const auto empty = strict.scoreOne(TeamBatchScorer::PackedTeam());
+    EXPECT_EQ(empty.team_size, 0);
+    EXPECT_EQ(empty.balance_score, 0);
+    EXPECT_TRUE(empty.flags & TeamBatchScorer::TEAM_TOO_SMALL);
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <numeric>
+#include "core/pokemon_data.h"
+#include "core/team_builder.h"
+#include "core/team_matchup_simulator.h"
+
+class TeamMatchupSimulatorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        pokemon_data = std::make_shared<PokemonData>();
+        auto result = pokemon_data->initialize();
+        ASSERT_TRUE(result.success) << "Failed to initialize Pokemon data: " << result.error_message;
+
+        team1 = TeamBuilder::Team("Alpha");
+        team1.pokemon.emplace_back("testmona", std::vector<std::string>{"testmove"});
+        team1.pokemon.emplace_back("testmonb", std::vector<std::string>{"testmove"});
+        team2 = TeamBuilder::Team("Beta");
+        team2.pokemon.emplace_back("testmonc", std::vector<std::string>{"testmove"});
+    }
+
+    static TeamBuilder::ComparisonSettings makeSettings() {
+        TeamBuilder::ComparisonSettings settings;
+        settings.difficulties = {"easy", "medium"};
+        settings.max_battles_per_difficulty = 40;
+        settings.min_battles_per_difficulty = 8;
+        settings.target_margin = 0.0;
+        settings.worker_threads = 2;
+        settings.seed = 38;
+        return settings;
+    }
+
+    std::shared_ptr<PokemonData> pokemon_data;
+    TeamBuilder::Team team1;
+    TeamBuilder::Team team2;
+};
+
+TEST_F(TeamMatchupSimulatorTest, WilsonIntervalBracketsTheRate) {
+    double low = 0.0;
+    double high = 0.0;
+    TeamMatchupSimulator::wilsonInterval(50.0, 100, low, high);
+    EXPECT_NEAR(low, 0.404, 0.001);
+    EXPECT_NEAR(high, 0.596, 0.001);
+
+    TeamMatchupSimulator::wilsonInterval(20.0, 20, low, high);
+    EXPECT_GT(low, 0.8);
+    EXPECT_DOUBLE_EQ(high, 1.0);
+
+    TeamMatchupSimulator::wilsonInterval(0.0, 0, low, high);
+    EXPECT_DOUBLE_EQ(low, 0.0);
+    EXPECT_DOUBLE_EQ(high, 1.0);
+}
+
+TEST_F(TeamMatchupSimulatorTest, SameSeedGivesSameResultsOnAnyThreadCount) {
+    auto settings = makeSettings();
+    const auto a = TeamMatchupSimulator::run(team1, team2, settings);
+    settings.worker_threads = 1;
+    const auto b = TeamMatchupSimulator::run(team1, team2, settings);
+
+    ASSERT_TRUE(a.performed);
+    EXPECT_FALSE(a.cancelled);
+    ASSERT_EQ(a.by_difficulty.size(), 2u);
+    EXPECT_EQ(a.overall.battles, 80);
+    EXPECT_EQ(a.overall.team1_wins, b.overall.team1_wins);
+    EXPECT_EQ(a.overall.draws, b.overall.draws);
+    EXPECT_EQ(a.overall.turn_histogram, b.overall.turn_histogram);
+    EXPECT_EQ(a.overall.team1_wins + a.overall.team2_wins + a.overall.draws, a.overall.battles);
+    EXPECT_EQ(std::accumulate(a.overall.turn_histogram.begin(), a.overall.turn_histogram.end(), 0), 80);
+    EXPECT_LE(a.overall.confidence_low, a.overall.team1_win_rate);
+    EXPECT_GE(a.overall.confidence_high, a.overall.team1_win_rate);
+
+    // Every knockout is credited to a member, and MVPs only go to winners
+    ASSERT_EQ(a.team1_members.size(), 2u);
+    ASSERT_EQ(a.team2_members.size(), 1u);
+    EXPECT_EQ(a.team1_members[1].name, "testmonb");
+    int team1_mvps = 0;
+    for (size_t i = 0; i < a.team1_members.size(); ++i) {
+        EXPECT_EQ(a.team1_members[i].knockouts, b.team1_members[i].knockouts);
+        EXPECT_EQ(a.team1_members[i].mvp_awards, b.team1_members[i].mvp_awards);
+        team1_mvps += a.team1_members[i].mvp_awards;
+    }
+    EXPECT_LE(team1_mvps, a.overall.team1_wins);
+    EXPECT_LE(a.team2_members[0].faints, a.overall.battles);
+}
+
+TEST_F(TeamMatchupSimulatorTest, StopsEarlyAndCancels) {
+    auto settings = makeSettings();
+    settings.target_margin = 1.0;   // Any interval is tight enough
+    const auto early = TeamMatchupSimulator::run(team1, team2, settings);
+    ASSERT_TRUE(early.performed);
+    for (const auto& record : early.by_difficulty) {
+        EXPECT_EQ(record.battles, 8);
+    }
+
+    // Single-threaded, so no battle finishes after the callback asks to stop
+    auto single = makeSettings();
+    single.worker_threads = 1;
+    size_t last_completed = 0;
+    const auto cancelled = TeamMatchupSimulator::run(team1, team2, single,
+        [&last_completed](size_t completed, size_t /* total */) {
+            last_completed = completed;
+            return completed < 5;
+        });
+    EXPECT_TRUE(cancelled.cancelled);
+    EXPECT_EQ(cancelled.overall.battles, 5);
+    EXPECT_EQ(last_completed, 5u);
+
+    settings.difficulties = {"impossible"};
+    EXPECT_FALSE(TeamMatchupSimulator::run(team1, team2, settings).performed);
+    EXPECT_FALSE(TeamMatchupSimulator::run(team1, TeamBuilder::Team("Empty"), makeSettings()).performed);
+}
+
+TEST_F(TeamMatchupSimulatorTest, CompareTeamsReportsSimulatedWinRate) {
+    TeamBuilder builder(pokemon_data);
+    auto settings = makeSettings();
+    settings.difficulties = {"easy"};
+
+    size_t progress_calls = 0;
+    const auto comparison = builder.compareTeams(team1, team2, settings,
+        [&progress_calls](size_t completed, size_t total) {
+            ++progress_calls;
+            EXPECT_LE(completed, total);
+            return true;
+        });
+    ASSERT_TRUE(comparison.simulation.performed);
+    EXPECT_EQ(comparison.simulation.overall.battles, 40);
+    EXPECT_GT(progress_calls, 0u);
+    EXPECT_DOUBLE_EQ(comparison.team1_win_probability, comparison.simulation.overall.team1_win_rate);
+    EXPECT_NE(comparison.battle_prediction_reasoning.find("simulated"), std::string::npos);
+
+    const auto heuristic = builder.compareTeams(team1, team2);
+    EXPECT_FALSE(heuristic.simulation.performed);
+}
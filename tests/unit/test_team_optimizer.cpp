@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include "core/pokemon_data.h"
+#include "core/team_builder.h"
+#include "core/team_optimizer.h"
+
+class TeamOptimizerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        pokemon_data = std::make_shared<PokemonData>();
+        auto result = pokemon_data->initialize();
+        ASSERT_TRUE(result.success) << "Failed to initialize Pokemon data: " << result.error_message;
+    }
+
+    TeamBuilder::Team makeGauntletTeam() const {
+        TeamBuilder::Team team("Gauntlet");
+        team.pokemon.emplace_back("testmonb", std::vector<std::string>{"testmove"});
+        return team;
+    }
+
+    TeamOptimizer::Settings makeSettings() const {
+        TeamOptimizer::Settings settings;
+        settings.team_size = 2;
+        settings.population_size = 8;
+        settings.generations = 3;
+        settings.worker_threads = 2;
+        settings.seed = 99;
+        return settings;
+    }
+
+    std::shared_ptr<PokemonData> pokemon_data;
+};
+
+TEST_F(TeamOptimizerTest, SameSeedProducesSameTeam) {
+    auto settings = makeSettings();
+    TeamOptimizer first(pokemon_data, settings);
+    ASSERT_TRUE(first.addGauntletTeam(makeGauntletTeam()));
+    settings.worker_threads = 1;
+    TeamOptimizer second(pokemon_data, settings);
+    ASSERT_TRUE(second.addGauntletTeam(makeGauntletTeam()));
+
+    const auto a = first.optimize("Optimized");
+    const auto b = second.optimize("Optimized");
+    ASSERT_EQ(a.team.pokemon.size(), 2u);
+    ASSERT_EQ(b.team.pokemon.size(), 2u);
+    for (size_t i = 0; i < a.team.pokemon.size(); ++i) {
+        EXPECT_EQ(a.team.pokemon[i].name, b.team.pokemon[i].name);
+        EXPECT_EQ(a.team.pokemon[i].moves, b.team.pokemon[i].moves);
+    }
+    EXPECT_NE(a.team.pokemon[0].name, a.team.pokemon[1].name);
+    EXPECT_DOUBLE_EQ(a.fitness, b.fitness);
+    EXPECT_EQ(a.games_played, b.games_played);
+    EXPECT_EQ(a.generations_completed, 3);
+    EXPECT_EQ(a.team.name, "Optimized");
+}
+
+TEST_F(TeamOptimizerTest, SuccessiveHalvingNarrowsEachGeneration) {
+    auto settings = makeSettings();
+    settings.generations = 1;
+    settings.evaluation_budget = 0;
+    TeamOptimizer optimizer(pokemon_data, settings);
+    ASSERT_TRUE(optimizer.addGauntletTeam(makeGauntletTeam()));
+
+    const auto result = optimizer.optimize("Optimized");
+    // Rungs of 8, 4, 2 and 1 candidates playing 1, 2, 4 and 8 games each
+    EXPECT_EQ(result.games_played, 32u);
+    EXPECT_EQ(result.fitness_games, 15);
+    EXPECT_GE(result.fitness, 0.0);
+    EXPECT_LE(result.fitness, 1.0);
+}
+
+TEST_F(TeamOptimizerTest, StopsWithinEvaluationBudget) {
+    auto settings = makeSettings();
+    settings.generations = 50;
+    settings.evaluation_budget = 70;
+    TeamOptimizer optimizer(pokemon_data, settings);
+    ASSERT_TRUE(optimizer.addGauntletTeam(makeGauntletTeam()));
+
+    const auto result = optimizer.optimize("Optimized");
+    EXPECT_LE(result.games_played, 70u);
+    EXPECT_EQ(result.generations_completed, 2);
+    EXPECT_FALSE(result.team.pokemon.empty());
+}
+
+TEST_F(TeamOptimizerTest, RequiresGauntlet) {
+    TeamOptimizer optimizer(pokemon_data, makeSettings());
+    TeamBuilder::Team unknown("Unknown");
+    unknown.pokemon.emplace_back("missingno", std::vector<std::string>{"testmove"});
+    EXPECT_FALSE(optimizer.addGauntletTeam(unknown));
+
+    const auto result = optimizer.optimize("Optimized");
+    EXPECT_TRUE(result.team.pokemon.empty());
+    EXPECT_EQ(result.games_played, 0u);
+}
+
+TEST_F(TeamOptimizerTest, TeamBuilderSimulationModeUsesGauntlet) {
+    TeamBuilder builder(pokemon_data);
+    TeamBuilder::RandomGenerationSettings settings;
+    settings.team_size = 2;
+    settings.simulate_battles = true;
+    settings.evaluation_budget = 200;
+    settings.seed = 5;
+    settings.gauntlet.push_back(makeGauntletTeam());
+
+    const auto first = builder.generateMetaOptimizedTeam(settings);
+    const auto second = builder.generateMetaOptimizedTeam(settings);
+    ASSERT_EQ(first.pokemon.size(), 2u);
+    ASSERT_EQ(second.pokemon.size(), 2u);
+    EXPECT_EQ(first.pokemon[0].name, second.pokemon[0].name);
+    EXPECT_EQ(first.pokemon[1].name, second.pokemon[1].name);
+}
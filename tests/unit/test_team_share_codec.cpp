@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include "core/team_share_codec.h"
+#include "core/team_builder.h"
+#include "utils/base64.h"
+
+class TeamShareCodecTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        pokemon_data = std::make_shared<PokemonData>();
+        ASSERT_TRUE(pokemon_data->initialize().success);
+    }
+
+    static TeamBuilder::TeamShareCode sampleCode() {
+        TeamBuilder::TeamShareCode share_code;
+        share_code.team_name = "Codec Team";
+        share_code.creator_name = "Tester";
+        share_code.description = "Three test Pokemon";
+        share_code.creation_date = "2024-01-02 03:04:05";
+        share_code.pokemon = {
+            {"testmona", {"testmove"}},
+            {"testmonb", {"testmove", "testmove"}},
+            {"testmonc", {}}
+        };
+        return share_code;
+    }
+
+    std::shared_ptr<PokemonData> pokemon_data;
+};
+
+TEST(Base64Test, RoundTripsAllTailLengthsInBothAlphabets) {
+    std::vector<uint8_t> bytes;
+    for (int length = 0; length < 12; ++length) {
+        std::vector<uint8_t> decoded;
+        ASSERT_TRUE(Base64::decode(Base64::encode(bytes.data(), bytes.size()), decoded));
+        EXPECT_EQ(decoded, bytes);
+        ASSERT_TRUE(Base64::decode(Base64::encodeUrl(bytes.data(), bytes.size()), decoded));
+        EXPECT_EQ(decoded, bytes);
+        bytes.push_back(static_cast<uint8_t>(length * 37 + 250));
+    }
+
+    const std::string text = "Man";
+    EXPECT_EQ(Base64::encode(reinterpret_cast<const uint8_t*>(text.data()), 2), "TWE=");
+    const uint8_t high[] = {0xFB, 0xFF};
+    EXPECT_EQ(Base64::encode(high, 2), "+/8=");
+    EXPECT_EQ(Base64::encodeUrl(high, 2), "-_8");
+
+    std::vector<uint8_t> decoded;
+    EXPECT_FALSE(Base64::decode("TW!=", decoded));
+    EXPECT_FALSE(Base64::decode("TWFuT", decoded));
+    EXPECT_FALSE(Base64::decode("TQ===", decoded));
+}
+
+TEST_F(TeamShareCodecTest, RoundTripsTeamsAndMetadata) {
+    TeamShareCodec codec(*pokemon_data);
+    const auto original = sampleCode();
+
+    std::string code;
+    ASSERT_TRUE(codec.encode(original, code));
+    EXPECT_EQ(code.find_first_of("+/="), std::string::npos);
+
+    TeamBuilder::TeamShareCode decoded;
+    ASSERT_TRUE(codec.decode(code, decoded));
+    EXPECT_EQ(decoded.team_name, original.team_name);
+    EXPECT_EQ(decoded.creator_name, original.creator_name);
+    EXPECT_EQ(decoded.description, original.description);
+    EXPECT_EQ(decoded.creation_date, original.creation_date);
+    EXPECT_EQ(decoded.format_version, "2.0");
+    ASSERT_EQ(decoded.pokemon.size(), 3u);
+    for (size_t i = 0; i < decoded.pokemon.size(); ++i) {
+        EXPECT_EQ(decoded.pokemon[i].name, original.pokemon[i].name);
+        EXPECT_EQ(decoded.pokemon[i].moves, original.pokemon[i].moves);
+    }
+}
+
+TEST_F(TeamShareCodecTest, RejectsUnencodableTeamsAndDamagedCodes) {
+    TeamShareCodec codec(*pokemon_data);
+    std::string code;
+
+    auto unknown = sampleCode();
+    unknown.pokemon[0].name = "missingno";
+    EXPECT_FALSE(codec.encode(unknown, code));
+    auto too_many_moves = sampleCode();
+    too_many_moves.pokemon[0].moves.assign(5, "testmove");
+    EXPECT_FALSE(codec.encode(too_many_moves, code));
+
+    ASSERT_TRUE(codec.encode(sampleCode(), code));
+    TeamBuilder::TeamShareCode decoded;
+    for (size_t i = 0; i < code.size(); ++i) {
+        std::string damaged = code;
+        damaged[i] = damaged[i] == 'A' ? 'B' : 'A';
+        EXPECT_FALSE(codec.decode(damaged, decoded)) << i;
+    }
+    EXPECT_FALSE(codec.decode(code.substr(0, code.size() - 2), decoded));
+    EXPECT_FALSE(codec.decode("", decoded));
+}
+
+TEST_F(TeamShareCodecTest, TeamBuilderExportsBinaryAndStillImportsLegacyJson) {
+    TeamBuilder builder(pokemon_data);
+    TeamBuilder::Team team("Share Team");
+    team.pokemon.emplace_back("testmona", std::vector<std::string>{"testmove"});
+    team.pokemon.emplace_back("testmonb", std::vector<std::string>{"testmove"});
+
+    const std::string code = builder.exportTeamShareCode(team, "Tester", "binary");
+    TeamShareCodec codec(*pokemon_data);
+    TeamBuilder::TeamShareCode decoded;
+    EXPECT_TRUE(codec.decode(code, decoded));
+
+    auto imported = builder.importTeamFromShareCode(code, false);
+    EXPECT_EQ(imported.name, "Share Team");
+    ASSERT_EQ(imported.pokemon.size(), 2u);
+    EXPECT_EQ(imported.pokemon[1].name, "testmonb");
+
+    // A code in the original JSON format
+    const std::string legacy_json =
+        R"({"creation_date":"2024-01-01 00:00:00","creator_name":"Old","description":"",)"
+        R"("format_version":"1.0","pokemon":[{"moves":["testmove"],"name":"testmonc"}],"team_name":"Legacy Team"})";
+    const std::string legacy_code = Base64::encode(reinterpret_cast<const uint8_t*>(legacy_json.data()),
+                                                   legacy_json.size());
+    EXPECT_LT(code.size() * 2, legacy_code.size());
+
+    auto legacy = builder.importTeamFromShareCode(legacy_code, false);
+    EXPECT_EQ(legacy.name, "Legacy Team");
+    ASSERT_EQ(legacy.pokemon.size(), 1u);
+    EXPECT_EQ(legacy.pokemon[0].name, "testmonc");
+
+    EXPECT_EQ(builder.importTeamFromShareCode("not a code!", false).name, "Import_Failed");
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include "utils/text_search_index.h"
+
+class TextSearchIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        index.addDocument({{"Fire Team", 3.0}, {"Burn everything with fire-type attackers", 1.0}});
+        index.addDocument({{"Water Team", 3.0}, {"Rain support and bulky water attackers", 1.0}});
+        index.addDocument({{"Balanced Starter", 3.0}, {"charizard special_attacker, blastoise tank", 1.0}});
+        index.addDocument({{"Fortress Stall", 3.0}, {"Defensive team that outlasts fire and water threats", 1.0}});
+        index.finalize();
+    }
+
+    static std::vector<size_t> documents(const std::vector<TextSearchIndex::Hit>& hits) {
+        std::vector<size_t> ids;
+        for (const auto& hit : hits) {
+            ids.push_back(hit.document);
+        }
+        return ids;
+    }
+
+    TextSearchIndex index;
+};
+
+TEST_F(TextSearchIndexTest, TokenizesIntoLowercaseWords) {
+    EXPECT_EQ(TextSearchIndex::tokenize("Dragon-Breath, special_attacker  X2!"),
+              (std::vector<std::string>{"dragon", "breath", "special", "attacker", "x2"}));
+    EXPECT_TRUE(TextSearchIndex::tokenize(" -- ").empty());
+    EXPECT_EQ(index.documentCount(), 4u);
+}
+
+TEST_F(TextSearchIndexTest, RanksByFieldWeightAndRarity) {
+    // Both fire documents match; the one named "Fire" ranks first
+    EXPECT_EQ(documents(index.search({"FIRE"})), (std::vector<size_t>{0, 3}));
+
+    // Prefixes match longer words; the rarer "attacker" outranks "attackers"
+    EXPECT_EQ(documents(index.search({"attack"})), (std::vector<size_t>{2, 0, 1}));
+    EXPECT_EQ(documents(index.search({"char"})), (std::vector<size_t>{2}));
+
+    EXPECT_TRUE(index.search({"ghost"}).empty());
+    EXPECT_TRUE(index.search({"", "!!"}).empty());
+    EXPECT_EQ(index.search({"team"}, 1).size(), 1u);
+}
+
+TEST_F(TextSearchIndexTest, PhrasesNeedEveryWordAndKeywordsAreAlternatives) {
+    EXPECT_EQ(documents(index.search({"water attackers"})), (std::vector<size_t>{1}));
+    EXPECT_EQ(documents(index.search({"fire rain"})), (std::vector<size_t>{}));
+
+    const auto either = documents(index.search({"rain", "stall"}));
+    ASSERT_EQ(either.size(), 2u);
+    EXPECT_NE(std::find(either.begin(), either.end(), 1u), either.end());
+    EXPECT_NE(std::find(either.begin(), either.end(), 3u), either.end());
+
+    // Repeating a word in a phrase still matches
+    EXPECT_EQ(documents(index.search({"fire fire"})), (std::vector<size_t>{0, 3}));
+}
+
+TEST_F(TextSearchIndexTest, ScalesToManyDocuments) {
+    TextSearchIndex large;
+    const std::vector<std::string> words = {"offense", "stall", "rain", "sun", "trick", "room", "hazard", "pivot"};
+    for (size_t i = 0; i < 20000; ++i) {
+        large.addDocument({{"template " + std::to_string(i), 3.0},
+                           {words[i % words.size()] + " " + words[(i / 8) % words.size()], 1.0}});
+    }
+    large.finalize();
+
+    EXPECT_EQ(large.search({"template 12345"}).front().document, 12345u);
+    size_t rain_and_sun = 0;
+    for (size_t i = 0; i < 20000; ++i) {
+        const auto first = i % words.size();
+        const auto second = (i / 8) % words.size();
+        rain_and_sun += (first == 2 && second == 3) || (first == 3 && second == 2);
+    }
+    EXPECT_EQ(large.search({"rain sun"}).size(), rain_and_sun);
+    EXPECT_EQ(large.search({"st"}, 10).size(), 10u);
+
+    large.clear();
+    EXPECT_EQ(large.documentCount(), 0u);
+    EXPECT_TRUE(large.search({"rain"}).empty());
+}
@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include "test_utils.h"
+#include "core/battle_simulator.h"
+#include "core/tournament_scheduler.h"
+#include "utils/json.hpp"
+
+namespace fs = std::filesystem;
+
+class TournamentSchedulerTest : public ::testing::Test {
+protected:
+    static Move makeMove(const std::string& name, int power, const std::string& type) {
+        Move move = TestUtils::createTestMove(name, power, 100, 35, type, "physical");
+        move.multi_turn_behavior = MultiTurnBehavior::NONE;
+        move.is_weather_dependent = false;
+        move.boosts_defense_on_charge = false;
+        return move;
+    }
+
+    // Entrants get gradually stronger so results are not all coin flips
+    static Team makeTeam(int strength) {
+        std::vector<Pokemon> members;
+        for (int i = 0; i < 3; ++i) {
+            Pokemon pokemon = TestUtils::createTestPokemon(
+                "mon" + std::to_string(strength) + "_" + std::to_string(i),
+                80 + strength * 10, 60 + strength * 10, 60 + strength * 5,
+                60, 60, 50 + strength * 5, {"normal"}, {});
+            pokemon.moves.push_back(makeMove("tackle", 40 + strength * 10, "normal"));
+            members.push_back(pokemon);
+        }
+        return TestUtils::createTestTeam(members);
+    }
+
+    static TournamentScheduler makeScheduler(const TournamentScheduler::Settings& settings, int entrants) {
+        TournamentScheduler scheduler(settings);
+        for (int i = 0; i < entrants; ++i) {
+            EXPECT_TRUE(scheduler.addEntrant("team" + std::to_string(i), makeTeam(i % 5)));
+        }
+        return scheduler;
+    }
+};
+
+TEST_F(TournamentSchedulerTest, SimulatorIsDeterministicAndFavoursStrongerTeam) {
+    BattleSimulator::Options options;
+    options.seed = 42;
+    const Team weak = makeTeam(0);
+    const Team strong = makeTeam(6);
+
+    const auto first = BattleSimulator::simulate(strong, weak, options);
+    const auto second = BattleSimulator::simulate(strong, weak, options);
+    EXPECT_EQ(first.outcome, BattleSimulator::Outcome::TEAM_A_WINS);
+    EXPECT_EQ(first.turns, second.turns);
+    EXPECT_DOUBLE_EQ(first.team_a_hp_fraction, second.team_a_hp_fraction);
+    EXPECT_EQ(first.team_b_remaining, 0);
+
+    const auto reversed = BattleSimulator::simulate(weak, strong, options);
+    EXPECT_EQ(reversed.outcome, BattleSimulator::Outcome::TEAM_B_WINS);
+}
+
+TEST_F(TournamentSchedulerTest, SimulatorLogsKnockoutsAndPlaysSeries) {
+    BattleSimulator::Options options;
+    options.seed = 39;
+    const Team weak = makeTeam(1);
+    const Team strong = makeTeam(5);
+
+    EXPECT_TRUE(BattleSimulator::simulate(strong, weak, options).knockout_log.empty());
+
+    options.record_knockouts = true;
+    const auto result = BattleSimulator::simulate(strong, weak, options);
+    ASSERT_EQ(result.outcome, BattleSimulator::Outcome::TEAM_A_WINS);
+
+    // Every fainted slot is logged once, in turn order, and credited knockouts match
+    std::array<int, 6> credited{};
+    int team_b_faints = 0;
+    int last_turn = 0;
+    for (const auto& knockout : result.knockout_log) {
+        EXPECT_GE(knockout.turn, last_turn);
+        EXPECT_LE(knockout.turn, result.turns);
+        last_turn = knockout.turn;
+        const auto& fainted = knockout.team_a ? result.team_a_fainted : result.team_b_fainted;
+        EXPECT_TRUE(fainted[knockout.slot]);
+        if (!knockout.team_a) {
+            team_b_faints++;
+            if (knockout.attacker_slot >= 0) {
+                credited[knockout.attacker_slot]++;
+            }
+        }
+    }
+    EXPECT_EQ(team_b_faints, 3);
+    EXPECT_EQ(credited, result.team_a_knockouts);
+    EXPECT_DOUBLE_EQ(result.team_b_slot_hp[0], 0.0);
+
+    const auto series = BattleSimulator::simulateSeries(strong, weak, 5, options);
+    EXPECT_EQ(series.winner, BattleSimulator::Outcome::TEAM_A_WINS);
+    EXPECT_EQ(series.team_a_wins, 3);
+    EXPECT_GE(series.games_played, 3);
+    EXPECT_LE(series.games_played, 10);
+    EXPECT_EQ(series.team_a_wins + series.team_b_wins + series.draws, series.games_played);
+    EXPECT_GT(series.average_turns, 0.0);
+
+    const auto repeat = BattleSimulator::simulateSeries(strong, weak, 5, options);
+    EXPECT_EQ(repeat.games_played, series.games_played);
+    EXPECT_DOUBLE_EQ(repeat.average_turns, series.average_turns);
+}
+
+TEST_F(TournamentSchedulerTest, RoundRobinPairsEveryTeamOnce) {
+    TournamentScheduler::Settings settings;
+    settings.format = TournamentScheduler::Format::ROUND_ROBIN;
+    settings.games_per_pairing = 1;
+    settings.worker_threads = 4;
+    auto scheduler = makeScheduler(settings, 7);
+
+    ASSERT_TRUE(scheduler.run());
+    EXPECT_EQ(scheduler.getRoundCount(), 7);
+
+    std::set<std::pair<int, int>> seen;
+    std::vector<int> byes(7, 0);
+    for (const auto& pairing : scheduler.getSchedule()) {
+        if (pairing.isBye()) {
+            byes[pairing.team_a]++;
+            continue;
+        }
+        EXPECT_EQ(pairing.wins_a + pairing.wins_b + pairing.draws, 1);
+        const auto key = std::minmax(pairing.team_a, pairing.team_b);
+        EXPECT_TRUE(seen.insert(key).second) << "Rematch in round " << pairing.round;
+    }
+    EXPECT_EQ(seen.size(), 21u);  // 7 * 6 / 2
+    for (int count : byes) {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST_F(TournamentSchedulerTest, SwissAvoidsRematchesAndGivesOneByePerEntrant) {
+    TournamentScheduler::Settings settings;
+    settings.format = TournamentScheduler::Format::SWISS;
+    settings.games_per_pairing = 3;
+    settings.seed = 7;
+    auto scheduler = makeScheduler(settings, 9);
+
+    ASSERT_TRUE(scheduler.run());
+    EXPECT_EQ(scheduler.getRoundCount(), 4);
+
+    std::set<std::pair<int, int>> seen;
+    std::set<int> bye_entrants;
+    for (const auto& pairing : scheduler.getSchedule()) {
+        if (pairing.isBye()) {
+            EXPECT_TRUE(bye_entrants.insert(pairing.team_a).second);
+            continue;
+        }
+        EXPECT_TRUE(seen.insert(std::minmax(pairing.team_a, pairing.team_b)).second);
+    }
+    EXPECT_EQ(bye_entrants.size(), 4u);
+
+    const auto standings = scheduler.getStandings();
+    ASSERT_EQ(standings.size(), 9u);
+    double total_points = 0.0;
+    for (size_t i = 0; i < standings.size(); ++i) {
+        EXPECT_EQ(standings[i].rank, static_cast<int>(i + 1));
+        if (i > 0) {
+            EXPECT_GE(standings[i - 1].match_points, standings[i].match_points);
+        }
+        total_points += standings[i].match_points;
+    }
+    EXPECT_DOUBLE_EQ(total_points, 4 * 4 + 4);  // Four matches and one bye per round
+}
+
+TEST_F(TournamentSchedulerTest, ResultsAreReproducibleBySeedAndReplayable) {
+    TournamentScheduler::Settings settings;
+    settings.seed = 1234;
+    settings.worker_threads = 3;
+    auto first = makeScheduler(settings, 8);
+    settings.worker_threads = 1;
+    auto second = makeScheduler(settings, 8);
+    ASSERT_TRUE(first.run());
+    ASSERT_TRUE(second.run());
+
+    const auto& a = first.getSchedule();
+    const auto& b = second.getSchedule();
+    ASSERT_EQ(a.size(), b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        EXPECT_EQ(a[i].team_a, b[i].team_a);
+        EXPECT_EQ(a[i].team_b, b[i].team_b);
+        EXPECT_EQ(a[i].seed, b[i].seed);
+        EXPECT_EQ(a[i].wins_a, b[i].wins_a);
+        EXPECT_EQ(a[i].wins_b, b[i].wins_b);
+
+        const auto replayed = first.replayPairing(a[i]);
+        EXPECT_EQ(replayed.wins_a, a[i].wins_a);
+        EXPECT_EQ(replayed.wins_b, a[i].wins_b);
+        EXPECT_EQ(replayed.draws, a[i].draws);
+    }
+}
+
+TEST_F(TournamentSchedulerTest, RejectsDuplicatesAndSavesSchedule) {
+    TournamentScheduler scheduler;
+    EXPECT_TRUE(scheduler.addEntrant("alpha", makeTeam(1)));
+    EXPECT_FALSE(scheduler.addEntrant("alpha", makeTeam(2)));
+    EXPECT_FALSE(scheduler.addEntrant("empty", Team()));
+    EXPECT_FALSE(scheduler.run());
+
+    EXPECT_TRUE(scheduler.addEntrant("beta", makeTeam(2)));
+    ASSERT_TRUE(scheduler.run());
+
+    const std::string path = (fs::temp_directory_path() / "tournament_scheduler_test" / "schedule.json").string();
+    ASSERT_TRUE(scheduler.saveSchedule(path));
+
+    std::ifstream file(path);
+    const auto data = nlohmann::json::parse(file);
+    EXPECT_EQ(data["entrants"].size(), 2u);
+    EXPECT_EQ(data["pairings"].size(), 1u);
+    EXPECT_EQ(data["standings"][0]["rank"], 1);
+    fs::remove_all(fs::path(path).parent_path());
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "json.hpp"
+#include "trace.h"
+
+namespace {
+
+std::vector<Trace::Event> eventsNamed(const std::string& name) {
+    std::vector<Trace::Event> matches;
+    for (const auto& event : Trace::collect()) {
+        if (name == event.name) {
+            matches.push_back(event);
+        }
+    }
+    return matches;
+}
+
+} // namespace
+
+TEST(TraceTest, ScopesRecordOnlyWhileRecording) {
+    Trace::stop();
+    Trace::clear();
+    { Trace::Scope ignored("test", "before"); }
+    EXPECT_TRUE(Trace::collect().empty());
+
+    Trace::start();
+    {
+        Trace::Scope outer("test", "outer");
+        Trace::Scope inner("test", "inner");
+    }
+    Trace::stop();
+    { Trace::Scope ignored("test", "after"); }
+
+    const auto events = Trace::collect();
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_STREQ(events[0].name, "outer");   // Ordered by start time
+    EXPECT_STREQ(events[1].name, "inner");
+    EXPECT_STREQ(events[1].category, "test");
+    EXPECT_LE(events[0].start_ns, events[1].start_ns);
+    EXPECT_GE(events[0].start_ns + events[0].duration_ns, events[1].start_ns + events[1].duration_ns);
+}
+
+TEST(TraceTest, ThreadsHaveTheirOwnRingBuffers) {
+    Trace::start();
+    for (size_t i = 0; i < Trace::kEventsPerThread + 10; ++i) {
+        Trace::record("test", "main", Trace::now(), 1);
+    }
+    std::thread worker([] { Trace::Scope scope("test", "worker"); });
+    worker.join();
+    Trace::stop();
+
+    const auto main_events = eventsNamed("main");
+    const auto worker_events = eventsNamed("worker");
+    EXPECT_EQ(main_events.size(), Trace::kEventsPerThread);   // Oldest overwritten
+    EXPECT_EQ(Trace::getDroppedCount(), 10u);
+    ASSERT_EQ(worker_events.size(), 1u);
+    EXPECT_NE(worker_events[0].thread_id, main_events[0].thread_id);
+}
+
+TEST(TraceTest, WritesChromeTraceEventJson) {
+    Trace::start();
+    { Trace::Scope scope("battle", "quoted \"name\""); }
+#if POKEMON_TRACING
+    { TRACE_SCOPE("battle", "macro"); }
+#endif
+    Trace::stop();
+
+    std::ostringstream out;
+    Trace::writeChromeTrace(out);
+    const auto document = nlohmann::json::parse(out.str());
+    const auto& events = document.at("traceEvents");
+    ASSERT_TRUE(events.is_array());
+
+    std::vector<std::string> names;
+    for (const auto& event : events) {
+        if (event.at("ph") == "X") {
+            names.push_back(event.at("name").get<std::string>());
+            EXPECT_EQ(event.at("cat"), "battle");
+            EXPECT_TRUE(event.at("ts").is_number());
+            EXPECT_TRUE(event.at("dur").is_number());
+            EXPECT_TRUE(event.contains("pid") && event.contains("tid"));
+        }
+    }
+    EXPECT_NE(std::find(names.begin(), names.end(), "quoted \"name\""), names.end());
+#if POKEMON_TRACING
+    EXPECT_NE(std::find(names.begin(), names.end(), "macro"), names.end());
+#endif
+}
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include "utils/type_mask.h"
+#include "core/team_builder.h"
+
+TEST(TypeMaskTest, ConvertsBetweenNamesAndBits) {
+    EXPECT_EQ(TypeMasks::typeIndex("normal"), 0);
+    EXPECT_EQ(TypeMasks::typeIndex("fairy"), TypeMasks::kTypeCount - 1);
+    EXPECT_EQ(TypeMasks::typeIndex("shadow"), -1);
+
+    const TypeMask mask = TypeMasks::fromTypes({"water", "fire", "shadow", "fire"});
+    EXPECT_EQ(TypeMasks::count(mask), 2);
+    EXPECT_EQ(TypeMasks::toTypes(mask), (std::vector<std::string>{"fire", "water"}));
+    EXPECT_EQ(TypeMasks::count(TypeMasks::kAllTypes), 18);
+    EXPECT_EQ(TypeMasks::bit(-1), 0u);
+}
+
+TEST(TypeMaskTest, SuperEffectiveTargetsFollowTheChart) {
+    const TypeMask water_hits = TypeMasks::superEffectiveAgainst(TypeMasks::typeIndex("water"));
+    EXPECT_EQ(water_hits, TypeMasks::fromTypes({"fire", "ground", "rock"}));
+    EXPECT_EQ(TypeMasks::superEffectiveAgainst(TypeMasks::typeIndex("normal")), 0u);
+    EXPECT_EQ(TypeMasks::superEffectiveAgainst(-1), 0u);
+}
+
+TEST(TypeMaskTest, DualTypeDefenseProfileCombinesMultipliers) {
+    const auto profile = TypeMasks::defenseProfile(TypeMasks::fromTypes({"fire", "flying"}));
+    const TypeMask expected_weak = TypeMasks::fromTypes({"water", "electric", "rock"});
+    EXPECT_EQ(profile.weak & expected_weak, expected_weak);
+    EXPECT_NE(profile.immune & TypeMasks::fromTypes({"ground"}), 0u);
+    EXPECT_NE(profile.resist & TypeMasks::fromTypes({"grass"}), 0u);  // 0.25x
+    EXPECT_NE(profile.resist & TypeMasks::fromTypes({"bug"}), 0u);
+    EXPECT_EQ(profile.weak & profile.resist, 0u);
+    EXPECT_EQ(profile.weak & TypeMasks::fromTypes({"ice"}), 0u);     // 2x * 0.5x
+
+    const auto normal = TypeMasks::defenseProfile(TypeMasks::fromTypes({"normal"}));
+    EXPECT_EQ(normal.immune, TypeMasks::fromTypes({"ghost"}));
+    EXPECT_EQ(normal.weak, TypeMasks::fromTypes({"fighting"}));
+}
+
+TEST(TypeMaskTest, TeamAnalysisUsesMaskedMatchups) {
+    auto pokemon_data = std::make_shared<PokemonData>();
+    ASSERT_TRUE(pokemon_data->initialize().success);
+    TeamBuilder builder(pokemon_data);
+
+    TeamBuilder::Team team("Masks");
+    team.pokemon.emplace_back("testmonb", std::vector<std::string>{"testmove"});
+    team.pokemon.emplace_back("testmonc", std::vector<std::string>{"testmove"});
+
+    const auto analysis = builder.analyzeTeam(team);
+    EXPECT_EQ(analysis.offensive_types, (std::vector<std::string>{"fire", "water"}));
+    EXPECT_EQ(analysis.physical_moves, 2);
+
+    // Fire and water both resist fire, water, ice and steel; electric and grass cancel out
+    const auto& resistances = analysis.defensive_resistances;
+    for (const std::string type : {"fire", "ice", "steel"}) {
+        EXPECT_NE(std::find(resistances.begin(), resistances.end(), type), resistances.end()) << type;
+    }
+    const auto& weaknesses = analysis.defensive_weaknesses;
+    EXPECT_NE(std::find(weaknesses.begin(), weaknesses.end(), "ground"), weaknesses.end());
+    EXPECT_EQ(std::find(weaknesses.begin(), weaknesses.end(), "grass"), weaknesses.end());
+    EXPECT_GT(analysis.average_hp, 0.0);
+}